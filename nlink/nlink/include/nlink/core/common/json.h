@@ -6,7 +6,24 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <float.h>
+#include <math.h>
 #include <ctype.h>
+#include <errno.h>
+#include <unistd.h>
+
+// Vector scanning reads whole aligned blocks past the terminator, which
+// AddressSanitizer would report, so sanitized builds scan bytewise
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define NEXUS_JSON_SANITIZED 1
+#endif
+#endif
+#if defined(__SSE2__) && !defined(__SANITIZE_ADDRESS__) && !defined(NEXUS_JSON_SANITIZED)
+#define NEXUS_JSON_SSE2 1
+#include <emmintrin.h>
+#endif
 
 // JSON value types
 typedef enum {
@@ -33,10 +50,116 @@ typedef struct NexusJsonValue {
             char** keys;
             struct NexusJsonValue** values;
             size_t count;
+            struct NexusJsonObjectIndex* index;     // Key hash index, NULL until needed
         } object;
     } data;
 } NexusJsonValue;
 
+// Object key with its hash computed once, for repeated lookups
+typedef struct NexusJsonKey {
+    const char* name;
+    uint32_t hash;
+} NexusJsonKey;
+
+// Object key index
+//
+// Objects with at least NEXUS_JSON_INDEX_THRESHOLD members get an
+// open-addressing (linear probing) index over their keys. Heap objects
+// build it on their first lookup; arena objects get it while parsing, from
+// the arena. Smaller objects are scanned, which is faster at that size.
+// Building the index lazily writes to the object, so a heap object shared
+// between threads must be looked up once before it is shared.
+#define NEXUS_JSON_INDEX_THRESHOLD 16
+
+typedef struct NexusJsonIndexSlot {
+    uint32_t hash;
+    uint32_t position;      // Member position + 1; 0 marks an empty slot
+} NexusJsonIndexSlot;
+
+typedef struct NexusJsonObjectIndex {
+    size_t capacity;        // Slot count, a power of two
+    bool in_arena;          // Storage belongs to an arena, not the object
+    NexusJsonIndexSlot slots[];
+} NexusJsonObjectIndex;
+
+// Hash an object key (32-bit FNV-1a)
+uint32_t nexus_json_hash_key(const char* name) {
+    uint32_t hash = 2166136261u;
+    while (*name) {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Precompute the hash of a key
+NexusJsonKey nexus_json_key(const char* name) {
+    NexusJsonKey key = { name, nexus_json_hash_key(name) };
+    return key;
+}
+
+// Slot count keeping the load factor at or below one half
+size_t nexus_json_index_capacity(size_t count) {
+    size_t capacity = 32;
+    while (capacity < count * 2) capacity <<= 1;
+    return capacity;
+}
+
+// Bytes needed for an index with the given slot count
+size_t nexus_json_index_bytes(size_t capacity) {
+    return sizeof(NexusJsonObjectIndex) + capacity * sizeof(NexusJsonIndexSlot);
+}
+
+// Index the member at a position; a repeated key keeps its first position
+void nexus_json_index_insert(NexusJsonObjectIndex* index, char** keys, uint32_t hash, size_t position) {
+    size_t mask = index->capacity - 1;
+    size_t i = hash & mask;
+    
+    while (index->slots[i].position) {
+        if (index->slots[i].hash == hash && strcmp(keys[index->slots[i].position - 1], keys[position]) == 0) {
+            return;
+        }
+        i = (i + 1) & mask;
+    }
+    
+    index->slots[i].hash = hash;
+    index->slots[i].position = (uint32_t)position + 1;
+}
+
+// Fill an index over every member of an object
+void nexus_json_index_fill(NexusJsonObjectIndex* index, size_t capacity, const NexusJsonValue* object) {
+    index->capacity = capacity;
+    index->in_arena = false;
+    memset(index->slots, 0, capacity * sizeof(NexusJsonIndexSlot));
+    
+    for (size_t i = 0; i < object->data.object.count; i++) {
+        nexus_json_index_insert(index, object->data.object.keys,
+                                nexus_json_hash_key(object->data.object.keys[i]), i);
+    }
+}
+
+// Build the heap index of an object
+NexusJsonObjectIndex* nexus_json_index_build(NexusJsonValue* object) {
+    if (object->data.object.count >= UINT32_MAX) return NULL;
+    
+    size_t capacity = nexus_json_index_capacity(object->data.object.count);
+    NexusJsonObjectIndex* index = (NexusJsonObjectIndex*)malloc(nexus_json_index_bytes(capacity));
+    if (!index) return NULL;
+    
+    nexus_json_index_fill(index, capacity, object);
+    object->data.object.index = index;
+    return index;
+}
+
+// Drop the index of an object; it is rebuilt by the next lookup
+void nexus_json_index_free(NexusJsonValue* object) {
+    NexusJsonObjectIndex* index = object->data.object.index;
+    if (index && !index->in_arena) {
+        free(index);
+    }
+    object->data.object.index = NULL;
+}
+
 // Create a JSON null value
 NexusJsonValue* nexus_json_null() {
     NexusJsonValue* value = (NexusJsonValue*)malloc(sizeof(NexusJsonValue));
@@ -97,6 +220,7 @@ NexusJsonValue* nexus_json_object() {
     value->data.object.keys = NULL;
     value->data.object.values = NULL;
     value->data.object.count = 0;
+    value->data.object.index = NULL;
     return value;
 }
 
@@ -116,19 +240,64 @@ void nexus_json_object_add(NexusJsonValue* object, const char* key, NexusJsonVal
     
     object->data.object.keys[object->data.object.count - 1] = strdup(key);
     object->data.object.values[object->data.object.count - 1] = value;
+    
+    // Keep an existing index current until it would pass half full
+    NexusJsonObjectIndex* index = object->data.object.index;
+    if (index) {
+        if (object->data.object.count * 2 > index->capacity) {
+            nexus_json_index_free(object);
+        } else {
+            nexus_json_index_insert(index, object->data.object.keys, nexus_json_hash_key(key),
+                                    object->data.object.count - 1);
+        }
+    }
+}
+
+// Get a value from a JSON object by precomputed key
+NexusJsonValue* nexus_json_object_get_key(NexusJsonValue* object, const NexusJsonKey* key) {
+    if (object->type != NEXUS_JSON_OBJECT) return NULL;
+    
+    NexusJsonObjectIndex* index = object->data.object.index;
+    if (!index && object->data.object.count >= NEXUS_JSON_INDEX_THRESHOLD) {
+        index = nexus_json_index_build(object);
+    }
+    
+    if (!index) {
+        for (size_t i = 0; i < object->data.object.count; i++) {
+            if (strcmp(object->data.object.keys[i], key->name) == 0) {
+                return object->data.object.values[i];
+            }
+        }
+        return NULL;
+    }
+    
+    size_t mask = index->capacity - 1;
+    for (size_t i = key->hash & mask; index->slots[i].position; i = (i + 1) & mask) {
+        size_t position = index->slots[i].position - 1;
+        if (index->slots[i].hash == key->hash && strcmp(object->data.object.keys[position], key->name) == 0) {
+            return object->data.object.values[position];
+        }
+    }
+    
+    return NULL;
 }
 
 // Get a value from a JSON object by key
 NexusJsonValue* nexus_json_object_get(NexusJsonValue* object, const char* key) {
     if (object->type != NEXUS_JSON_OBJECT) return NULL;
     
-    for (size_t i = 0; i < object->data.object.count; i++) {
-        if (strcmp(object->data.object.keys[i], key) == 0) {
-            return object->data.object.values[i];
+    // Small objects are scanned without hashing the key
+    if (!object->data.object.index && object->data.object.count < NEXUS_JSON_INDEX_THRESHOLD) {
+        for (size_t i = 0; i < object->data.object.count; i++) {
+            if (strcmp(object->data.object.keys[i], key) == 0) {
+                return object->data.object.values[i];
+            }
         }
+        return NULL;
     }
     
-    return NULL;
+    NexusJsonKey hashed = nexus_json_key(key);
+    return nexus_json_object_get_key(object, &hashed);
 }
 
 // Get a string from a JSON object by key
@@ -158,6 +327,33 @@ bool nexus_json_object_get_bool(NexusJsonValue* object, const char* key, bool de
     return default_value;
 }
 
+// Get a string from a JSON object by precomputed key
+const char* nexus_json_object_get_string_key(NexusJsonValue* object, const NexusJsonKey* key, const char* default_value) {
+    NexusJsonValue* value = nexus_json_object_get_key(object, key);
+    if (value && value->type == NEXUS_JSON_STRING) {
+        return value->data.string;
+    }
+    return default_value;
+}
+
+// Get a number from a JSON object by precomputed key
+double nexus_json_object_get_number_key(NexusJsonValue* object, const NexusJsonKey* key, double default_value) {
+    NexusJsonValue* value = nexus_json_object_get_key(object, key);
+    if (value && value->type == NEXUS_JSON_NUMBER) {
+        return value->data.number;
+    }
+    return default_value;
+}
+
+// Get a boolean from a JSON object by precomputed key
+bool nexus_json_object_get_bool_key(NexusJsonValue* object, const NexusJsonKey* key, bool default_value) {
+    NexusJsonValue* value = nexus_json_object_get_key(object, key);
+    if (value && value->type == NEXUS_JSON_BOOL) {
+        return value->data.boolean;
+    }
+    return default_value;
+}
+
 // Free a JSON value and all its children
 void nexus_json_free(NexusJsonValue* value) {
     if (!value) return;
@@ -179,6 +375,7 @@ void nexus_json_free(NexusJsonValue* value) {
             }
             free(value->data.object.keys);
             free(value->data.object.values);
+            nexus_json_index_free(value);
             break;
         default:
             break;
@@ -187,33 +384,141 @@ void nexus_json_free(NexusJsonValue* value) {
     free(value);
 }
 
+// Whitespace as isspace sees it in the C locale, without the table lookup
+#define NEXUS_JSON_IS_SPACE(c) ((c) == ' ' || ((c) >= '\t' && (c) <= '\r'))
+
 // Skip whitespace in a JSON string
 const char* nexus_json_skip_whitespace(const char* s) {
-    while (isspace(*s)) s++;
+    while (NEXUS_JSON_IS_SPACE(*s)) s++;
     return s;
 }
 
+// Find the first quote, backslash or terminator at or after s
+//
+// String bodies are scanned 16 bytes at a time. Loads are 16-byte aligned
+// so a block never crosses into the next page, which makes reading past
+// the terminator safe, as in strlen.
+const char* nexus_json_find_string_special(const char* s) {
+#if defined(NEXUS_JSON_SSE2)
+    size_t offset = (uintptr_t)s & 15;
+    const __m128i* block = (const __m128i*)(s - offset);
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    unsigned int mask;
+    
+    for (;;) {
+        __m128i bytes = _mm_load_si128(block);
+        __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, quote), _mm_cmpeq_epi8(bytes, backslash)),
+                                   _mm_cmpeq_epi8(bytes, _mm_setzero_si128()));
+        mask = (unsigned int)_mm_movemask_epi8(hit) >> offset;
+        if (mask) break;
+        block++;
+        s = (const char*)block;
+        offset = 0;
+    }
+    
+    return s + __builtin_ctz(mask);
+#else
+    while (*s && *s != '"' && *s != '\\') s++;
+    return s;
+#endif
+}
+
+// Powers of ten that are exact doubles
+static const double nexus_json_pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Scan a JSON number
+//
+// A decimal whose digits fit in 53 bits and whose exponent is within the
+// exact powers of ten is one correctly rounded multiply or divide away
+// from its value. Everything else, and anything strtod would read further
+// (hex, inf, nan), goes to strtod. Returns NULL if there is no number.
+const char* nexus_json_scan_number(const char* s, double* out) {
+#if FLT_EVAL_METHOD == 0
+    const char* p = s;
+    bool negative = *p == '-';
+    if (negative) p++;
+    
+    uint64_t mantissa = 0;
+    const char* digits = p;
+    while (*p >= '0' && *p <= '9') {
+        mantissa = mantissa * 10 + (uint64_t)(*p++ - '0');
+    }
+    size_t int_digits = (size_t)(p - digits);
+    
+    size_t frac_digits = 0;
+    if (*p == '.') {
+        const char* fraction = ++p;
+        while (*p >= '0' && *p <= '9') {
+            mantissa = mantissa * 10 + (uint64_t)(*p++ - '0');
+        }
+        frac_digits = (size_t)(p - fraction);
+        if (frac_digits == 0) goto slow;
+    }
+    
+    int exponent = 0;
+    if (*p == 'e' || *p == 'E') {
+        p++;
+        bool exponent_negative = *p == '-';
+        if (*p == '+' || *p == '-') p++;
+        if (*p < '0' || *p > '9') goto slow;
+        while (*p >= '0' && *p <= '9') {
+            if (exponent < 10000) exponent = exponent * 10 + (*p - '0');
+            p++;
+        }
+        if (exponent_negative) exponent = -exponent;
+    }
+    
+    if (int_digits == 0 || int_digits + frac_digits > 19 || isalnum((unsigned char)*p) || *p == '.') goto slow;
+    if (mantissa > ((uint64_t)1 << 53)) goto slow;
+    
+    exponent -= (int)frac_digits;
+    if (exponent < -22 || exponent > 22) goto slow;
+    
+    double value = (double)mantissa;
+    value = exponent < 0 ? value / nexus_json_pow10[-exponent] : value * nexus_json_pow10[exponent];
+    *out = negative ? -value : value;
+    return p;
+    
+slow:
+#endif
+    {
+        char* end;
+        *out = strtod(s, &end);
+        return end == s ? NULL : end;
+    }
+}
+
 // Parse a JSON string value
 const char* nexus_json_parse_string(const char* s, char** out) {
     if (*s != '"') return NULL;
     s++;
     
     // Calculate string length with escape handling
-    size_t len = 0;
+    size_t escapes = 0;
     const char* start = s;
-    while (*s && *s != '"') {
-        if (*s == '\\') {
-            s++;
-            if (!*s) return NULL;
-        }
-        s++;
-        len++;
+    for (;;) {
+        s = nexus_json_find_string_special(s);
+        if (*s != '\\') break;
+        if (!s[1]) return NULL;
+        s += 2;
+        escapes++;
     }
     
     if (!*s) return NULL;
     
-    // Allocate and copy string
+    // Allocate and copy string; without escapes it is one copy
+    size_t len = (size_t)(s - start) - escapes;
     *out = (char*)malloc(len + 1);
+    if (escapes == 0) {
+        memcpy(*out, start, len);
+        (*out)[len] = '\0';
+        return s + 1;
+    }
+    
     char* dest = *out;
     s = start;
     
@@ -245,9 +550,9 @@ const char* nexus_json_parse_object(const char* s, NexusJsonValue** out);
 
 // Parse a JSON number value
 const char* nexus_json_parse_number(const char* s, NexusJsonValue** out) {
-    char* end;
-    double number = strtod(s, &end);
-    if (end == s) return NULL;
+    double number;
+    const char* end = nexus_json_scan_number(s, &number);
+    if (!end) return NULL;
     
     *out = nexus_json_number(number);
     return end;
@@ -454,250 +759,977 @@ NexusJsonValue* nexus_json_parse_file(const char* filename) {
     return result;
 }
 
-// Write a JSON value to a string with formatting
-void nexus_json_write_to_string(const NexusJsonValue* value, char** out, size_t* length, size_t* capacity, int indent, int current_indent) {
-    // Ensure buffer capacity
-    if (*length + 256 > *capacity) {
-        *capacity = *capacity * 2 + 256;
-        *out = (char*)realloc(*out, *capacity);
+// Streaming output
+//
+// A NexusJsonWriter formats JSON into one fixed buffer and hands each full
+// buffer to a sink: a FILE*, a file descriptor or a growing string. Memory
+// use is bounded by the buffer whatever the size of the document, and the
+// caller may supply the buffer to reuse it across documents. Documents are
+// written either from a NexusJsonValue tree or one event at a time, with
+// no tree at all.
+
+// Deepest nesting the arena parser and the writer accept
+#define NEXUS_JSON_MAX_DEPTH 512
+
+#define NEXUS_JSON_WRITER_BUFFER 65536
+#define NEXUS_JSON_WRITER_MIN_BUFFER 64
+
+// Receives formatted output; returns false to fail the writer
+typedef bool (*NexusJsonSink)(void* context, const char* data, size_t length);
+
+typedef struct NexusJsonWriter {
+    char* buffer;
+    size_t capacity;
+    size_t length;
+    bool owns_buffer;
+    NexusJsonSink sink;
+    void* context;
+    int fd;                         // Target of nexus_json_writer_init_fd
+    int indent;                     // Spaces per level; 0 writes compact JSON
+    int depth;
+    bool after_key;                 // The next value completes a member
+    bool failed;                    // A sink write failed or nesting overflowed
+    uint64_t has_items[NEXUS_JSON_MAX_DEPTH / 64 + 1];  // Open container at each depth is not empty
+} NexusJsonWriter;
+
+// Growing string target of nexus_json_sink_string
+typedef struct NexusJsonStringSink {
+    char* data;
+    size_t length;
+    size_t capacity;
+} NexusJsonStringSink;
+
+// Sink writing to a FILE*
+bool nexus_json_sink_file(void* context, const char* data, size_t length) {
+    return fwrite(data, 1, length, (FILE*)context) == length;
+}
+
+// Sink writing to the writer's file descriptor
+bool nexus_json_sink_fd(void* context, const char* data, size_t length) {
+    const NexusJsonWriter* writer = (const NexusJsonWriter*)context;
+    while (length > 0) {
+        ssize_t written = write(writer->fd, data, length);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += written;
+        length -= (size_t)written;
+    }
+    return true;
+}
+
+// Sink appending to a NexusJsonStringSink, kept NUL-terminated
+bool nexus_json_sink_string(void* context, const char* data, size_t length) {
+    NexusJsonStringSink* string = (NexusJsonStringSink*)context;
+    if (string->length + length + 1 > string->capacity) {
+        size_t capacity = string->capacity ? string->capacity : 256;
+        while (capacity < string->length + length + 1) capacity *= 2;
+        char* grown = (char*)realloc(string->data, capacity);
+        if (!grown) return false;
+        string->data = grown;
+        string->capacity = capacity;
     }
+    memcpy(string->data + string->length, data, length);
+    string->length += length;
+    string->data[string->length] = '\0';
+    return true;
+}
+
+// Start a document
+//
+// With a NULL buffer (or one smaller than NEXUS_JSON_WRITER_MIN_BUFFER) the
+// writer allocates NEXUS_JSON_WRITER_BUFFER bytes and frees them in
+// nexus_json_writer_finish. Returns false if that allocation fails.
+bool nexus_json_writer_init(NexusJsonWriter* writer, NexusJsonSink sink, void* context,
+                            char* buffer, size_t capacity, int indent) {
+    memset(writer, 0, sizeof(NexusJsonWriter));
+    writer->sink = sink;
+    writer->context = context;
+    writer->fd = -1;
+    writer->indent = indent > 0 ? indent : 0;
     
-    char* buffer = *out + *length;
-    size_t remaining = *capacity - *length;
-    int written = 0;
+    if (!buffer || capacity < NEXUS_JSON_WRITER_MIN_BUFFER) {
+        buffer = (char*)malloc(NEXUS_JSON_WRITER_BUFFER);
+        if (!buffer) return false;
+        capacity = NEXUS_JSON_WRITER_BUFFER;
+        writer->owns_buffer = true;
+    }
     
-    // Write indentation
-    if (indent > 0 && current_indent > 0) {
-        for (int i = 0; i < current_indent; i++) {
-            buffer[written++] = ' ';
+    writer->buffer = buffer;
+    writer->capacity = capacity;
+    return true;
+}
+
+// Start a document written to a FILE*
+bool nexus_json_writer_init_file(NexusJsonWriter* writer, FILE* file, char* buffer, size_t capacity, int indent) {
+    return nexus_json_writer_init(writer, nexus_json_sink_file, file, buffer, capacity, indent);
+}
+
+// Start a document written to a file descriptor
+bool nexus_json_writer_init_fd(NexusJsonWriter* writer, int fd, char* buffer, size_t capacity, int indent) {
+    if (!nexus_json_writer_init(writer, nexus_json_sink_fd, NULL, buffer, capacity, indent)) return false;
+    writer->context = writer;
+    writer->fd = fd;
+    return true;
+}
+
+// Hand the buffered output to the sink
+bool nexus_json_writer_flush(NexusJsonWriter* writer) {
+    if (writer->length > 0 && !writer->failed) {
+        if (!writer->sink(writer->context, writer->buffer, writer->length)) {
+            writer->failed = true;
+        }
+    }
+    writer->length = 0;
+    return !writer->failed;
+}
+
+// Flush, release an owned buffer, and report whether every write succeeded
+bool nexus_json_writer_finish(NexusJsonWriter* writer) {
+    bool ok = nexus_json_writer_flush(writer) && writer->depth == 0;
+    if (writer->owns_buffer) {
+        free(writer->buffer);
+    }
+    writer->buffer = NULL;
+    writer->capacity = 0;
+    return ok;
+}
+
+// Make room for size bytes (at most NEXUS_JSON_WRITER_MIN_BUFFER) in the buffer
+char* nexus_json_writer_reserve(NexusJsonWriter* writer, size_t size) {
+    if (writer->capacity - writer->length < size) {
+        nexus_json_writer_flush(writer);
+    }
+    return writer->buffer + writer->length;
+}
+
+// Append raw bytes
+void nexus_json_writer_put(NexusJsonWriter* writer, const char* data, size_t length) {
+    if (writer->capacity - writer->length < length) {
+        nexus_json_writer_flush(writer);
+        
+        // Runs longer than the buffer go straight to the sink
+        if (length > writer->capacity) {
+            if (!writer->failed && !writer->sink(writer->context, data, length)) {
+                writer->failed = true;
+            }
+            return;
+        }
+    }
+    memcpy(writer->buffer + writer->length, data, length);
+    writer->length += length;
+}
+
+// Start a new line at the current depth
+void nexus_json_writer_newline(NexusJsonWriter* writer) {
+    static const char spaces[] = "                                ";
+    size_t remaining = (size_t)writer->depth * (size_t)writer->indent;
+    
+    nexus_json_writer_put(writer, "\n", 1);
+    while (remaining > 0) {
+        size_t chunk = remaining < sizeof(spaces) - 1 ? remaining : sizeof(spaces) - 1;
+        nexus_json_writer_put(writer, spaces, chunk);
+        remaining -= chunk;
+    }
+}
+
+// Write the separator and indentation that precede a value or member
+void nexus_json_writer_prefix(NexusJsonWriter* writer) {
+    if (writer->after_key) {
+        writer->after_key = false;
+        return;
+    }
+    if (writer->depth == 0) return;
+    
+    uint64_t bit = (uint64_t)1 << (writer->depth % 64);
+    uint64_t* items = &writer->has_items[writer->depth / 64];
+    if (*items & bit) {
+        nexus_json_writer_put(writer, ",", 1);
+    }
+    *items |= bit;
+    
+    if (writer->indent) {
+        nexus_json_writer_newline(writer);
+    }
+}
+
+// Open an array or object
+void nexus_json_writer_open(NexusJsonWriter* writer, char bracket) {
+    nexus_json_writer_prefix(writer);
+    nexus_json_writer_put(writer, &bracket, 1);
+    
+    if (writer->depth >= NEXUS_JSON_MAX_DEPTH) {
+        writer->failed = true;
+        return;
+    }
+    writer->depth++;
+    writer->has_items[writer->depth / 64] &= ~((uint64_t)1 << (writer->depth % 64));
+}
+
+// Close the innermost array or object
+void nexus_json_writer_close(NexusJsonWriter* writer, char bracket) {
+    if (writer->depth == 0) {
+        writer->failed = true;
+        return;
+    }
+    
+    bool has_items = (writer->has_items[writer->depth / 64] >> (writer->depth % 64)) & 1;
+    writer->depth--;
+    if (has_items && writer->indent) {
+        nexus_json_writer_newline(writer);
+    }
+    nexus_json_writer_put(writer, &bracket, 1);
+}
+
+void nexus_json_writer_begin_object(NexusJsonWriter* writer) { nexus_json_writer_open(writer, '{'); }
+void nexus_json_writer_end_object(NexusJsonWriter* writer) { nexus_json_writer_close(writer, '}'); }
+void nexus_json_writer_begin_array(NexusJsonWriter* writer) { nexus_json_writer_open(writer, '['); }
+void nexus_json_writer_end_array(NexusJsonWriter* writer) { nexus_json_writer_close(writer, ']'); }
+
+// Write a quoted, escaped string
+void nexus_json_writer_quote(NexusJsonWriter* writer, const char* s) {
+    static const char hex[] = "0123456789abcdef";
+    nexus_json_writer_put(writer, "\"", 1);
+    
+    // Copy runs that need no escaping in one go
+    const char* run = s;
+    for (;; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c >= 0x20 && c != '"' && c != '\\') continue;
+        
+        nexus_json_writer_put(writer, run, (size_t)(s - run));
+        if (c == '\0') break;
+        
+        char escape[6] = { '\\', 0, 0, 0, 0, 0 };
+        size_t length = 2;
+        switch (c) {
+            case '"': escape[1] = '"'; break;
+            case '\\': escape[1] = '\\'; break;
+            case '\n': escape[1] = 'n'; break;
+            case '\r': escape[1] = 'r'; break;
+            case '\t': escape[1] = 't'; break;
+            case '\b': escape[1] = 'b'; break;
+            case '\f': escape[1] = 'f'; break;
+            default:
+                escape[1] = 'u';
+                escape[2] = '0';
+                escape[3] = '0';
+                escape[4] = hex[c >> 4];
+                escape[5] = hex[c & 15];
+                length = 6;
+                break;
+        }
+        nexus_json_writer_put(writer, escape, length);
+        run = s + 1;
+    }
+    
+    nexus_json_writer_put(writer, "\"", 1);
+}
+
+// Write an object member name; the next value written is its value
+void nexus_json_writer_key(NexusJsonWriter* writer, const char* key) {
+    nexus_json_writer_prefix(writer);
+    nexus_json_writer_quote(writer, key);
+    nexus_json_writer_put(writer, writer->indent ? ": " : ":", writer->indent ? 2 : 1);
+    writer->after_key = true;
+}
+
+void nexus_json_writer_string(NexusJsonWriter* writer, const char* value) {
+    nexus_json_writer_prefix(writer);
+    nexus_json_writer_quote(writer, value);
+}
+
+void nexus_json_writer_bool(NexusJsonWriter* writer, bool value) {
+    nexus_json_writer_prefix(writer);
+    nexus_json_writer_put(writer, value ? "true" : "false", value ? 4 : 5);
+}
+
+void nexus_json_writer_null(NexusJsonWriter* writer) {
+    nexus_json_writer_prefix(writer);
+    nexus_json_writer_put(writer, "null", 4);
+}
+
+// Format the decimal digits of an unsigned integer; returns the length
+size_t nexus_json_format_digits(char* out, uint64_t value) {
+    char digits[20];
+    size_t count = 0;
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+    
+    for (size_t i = 0; i < count; i++) {
+        out[i] = digits[count - 1 - i];
+    }
+    return count;
+}
+
+// Lay out significant digits as JSON number text
+//
+// value = 0.digits x 10^point. Follows ECMAScript Number::toString: fixed
+// point while the decimal point lies within 21 digits left of the first
+// digit and 6 zeros right of it, exponent form ("1e-7", "1e+21")
+// otherwise. Returns the length.
+static size_t nexus_json_layout_number(char* out, const char* digits, size_t count, int point) {
+    char* p = out;
+    
+    if (point > 0 && point <= 21) {
+        if ((size_t)point >= count) {
+            memcpy(p, digits, count);
+            p += count;
+            memset(p, '0', (size_t)point - count);
+            p += (size_t)point - count;
+        } else {
+            memcpy(p, digits, (size_t)point);
+            p += point;
+            *p++ = '.';
+            memcpy(p, digits + point, count - (size_t)point);
+            p += count - (size_t)point;
+        }
+    } else if (point <= 0 && point > -6) {
+        *p++ = '0';
+        *p++ = '.';
+        memset(p, '0', (size_t)-point);
+        p += -point;
+        memcpy(p, digits, count);
+        p += count;
+    } else {
+        *p++ = digits[0];
+        if (count > 1) {
+            *p++ = '.';
+            memcpy(p, digits + 1, count - 1);
+            p += count - 1;
+        }
+        int exponent = point - 1;
+        *p++ = 'e';
+        *p++ = exponent < 0 ? '-' : '+';
+        p += nexus_json_format_digits(p, (uint64_t)(exponent < 0 ? -exponent : exponent));
+    }
+    
+    return (size_t)(p - out);
+}
+
+// Format a number as the shortest text that reads back as the same double
+//
+// The digits are the fewest significant digits p for which the correctly
+// rounded p-digit decimal reads back exactly. Integers below 2^53 are
+// their own digits. Other values below 2^53 try the fewest fraction
+// digits k such that m / 10^k is exactly the value; with m below 2^53 and
+// 10^k exact that quotient is correctly rounded, so it is also what any
+// correct parser reads. The remaining values (large, tiny and subnormal)
+// binary search p over %.*e, parsing each candidate back with strtod.
+// The digits are then laid out by nexus_json_layout_number. NaN and
+// infinities have no JSON form and are written as null. out needs 32
+// bytes; returns the length.
+size_t nexus_json_format_number(char* out, double value) {
+    if (value != value || value > DBL_MAX || value < -DBL_MAX) {
+        memcpy(out, "null", 4);
+        return 4;
+    }
+    
+    char* p = out;
+    double magnitude = value;
+    if (signbit(value)) {
+        *p++ = '-';
+        magnitude = -value;
+    }
+    
+    char digits[24];
+    size_t count = 0;
+    int point = 0;
+    
+    const double limit = 9007199254740992.0;    // 2^53
+    if (magnitude < limit) {
+        uint64_t whole = (uint64_t)magnitude;
+        if ((double)whole == magnitude) {
+            return (size_t)(p - out) + nexus_json_format_digits(p, whole);
+        }
+        
+        for (int k = 1; k <= 17; k++) {
+            double scaled = magnitude * nexus_json_pow10[k];
+            if (scaled >= limit) break;
+            
+            uint64_t mantissa = (uint64_t)(scaled + 0.5);
+            if ((double)mantissa / nexus_json_pow10[k] != magnitude) continue;
+            
+            count = nexus_json_format_digits(digits, mantissa);
+            point = (int)count - k;
+            break;
         }
     }
     
-    // Write value based on type
+    if (count == 0) {
+        // 17 significant digits always read back exactly
+        char text[32];
+        int low = 1, high = 17;
+        while (low < high) {
+            int precision = (low + high) / 2;
+            snprintf(text, sizeof(text), "%.*e", precision - 1, magnitude);
+            if (strtod(text, NULL) == magnitude) {
+                high = precision;
+            } else {
+                low = precision + 1;
+            }
+        }
+        snprintf(text, sizeof(text), "%.*e", low - 1, magnitude);
+        
+        const char* s = text;
+        for (; *s != 'e'; s++) {
+            if (*s != '.') digits[count++] = *s;
+        }
+        point = atoi(s + 1) + 1;
+    }
+    
+    while (count > 1 && digits[count - 1] == '0') {
+        count--;
+    }
+    
+    return (size_t)(p - out) + nexus_json_layout_number(p, digits, count, point);
+}
+
+void nexus_json_writer_number(NexusJsonWriter* writer, double value) {
+    nexus_json_writer_prefix(writer);
+    char* out = nexus_json_writer_reserve(writer, 32);
+    writer->length += nexus_json_format_number(out, value);
+}
+
+void nexus_json_writer_integer(NexusJsonWriter* writer, int64_t value) {
+    nexus_json_writer_prefix(writer);
+    char* out = nexus_json_writer_reserve(writer, 21);
+    size_t length = 0;
+    if (value < 0) {
+        out[length++] = '-';
+    }
+    uint64_t magnitude = value < 0 ? (uint64_t)0 - (uint64_t)value : (uint64_t)value;
+    writer->length += length + nexus_json_format_digits(out + length, magnitude);
+}
+
+// Write a value tree
+void nexus_json_writer_value(NexusJsonWriter* writer, const NexusJsonValue* value) {
     switch (value->type) {
         case NEXUS_JSON_NULL:
-            written += snprintf(buffer + written, remaining - written, "null");
+            nexus_json_writer_null(writer);
             break;
-            
         case NEXUS_JSON_BOOL:
-            written += snprintf(buffer + written, remaining - written, 
-                             value->data.boolean ? "true" : "false");
+            nexus_json_writer_bool(writer, value->data.boolean);
             break;
-            
         case NEXUS_JSON_NUMBER:
-            // Format number intelligently - use integer format if it's an integer
-            if (value->data.number == (int)value->data.number) {
-                written += snprintf(buffer + written, remaining - written, "%d", (int)value->data.number);
-            } else {
-                written += snprintf(buffer + written, remaining - written, "%g", value->data.number);
-            }
+            nexus_json_writer_number(writer, value->data.number);
             break;
-            
         case NEXUS_JSON_STRING:
-            written += snprintf(buffer + written, remaining - written, "\"");
-            // Escape special characters
-            for (const char* s = value->data.string; *s; s++) {
-                if (*length + written + 10 > *capacity) {
-                    *length += written;
-                    *capacity = *capacity * 2 + 256;
-                    *out = (char*)realloc(*out, *capacity);
-                    buffer = *out + *length;
-                    remaining = *capacity - *length;
-                    written = 0;
-                }
-                
-                switch (*s) {
-                    case '"': written += snprintf(buffer + written, remaining - written, "\\\""); break;
-                    case '\\': written += snprintf(buffer + written, remaining - written, "\\\\"); break;
-                    case '\n': written += snprintf(buffer + written, remaining - written, "\\n"); break;
-                    case '\r': written += snprintf(buffer + written, remaining - written, "\\r"); break;
-                    case '\t': written += snprintf(buffer + written, remaining - written, "\\t"); break;
-                    default: buffer[written++] = *s; break;
-                }
-            }
-            written += snprintf(buffer + written, remaining - written, "\"");
+            nexus_json_writer_string(writer, value->data.string);
             break;
-            
         case NEXUS_JSON_ARRAY:
-            written += snprintf(buffer + written, remaining - written, "[");
-            *length += written;
-            
-            if (value->data.array.count > 0 && indent > 0) {
-                written = 0;
-                written += snprintf(buffer + written, remaining - written, "\n");
-                *length += written;
-                
-                for (size_t i = 0; i < value->data.array.count; i++) {
-                    nexus_json_write_to_string(value->data.array.items[i], out, length, capacity, 
-                                           indent, current_indent + indent);
-                    
-                    if (i < value->data.array.count - 1) {
-                        buffer = *out + *length;
-                        remaining = *capacity - *length;
-                        written = 0;
-                        written += snprintf(buffer + written, remaining - written, ",\n");
-                        *length += written;
-                    } else {
-                        buffer = *out + *length;
-                        remaining = *capacity - *length;
-                        written = 0;
-                        written += snprintf(buffer + written, remaining - written, "\n");
-                        *length += written;
-                    }
-                }
-                
-                buffer = *out + *length;
-                remaining = *capacity - *length;
-                written = 0;
-                
-                for (int i = 0; i < current_indent; i++) {
-                    buffer[written++] = ' ';
-                }
-                
-                written += snprintf(buffer + written, remaining - written, "]");
-            } else {
-                for (size_t i = 0; i < value->data.array.count; i++) {
-                    buffer = *out + *length;
-                    remaining = *capacity - *length;
-                    written = 0;
-                    
-                    nexus_json_write_to_string(value->data.array.items[i], out, length, capacity, 0, 0);
-                    
-                    if (i < value->data.array.count - 1) {
-                        buffer = *out + *length;
-                        remaining = *capacity - *length;
-                        written = 0;
-                        written += snprintf(buffer + written, remaining - written, ",");
-                        *length += written;
-                    }
-                }
-                
-                buffer = *out + *length;
-                remaining = *capacity - *length;
-                written = 0;
-                written += snprintf(buffer + written, remaining - written, "]");
+            nexus_json_writer_begin_array(writer);
+            for (size_t i = 0; i < value->data.array.count && !writer->failed; i++) {
+                nexus_json_writer_value(writer, value->data.array.items[i]);
             }
-            
+            nexus_json_writer_end_array(writer);
             break;
-            
         case NEXUS_JSON_OBJECT:
-            written += snprintf(buffer + written, remaining - written, "{");
-            *length += written;
-            
-            if (value->data.object.count > 0 && indent > 0) {
-                written = 0;
-                written += snprintf(buffer + written, remaining - written, "\n");
-                *length += written;
-                
-                for (size_t i = 0; i < value->data.object.count; i++) {
-                    // Write key with indentation
-                    buffer = *out + *length;
-                    remaining = *capacity - *length;
-                    written = 0;
-                    
-                    for (int j = 0; j < current_indent + indent; j++) {
-                        buffer[written++] = ' ';
-                    }
-                    
-                    written += snprintf(buffer + written, remaining - written, "\"%s\": ", 
-                                     value->data.object.keys[i]);
-                    *length += written;
-                    
-                    // Write value
-                    nexus_json_write_to_string(value->data.object.values[i], out, length, capacity, 
-                                           indent, current_indent + indent);
-                    
-                    if (i < value->data.object.count - 1) {
-                        buffer = *out + *length;
-                        remaining = *capacity - *length;
-                        written = 0;
-                        written += snprintf(buffer + written, remaining - written, ",\n");
-                        *length += written;
-                    } else {
-                        buffer = *out + *length;
-                        remaining = *capacity - *length;
-                        written = 0;
-                        written += snprintf(buffer + written, remaining - written, "\n");
-                        *length += written;
-                    }
-                }
-                
-                buffer = *out + *length;
-                remaining = *capacity - *length;
-                written = 0;
+            nexus_json_writer_begin_object(writer);
+            for (size_t i = 0; i < value->data.object.count && !writer->failed; i++) {
+                nexus_json_writer_key(writer, value->data.object.keys[i]);
+                nexus_json_writer_value(writer, value->data.object.values[i]);
+            }
+            nexus_json_writer_end_object(writer);
+            break;
+    }
+}
+
+// Append a JSON value to a growing string
+//
+// Kept for callers of the old formatter. The value starts after
+// current_indent spaces and its nested lines are indented from there.
+void nexus_json_write_to_string(const NexusJsonValue* value, char** out, size_t* length, size_t* capacity, int indent, int current_indent) {
+    NexusJsonStringSink string = { *out, *length, *capacity };
+    NexusJsonWriter writer;
+    char buffer[1024];
+    
+    nexus_json_writer_init(&writer, nexus_json_sink_string, &string, buffer, sizeof(buffer), indent);
+    if (indent > 0 && current_indent > 0) {
+        for (int i = 0; i < current_indent; i++) {
+            nexus_json_writer_put(&writer, " ", 1);
+        }
+        writer.depth = current_indent / indent;
+        writer.after_key = true;
+    }
+    
+    nexus_json_writer_value(&writer, value);
+    writer.depth = 0;
+    nexus_json_writer_finish(&writer);
+    
+    *out = string.data;
+    *length = string.length;
+    *capacity = string.capacity;
+}
+
+// Convert a JSON value to a string
+char* nexus_json_to_string(const NexusJsonValue* value, bool pretty) {
+    NexusJsonStringSink string = { NULL, 0, 0 };
+    NexusJsonWriter writer;
+    char buffer[4096];
+    
+    nexus_json_writer_init(&writer, nexus_json_sink_string, &string, buffer, sizeof(buffer), pretty ? 2 : 0);
+    nexus_json_writer_value(&writer, value);
+    if (!nexus_json_writer_finish(&writer)) {
+        free(string.data);
+        return NULL;
+    }
+    
+    // An empty sink still yields an empty string
+    return string.data ? string.data : strdup("");
+}
+
+// Write a JSON value to a file
+//
+// The document is streamed through a fixed buffer instead of being built
+// as one string first.
+bool nexus_json_write_file(const NexusJsonValue* value, const char* filename, bool pretty) {
+    FILE* file = fopen(filename, "w");
+    if (!file) return false;
+    
+    NexusJsonWriter writer;
+    if (!nexus_json_writer_init_file(&writer, file, NULL, 0, pretty ? 2 : 0)) {
+        fclose(file);
+        return false;
+    }
+    
+    nexus_json_writer_value(&writer, value);
+    bool ok = nexus_json_writer_finish(&writer);
+    return fclose(file) == 0 && ok;
+}
+
+// Arena-backed parsing
+//
+// A NexusJsonArena owns every value, key and string of the documents
+// parsed into it, so a whole DOM is released by resetting or destroying
+// the arena. Values from an arena must not be passed to nexus_json_free,
+// nexus_json_array_add or nexus_json_object_add.
+
+#define NEXUS_JSON_ARENA_MIN_BLOCK 4096
+#define NEXUS_JSON_ARENA_ALIGN 8
+
+// Arena block; allocations follow the header
+typedef struct NexusJsonArenaBlock {
+    struct NexusJsonArenaBlock* next;
+    size_t size;
+    size_t used;
+} NexusJsonArenaBlock;
+
+#define NEXUS_JSON_ARENA_HEADER \
+    ((sizeof(NexusJsonArenaBlock) + NEXUS_JSON_ARENA_ALIGN - 1) & ~(size_t)(NEXUS_JSON_ARENA_ALIGN - 1))
+
+// Arena for JSON documents
+typedef struct NexusJsonArena {
+    NexusJsonArenaBlock* blocks;    // Current block first
+    size_t block_size;              // Size of the next block to allocate
+    void** scratch;                 // Children of open arrays and objects while parsing
+    size_t scratch_capacity;
+} NexusJsonArena;
+
+// Create an arena whose first block holds at least initial_size bytes
+NexusJsonArena* nexus_json_arena_create(size_t initial_size) {
+    NexusJsonArena* arena = (NexusJsonArena*)calloc(1, sizeof(NexusJsonArena));
+    if (!arena) return NULL;
+    
+    arena->block_size = initial_size > NEXUS_JSON_ARENA_MIN_BLOCK ? initial_size : NEXUS_JSON_ARENA_MIN_BLOCK;
+    return arena;
+}
+
+// Allocate size bytes from the arena
+void* nexus_json_arena_alloc(NexusJsonArena* arena, size_t size) {
+    size = (size + NEXUS_JSON_ARENA_ALIGN - 1) & ~(size_t)(NEXUS_JSON_ARENA_ALIGN - 1);
+    
+    NexusJsonArenaBlock* block = arena->blocks;
+    if (!block || block->size - block->used < size) {
+        // Oversized requests get room for about as much again after them
+        size_t block_size = arena->block_size;
+        if (block_size < size * 2) {
+            block_size = size * 2;
+        }
+        
+        block = (NexusJsonArenaBlock*)malloc(NEXUS_JSON_ARENA_HEADER + block_size);
+        if (!block) return NULL;
+        
+        block->next = arena->blocks;
+        block->size = block_size;
+        block->used = 0;
+        arena->blocks = block;
+        
+        // Grow geometrically so large documents need few blocks
+        if (arena->block_size < 1024 * 1024) {
+            arena->block_size *= 2;
+        }
+    }
+    
+    void* memory = (char*)block + NEXUS_JSON_ARENA_HEADER + block->used;
+    block->used += size;
+    return memory;
+}
+
+// Release every document in the arena, keeping the newest block for reuse
+void nexus_json_arena_reset(NexusJsonArena* arena) {
+    if (!arena || !arena->blocks) return;
+    
+    NexusJsonArenaBlock* block = arena->blocks->next;
+    while (block) {
+        NexusJsonArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    
+    arena->blocks->next = NULL;
+    arena->blocks->used = 0;
+}
+
+// Free the arena and every document parsed into it
+void nexus_json_arena_destroy(NexusJsonArena* arena) {
+    if (!arena) return;
+    
+    NexusJsonArenaBlock* block = arena->blocks;
+    while (block) {
+        NexusJsonArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    
+    free(arena->scratch);
+    free(arena);
+}
+
+// Parser state for one arena parse
+typedef struct NexusJsonArenaParser {
+    NexusJsonArena* arena;
+    size_t scratch_count;
+    int depth;
+} NexusJsonArenaParser;
+
+// Push a pending child onto the scratch stack
+bool nexus_json_arena_push(NexusJsonArenaParser* parser, void* item) {
+    NexusJsonArena* arena = parser->arena;
+    if (parser->scratch_count == arena->scratch_capacity) {
+        size_t capacity = arena->scratch_capacity ? arena->scratch_capacity * 2 : 64;
+        void** scratch = (void**)realloc(arena->scratch, capacity * sizeof(void*));
+        if (!scratch) return false;
+        arena->scratch = scratch;
+        arena->scratch_capacity = capacity;
+    }
+    
+    arena->scratch[parser->scratch_count++] = item;
+    return true;
+}
+
+// Allocate a value of the given type from the arena
+NexusJsonValue* nexus_json_arena_value(NexusJsonArena* arena, NexusJsonType type) {
+    NexusJsonValue* value = (NexusJsonValue*)nexus_json_arena_alloc(arena, sizeof(NexusJsonValue));
+    if (value) {
+        memset(value, 0, sizeof(NexusJsonValue));
+        value->type = type;
+    }
+    return value;
+}
+
+// Read four hex digits
+bool nexus_json_parse_hex4(const char* s, unsigned int* out) {
+    unsigned int value = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = s[i];
+        value <<= 4;
+        if (c >= '0' && c <= '9') value |= (unsigned int)(c - '0');
+        else if (c >= 'a' && c <= 'f') value |= (unsigned int)(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') value |= (unsigned int)(c - 'A' + 10);
+        else return false;
+    }
+    *out = value;
+    return true;
+}
+
+// Parse a JSON string in place
+//
+// The unescaped string is written over its own source text, which is
+// never shorter, and terminated where the closing quote was.
+char* nexus_json_parse_string_in_place(char* s, char** out) {
+    if (*s != '"') return NULL;
+    s++;
+    *out = s;
+    
+    // Strings without escapes need no copying
+    s = (char*)nexus_json_find_string_special(s);
+    if (*s == '\0') return NULL;
+    
+    char* dest = s;
+    while (*s != '"') {
+        if (*s == '\0') return NULL;
+        
+        if (*s != '\\') {
+            *dest++ = *s++;
+            continue;
+        }
+        
+        s++;
+        switch (*s) {
+            case 'n': *dest++ = '\n'; break;
+            case 'r': *dest++ = '\r'; break;
+            case 't': *dest++ = '\t'; break;
+            case 'b': *dest++ = '\b'; break;
+            case 'f': *dest++ = '\f'; break;
+            case 'u': {
+                unsigned int code;
+                if (!nexus_json_parse_hex4(s + 1, &code)) return NULL;
+                s += 4;
                 
-                for (int i = 0; i < current_indent; i++) {
-                    buffer[written++] = ' ';
+                // Combine a surrogate pair into one code point
+                unsigned int low;
+                if (code >= 0xD800 && code <= 0xDBFF && s[1] == '\\' && s[2] == 'u' &&
+                    nexus_json_parse_hex4(s + 3, &low) && low >= 0xDC00 && low <= 0xDFFF) {
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    s += 6;
                 }
                 
-                written += snprintf(buffer + written, remaining - written, "}");
-            } else {
-                for (size_t i = 0; i < value->data.object.count; i++) {
-                    buffer = *out + *length;
-                    remaining = *capacity - *length;
-                    written = 0;
-                    
-                    written += snprintf(buffer + written, remaining - written, "\"%s\":", 
-                                     value->data.object.keys[i]);
-                    *length += written;
-                    
-                    nexus_json_write_to_string(value->data.object.values[i], out, length, capacity, 0, 0);
-                    
-                    if (i < value->data.object.count - 1) {
-                        buffer = *out + *length;
-                        remaining = *capacity - *length;
-                        written = 0;
-                        written += snprintf(buffer + written, remaining - written, ",");
-                        *length += written;
-                    }
+                if (code < 0x80) {
+                    *dest++ = (char)code;
+                } else if (code < 0x800) {
+                    *dest++ = (char)(0xC0 | (code >> 6));
+                    *dest++ = (char)(0x80 | (code & 0x3F));
+                } else if (code < 0x10000) {
+                    *dest++ = (char)(0xE0 | (code >> 12));
+                    *dest++ = (char)(0x80 | ((code >> 6) & 0x3F));
+                    *dest++ = (char)(0x80 | (code & 0x3F));
+                } else {
+                    *dest++ = (char)(0xF0 | (code >> 18));
+                    *dest++ = (char)(0x80 | ((code >> 12) & 0x3F));
+                    *dest++ = (char)(0x80 | ((code >> 6) & 0x3F));
+                    *dest++ = (char)(0x80 | (code & 0x3F));
                 }
-                
-                buffer = *out + *length;
-                remaining = *capacity - *length;
-                written = 0;
-                written += snprintf(buffer + written, remaining - written, "}");
+                break;
             }
+            case '\0': return NULL;
+            default: *dest++ = *s; break;
+        }
+        s++;
+    }
+    
+    *dest = '\0';
+    return s + 1; // Skip closing quote
+}
+
+char* nexus_json_arena_parse_value(NexusJsonArenaParser* parser, char* s, NexusJsonValue** out);
+
+// Parse a JSON array into the arena
+//
+// Items collect on the scratch stack and are copied into an exactly sized
+// array once the closing bracket is reached.
+char* nexus_json_arena_parse_array(NexusJsonArenaParser* parser, char* s, NexusJsonValue** out) {
+    size_t base = parser->scratch_count;
+    
+    s = (char*)nexus_json_skip_whitespace(s + 1);
+    if (*s != ']') {
+        while (1) {
+            NexusJsonValue* item;
+            s = nexus_json_arena_parse_value(parser, s, &item);
+            if (!s || !nexus_json_arena_push(parser, item)) return NULL;
             
-            break;
+            s = (char*)nexus_json_skip_whitespace(s);
+            if (*s == ']') break;
+            if (*s != ',') return NULL;
+            s++;
+        }
+    }
+    
+    NexusJsonValue* array = nexus_json_arena_value(parser->arena, NEXUS_JSON_ARRAY);
+    if (!array) return NULL;
+    
+    size_t count = parser->scratch_count - base;
+    if (count > 0) {
+        array->data.array.items = (NexusJsonValue**)nexus_json_arena_alloc(parser->arena, count * sizeof(NexusJsonValue*));
+        if (!array->data.array.items) return NULL;
+        memcpy(array->data.array.items, parser->arena->scratch + base, count * sizeof(NexusJsonValue*));
     }
+    array->data.array.count = count;
     
-    *length += written;
+    parser->scratch_count = base;
+    *out = array;
+    return s + 1;
 }
 
-// Convert a JSON value to a string
-char* nexus_json_to_string(const NexusJsonValue* value, bool pretty) {
-    size_t length = 0;
-    size_t capacity = 256;
-    char* buffer = (char*)malloc(capacity);
+// Parse a JSON object into the arena
+char* nexus_json_arena_parse_object(NexusJsonArenaParser* parser, char* s, NexusJsonValue** out) {
+    size_t base = parser->scratch_count;
     
-    nexus_json_write_to_string(value, &buffer, &length, &capacity, pretty ? 2 : 0, 0);
+    s = (char*)nexus_json_skip_whitespace(s + 1);
+    if (*s != '}') {
+        while (1) {
+            char* key;
+            s = nexus_json_parse_string_in_place(s, &key);
+            if (!s) return NULL;
+            
+            s = (char*)nexus_json_skip_whitespace(s);
+            if (*s != ':') return NULL;
+            
+            NexusJsonValue* value;
+            s = nexus_json_arena_parse_value(parser, s + 1, &value);
+            if (!s || !nexus_json_arena_push(parser, key) || !nexus_json_arena_push(parser, value)) return NULL;
+            
+            s = (char*)nexus_json_skip_whitespace(s);
+            if (*s == '}') break;
+            if (*s != ',') return NULL;
+            s = (char*)nexus_json_skip_whitespace(s + 1);
+        }
+    }
     
-    // Ensure null termination
-    if (length + 1 > capacity) {
-        capacity = length + 1;
-        buffer = (char*)realloc(buffer, capacity);
+    NexusJsonValue* object = nexus_json_arena_value(parser->arena, NEXUS_JSON_OBJECT);
+    if (!object) return NULL;
+    
+    size_t count = (parser->scratch_count - base) / 2;
+    if (count > 0) {
+        object->data.object.keys = (char**)nexus_json_arena_alloc(parser->arena, count * sizeof(char*));
+        object->data.object.values = (NexusJsonValue**)nexus_json_arena_alloc(parser->arena, count * sizeof(NexusJsonValue*));
+        if (!object->data.object.keys || !object->data.object.values) return NULL;
+        
+        void** pairs = parser->arena->scratch + base;
+        for (size_t i = 0; i < count; i++) {
+            object->data.object.keys[i] = (char*)pairs[2 * i];
+            object->data.object.values[i] = (NexusJsonValue*)pairs[2 * i + 1];
+        }
     }
+    object->data.object.count = count;
     
-    buffer[length] = '\0';
+    // Large objects are indexed now, while the arena is at hand
+    if (count >= NEXUS_JSON_INDEX_THRESHOLD && count < UINT32_MAX) {
+        size_t capacity = nexus_json_index_capacity(count);
+        NexusJsonObjectIndex* index = (NexusJsonObjectIndex*)nexus_json_arena_alloc(parser->arena, nexus_json_index_bytes(capacity));
+        if (!index) return NULL;
+        nexus_json_index_fill(index, capacity, object);
+        index->in_arena = true;
+        object->data.object.index = index;
+    }
     
-    return buffer;
+    parser->scratch_count = base;
+    *out = object;
+    return s + 1;
 }
 
-// Write a JSON value to a file
-bool nexus_json_write_file(const NexusJsonValue* value, const char* filename, bool pretty) {
-    char* json = nexus_json_to_string(value, pretty);
+// Parse a JSON value into the arena
+char* nexus_json_arena_parse_value(NexusJsonArenaParser* parser, char* s, NexusJsonValue** out) {
+    s = (char*)nexus_json_skip_whitespace(s);
     
-    FILE* file = fopen(filename, "w");
-    if (!file) {
-        free(json);
-        return false;
+    switch (*s) {
+        case 'n':
+            if (strncmp(s, "null", 4) != 0) return NULL;
+            *out = nexus_json_arena_value(parser->arena, NEXUS_JSON_NULL);
+            return *out ? s + 4 : NULL;
+        
+        case 't':
+        case 'f': {
+            bool truth = *s == 't';
+            size_t length = truth ? 4 : 5;
+            if (strncmp(s, truth ? "true" : "false", length) != 0) return NULL;
+            *out = nexus_json_arena_value(parser->arena, NEXUS_JSON_BOOL);
+            if (!*out) return NULL;
+            (*out)->data.boolean = truth;
+            return s + length;
+        }
+        
+        case '"': {
+            char* string;
+            char* next = nexus_json_parse_string_in_place(s, &string);
+            if (!next) return NULL;
+            *out = nexus_json_arena_value(parser->arena, NEXUS_JSON_STRING);
+            if (!*out) return NULL;
+            (*out)->data.string = string;
+            return next;
+        }
+        
+        case '[':
+        case '{': {
+            if (parser->depth >= NEXUS_JSON_MAX_DEPTH) return NULL;
+            parser->depth++;
+            char* next = *s == '[' ? nexus_json_arena_parse_array(parser, s, out)
+                                   : nexus_json_arena_parse_object(parser, s, out);
+            parser->depth--;
+            return next;
+        }
+        
+        case '-':
+        case '0': case '1': case '2': case '3': case '4':
+        case '5': case '6': case '7': case '8': case '9': {
+            double number;
+            char* end = (char*)nexus_json_scan_number(s, &number);
+            if (!end) return NULL;
+            *out = nexus_json_arena_value(parser->arena, NEXUS_JSON_NUMBER);
+            if (!*out) return NULL;
+            (*out)->data.number = number;
+            return end;
+        }
+        
+        default:
+            return NULL;
+    }
+}
+
+// Parse a mutable JSON buffer into the arena
+//
+// Strings and keys are unescaped in place and point into json, which must
+// outlive the returned document. On failure the arena keeps whatever it
+// allocated until it is reset or destroyed.
+NexusJsonValue* nexus_json_parse_in_place(NexusJsonArena* arena, char* json) {
+    if (!arena || !json) return NULL;
+    
+    NexusJsonArenaParser parser = { arena, 0, 0 };
+    NexusJsonValue* result = NULL;
+    char* end = nexus_json_arena_parse_value(&parser, json, &result);
+    
+    if (!end || *nexus_json_skip_whitespace(end) != '\0') {
+        return NULL;
     }
     
-    fprintf(file, "%s", json);
+    return result;
+}
+
+// Parse a JSON string into the arena
+//
+// The text is copied into the arena once, so the document is independent
+// of json.
+NexusJsonValue* nexus_json_parse_arena(NexusJsonArena* arena, const char* json) {
+    if (!arena || !json) return NULL;
+    
+    size_t length = strlen(json);
+    char* copy = (char*)nexus_json_arena_alloc(arena, length + 1);
+    if (!copy) return NULL;
+    
+    memcpy(copy, json, length + 1);
+    return nexus_json_parse_in_place(arena, copy);
+}
+
+// Parse a JSON file into the arena
+NexusJsonValue* nexus_json_parse_file_arena(NexusJsonArena* arena, const char* filename) {
+    if (!arena || !filename) return NULL;
+    
+    FILE* file = fopen(filename, "rb");
+    if (!file) return NULL;
+    
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size < 0) {
+        fclose(file);
+        return NULL;
+    }
+    
+    // The file text becomes the string storage of the document
+    char* content = (char*)nexus_json_arena_alloc(arena, (size_t)size + 1);
+    if (!content) {
+        fclose(file);
+        return NULL;
+    }
+    
+    size_t read_size = fread(content, 1, (size_t)size, file);
     fclose(file);
+    content[read_size] = '\0';
     
-    free(json);
-    return true;
+    return nexus_json_parse_in_place(arena, content);
 }
 
 #endif // NEXUS_JSON_H
\ No newline at end of file
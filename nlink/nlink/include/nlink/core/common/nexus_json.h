@@ -4,6 +4,7 @@
 
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdio.h>
 #include <ctype.h>
@@ -36,10 +37,17 @@ typedef struct NexusJsonValue {
             char** keys;
             struct NexusJsonValue** values;
             size_t count;
+            struct NexusJsonObjectIndex* index;     // Key hash index, NULL until needed
         } object;
     } data;
 } NexusJsonValue;
 
+// Object key with its hash computed once, for repeated lookups
+typedef struct NexusJsonKey {
+    const char* name;
+    uint32_t hash;
+} NexusJsonKey;
+
 // Function declarations only
 // Create JSON values
 extern NexusJsonValue* nexus_json_null(void);
@@ -59,6 +67,16 @@ extern const char* nexus_json_object_get_string(NexusJsonValue* object, const ch
 extern double nexus_json_object_get_number(NexusJsonValue* object, const char* key, double default_value);
 extern bool nexus_json_object_get_bool(NexusJsonValue* object, const char* key, bool default_value);
 
+// Lookup by precomputed key: objects of NEXUS_JSON_INDEX_THRESHOLD or more
+// members are searched through a hash index instead of a linear scan
+#define NEXUS_JSON_INDEX_THRESHOLD 16
+
+extern NexusJsonKey nexus_json_key(const char* name);
+extern NexusJsonValue* nexus_json_object_get_key(NexusJsonValue* object, const NexusJsonKey* key);
+extern const char* nexus_json_object_get_string_key(NexusJsonValue* object, const NexusJsonKey* key, const char* default_value);
+extern double nexus_json_object_get_number_key(NexusJsonValue* object, const NexusJsonKey* key, double default_value);
+extern bool nexus_json_object_get_bool_key(NexusJsonValue* object, const NexusJsonKey* key, bool default_value);
+
 // Memory management
 extern void nexus_json_free(NexusJsonValue* value);
 
@@ -72,6 +90,19 @@ extern const char* nexus_json_parse_value(const char* s, NexusJsonValue** out);
 extern NexusJsonValue* nexus_json_parse(const char* json);
 extern NexusJsonValue* nexus_json_parse_file(const char* filename);
 
+// Arena-backed parsing: every value, key and string of a document lives in
+// the arena and is released by nexus_json_arena_reset or _destroy. Arena
+// values must not be passed to nexus_json_free.
+typedef struct NexusJsonArena NexusJsonArena;
+
+extern NexusJsonArena* nexus_json_arena_create(size_t initial_size);
+extern void* nexus_json_arena_alloc(NexusJsonArena* arena, size_t size);
+extern void nexus_json_arena_reset(NexusJsonArena* arena);
+extern void nexus_json_arena_destroy(NexusJsonArena* arena);
+extern NexusJsonValue* nexus_json_parse_in_place(NexusJsonArena* arena, char* json);
+extern NexusJsonValue* nexus_json_parse_arena(NexusJsonArena* arena, const char* json);
+extern NexusJsonValue* nexus_json_parse_file_arena(NexusJsonArena* arena, const char* filename);
+
 // Output
 #ifndef NEXUS_JSON_IMPLEMENTATION
 extern void nexus_json_write_to_string(const NexusJsonValue* value, char** out, size_t* length, size_t* capacity, int indent, int current_indent);
@@ -79,5 +110,56 @@ extern char* nexus_json_to_string(const NexusJsonValue* value, bool pretty);
 extern bool nexus_json_write_file(const NexusJsonValue* value, const char* filename, bool pretty);
 #endif
 
+// Streaming output: formats into one bounded buffer and hands it to a sink
+// whenever it fills, so memory use does not grow with the document.
+#define NEXUS_JSON_MAX_DEPTH 512
+#define NEXUS_JSON_WRITER_BUFFER 65536
+#define NEXUS_JSON_WRITER_MIN_BUFFER 64
+
+typedef bool (*NexusJsonSink)(void* context, const char* data, size_t length);
+
+typedef struct NexusJsonWriter {
+    char* buffer;
+    size_t capacity;
+    size_t length;
+    bool owns_buffer;
+    NexusJsonSink sink;
+    void* context;
+    int fd;
+    int indent;
+    int depth;
+    bool after_key;
+    bool failed;
+    uint64_t has_items[NEXUS_JSON_MAX_DEPTH / 64 + 1];
+} NexusJsonWriter;
+
+typedef struct NexusJsonStringSink {
+    char* data;
+    size_t length;
+    size_t capacity;
+} NexusJsonStringSink;
+
+extern bool nexus_json_sink_file(void* context, const char* data, size_t length);
+extern bool nexus_json_sink_fd(void* context, const char* data, size_t length);
+extern bool nexus_json_sink_string(void* context, const char* data, size_t length);
+extern bool nexus_json_writer_init(NexusJsonWriter* writer, NexusJsonSink sink, void* context,
+                                   char* buffer, size_t capacity, int indent);
+extern bool nexus_json_writer_init_file(NexusJsonWriter* writer, FILE* file, char* buffer, size_t capacity, int indent);
+extern bool nexus_json_writer_init_fd(NexusJsonWriter* writer, int fd, char* buffer, size_t capacity, int indent);
+extern bool nexus_json_writer_flush(NexusJsonWriter* writer);
+extern bool nexus_json_writer_finish(NexusJsonWriter* writer);
+extern void nexus_json_writer_begin_object(NexusJsonWriter* writer);
+extern void nexus_json_writer_end_object(NexusJsonWriter* writer);
+extern void nexus_json_writer_begin_array(NexusJsonWriter* writer);
+extern void nexus_json_writer_end_array(NexusJsonWriter* writer);
+extern void nexus_json_writer_key(NexusJsonWriter* writer, const char* key);
+extern void nexus_json_writer_string(NexusJsonWriter* writer, const char* value);
+extern void nexus_json_writer_number(NexusJsonWriter* writer, double value);
+extern void nexus_json_writer_integer(NexusJsonWriter* writer, int64_t value);
+extern void nexus_json_writer_bool(NexusJsonWriter* writer, bool value);
+extern void nexus_json_writer_null(NexusJsonWriter* writer);
+extern void nexus_json_writer_value(NexusJsonWriter* writer, const NexusJsonValue* value);
+extern size_t nexus_json_format_number(char* out, double value);
+
 
 #endif // NEXUS_JSON_H
\ No newline at end of file
@@ -28,20 +28,16 @@
 // Define the default registry size
 #define NEXUS_DEFAULT_REGISTRY_SIZE 16
 
-// Forward declaration of handle registry
-struct NexusHandleRegistry;
 /**
-* @brief Handle registry structure
+* @brief Handle registry
+*
+* Maps component library paths to dlopen handles. Each library is indexed
+* by the path it was registered under, by its canonical path and by its
+* (device, inode) pair, so a symlink or relative spelling of a loaded
+* library finds the existing handle. Lookups take no locks; registrations
+* are serialized internally.
 */
-typedef struct NexusHandleRegistry {
-    void** handles;     /**< Array of library handles */
-    char** paths;       /**< Array of library paths */
-    char** components;  /**< Array of component identifiers */
-    size_t count;       /**< Number of registered handles */
-    size_t capacity;    /**< Capacity of the arrays */
-
-    pthread_mutex_t mutex; /**< Mutex for thread safety */
-} NexusHandleRegistry;
+typedef struct NexusHandleRegistry NexusHandleRegistry;
 /**
  * @brief Component structure
  *  
@@ -64,6 +60,9 @@ struct NexusComponent {
  /**
   * @brief Find a component handle by path
   * 
+  * Safe to call concurrently with registrations. A path not registered
+  * verbatim costs one stat() to match by (device, inode).
+  * 
   * @param registry The handle registry
   * @param path Path to the component library
   * @return Handle, or NULL if not found
@@ -77,11 +76,20 @@ struct NexusComponent {
   * @param handle Component handle
   * @param path Path to the component library
   * @param component_id Component identifier
-  * @return Result code
+  * @return Result code; NEXUS_ALREADY_EXISTS if the library is already
+  *         registered under this or an equivalent path
   */
  NexusResult nexus_register_component_handle(NexusHandleRegistry* registry, void* handle, 
                                            const char* path, const char* component_id);
  
+ /**
+  * @brief Get the number of registered libraries
+  * 
+  * @param registry The handle registry
+  * @return Number of registered libraries
+  */
+ size_t nexus_handle_registry_count(const NexusHandleRegistry* registry);
+ 
  /**
   * @brief Load a component
   * 
@@ -92,6 +100,75 @@ struct NexusComponent {
   */
  NexusComponent* nexus_load_component(NexusContext* ctx, const char* path, const char* component_id);
  
+ /**
+  * @brief A component to load as part of a batch
+  * 
+  * Dependencies name other components of the same batch by identifier, as
+  * listed under "dependencies" in the component metadata.
+  */
+ typedef struct NexusComponentSpec {
+     const char* path;                   /**< Path to the component library */
+     const char* id;                     /**< Component identifier */
+     const char* const* dependencies;    /**< Identifiers this component depends on */
+     const bool* optional;               /**< Per dependency; NULL if all are required */
+     size_t dependency_count;            /**< Number of dependencies */
+ } NexusComponentSpec;
+ 
+ /**
+  * @brief Startup timeline entry for one component of a batch
+  * 
+  * Times are milliseconds since the batch started, or -1 for a phase that
+  * did not run. Workers are numbered from 0, the calling thread.
+  */
+ typedef struct NexusComponentTiming {
+     double open_start_ms;   /**< dlopen started */
+     double open_end_ms;     /**< dlopen returned */
+     double init_start_ms;   /**< All dependencies initialized, nexus_component_init started */
+     double init_end_ms;     /**< nexus_component_init returned */
+     int open_worker;        /**< Thread that opened the library */
+     int init_worker;        /**< Thread that initialized the component */
+     NexusResult result;     /**< NEXUS_SUCCESS, or why the component did not load */
+ } NexusComponentTiming;
+ 
+ /**
+  * @brief Load a set of components concurrently
+  * 
+  * Libraries are opened on a pool of threads, those with the longest
+  * dependency chains above them first. A component is initialized as soon
+  * as its library is open and every dependency has been initialized, so
+  * independent components initialize in parallel while each one still
+  * sees its dependencies initialized. A component whose library cannot be
+  * opened (NEXUS_IO_ERROR) or whose initialization fails
+  * (NEXUS_NOT_INITIALIZED) takes its dependents down with it
+  * (NEXUS_DEPENDENCY_ERROR); the rest still load.
+  * 
+  * An optional dependency outside the batch is ignored. A required one,
+  * or a dependency cycle, fails the whole batch before anything is opened.
+  * 
+  * @param ctx The NexusLink context
+  * @param specs Components to load
+  * @param count Number of components
+  * @param max_threads Threads to use including the caller; 0 for one per CPU
+  * @param components Receives each loaded component, or NULL where loading failed
+  * @param timeline Optional, receives one entry per component
+  * @return NEXUS_SUCCESS if every component loaded, NEXUS_PARTIAL_SUCCESS
+  *         if some did, otherwise the first failure
+  */
+ NexusResult nexus_load_components(NexusContext* ctx, const NexusComponentSpec* specs, size_t count,
+                                   size_t max_threads, NexusComponent** components,
+                                   NexusComponentTiming* timeline);
+ 
+ /**
+  * @brief Print a batch startup timeline, one line per component
+  * 
+  * @param out Output stream
+  * @param specs Components passed to nexus_load_components
+  * @param timeline Timeline filled by nexus_load_components
+  * @param count Number of components
+  */
+ void nexus_print_component_timeline(FILE* out, const NexusComponentSpec* specs,
+                                     const NexusComponentTiming* timeline, size_t count);
+ 
  /**
   * @brief Unload a component
   * 
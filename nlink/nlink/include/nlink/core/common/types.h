@@ -24,6 +24,25 @@
      typedef struct NexusContext NexusContext;
      typedef struct NexusComponent NexusComponent;
      
+     /**
+      * @brief Symbol types for NexusLink symbols
+      */
+     typedef enum NexusSymbolType
+     {
+         NEXUS_SYMBOL_FUNCTION,  /**< Function symbol */
+         NEXUS_SYMBOL_VARIABLE,  /**< Variable symbol */
+         NEXUS_SYMBOL_TYPE,      /**< Type symbol */
+         NEXUS_SYMBOL_CONSTANT,  /**< Constant symbol */
+         NEXUS_SYMBOL_MACRO,     /**< Macro symbol */
+         NEXUS_SYMBOL_STRUCT,    /**< Structure symbol */
+         NEXUS_SYMBOL_ENUM,      /**< Enumeration symbol */
+         NEXUS_SYMBOL_UNION,     /**< Union symbol */
+         NEXUS_SYMBOL_UNKNOWN,   /**< Unknown symbol type */
+         /* Legacy names for backward compatibility */
+         NEXUS_SYMBOL_DATA = NEXUS_SYMBOL_VARIABLE, /**< Data symbol (alias for VARIABLE) */
+         NEXUS_SYMBOL_CONST = NEXUS_SYMBOL_CONSTANT /**< Const symbol (alias for CONSTANT) */
+     } NexusSymbolType;
+
      /**
       * @brief Symbol structure for NexusLink
       */
@@ -34,8 +53,18 @@
          NexusSymbolType type;   /**< Symbol type */
          char* component_id;     /**< Component that provides this symbol */
          int ref_count;          /**< Reference count */
+         uint32_t hash;          /**< Precomputed name hash (see nexus_symbol_hash) */
      } NexusSymbol;
      
+     /**
+      * @brief Slot in a symbol table's open-addressing hash index
+      */
+     typedef struct NexusSymbolIndexSlot
+     {
+         uint32_t hash;          /**< Cached name hash of the referenced symbol */
+         uint32_t position;      /**< Position in the symbols array (NEXUS_SYMBOL_INDEX_EMPTY if free) */
+     } NexusSymbolIndexSlot;
+     
      /**
       * @brief Symbol table structure for NexusLink
       */
@@ -44,6 +73,8 @@
          NexusSymbol* symbols;   /**< Array of symbols */
          size_t size;            /**< Current number of symbols */
          size_t capacity;        /**< Total capacity of symbol array */
+         NexusSymbolIndexSlot* index; /**< Open-addressing hash index into symbols */
+         size_t index_capacity;  /**< Number of index slots (power of two, 0 if unindexed) */
      } NexusSymbolTable;
      
      /**
@@ -56,6 +87,16 @@
          NexusSymbolTable exported;  /**< Exported symbols */
      } NexusSymbolRegistry;
  
+     /**
+      * @brief Sized byte buffer passed between pipeline stages
+      */
+     typedef struct NexusBuffer
+     {
+         void* data;             /**< Buffer contents (heap-allocated when capacity > 0) */
+         size_t size;            /**< Number of valid bytes in data */
+         size_t capacity;        /**< Number of bytes allocated for data */
+     } NexusBuffer;
+ 
      /**
       * @brief Result codes for NexusLink operations
       */
@@ -107,24 +148,6 @@
          NEXUS_FLAG_STRICT_DEPS = (1 << 2)  /**< Enforce strict dependency checking */
      } NexusFlags;
  
-     /**
-      * @brief Symbol types for NexusLink symbols
-      */
-     typedef enum NexusSymbolType
-     {
-         NEXUS_SYMBOL_FUNCTION,  /**< Function symbol */
-         NEXUS_SYMBOL_VARIABLE,  /**< Variable symbol */
-         NEXUS_SYMBOL_TYPE,      /**< Type symbol */
-         NEXUS_SYMBOL_CONSTANT,  /**< Constant symbol */
-         NEXUS_SYMBOL_MACRO,     /**< Macro symbol */
-         NEXUS_SYMBOL_STRUCT,    /**< Structure symbol */
-         NEXUS_SYMBOL_ENUM,      /**< Enumeration symbol */
-         NEXUS_SYMBOL_UNION,     /**< Union symbol */
-         NEXUS_SYMBOL_UNKNOWN,   /**< Unknown symbol type */
-         /* Legacy names for backward compatibility */
-         NEXUS_SYMBOL_DATA = NEXUS_SYMBOL_VARIABLE, /**< Data symbol (alias for VARIABLE) */
-         NEXUS_SYMBOL_CONST = NEXUS_SYMBOL_CONSTANT /**< Const symbol (alias for CONSTANT) */
-     } NexusSymbolType;
  
      /* Callback type definitions */
      typedef void (*NexusLogCallback)(NexusLogLevel level, const char *format, va_list args);
@@ -134,6 +157,7 @@
      /* Constants */
      #define NEXUS_DEFAULT_TABLE_SIZE 64
      #define NEXUS_DEFAULT_REGISTRY_SIZE 16
+     #define NEXUS_SYMBOL_INDEX_EMPTY UINT32_MAX
  
  #ifdef __cplusplus
  }
@@ -14,6 +14,7 @@
 #include "nlink/core/common/nexus_loader.h"
 #include "nlink/core/common/types.h"
 #include "nlink/core/common/result.h"
+#include "nlink/core/versioning/semver.h"
 
 
 // Enhanced dependency structure with version requirements
@@ -22,6 +23,7 @@ typedef struct {
     char* version_req;        // Version requirement (e.g., "^1.2.3")
     bool optional;            // Whether this dependency is optional
     char* resolved_version;   // The actual version that was resolved (NULL if not resolved)
+    SemVerConstraint* constraint; // Compiled version_req (NULL if absent or malformed)
 } EnhancedDependency;
 
 // Symbol definition structure
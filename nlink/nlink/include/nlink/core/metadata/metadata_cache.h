@@ -0,0 +1,69 @@
+// include/nlink/core/metadata/metadata_cache.h
+// Binary on-disk cache of parsed component metadata for NexusLink
+// Author: Implementation Team
+
+#ifndef NEXUS_METADATA_CACHE_H
+#define NEXUS_METADATA_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "nlink/core/metadata/enhanced_metadata.h"
+
+// Bumped whenever the file layout changes; older caches are ignored
+#define NEXUS_METADATA_CACHE_VERSION 1
+
+// A cache file mapped into memory
+//
+// The file is an image of EnhancedComponentMetadata structures, their
+// arrays, parsed versions, compiled constraints and a string table, with
+// every pointer stored as an offset from the start of the file. Opening
+// maps it copy-on-write and adds the mapping address to each pointer
+// listed in its relocation table; nothing is parsed or copied.
+//
+// Entries are keyed by the path of the JSON file they were loaded from
+// and validated against its modification time and size. When those
+// changed, a matching content hash still counts as a hit.
+typedef struct NexusMetadataCache NexusMetadataCache;
+
+// Map a cache file
+// Returns NULL if it does not exist, was written by another layout
+// version or fails validation
+NexusMetadataCache* nexus_metadata_cache_open(const char* cache_path);
+
+// Find the metadata loaded from a JSON file
+// Returns NULL if the file is not cached or has changed since. The
+// metadata belongs to the cache: it stays valid until the cache is closed
+// and must not be passed to nexus_free_enhanced_metadata. Usage fields may
+// be updated in place; changes are not written back.
+EnhancedComponentMetadata* nexus_metadata_cache_lookup(NexusMetadataCache* cache, const char* metadata_path);
+
+// Number of cached components
+size_t nexus_metadata_cache_count(const NexusMetadataCache* cache);
+
+// Unmap a cache file
+void nexus_metadata_cache_close(NexusMetadataCache* cache);
+
+// Write a cache file holding metadata[i] keyed by metadata_paths[i]
+// Each JSON file is hashed as it is now, so write right after loading.
+// The file is replaced atomically.
+bool nexus_metadata_cache_write(
+    const char* cache_path,
+    const char* const* metadata_paths,
+    const EnhancedComponentMetadata* const* metadata,
+    size_t count
+);
+
+// Load metadata for a set of components through a cache file
+// Cached entries are used in place. Missing or stale ones are parsed from
+// JSON, after which the cache file is rewritten and mapped again, so every
+// metadata_out[i] belongs to the returned cache (NULL where the JSON could
+// not be loaded). Returns NULL only if the cache cannot be written or
+// mapped; fall back to nexus_load_enhanced_metadata then.
+NexusMetadataCache* nexus_metadata_cache_load(
+    const char* cache_path,
+    const char* const* metadata_paths,
+    size_t count,
+    EnhancedComponentMetadata** metadata_out
+);
+
+#endif // NEXUS_METADATA_CACHE_H
@@ -88,7 +88,9 @@
   * @brief Minimize an automaton using Okpala's state machine minimization algorithm
   * 
   * This function creates a new minimized automaton based on the input automaton.
-  * The original automaton is not modified.
+  * The original automaton is not modified. Equivalent states are merged by
+  * Hopcroft partition refinement over a symbol-interned transition table,
+  * in O(n·k·log n) time for n states over k input symbols.
   * 
   * @param automaton The automaton to minimize
   * @param use_boolean_reduction Whether to use boolean reduction for further optimization
@@ -97,6 +99,20 @@
  OkpalaAutomaton* okpala_minimize_automaton(OkpalaAutomaton* automaton, 
 										 bool use_boolean_reduction);
  
+ /**
+  * @brief Minimize an automaton with the pairwise equivalence matrix
+  * 
+  * Reference implementation using O(n²) memory and up to O(n³·k) time.
+  * It produces the same automaton as okpala_minimize_automaton and is kept
+  * for differential testing only.
+  * 
+  * @param automaton The automaton to minimize
+  * @param use_boolean_reduction Whether to use boolean reduction for further optimization
+  * @return A new minimized automaton, or NULL if minimization failed
+  */
+ OkpalaAutomaton* okpala_minimize_automaton_reference(OkpalaAutomaton* automaton, 
+												   bool use_boolean_reduction);
+ 
  /**
   * @brief Free an Okpala Automaton instance and all associated resources
   * 
@@ -0,0 +1,203 @@
+/**
+ * @file okpala_dense.h
+ * @brief Compact integer-indexed representation of the Okpala Automaton
+ * 
+ * OkpalaAutomaton keeps string ids, strdup'd input symbols and pointer
+ * transitions, which suits construction but not execution. This header
+ * defines a compiled form of the same automaton: input symbols interned to
+ * small integers, states numbered by uint32_t in the order they were added,
+ * transitions packed in CSR rows and, when the alphabet is dense enough,
+ * a flat [state][symbol] table that the run functions step through with a
+ * single load per input symbol.
+ * 
+ * Copyright © 2025 OBINexus Computing
+ */
+
+ #ifndef NLINK_CORE_MINIMIZER_OKPALA_DENSE_H
+ #define NLINK_CORE_MINIMIZER_OKPALA_DENSE_H
+ 
+ #include "nlink/core/minimizer/okpala_automaton.h"
+ #include <stdbool.h>
+ #include <stddef.h>
+ #include <stdint.h>
+ 
+ #ifdef __cplusplus
+ extern "C" {
+ #endif
+ 
+ /**
+  * @brief Marker for a missing state or symbol id
+  */
+ #define OKPALA_DENSE_NONE UINT32_MAX
+ 
+ /**
+  * @brief Transition table layout of a dense automaton
+  */
+ typedef enum OkpalaDenseLayout {
+	 OKPALA_LAYOUT_AUTO = 0,        /**< Flat table when the alphabet is dense enough, CSR otherwise */
+	 OKPALA_LAYOUT_FLAT,            /**< Always build the flat [state][symbol] table */
+	 OKPALA_LAYOUT_CSR              /**< CSR rows only, for large sparse alphabets */
+ } OkpalaDenseLayout;
+ 
+ /**
+  * @brief Input alphabet interned to consecutive integer ids
+  */
+ typedef struct OkpalaAlphabet {
+	 char** symbols;                /**< Symbol strings indexed by id */
+	 uint32_t* hashes;              /**< Hash of each symbol */
+	 uint32_t count;                /**< Number of symbols */
+	 uint32_t* slots;               /**< Open-addressing index of symbol ids */
+	 size_t capacity;               /**< Number of index slots (power of two) */
+	 uint32_t byte_map[256];        /**< Id of each single-byte symbol, or count if none */
+ } OkpalaAlphabet;
+ 
+ /**
+  * @brief Compiled deterministic automaton with integer states and symbols
+  * 
+  * State i corresponds to automaton->states[i] of the source automaton.
+  * Only the first transition of a state on a given symbol is kept.
+  */
+ typedef struct OkpalaDenseAutomaton {
+	 OkpalaAlphabet alphabet;       /**< Interned input symbols */
+	 uint32_t state_count;          /**< Number of states */
+	 uint32_t initial_state;        /**< Initial state id */
+	 uint8_t* accepting;            /**< Non-zero for final states */
+	 uint32_t transition_count;     /**< Number of transitions */
+	 uint32_t* row_offsets;         /**< Transitions of state s are [row_offsets[s], row_offsets[s + 1]) */
+	 uint32_t* row_symbols;         /**< Symbol of each transition, ascending within a row */
+	 uint32_t* row_targets;         /**< Target state of each transition */
+	 uint32_t* table;               /**< Flat table, or NULL for the CSR layout (see below) */
+	 uint32_t table_stride;         /**< Entries per table row: symbol count + 1 */
+ } OkpalaDenseAutomaton;
+ 
+ /*
+  * The flat table has state_count + 1 rows of table_stride entries. Row
+  * state_count is a dead state looping on itself, and column symbol count
+  * catches unknown symbols, so missing transitions lead to the dead row and
+  * the run loop needs no branch per symbol.
+  */
+ 
+ /**
+  * @brief Compile an automaton into its dense representation
+  * 
+  * @param automaton The automaton to compile (must be deterministic)
+  * @param layout Transition table layout
+  * @return A new dense automaton, or NULL on failure
+  */
+ OkpalaDenseAutomaton* okpala_dense_create(const OkpalaAutomaton* automaton,
+										   OkpalaDenseLayout layout);
+ 
+ /**
+  * @brief Free a dense automaton
+  * 
+  * @param dense The dense automaton to free
+  */
+ void okpala_dense_free(OkpalaDenseAutomaton* dense);
+ 
+ /**
+  * @brief Look up the interned id of an input symbol
+  * 
+  * @param dense The dense automaton
+  * @param symbol The input symbol
+  * @return The symbol id, or OKPALA_DENSE_NONE if it is not in the alphabet
+  */
+ uint32_t okpala_dense_symbol(const OkpalaDenseAutomaton* dense, const char* symbol);
+ 
+ /**
+  * @brief Intern a sequence of input symbols for the run functions
+  * 
+  * Symbols outside the alphabet are stored as OKPALA_DENSE_NONE, which the
+  * run functions treat as having no transition.
+  * 
+  * @param dense The dense automaton
+  * @param symbols Input symbols
+  * @param count Number of symbols
+  * @param ids Output array of count symbol ids
+  * @return NexusResult result code (NEXUS_SUCCESS on success)
+  */
+ NexusResult okpala_dense_encode(const OkpalaDenseAutomaton* dense,
+								 const char* const* symbols,
+								 size_t count,
+								 uint32_t* ids);
+ 
+ /**
+  * @brief Follow a single transition
+  * 
+  * @param dense The dense automaton
+  * @param state Current state id
+  * @param symbol Symbol id
+  * @return The next state, or OKPALA_DENSE_NONE if there is no transition
+  */
+ uint32_t okpala_dense_step(const OkpalaDenseAutomaton* dense, uint32_t state, uint32_t symbol);
+ 
+ /**
+  * @brief Run a chunk of symbol ids through the automaton
+  * 
+  * Input may be streamed in chunks by passing the returned state back in.
+  * 
+  * @param dense The dense automaton
+  * @param state State to start from (initial_state for a new input)
+  * @param input Symbol ids
+  * @param length Number of symbol ids
+  * @return The state reached, or OKPALA_DENSE_NONE if the input was rejected early
+  */
+ uint32_t okpala_dense_run(const OkpalaDenseAutomaton* dense,
+						   uint32_t state,
+						   const uint32_t* input,
+						   size_t length);
+ 
+ /**
+  * @brief Run a chunk of bytes through an automaton over single-byte symbols
+  * 
+  * Each byte is the one-character input symbol it spells; bytes that are
+  * not in the alphabet have no transition.
+  * 
+  * @param dense The dense automaton
+  * @param state State to start from (initial_state for a new input)
+  * @param input Input bytes
+  * @param length Number of bytes
+  * @return The state reached, or OKPALA_DENSE_NONE if the input was rejected early
+  */
+ uint32_t okpala_dense_run_bytes(const OkpalaDenseAutomaton* dense,
+								 uint32_t state,
+								 const void* input,
+								 size_t length);
+ 
+ /**
+  * @brief Check whether a state is accepting
+  * 
+  * @param dense The dense automaton
+  * @param state State id, possibly OKPALA_DENSE_NONE
+  * @return true if the state is a final state
+  */
+ bool okpala_dense_is_accepting(const OkpalaDenseAutomaton* dense, uint32_t state);
+ 
+ /**
+  * @brief Check whether the automaton accepts a whole input of symbol ids
+  * 
+  * @param dense The dense automaton
+  * @param input Symbol ids
+  * @param length Number of symbol ids
+  * @return true if the input is accepted
+  */
+ bool okpala_dense_accepts(const OkpalaDenseAutomaton* dense,
+						   const uint32_t* input,
+						   size_t length);
+ 
+ /**
+  * @brief Check whether the automaton accepts a whole byte input
+  * 
+  * @param dense The dense automaton
+  * @param input Input bytes
+  * @param length Number of bytes
+  * @return true if the input is accepted
+  */
+ bool okpala_dense_accepts_bytes(const OkpalaDenseAutomaton* dense,
+								 const void* input,
+								 size_t length);
+ 
+ #ifdef __cplusplus
+ }
+ #endif
+ 
+ #endif /* NLINK_CORE_MINIMIZER_OKPALA_DENSE_H */
@@ -99,12 +99,20 @@ NexusResult mps_validate_pipeline_config(NexusContext* ctx, NexusMPSConfig* conf
  *
  * @param ctx NexusLink context
  * @param config Configuration to check
- * @param cycles Output parameter for cycle information
- * @param cycle_count Output parameter for number of cycles found
+ * @param cycles Output parameter for cycle information (may be NULL)
+ * @param cycle_count Output parameter for number of cycles found (may be NULL)
  * @return bool True if cycles were found, false otherwise
  */
 bool mps_detect_cycles(NexusContext* ctx, NexusMPSConfig* config, NexusCycleInfo** cycles, size_t* cycle_count);
 
+/**
+ * @brief Free cycle information returned by mps_detect_cycles
+ *
+ * @param cycles Cycle array to free
+ * @param cycle_count Number of cycles
+ */
+void mps_free_cycle_info(NexusCycleInfo* cycles, size_t cycle_count);
+
 /**
  * @brief Create a default multi-pass pipeline configuration
  *
@@ -80,6 +80,9 @@ NexusMPSDependencyGraph* mps_create_dependency_graph(NexusContext* ctx,
 /**
  * @brief Resolve bidirectional dependencies
  *
+ * Produces one execution group per strongly connected component, in an
+ * order where every group runs after the groups that feed it.
+ *
  * @param ctx NexusLink context
  * @param graph Dependency graph
  * @param execution_groups Output parameter for execution groups
@@ -94,16 +97,19 @@ NexusResult mps_resolve_bidirectional_dependencies(NexusContext* ctx,
 /**
  * @brief Find strongly connected components (for cycle detection)
  *
+ * Also stores each node's group number in its component_group field.
+ * Groups are returned in topological order of the condensed graph.
+ *
  * @param ctx NexusLink context
  * @param graph Dependency graph
- * @param components Output parameter for component groups
+ * @param components Output parameter for groups of node indices (caller frees each group and the array)
  * @param component_counts Output parameter for number of components in each group
  * @param group_count Output parameter for number of groups
  * @return NexusResult Operation result
  */
 NexusResult mps_find_strongly_connected_components(NexusContext* ctx,
                                                   NexusMPSDependencyGraph* graph,
-                                                  NexusComponent*** components,
+                                                  size_t*** components,
                                                   size_t** component_counts,
                                                   size_t* group_count);
 
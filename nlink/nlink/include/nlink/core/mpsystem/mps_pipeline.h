@@ -43,6 +43,17 @@ typedef void (*NexusMPSPipelineErrorHandler)(NexusMPSPipeline* pipeline,
                                             const char* component_id,
                                             const char* message);
 
+/**
+ * @brief Statistics for one execution group from the most recent run
+ */
+typedef struct NexusMPSGroupStats {
+    int level;                      /**< Scheduling level (groups on one level run concurrently) */
+    int component_count;            /**< Number of components in the group */
+    int iterations;                 /**< Passes over the group in the last run */
+    double execution_time_ms;       /**< Wall time of the group in the last run */
+    bool converged;                 /**< Whether a cyclic group reached a fixpoint */
+} NexusMPSGroupStats;
+
 /**
  * @brief Pipeline statistics
  */
@@ -54,8 +65,16 @@ typedef struct NexusMPSPipelineStats {
     int max_group_size;             /**< Maximum execution group size */
     int component_count;            /**< Number of components */
     int cycle_count;                /**< Number of cycles */
+    int level_count;                /**< Number of scheduling levels */
+    NexusMPSGroupStats* groups;     /**< Per-group statistics, owned by the pipeline */
+    size_t group_count;             /**< Number of entries in groups */
 } NexusMPSPipelineStats;
 
+/**
+ * @brief Internal scheduling state (streams, levels and worker pool)
+ */
+typedef struct NexusMPSExecutionState NexusMPSExecutionState;
+
 /**
  * @brief Multi-pass pipeline component structure
  */
@@ -88,6 +107,7 @@ struct NexusMPSPipeline {
     int current_iteration;          /**< Current iteration counter */
     int max_iterations;             /**< Maximum iterations (0 = unlimited) */
     NexusMPSPipelineStats stats;    /**< Execution statistics */
+    NexusMPSExecutionState* execution_state; /**< Streams, levels and workers for execution */
 };
 
 /**
@@ -111,6 +131,16 @@ NexusResult mps_pipeline_initialize(NexusContext* ctx, NexusMPSPipeline* pipelin
 /**
  * @brief Execute the multi-pass pipeline with input data
  *
+ * Each strongly connected component of the dependency graph is an
+ * execution group. Groups are scheduled level by level over the condensed
+ * graph; groups on the same level run concurrently on a worker pool. A
+ * cyclic group is re-run until a pass leaves every member's output
+ * unchanged or the iteration limit is reached.
+ *
+ * Components without inputs read the pipeline input; the outputs of
+ * components without outputs are appended to the pipeline output in
+ * configuration order.
+ *
  * @param ctx NexusLink context
  * @param pipeline Pipeline to execute
  * @param input Input data stream
@@ -133,10 +163,13 @@ void mps_pipeline_destroy(NexusContext* ctx, NexusMPSPipeline* pipeline);
 /**
  * @brief Execute a specific component group in the pipeline
  *
+ * Runs the group on the calling thread, iterating cyclic groups to a
+ * fixpoint, and reads and writes the connection streams in the map.
+ *
  * @param ctx NexusLink context
  * @param pipeline Pipeline containing the group
  * @param group Execution group to execute
- * @param streams Data stream map for component I/O
+ * @param streams Data stream map for component I/O (NULL for the pipeline's own streams)
  * @return NexusResult Operation result
  */
 NexusResult mps_pipeline_execute_group(NexusContext* ctx,
@@ -230,6 +263,9 @@ void mps_pipeline_set_iteration_limit(NexusMPSPipeline* pipeline, int max_iterat
 /**
  * @brief Get pipeline execution statistics
  *
+ * The per-group array is owned by the pipeline and is valid until the
+ * next execution or destruction.
+ *
  * @param pipeline Pipeline to get statistics from
  * @param stats Output parameter for statistics
  */
@@ -14,6 +14,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <regex.h>
 #include <string.h>
 
@@ -31,6 +32,14 @@ extern "C" {
  */
 typedef struct NlinkMatchInfo NlinkMatchInfo;
 
+/**
+ * @brief Compiled glob program
+ *
+ * Built once by nlink_pattern_create; matching runs over it without
+ * re-reading the pattern string.
+ */
+typedef struct NlinkGlobProgram NlinkGlobProgram;
+
 /**
  * @brief Pattern matching flags
  */
@@ -61,6 +70,7 @@ typedef enum {
     // Internal compiled representation
     union {
         regex_t regex;          // Compiled regex pattern
+        NlinkGlobProgram* glob; // Compiled glob program
         void* reserved;         // Reserved for future pattern types
     } compiled;
     
@@ -180,7 +190,7 @@ typedef enum {
   * @param matcher Pattern matcher
   * @return NlinkPatternFlags Pattern flags
   */
- NlinkPatternFlags* nlink_pattern_get_flags(const NlinkPatternMatcher* matcher);
+ NlinkPatternFlags nlink_pattern_get_flags(const NlinkPatternMatcher* matcher);
  
  /**
   * @brief Check if the pattern is a regex pattern
@@ -212,6 +222,59 @@ typedef enum {
  */
 void nlink_pattern_destroy(NlinkPatternMatcher* matcher);
 
+/**
+ * @brief Set of glob patterns matched together
+ *
+ * All patterns are simulated as one bit-parallel automaton, so a string
+ * is tested against every pattern in a single left-to-right pass.
+ */
+typedef struct NlinkPatternSet NlinkPatternSet;
+
+/**
+ * @brief Create a pattern set
+ *
+ * Every pattern is treated as a glob; a pattern without wildcards
+ * matches only itself. Only NLINK_PATTERN_FLAG_CASE_INSENSITIVE is
+ * honoured in flags.
+ *
+ * @param patterns Array of pattern strings
+ * @param count Number of patterns
+ * @param flags Behavior flags applied to every pattern
+ * @return NlinkPatternSet* New set or NULL on failure
+ */
+NlinkPatternSet* nlink_pattern_set_create(const char* const* patterns,
+                                          size_t count,
+                                          NlinkPatternFlags flags);
+
+/**
+ * @brief Match a string against every pattern in the set
+ *
+ * @param set Pattern set
+ * @param string String to match
+ * @param matches Receives indices of matching patterns in ascending order (may be NULL)
+ * @param max_matches Capacity of matches
+ * @return size_t Number of matching patterns (may exceed max_matches)
+ */
+size_t nlink_pattern_set_match(const NlinkPatternSet* set,
+                               const char* string,
+                               size_t* matches,
+                               size_t max_matches);
+
+/**
+ * @brief Get the number of patterns in the set
+ *
+ * @param set Pattern set
+ * @return size_t Number of patterns (0 on error)
+ */
+size_t nlink_pattern_set_count(const NlinkPatternSet* set);
+
+/**
+ * @brief Free pattern set resources
+ *
+ * @param set Pattern set to free
+ */
+void nlink_pattern_set_destroy(NlinkPatternSet* set);
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,8 +21,16 @@ typedef struct nlink_pattern_options {
     bool dot_special;        // Whether dot files are handled specially
     bool extended_glob;      // Whether to use extended glob syntax
     bool follow_symlinks;    // Whether to follow symbolic links
+    size_t max_threads;      // Directory walker threads (0 = one per online CPU)
 } nlink_pattern_options;
 
+/**
+ * Callback receiving each path matched by a directory walk
+ *
+ * Return false to stop the walk early.
+ */
+typedef bool (*nlink_pattern_callback)(const char* path, void* user_data);
+
 /**
  * Pattern matching result with matched files
  */
@@ -42,6 +50,8 @@ nlink_pattern_options nlink_pattern_default_options(void);
 /**
  * @brief Match files using a glob pattern
  * 
+ * Collects the paths found by nlink_match_pattern_stream, sorted.
+ * 
  * @param pattern The glob pattern to match against
  * @param base_dir The base directory to start matching from
  * @param options Pattern matching options
@@ -51,6 +61,34 @@ nlink_pattern_result* nlink_match_pattern(const char* pattern,
                                          const char* base_dir,
                                          nlink_pattern_options options);
 
+/**
+ * @brief Walk the file system and stream paths matching a glob pattern
+ * 
+ * The pattern is matched one path component at a time: '*', '?' and
+ * '[...]' never cross a '/', and with extended_glob a "**" component
+ * matches any number of directories. The literal leading directories of
+ * the pattern are opened directly, as are literal components further
+ * down, so only directories that can contain a match are read.
+ * Subdirectories are spread over a work-stealing pool of worker threads.
+ * 
+ * Paths are relative to the current directory when base_dir is NULL,
+ * and start with base_dir otherwise; absolute patterns ignore base_dir.
+ * Callback invocations are serialized but arrive from worker threads in
+ * no particular order.
+ * 
+ * @param pattern The glob pattern to match against
+ * @param base_dir The base directory to start matching from (may be NULL)
+ * @param options Pattern matching options
+ * @param callback Function receiving each matched path
+ * @param user_data Passed through to the callback
+ * @return true if the walk ran (even if nothing matched), false on error
+ */
+bool nlink_match_pattern_stream(const char* pattern,
+                                const char* base_dir,
+                                nlink_pattern_options options,
+                                nlink_pattern_callback callback,
+                                void* user_data);
+
 /**
  * @brief Free pattern matching result
  * 
@@ -61,6 +99,8 @@ void nlink_pattern_result_free(nlink_pattern_result* result);
 /**
  * @brief Test if a string matches a glob pattern
  * 
+ * Uses the same per-component rules as nlink_match_pattern_stream.
+ * 
  * @param pattern The glob pattern to match
  * @param string The string to test
  * @param options Pattern matching options
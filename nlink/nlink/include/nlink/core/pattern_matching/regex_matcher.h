@@ -13,6 +13,16 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+/**
+ * Default memory limit of the lazy DFA cache of a compiled regex
+ */
+#define NLINK_REGEX_DEFAULT_DFA_MEMORY (1024 * 1024)
+
+/**
+ * Position of a capture group that took no part in the match
+ */
+#define NLINK_REGEX_UNSET ((size_t)-1)
+
 /**
  * Regular expression compilation options
  */
@@ -21,6 +31,7 @@ typedef struct nlink_regex_options {
     bool multiline;          // Multiline mode (^ and $ match line boundaries)
     bool dot_all;            // Dot matches all characters including newlines
     bool extended;           // Extended regular expression syntax
+    size_t max_dfa_memory;   // Lazy DFA cache limit in bytes (0 for the default)
 } nlink_regex_options;
 
 /**
@@ -31,13 +42,13 @@ typedef struct nlink_regex nlink_regex;
 /**
  * Regular expression match result
  */
-typedef struct nlink_regex_match {
+typedef struct nlink_regex_match_result {
     size_t start;            // Start position of match
     size_t end;              // End position of match
     size_t group_count;      // Number of capture groups
     size_t* group_starts;    // Array of group start positions
     size_t* group_ends;      // Array of group end positions
-} nlink_regex_match;
+} nlink_regex_match_result;
 
 /**
  * @brief Create default regular expression options
@@ -49,6 +60,14 @@ nlink_regex_options nlink_regex_default_options(void);
 /**
  * @brief Compile a regular expression pattern
  * 
+ * Supports literals, '.', bracket expressions with ranges and [:class:]
+ * names, the escapes \d \w \s (and their negations), \n \t \r \f \v
+ * and \xHH, groups, non-capturing (?:...) groups (extended syntax),
+ * alternation, the quantifiers * + ? {m} {m,} {m,n} and their lazy forms,
+ * and the anchors ^ and $. Basic syntax (extended == false) escapes the
+ * operators other than '*', as in \( \| \{m,n\}. Word boundaries and
+ * back-references are not supported.
+ * 
  * @param pattern The regex pattern to compile
  * @param options Compilation options
  * @return Compiled regex or NULL on error
@@ -65,19 +84,24 @@ void nlink_regex_free(nlink_regex* regex);
 /**
  * @brief Match a string against a regular expression
  * 
+ * Searches for the leftmost match; among matches starting there, greedy
+ * and lazy quantifiers choose as in Perl. Matching takes time linear in
+ * the length of the string. It is safe to match one regex from several
+ * threads at once.
+ * 
  * @param regex The compiled regex to match against
  * @param string The string to test
  * @param match Optional pointer to receive match details (can be NULL)
  * @return true if the string matches, false otherwise
  */
-bool nlink_regex_match(nlink_regex* regex, const char* string, nlink_regex_match* match);
+bool nlink_regex_match(nlink_regex* regex, const char* string, nlink_regex_match_result* match);
 
 /**
  * @brief Free regex match resources
  * 
  * @param match The match to free
  */
-void nlink_regex_match_free(nlink_regex_match* match);
+void nlink_regex_match_free(nlink_regex_match_result* match);
 
 /**
  * @brief Get a captured group from a match
@@ -87,7 +111,7 @@ void nlink_regex_match_free(nlink_regex_match* match);
  * @param group The group index (0 for the whole match)
  * @return Newly allocated string with the captured text or NULL
  */
-char* nlink_regex_get_group(const char* string, nlink_regex_match* match, size_t group);
+char* nlink_regex_get_group(const char* string, nlink_regex_match_result* match, size_t group);
 
 /**
  * @brief Escape special regex characters in a string
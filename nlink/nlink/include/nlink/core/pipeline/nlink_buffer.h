@@ -0,0 +1,117 @@
+/**
+ * @file nlink_buffer.h
+ * @brief Sized buffers and buffer pooling for NexusLink pipelines
+ * 
+ * Pipeline stages exchange NexusBuffer values that carry their length and
+ * capacity, so payloads are not limited to a fixed size. A NexusBufferPool
+ * keeps released buffers for reuse, which lets a pipeline run repeatedly
+ * without allocating once its buffers have grown to the working size.
+ * 
+ * Copyright © 2025 OBINexus Computing
+ */
+
+ #ifndef NLINK_BUFFER_H
+ #define NLINK_BUFFER_H
+ 
+ #include <stdbool.h>
+ #include <stddef.h>
+ #include "nlink/core/common/types.h"
+ 
+ #ifdef __cplusplus
+ extern "C" {
+ #endif
+ 
+ /**
+  * @brief Maximum number of idle buffers a pool retains
+  */
+ #define NEXUS_BUFFER_POOL_SLOTS 8
+ 
+ /**
+  * @brief Pool of reusable buffers
+  */
+ typedef struct NexusBufferPool {
+     NexusBuffer idle[NEXUS_BUFFER_POOL_SLOTS]; /**< Buffers available for reuse */
+     size_t idle_count;            /**< Number of idle buffers */
+     size_t allocations;           /**< Allocations and reallocations performed */
+     size_t reuses;                /**< Acquisitions served without allocating */
+ } NexusBufferPool;
+ 
+ /**
+  * @brief Ensure a buffer can hold at least the given number of bytes
+  * 
+  * Existing contents are preserved. Capacity grows geometrically.
+  * 
+  * @param buffer Buffer to grow
+  * @param capacity Required capacity in bytes
+  * @return NexusResult Result code
+  */
+ NexusResult nexus_buffer_reserve(NexusBuffer* buffer, size_t capacity);
+ 
+ /**
+  * @brief Replace the contents of a buffer with a copy of some bytes
+  * 
+  * @param buffer Target buffer
+  * @param data Bytes to copy
+  * @param size Number of bytes
+  * @return NexusResult Result code
+  */
+ NexusResult nexus_buffer_assign(NexusBuffer* buffer, const void* data, size_t size);
+ 
+ /**
+  * @brief Exchange the storage of two buffers without copying
+  * 
+  * @param a First buffer
+  * @param b Second buffer
+  */
+ void nexus_buffer_swap(NexusBuffer* a, NexusBuffer* b);
+ 
+ /**
+  * @brief Release the storage of a buffer
+  * 
+  * @param buffer Buffer to release
+  */
+ void nexus_buffer_free(NexusBuffer* buffer);
+ 
+ /**
+  * @brief Initialize an empty buffer pool
+  * 
+  * @param pool Pool to initialize
+  */
+ void nexus_buffer_pool_init(NexusBufferPool* pool);
+ 
+ /**
+  * @brief Take a buffer of at least the given capacity from a pool
+  * 
+  * The smallest idle buffer that is large enough is preferred; otherwise the
+  * largest idle buffer is grown, and a new buffer is allocated only when the
+  * pool is empty. The returned buffer has size 0.
+  * 
+  * @param pool Pool to take from
+  * @param capacity Required capacity in bytes
+  * @param buffer Receives the buffer
+  * @return NexusResult Result code
+  */
+ NexusResult nexus_buffer_pool_acquire(NexusBufferPool* pool, size_t capacity, NexusBuffer* buffer);
+ 
+ /**
+  * @brief Return a buffer to a pool
+  * 
+  * The buffer is emptied. If the pool is full its storage is freed.
+  * 
+  * @param pool Pool to return to
+  * @param buffer Buffer to return
+  */
+ void nexus_buffer_pool_release(NexusBufferPool* pool, NexusBuffer* buffer);
+ 
+ /**
+  * @brief Free every idle buffer of a pool
+  * 
+  * @param pool Pool to clean up
+  */
+ void nexus_buffer_pool_cleanup(NexusBufferPool* pool);
+ 
+ #ifdef __cplusplus
+ }
+ #endif
+ 
+ #endif /* NLINK_BUFFER_H */
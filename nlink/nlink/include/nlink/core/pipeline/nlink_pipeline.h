@@ -14,6 +14,7 @@
  #include <stdbool.h>
  #include "nlink/core/common/nexus_core.h"
  #include "nlink/core/common/result.h"
+ #include "nlink/core/pipeline/nlink_buffer.h"
  
  #ifdef __cplusplus
  extern "C" {
@@ -31,6 +32,23 @@
  * @brief Pipeline stage function prototype
  */
 typedef NexusResult (*NlinkPipelineStageFunc)(void* input, void* output, void* user_data);
+
+/**
+ * @brief Sized pipeline stage function prototype
+ *
+ * The stage reads input->size bytes and writes its result to output,
+ * growing it with nexus_buffer_reserve if needed and setting output->size.
+ * The output buffer is handed to the next stage as its input without
+ * copying.
+ */
+typedef NexusResult (*NlinkPipelineBufferStageFunc)(const NexusBuffer* input,
+                                                    NexusBuffer* output,
+                                                    void* user_data);
+ 
+ /**
+  * @brief Default payload size assumed for stages without a size contract
+  */
+ #define NLINK_PIPELINE_DEFAULT_BUFFER_SIZE 1024
  
  /**
   * @brief Pipeline configuration
@@ -41,6 +59,7 @@ typedef NexusResult (*NlinkPipelineStageFunc)(void* input, void* output, void* u
      bool enable_caching;          /**< Enable result caching between stages */
      unsigned max_iterations;      /**< Maximum iterations for multi-pass mode */
      const char* schema_path;      /**< Path to pipeline schema definition */
+     size_t buffer_size;           /**< Payload size for unsized (void*) stages and nlink_pipeline_execute */
  } NlinkPipelineConfig;
  
 /**
@@ -48,7 +67,9 @@ typedef NexusResult (*NlinkPipelineStageFunc)(void* input, void* output, void* u
  */
 typedef struct NlinkPipelineStage {
     char* name;                     /**< Stage name */
-    NlinkPipelineStageFunc func;    /**< Stage function */
+    NlinkPipelineStageFunc func;    /**< Stage function (unsized stages) */
+    NlinkPipelineBufferStageFunc buffer_func; /**< Stage function (sized stages) */
+    size_t output_size_hint;        /**< Expected output size, reserved before the stage runs */
     void* user_data;                /**< User data for stage function */
     struct NlinkPipelineStage* next; /**< Next stage in the pipeline */
 } NlinkPipelineStage;
@@ -63,6 +84,7 @@ struct NlinkPipeline {
     NlinkPipelineStage* last_stage;  /**< Last stage in the pipeline */
     unsigned stage_count;           /**< Number of stages */
     NexusContext* ctx;              /**< NexusLink context */
+    NexusBufferPool pool;           /**< Intermediate buffers reused across executions */
     
     /* Statistics for last execution */
     unsigned last_iterations;       /**< Number of iterations in last execution */
@@ -103,9 +125,28 @@ struct NlinkPipeline {
                                      NlinkPipelineStageFunc func,
                                      void* user_data);
  
+ /**
+  * @brief Add a sized stage to the pipeline
+  * 
+  * @param pipeline Target pipeline
+  * @param name Stage name
+  * @param func Stage function
+  * @param output_size_hint Expected output size in bytes (0 for the input size)
+  * @param user_data User data passed to the stage function
+  * @return NexusResult Result code
+  */
+ NexusResult nlink_pipeline_add_buffer_stage(NlinkPipeline* pipeline,
+                                            const char* name,
+                                            NlinkPipelineBufferStageFunc func,
+                                            size_t output_size_hint,
+                                            void* user_data);
+ 
  /**
   * @brief Execute the pipeline with the given input and output
   * 
+  * Input and output are treated as config.buffer_size bytes long. Use
+  * nlink_pipeline_execute_buffer for payloads of arbitrary size.
+  * 
   * @param pipeline Pipeline to execute
   * @param input Input data
   * @param output Output data
@@ -113,6 +154,23 @@ struct NlinkPipeline {
   */
  NexusResult nlink_pipeline_execute(NlinkPipeline* pipeline, void* input, void* output);
  
+ /**
+  * @brief Execute the pipeline on a sized buffer
+  * 
+  * The input is read in place. The final stage's buffer is handed to the
+  * caller by swapping it into output; whatever storage output held before
+  * is taken over by the pipeline's buffer pool, so output->data must be
+  * NULL or heap-allocated. Release it with nexus_buffer_free.
+  * 
+  * @param pipeline Pipeline to execute
+  * @param input Input buffer
+  * @param output Receives the result
+  * @return NexusResult Result code
+  */
+ NexusResult nlink_pipeline_execute_buffer(NlinkPipeline* pipeline,
+                                          const NexusBuffer* input,
+                                          NexusBuffer* output);
+ 
  /**
   * @brief Get the actual mode used by the pipeline
   * 
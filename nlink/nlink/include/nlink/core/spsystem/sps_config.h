@@ -19,6 +19,15 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Pipeline execution mode
+ */
+typedef enum NexusPipelineExecutionMode {
+    NEXUS_PIPELINE_EXECUTE_SEQUENTIAL = 0,  /**< Each component runs over the whole input in turn */
+    NEXUS_PIPELINE_EXECUTE_STREAMING,       /**< Chunks pushed through the chain on the calling thread */
+    NEXUS_PIPELINE_EXECUTE_THREADED         /**< One worker per component, linked by bounded queues */
+} NexusPipelineExecutionMode;
+
 /**
  * @brief Pipeline component configuration
  */
@@ -27,6 +36,8 @@ typedef struct NexusPipelineComponentConfig {
     const char* version_constraint;    /**< Version constraint */
     void* component_config;            /**< Component-specific configuration */
     bool optional;                     /**< Whether this component is optional */
+    const char** dependencies;         /**< Identifiers of components this one depends on */
+    size_t dependency_count;           /**< Number of dependencies */
 } NexusPipelineComponentConfig;
 
 /**
@@ -40,6 +51,11 @@ typedef struct NexusPipelineConfig {
     const char* input_format;                              /**< Input data format */
     const char* output_format;                             /**< Output data format */
     bool allow_partial_processing;                         /**< Allow partial pipeline execution */
+    bool size_streams_from_high_water;                     /**< Size pooled intermediate streams from observed peaks */
+    NexusPipelineExecutionMode execution_mode;             /**< How sps_pipeline_execute runs the components */
+    size_t chunk_size;                                     /**< Chunk size for streaming and threaded modes (0 for default) */
+    size_t queue_depth;                                    /**< Chunks in flight between threaded stages (0 for default) */
+    size_t init_threads;                                   /**< Threads for initializing and terminating a dependency level (0 for one per CPU) */
     void* (*component_config_creator)(const char* json);   /**< Function to create component config from JSON */
     void (*component_config_destructor)(void* config);     /**< Function to destroy component config */
 } NexusPipelineConfig;
@@ -15,6 +15,7 @@
 #include "nlink/core/common/result.h"
 #include "nlink/spsystem/sps_config.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,11 +35,25 @@ typedef struct NexusDependencyNode {
 
 /**
  * @brief Dependency graph for components
+ *
+ * Component identifiers are interned once when the graph is built: every
+ * dependency is resolved to a node index, and the edges are kept in
+ * compressed sparse row form in both directions. Ordering, cycle detection
+ * and missing-dependency reports then run in O(V + E) without comparing
+ * strings.
  */
 typedef struct NexusDependencyGraph {
     NexusDependencyNode** nodes;         /**< Array of dependency nodes */
     size_t node_count;                   /**< Number of nodes */
     const NexusPipelineConfig* config;   /**< Reference to pipeline configuration */
+    
+    size_t* id_slots;                    /**< Open-addressed identifier index: node index + 1, 0 if empty */
+    size_t id_mask;                      /**< Slot count - 1 */
+    size_t* edge_start;                  /**< Dependencies of node i: edge_targets[edge_start[i] .. edge_start[i + 1]] */
+    size_t* edge_targets;                /**< Node index of each dependency, SIZE_MAX if it names no node */
+    size_t* dependent_start;             /**< Dependents of node i: dependents[dependent_start[i] .. dependent_start[i + 1]] */
+    size_t* dependents;                  /**< Node index of each dependent */
+    size_t missing_count;                /**< Dependencies that name no node */
 } NexusDependencyGraph;
 
 /**
@@ -54,6 +69,9 @@ typedef struct NexusMissingDependency {
 /**
  * @brief Create a dependency graph from component metadata
  *
+ * Components declare dependencies in their configuration. When none of
+ * them does, each component depends on the one before it.
+ *
  * @param ctx NexusLink context
  * @param config Pipeline configuration
  * @return NexusDependencyGraph* New dependency graph or NULL on failure
@@ -61,9 +79,23 @@ typedef struct NexusMissingDependency {
 NexusDependencyGraph* sps_create_dependency_graph(NexusContext* ctx, 
                                                  const NexusPipelineConfig* config);
 
+/**
+ * @brief Find a node by component identifier
+ *
+ * @param graph Dependency graph
+ * @param component_id Component identifier
+ * @return size_t Node index, or SIZE_MAX if no component has the identifier
+ */
+size_t sps_find_dependency_node(const NexusDependencyGraph* graph, const char* component_id);
+
 /**
  * @brief Resolve dependencies and provide ordered loading sequence
  *
+ * Dependencies come before their dependents. Components whose dependencies
+ * are satisfied at the same time are placed in configuration order. On a
+ * cycle the members of one cycle are logged and NEXUS_DEPENDENCY_ERROR is
+ * returned.
+ *
  * @param ctx NexusLink context
  * @param graph Dependency graph
  * @param ordered_components Output parameter for ordered component IDs
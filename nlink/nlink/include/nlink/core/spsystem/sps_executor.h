@@ -0,0 +1,65 @@
+/**
+ * @file sps_executor.h
+ * @brief Thread-per-stage executor for single-pass pipelines
+ *
+ * Runs every pipeline component on its own worker thread. Neighbouring
+ * stages are linked by bounded lock-free single-producer/single-consumer
+ * rings of chunks, so throughput approaches that of the slowest stage
+ * rather than the sum of all stages.
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#ifndef NLINK_SPS_EXECUTOR_H
+#define NLINK_SPS_EXECUTOR_H
+
+#include "nlink/core/common/nexus_core.h"
+#include "nlink/core/common/result.h"
+#include "nlink/spsystem/sps_pipeline.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Default number of chunks in flight between two stages
+ */
+#define SPS_EXECUTOR_DEFAULT_QUEUE_DEPTH 4
+
+/**
+ * @brief Execute the pipeline with one worker thread per component
+ *
+ * The calling thread slices the input into chunks and feeds the first
+ * stage. Each link holds at most queue_depth chunk buffers; a stage whose
+ * successor falls behind blocks until a buffer is returned. A stage's
+ * output for one chunk is forwarded in chunk_size slices, so every stage
+ * processes chunk_size pieces as in streaming execution and memory stays
+ * near chunk_size x queue_depth per link. A component that gathers its
+ * input still holds its whole output in one buffer until it is consumed.
+ * The last stage appends to the output stream and calls the pipeline's
+ * chunk handler from its worker thread.
+ *
+ * Per-stage busy, idle and backpressure times are accumulated in each
+ * NexusPipelineComponent.
+ *
+ * @param ctx NexusLink context
+ * @param pipeline Pipeline to execute
+ * @param input Input data stream, read from its current position
+ * @param output Output data stream
+ * @param chunk_size Chunk size in bytes (0 for the default)
+ * @param queue_depth Chunks in flight per link (0 for the default)
+ * @return NexusResult Operation result
+ */
+NexusResult sps_pipeline_execute_threaded(NexusContext* ctx,
+                                         NexusPipeline* pipeline,
+                                         NexusDataStream* input,
+                                         NexusDataStream* output,
+                                         size_t chunk_size,
+                                         size_t queue_depth);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NLINK_SPS_EXECUTOR_H */
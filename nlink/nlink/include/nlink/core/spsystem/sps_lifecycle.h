@@ -36,6 +36,20 @@ typedef NexusResult (*NexusComponentInitFunc)(NexusPipelineComponent* component,
  */
 typedef NexusResult (*NexusComponentTermFunc)(NexusPipelineComponent* component, void* user_data);
 
+/**
+ * @brief Component chunk processing function
+ *
+ * Called once per chunk in streaming execution and a last time with
+ * final set and no data, so the component can flush buffered state.
+ * Output is appended to the output stream.
+ */
+typedef NexusResult (*NexusComponentChunkFunc)(NexusPipelineComponent* component,
+                                              const void* chunk,
+                                              size_t size,
+                                              bool final,
+                                              NexusDataStream* output,
+                                              void* user_data);
+
 /**
  * @brief Component lifecycle hooks
  */
@@ -44,6 +58,7 @@ typedef struct NexusComponentLifecycle {
     NexusComponentTermFunc term_func;     /**< Termination hook */
     NexusComponentTermFunc abort_func;    /**< Abort hook */
     void* user_data;                      /**< User-defined data */
+    NexusComponentChunkFunc chunk_func;   /**< Streaming chunk hook (optional) */
 } NexusComponentLifecycle;
 
 /**
@@ -81,6 +96,28 @@ NexusResult sps_component_execute(NexusContext* ctx,
                                  NexusDataStream* input,
                                  NexusDataStream* output);
 
+/**
+ * @brief Call chunk execution hook for a component
+ *
+ * Components with a chunk hook process each chunk as it arrives.
+ * Components without one gather their input and run their process
+ * function once on the final call.
+ *
+ * @param ctx NexusLink context
+ * @param component Component to execute
+ * @param chunk Chunk data (may be NULL when size is 0)
+ * @param size Chunk size in bytes
+ * @param final Whether this is the end-of-input call
+ * @param output Output data stream
+ * @return NexusResult Operation result
+ */
+NexusResult sps_component_execute_chunk(NexusContext* ctx,
+                                       NexusPipelineComponent* component,
+                                       const void* chunk,
+                                       size_t size,
+                                       bool final,
+                                       NexusDataStream* output);
+
 /**
  * @brief Call termination hook for a component
  *
@@ -27,6 +27,11 @@ extern "C" {
 typedef struct NexusPipeline NexusPipeline;
 typedef struct NexusPipelineComponent NexusPipelineComponent;
 
+/**
+ * @brief Default chunk size for streaming execution
+ */
+#define SPS_PIPELINE_DEFAULT_CHUNK_SIZE 65536
+
 /**
  * @brief Component processing function
  */
@@ -42,6 +47,17 @@ typedef void (*NexusPipelineErrorHandler)(NexusPipeline* pipeline,
                                          const char* component_id,
                                          const char* message);
 
+/**
+ * @brief Pipeline output chunk handler
+ *
+ * Called during streaming execution with the bytes the last component
+ * appended to the output stream for one chunk.
+ */
+typedef void (*NexusPipelineChunkHandler)(NexusPipeline* pipeline,
+                                         const void* data,
+                                         size_t size,
+                                         void* user_data);
+
 /**
  * @brief Pipeline component structure
  */
@@ -53,8 +69,38 @@ struct NexusPipelineComponent {
     NexusResult last_result;             /**< Last execution result */
     bool is_initialized;                 /**< Whether component is initialized */
     double last_execution_time_ms;       /**< Last execution time in milliseconds */
+    NexusDataStream* chunk_buffer;       /**< Input gathered for components without a chunk hook */
+    double busy_time_ms;                 /**< Threaded execution: time spent processing chunks */
+    double idle_time_ms;                 /**< Threaded execution: time spent waiting for input */
+    double backpressure_time_ms;         /**< Threaded execution: time spent waiting for output space */
+    size_t init_level;                   /**< Dependency level; lower levels are initialized first */
+    double init_time_ms;                 /**< Time spent in the last initialization */
+    NexusPipelineComponentConfig* config; /**< Configuration entry, NULL for components added later */
 };
 
+/**
+ * @brief Pipeline execution statistics
+ */
+typedef struct NexusPipelineStats {
+    size_t executions;                   /**< Number of pipeline executions */
+    size_t stream_allocations;           /**< Intermediate streams created */
+    size_t stream_reuses;                /**< Intermediate streams reused from the pool */
+    size_t stream_growths;               /**< Intermediate stream buffers grown during execution */
+    size_t high_water_size;              /**< Largest intermediate stream size observed */
+    size_t chunks;                       /**< Input chunks pushed in streaming execution */
+    size_t init_levels;                  /**< Dependency levels in the last initialization */
+    double init_time_ms;                 /**< Wall time of the last initialization */
+} NexusPipelineStats;
+
+/**
+ * @brief Pooled intermediate stream between two components
+ */
+typedef struct NexusPipelineStreamSlot {
+    NexusDataStream* stream;             /**< Pooled stream or NULL if released */
+    size_t capacity;                     /**< Stream capacity before the current execution */
+    size_t high_water;                   /**< Peak size observed for this slot */
+} NexusPipelineStreamSlot;
+
 /**
  * @brief Pipeline structure
  */
@@ -65,7 +111,11 @@ struct NexusPipeline {
     size_t component_count;              /**< Number of components */
     bool is_initialized;                 /**< Whether pipeline is initialized */
     NexusPipelineErrorHandler error_handler; /**< Error handler function */
+    NexusPipelineChunkHandler chunk_handler; /**< Streaming output handler */
     void* user_data;                     /**< User-defined data */
+    NexusPipelineStreamSlot* stream_slots; /**< Intermediate streams kept between executions */
+    size_t stream_slot_count;            /**< Number of stream slots */
+    NexusPipelineStats stats;            /**< Execution statistics */
 };
 
 /**
@@ -80,6 +130,12 @@ NexusPipeline* sps_pipeline_create(NexusContext* ctx, NexusPipelineConfig* confi
 /**
  * @brief Initialize all components in the pipeline
  *
+ * Components are grouped into levels by their dependencies. The
+ * components of one level are initialized concurrently on up to
+ * config->init_threads threads, and a level starts only after the one
+ * before it has finished. The time each component spends initializing is
+ * recorded in its init_time_ms.
+ *
  * @param ctx NexusLink context
  * @param pipeline Pipeline to initialize
  * @return NexusResult Operation result
@@ -100,9 +156,34 @@ NexusResult sps_pipeline_execute(NexusContext* ctx,
                                 NexusDataStream* input, 
                                 NexusDataStream* output);
 
+/**
+ * @brief Execute the pipeline by pushing fixed-size chunks through it
+ *
+ * Each chunk of the input runs through the whole component chain before
+ * the next one is read, so intermediate streams hold at most one chunk's
+ * worth of data per component and output starts arriving after the first
+ * chunk. Components that register no chunk hook gather their input and
+ * process it on the final call.
+ *
+ * @param ctx NexusLink context
+ * @param pipeline Pipeline to execute
+ * @param input Input data stream, read from its current position
+ * @param output Output data stream
+ * @param chunk_size Chunk size in bytes (0 for the default)
+ * @return NexusResult Operation result
+ */
+NexusResult sps_pipeline_execute_streaming(NexusContext* ctx,
+                                          NexusPipeline* pipeline,
+                                          NexusDataStream* input,
+                                          NexusDataStream* output,
+                                          size_t chunk_size);
+
 /**
  * @brief Clean up pipeline resources
  *
+ * Initialized components are terminated level by level in reverse, so a
+ * component is terminated before the components it depends on.
+ *
  * @param ctx NexusLink context
  * @param pipeline Pipeline to destroy
  */
@@ -143,6 +224,25 @@ NexusResult sps_pipeline_remove_component(NexusContext* ctx,
                                          NexusPipeline* pipeline, 
                                          const char* component_id);
 
+/**
+ * @brief Get pipeline execution statistics
+ *
+ * @param pipeline Pipeline to query
+ * @param stats Receives the statistics
+ * @return NexusResult Operation result
+ */
+NexusResult sps_pipeline_get_stats(const NexusPipeline* pipeline, NexusPipelineStats* stats);
+
+/**
+ * @brief Release the pooled intermediate streams of a pipeline
+ *
+ * The pool is rebuilt on the next execution. Statistics and high-water
+ * marks are kept, so high-water sizing still applies to the new streams.
+ *
+ * @param pipeline Pipeline to trim
+ */
+void sps_pipeline_release_streams(NexusPipeline* pipeline);
+
 /**
  * @brief Set pipeline-level error handler
  *
@@ -151,6 +251,16 @@ NexusResult sps_pipeline_remove_component(NexusContext* ctx,
  */
 void sps_pipeline_set_error_handler(NexusPipeline* pipeline, NexusPipelineErrorHandler handler);
 
+/**
+ * @brief Set the output handler for streaming execution
+ *
+ * The handler receives pipeline->user_data.
+ *
+ * @param pipeline Pipeline to modify
+ * @param handler Chunk handler function (NULL to disable)
+ */
+void sps_pipeline_set_chunk_handler(NexusPipeline* pipeline, NexusPipelineChunkHandler handler);
+
 #ifdef __cplusplus
 }
 #endif
@@ -126,6 +126,9 @@ void sps_stream_clear(NexusDataStream* stream);
 /**
  * @brief Reset a stream to initial state
  *
+ * Empties the stream and releases its metadata. The buffer and format
+ * are kept so the stream can be reused.
+ *
  * @param stream Stream to reset
  */
 void sps_stream_reset(NexusDataStream* stream);
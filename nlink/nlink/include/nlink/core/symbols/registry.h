@@ -35,6 +35,7 @@
      NexusSymbolType type;    /**< Symbol type */
      char* component_id;      /**< ID of the component that provides this symbol */
      int ref_count;           /**< Reference count for usage tracking */
+     uint32_t hash;           /**< Precomputed name hash used by the table index */
  };
  
  /**
@@ -46,6 +47,8 @@
      NexusSymbol* symbols;    /**< Array of symbols */
      size_t capacity;         /**< Capacity of the symbols array */
      size_t size;             /**< Number of symbols in the table */
+     NexusSymbolIndexSlot* index; /**< Open-addressing hash index into the symbols array */
+     size_t index_capacity;   /**< Number of index slots (power of two) */
  };
  
  /**
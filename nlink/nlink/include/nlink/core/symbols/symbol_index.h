@@ -0,0 +1,93 @@
+/**
+ * @file symbol_index.h
+ * @brief Hash index for NexusLink symbol tables
+ *
+ * Each NexusSymbolTable keeps its symbols in a dense array. This module
+ * maintains an open-addressing (linear probing) index alongside that array
+ * so lookups by name are O(1) on average instead of a linear strcmp scan.
+ * Name hashes are computed once and cached in both the symbol and its slot,
+ * so a probe only touches the symbol string when the hashes already match.
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+ #ifndef NEXUS_SYMBOL_INDEX_H
+ #define NEXUS_SYMBOL_INDEX_H
+
+ #include "nlink/core/common/types.h"
+ #include <stddef.h>
+ #include <stdint.h>
+
+ #ifdef __cplusplus
+ extern "C" {
+ #endif
+
+ /**
+  * @brief Compute the hash of a symbol name (32-bit FNV-1a)
+  *
+  * @param name Symbol name
+  * @return uint32_t Name hash
+  */
+ uint32_t nexus_symbol_hash(const char* name);
+
+ /**
+  * @brief Index the symbol stored at a position of the symbols array
+  *
+  * The symbol's hash field must already be set. The index grows as needed
+  * to keep the load factor at or below one half.
+  *
+  * @param table Table owning the symbol
+  * @param position Position of the symbol in table->symbols
+  * @return NexusResult Operation result
+  */
+ NexusResult nexus_symbol_index_insert(NexusSymbolTable* table, size_t position);
+
+ /**
+  * @brief Find a symbol using a precomputed name hash
+  *
+  * @param table Table to search
+  * @param name Symbol name
+  * @param hash Result of nexus_symbol_hash(name)
+  * @return NexusSymbol* Found symbol or NULL
+  */
+ NexusSymbol* nexus_symbol_index_find(const NexusSymbolTable* table,
+                                     const char* name,
+                                     uint32_t hash);
+
+ /**
+  * @brief Drop the index slot referring to a position of the symbols array
+  *
+  * @param table Table owning the symbol
+  * @param position Position of the symbol being removed
+  */
+ void nexus_symbol_index_remove(NexusSymbolTable* table, size_t position);
+
+ /**
+  * @brief Repoint the slot of a symbol that moved within the symbols array
+  *
+  * @param table Table owning the symbol
+  * @param from Previous position of the symbol
+  * @param to New position of the symbol
+  */
+ void nexus_symbol_index_relocate(NexusSymbolTable* table, size_t from, size_t to);
+
+ /**
+  * @brief Rebuild the index from the current symbols array
+  *
+  * @param table Table to reindex
+  * @return NexusResult Operation result
+  */
+ NexusResult nexus_symbol_index_rebuild(NexusSymbolTable* table);
+
+ /**
+  * @brief Release the index of a table
+  *
+  * @param table Table whose index is released
+  */
+ void nexus_symbol_index_free(NexusSymbolTable* table);
+
+ #ifdef __cplusplus
+ }
+ #endif
+
+ #endif /* NEXUS_SYMBOL_INDEX_H */
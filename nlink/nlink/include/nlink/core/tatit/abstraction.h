@@ -140,6 +140,80 @@ bool nlink_all(void** items, size_t count, nlink_filter_fn predicate, void* cont
  */
 void** nlink_clone_array(void** items, size_t count);
 
+/**
+ * Parallel variants
+ *
+ * These split the array into chunks and run them on the shared pool from
+ * parallel.h. Callbacks may be called concurrently for different items,
+ * so they must be thread-safe. Small arrays are processed on the calling
+ * thread.
+ */
+
+/**
+ * @brief Map a function over an array of items in parallel
+ *
+ * Same contract as nlink_map.
+ *
+ * @param items Array of input items
+ * @param count Number of items
+ * @param map_func Function to apply to each item
+ * @param context Optional context passed to the mapping function
+ * @param result_size Pointer to receive the size of the result array
+ * @return Newly allocated array with mapped results, or NULL on failure
+ */
+void** nlink_parallel_map(void** items, size_t count, nlink_map_fn map_func,
+                         void* context, size_t* result_size);
+
+/**
+ * @brief Filter an array using a predicate function in parallel
+ *
+ * Same contract as nlink_filter; matching items keep their order. Each
+ * chunk counts its matches, and a prefix sum over the counts gives every
+ * chunk its offset in the result.
+ *
+ * @param items Array of input items
+ * @param count Number of items
+ * @param filter_func Predicate function
+ * @param context Optional context passed to the predicate
+ * @param result_size Pointer to receive the size of the result array
+ * @return Newly allocated array with filtered results, or NULL on failure
+ */
+void** nlink_parallel_filter(void** items, size_t count, nlink_filter_fn filter_func,
+                            void* context, size_t* result_size);
+
+/**
+ * @brief Fold (reduce) an array to a single value in parallel
+ *
+ * Each chunk is folded from identity, and the partial results are then
+ * combined pairwise in a tree. The fold must be associative and identity
+ * must be neutral for the result to match nlink_fold; the order of items
+ * is preserved, so the fold need not be commutative.
+ *
+ * @param items Array of input items
+ * @param count Number of items
+ * @param identity Neutral accumulator value each chunk starts from
+ * @param fold_func Function to combine accumulator with each item
+ * @param combine_func Function to combine two partial results (NULL = fold_func)
+ * @param context Optional context passed to the fold and combine functions
+ * @return Final accumulator value, or identity if there are no items
+ */
+void* nlink_parallel_fold(void** items, size_t count, void* identity,
+                         nlink_fold_fn fold_func, nlink_fold_fn combine_func, void* context);
+
+/**
+ * @brief Sort an array using a comparison function in parallel
+ *
+ * Sorts chunks concurrently, then merges runs pairwise. Each merge is
+ * split into independent output ranges, so the final merges use every
+ * thread as well. Like nlink_sort, the sort is not stable.
+ *
+ * @param items Array of items to sort (modified in place)
+ * @param count Number of items
+ * @param compare Comparison function
+ * @param context Optional context passed to the comparison function
+ */
+void nlink_parallel_sort(void** items, size_t count, nlink_compare_fn compare, void* context);
+
 /**
  * Abstraction macros for common operations
  */
@@ -165,6 +165,32 @@ void** nlink_combine_arrays(void*** arrays, size_t array_count, size_t* result_c
  */
 nlink_aggregation_result* nlink_numerical_summary(void** values, size_t count);
 
+/**
+ * @brief Create a numerical summary of a contiguous array of doubles
+ *
+ * Like nlink_numerical_summary, but reads the values directly instead of
+ * through pointers, so the loop can be vectorized. Values are summed in
+ * several interleaved lanes, which may change the last bits of the sum.
+ *
+ * @param values Array of values
+ * @param count Number of values
+ * @return Aggregation result with numeric statistics (min, max and average point to doubles)
+ */
+nlink_aggregation_result* nlink_numerical_summary_double(const double* values, size_t count);
+
+/**
+ * @brief Create a numerical summary of a contiguous array of 64-bit integers
+ *
+ * The sum is computed exactly in 64-bit arithmetic and wraps around if
+ * it overflows.
+ *
+ * @param values Array of values
+ * @param count Number of values
+ * @return Aggregation result with numeric statistics (min and max point to
+ *         int64_t values, average to a double)
+ */
+nlink_aggregation_result* nlink_numerical_summary_int64(const int64_t* values, size_t count);
+
 /**
  * Macro for simple aggregation operations
  */
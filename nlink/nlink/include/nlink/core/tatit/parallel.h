@@ -0,0 +1,76 @@
+/**
+ * @file parallel.h
+ * @brief Shared parallel execution backend for NexusLink tactics
+ * @copyright Copyright © 2025 OBINexus Computing
+ *
+ * This module runs chunked loops on a process-wide pool of worker
+ * threads. The pool is created on first use and the calling thread
+ * always takes part in the work. Tactics such as nlink_parallel_map
+ * and nlink_parallel_sort are built on nlink_parallel_for.
+ */
+
+#ifndef NLINK_TACTIC_PARALLEL_H
+#define NLINK_TACTIC_PARALLEL_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * Function pointer type for a chunk of a parallel loop
+ *
+ * Processes the items in [begin, end). Chunks are numbered from zero in
+ * item order, so per-chunk results can be combined in order afterwards.
+ */
+typedef void (*nlink_parallel_chunk_fn)(size_t begin, size_t end, size_t chunk, void* context);
+
+/**
+ * @brief Number of chunks nlink_parallel_for splits a loop into
+ *
+ * @param count Number of items
+ * @param grain Items per chunk (0 is treated as 1)
+ * @return Number of chunks, the last of which may be shorter
+ */
+size_t nlink_parallel_chunk_count(size_t count, size_t grain);
+
+/**
+ * @brief Run a chunked loop on the shared pool
+ *
+ * Splits [0, count) into chunks of grain items and calls chunk_fn once
+ * per chunk, concurrently and in no particular order. Returns once every
+ * chunk has completed. Loops with a single chunk, and loops started
+ * while the pool is busy (for example from inside another chunk), run
+ * on the calling thread alone.
+ *
+ * @param count Number of items
+ * @param grain Items per chunk (0 is treated as 1)
+ * @param chunk_fn Function to call for each chunk
+ * @param context Context passed to chunk_fn
+ */
+void nlink_parallel_for(size_t count, size_t grain, nlink_parallel_chunk_fn chunk_fn, void* context);
+
+/**
+ * @brief Set the number of threads used by the shared pool
+ *
+ * The count includes the calling thread. Takes effect on the next
+ * parallel loop; a running pool is stopped first, so this must not be
+ * called from inside a chunk.
+ *
+ * @param thread_count Thread count (0 = one per online CPU)
+ */
+void nlink_parallel_set_threads(size_t thread_count);
+
+/**
+ * @brief Get the number of threads used by the shared pool
+ *
+ * @return Thread count including the calling thread
+ */
+size_t nlink_parallel_get_threads(void);
+
+/**
+ * @brief Stop and join the pool's worker threads
+ *
+ * A later parallel loop starts the pool again.
+ */
+void nlink_parallel_shutdown(void);
+
+#endif /* NLINK_TACTIC_PARALLEL_H */
@@ -10,6 +10,7 @@
  * - Transformation: Applying change operations to structures
  * - Traversal: Systematically navigating through data structures
  * - Identity: Providing baseline operations that maintain state
+ * - Parallel: Running tactics in chunks on a shared thread pool
  */
 
 #ifndef NLINK_TACTIC_H
@@ -212,4 +212,133 @@ bool nlink_traversal_visited(nlink_traversal_result* result, void* node);
  */
 void* nlink_traversal_get_result(nlink_traversal_result* result, void* node);
 
+/**
+ * Parallel traversal
+ *
+ * The traversals below run on the shared thread pool of parallel.h.
+ * Visitor, child, count, control and id functions may be called
+ * concurrently for different nodes, so they must be thread-safe. Each
+ * worker collects its results in its own buffers, which are merged into
+ * the returned result.
+ */
+
+/**
+ * Function pointer type returning a dense node identifier below node_count
+ */
+typedef size_t (*nlink_node_id_fn)(void* node, void* context);
+
+/**
+ * Parallel traversal configuration structure
+ */
+typedef struct nlink_parallel_traversal_config {
+    nlink_visitor_fn visitor;             // Function to apply to each node
+    nlink_node_getter_fn get_child;       // Function to get a child or adjacent node
+    nlink_child_count_fn get_child_count; // Function to get child or adjacent count
+    nlink_traversal_control_fn should_traverse; // Function to determine if a node is visited and expanded
+    nlink_node_id_fn get_id;              // Dense node identifier, required for graphs
+    size_t node_count;                    // Upper bound on node identifiers
+    size_t max_threads;                   // Threads including the caller (0 = the whole shared pool)
+    void* context;                        // Context for traversal functions
+    bool collect_results;                 // Whether to collect visitor results
+} nlink_parallel_traversal_config;
+
+/**
+ * @brief Create a new parallel traversal configuration
+ *
+ * @param visitor Visitor function to apply to each node
+ * @param get_child Function to get a child or adjacent node
+ * @param get_child_count Function to get the number of children or adjacent nodes
+ * @param context Context for traversal functions
+ * @return New parallel traversal configuration
+ */
+nlink_parallel_traversal_config* nlink_parallel_traversal_config_create(
+    nlink_visitor_fn visitor,
+    nlink_node_getter_fn get_child,
+    nlink_child_count_fn get_child_count,
+    void* context
+);
+
+/**
+ * @brief Set the dense node identifiers used to track visited graph nodes
+ *
+ * @param config Parallel traversal configuration
+ * @param get_id Function returning an identifier below node_count for each node
+ * @param node_count Upper bound on node identifiers
+ */
+void nlink_parallel_traversal_config_set_ids(
+    nlink_parallel_traversal_config* config,
+    nlink_node_id_fn get_id,
+    size_t node_count
+);
+
+/**
+ * @brief Set the number of threads, including the calling thread
+ *
+ * The count is capped by the shared pool; see nlink_parallel_set_threads.
+ *
+ * @param config Parallel traversal configuration
+ * @param max_threads Thread count (0 = the whole shared pool)
+ */
+void nlink_parallel_traversal_config_set_threads(
+    nlink_parallel_traversal_config* config,
+    size_t max_threads
+);
+
+/**
+ * @brief Free parallel traversal configuration
+ *
+ * @param config Configuration to free
+ */
+void nlink_parallel_traversal_config_free(nlink_parallel_traversal_config* config);
+
+/**
+ * @brief Walk a tree with work stealing
+ *
+ * Independent subtrees are walked concurrently. Each thread works
+ * depth-first on its own subtrees and idle threads steal the oldest
+ * pending ones. Every node is visited after its parent, but the order
+ * across subtrees is unspecified. Nodes reachable along several paths are
+ * visited once per path unless node identifiers are set.
+ *
+ * @param root Root node of the tree
+ * @param config Parallel traversal configuration
+ * @return Traversal result structure or NULL if traversal failed
+ */
+nlink_traversal_result* nlink_parallel_traverse_tree(
+    void* root,
+    const nlink_parallel_traversal_config* config
+);
+
+/**
+ * @brief Visit every node reachable in a directed graph with work stealing
+ *
+ * Like nlink_parallel_traverse_tree, but each node is claimed through an
+ * atomic visited bit and visited once. Requires node identifiers.
+ *
+ * @param start Starting node
+ * @param config Parallel traversal configuration
+ * @return Traversal result structure or NULL if traversal failed
+ */
+nlink_traversal_result* nlink_parallel_traverse_graph(
+    void* start,
+    const nlink_parallel_traversal_config* config
+);
+
+/**
+ * @brief Traverse a directed graph breadth-first, one frontier at a time
+ *
+ * The nodes of each frontier are visited concurrently, and their
+ * unvisited neighbours are claimed through atomic visited bits to form
+ * the next frontier. Results are in level order; the order within a level
+ * is unspecified. Requires node identifiers.
+ *
+ * @param start Starting node
+ * @param config Parallel traversal configuration
+ * @return Traversal result structure or NULL if traversal failed
+ */
+nlink_traversal_result* nlink_parallel_traverse_graph_bfs(
+    void* start,
+    const nlink_parallel_traversal_config* config
+);
+
 #endif /* NLINK_TACTIC_TRAVERSAL_H */
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <stdio.h>
 #include <stdint.h>
 #include "nlink/core/common/nexus_core.h"
+#include "nlink/core/versioning/semver.h"
 
 // Version information structure
 typedef struct {
@@ -27,6 +28,7 @@ typedef struct {
 	void* address;
 	int ref_count;
 	time_t last_used;
+	SemVer* semver;         // Parsed version (NULL if malformed); mirrors versioned_symbols.h
 } VersionedSymbol;
 
 // Symbol table structure
@@ -34,6 +36,7 @@ typedef struct {
 	VersionedSymbol* symbols;
 	size_t size;
 	size_t capacity;
+	uint64_t generation;    // Bumped when symbols are removed; mirrors VersionedSymbolTable
 } SymbolTable;
 
 // Registry for versioned symbols
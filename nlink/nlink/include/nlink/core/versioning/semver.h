@@ -41,9 +41,61 @@ int semver_compare(const SemVer* a, const SemVer* b);
 //   - "^1.2.3"   : Compatible with (same major version)
 //   - "~1.2.3"   : Compatible with (same major.minor version)
 //   - "*"        : Any version
+//   - ">=1.2 <2.0 || ^3.0.0" : Compound ranges (see SemVerConstraint)
+// Callers checking the same constraint repeatedly should compile it once
+// with semver_constraint_compile instead
 bool semver_satisfies(const char* version, const char* constraint);
 
 // Free a semantic version structure
 void semver_free(SemVer* ver);
 
+// Comparison operator of a single comparator in a compiled constraint
+typedef enum {
+    SEMVER_OP_ANY,          // "*", "latest", "x"
+    SEMVER_OP_EQ,           // "=1.2.3" or "1.2.3"
+    SEMVER_OP_GT,           // ">1.2.3"
+    SEMVER_OP_GE,           // ">=1.2.3"
+    SEMVER_OP_LT,           // "<1.2.3"
+    SEMVER_OP_LE,           // "<=1.2.3"
+    SEMVER_OP_CARET,        // "^1.2.3": same major, >= version
+    SEMVER_OP_TILDE,        // "~1.2.3": same major.minor, >= version
+    SEMVER_OP_NONE          // "<*": matches no version
+} SemVerOp;
+
+// Single comparator: operator applied to a version
+typedef struct {
+    SemVerOp op;
+    SemVer version;         // Owns version.prerelease; build is always NULL
+} SemVerComparator;
+
+// Compiled version constraint, parsed once and evaluated without allocation
+// A constraint is a disjunction ("||") of comparator sets; all comparators
+// of a set must hold (whitespace separated, e.g. ">=1.2 <2.0").
+// Partial versions are accepted: "1.2" as an exact match means ">=1.2.0 <1.3.0",
+// missing components of other operators default to zero.
+typedef struct {
+    SemVerComparator* comparators;  // All comparators, grouped by set
+    size_t comparator_count;        // Number of comparators
+    size_t* set_ends;               // set i is comparators[set_ends[i-1] .. set_ends[i])
+    size_t set_count;               // Number of comparator sets
+} SemVerConstraint;
+
+// Compile a constraint string
+// Returns NULL if the constraint is malformed
+SemVerConstraint* semver_constraint_compile(const char* constraint);
+
+// Check if a parsed version satisfies a compiled constraint
+bool semver_constraint_matches(const SemVerConstraint* constraint, const SemVer* version);
+
+// Filter candidate versions against one compiled constraint
+// Writes the indices of matching candidates to matches (room for count entries)
+// Returns the number of matches
+size_t semver_constraint_filter(const SemVerConstraint* constraint,
+                                const SemVer* const* candidates,
+                                size_t count,
+                                size_t* matches);
+
+// Free a compiled constraint
+void semver_constraint_free(SemVerConstraint* constraint);
+
 #endif // NEXUS_SEMVER_H
\ No newline at end of file
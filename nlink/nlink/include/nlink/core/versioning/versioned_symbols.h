@@ -11,6 +11,7 @@
 #include <stdio.h>
 #include <stdint.h>
 #include "nlink/core/common/nexus_core.h"
+#include "nlink/core/versioning/semver.h"
 
 
 // Symbol types (compatible with original nexus_symbols.h)
@@ -30,6 +31,7 @@ typedef struct {
     char* component_id;   // Component that provides this symbol
     int priority;         // Resolution priority (higher wins)
     int ref_count;        // Reference counting for usage tracking
+    SemVer* semver;       // Parsed version (NULL if the version is malformed)
 } VersionedSymbol;
 
 // Symbol table with version support
@@ -37,6 +39,7 @@ typedef struct {
     VersionedSymbol* symbols;  // Array of versioned symbols
     size_t size;               // Current number of symbols
     size_t capacity;           // Allocated capacity
+    uint64_t generation;       // Bumped whenever symbols are added or removed
 } VersionedSymbolTable;
 
 // Component dependency relationship
@@ -45,8 +48,36 @@ typedef struct {
     char* to_id;           // Dependency component
     char* version_req;     // Version requirement
     bool optional;         // Whether dependency is optional
+    SemVerConstraint* constraint;  // Compiled version_req (NULL if malformed)
 } ComponentDependency;
 
+// Memoized result of resolving a (name, constraint, requesting component) triple
+typedef struct {
+    char* key;                 // Packed triple (see versioned_symbols.c)
+    size_t key_length;         // Length of the packed key in bytes
+    uint32_t hash;             // Hash of the packed key
+    VersionedSymbol* symbol;   // Resolved symbol, NULL if resolution failed
+} VersionedResolutionEntry;
+
+// Resolution cache attached to a registry
+typedef struct {
+    VersionedResolutionEntry* entries;  // Open-addressing slots (key == NULL when free)
+    size_t count;                       // Number of occupied slots
+    size_t capacity;                    // Number of slots (power of two)
+    uint64_t generation;                // Registry generation the entries are valid for
+    uint64_t hits;                      // Lookups answered from the cache
+    uint64_t misses;                    // Lookups that ran a full resolution
+    uint64_t invalidations;             // Times the cache was flushed
+} VersionedResolutionCache;
+
+// Snapshot of resolution cache counters
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t invalidations;
+    size_t entries;
+} VersionedResolutionCacheStats;
+
 // Context-aware symbol registry
 typedef struct {
     VersionedSymbolTable global;     // Global symbols (always available)
@@ -57,6 +88,10 @@ typedef struct {
     ComponentDependency* dependencies;  // Array of component dependencies
     size_t deps_count;                  // Number of dependencies
     size_t deps_capacity;               // Allocated capacity for dependencies
+    uint64_t deps_generation;           // Bumped whenever a dependency edge changes
+    
+    // Memoized symbol resolutions
+    VersionedResolutionCache cache;
 } VersionedSymbolRegistry;
 
 // Initialize a versioned symbol table
@@ -109,6 +144,15 @@ void* nexus_resolve_versioned_symbol(VersionedSymbolRegistry* registry,
                                     const char* version_constraint,
                                     const char* requesting_component);
 
+// Get resolution cache counters for a registry
+void nexus_versioned_registry_get_cache_stats(const VersionedSymbolRegistry* registry,
+                                             VersionedResolutionCacheStats* stats);
+
+// Drop all memoized resolutions
+// Called automatically when symbols or dependency edges change through this API;
+// code that edits the tables directly must call it (or bump a generation) itself
+void nexus_versioned_registry_invalidate_cache(VersionedSymbolRegistry* registry);
+
 // Same as above but with additional type safety
 void* nexus_resolve_versioned_symbol_typed(VersionedSymbolRegistry* registry,
                                           const char* name,
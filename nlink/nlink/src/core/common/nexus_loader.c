@@ -14,32 +14,341 @@
 #include <stdlib.h>
 #include <string.h>
 #include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * Handle registry
+ *
+ * Entries are never removed before nexus_cleanup_handle_registry, so the
+ * hash index is insert-only. Writers hold the registry mutex, fill a slot
+ * and publish it with a release store; readers probe with acquire loads
+ * and take no locks. Growing the index builds a new table and publishes
+ * it atomically. The old table is kept until cleanup, so a reader still
+ * probing it stays safe: the retired tables add up to less than the live
+ * one.
+ */
+
+// A library known to the registry
+typedef struct NexusHandleEntry {
+    void* handle;
+    char* path;                 // Path the library was registered under
+    char* canonical;            // realpath() of path, NULL if it could not be resolved
+    char* component;            // Component identifier
+    dev_t dev;
+    ino_t ino;
+    bool has_inode;             // Whether dev/ino are valid
+} NexusHandleEntry;
+
+// A path string leading to an entry
+typedef struct NexusHandleKey {
+    uint64_t hash;
+    const char* path;           // Owned by the entry
+    NexusHandleEntry* entry;
+} NexusHandleKey;
+
+typedef struct NexusHandleTable {
+    size_t mask;                                // Slot count - 1, a power of two minus one
+    _Atomic(NexusHandleKey*)* path_slots;       // Open addressing by path hash
+    _Atomic(NexusHandleEntry*)* inode_slots;    // Open addressing by (dev, inode)
+    struct NexusHandleTable* retired;           // Previous table, freed at cleanup
+} NexusHandleTable;
+
+struct NexusHandleRegistry {
+    _Atomic(NexusHandleTable*) table;   // Published index
+    atomic_size_t count;                // Registered libraries
+    NexusHandleEntry** entries;         // Registration order, writers only
+    size_t capacity;
+    NexusHandleKey** keys;              // Every key, writers only
+    size_t key_count;
+    size_t key_capacity;
+    pthread_mutex_t mutex;              // Serializes writers
+};
 
 // Global handle registry instance
-static struct NexusHandleRegistry* g_handle_registry = NULL;
+static _Atomic(NexusHandleRegistry*) g_handle_registry = NULL;
+static pthread_mutex_t g_handle_registry_init = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t handle_path_hash(const char* path) {
+    uint64_t hash = 14695981039346656037ULL;
+    
+    for (const unsigned char* p = (const unsigned char*)path; *p; p++) {
+        hash ^= *p;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static uint64_t handle_inode_hash(dev_t dev, ino_t ino) {
+    uint64_t hash = (uint64_t)ino * 0x9E3779B97F4A7C15ULL ^ (uint64_t)dev;
+    return hash ^ (hash >> 32);
+}
+
+static NexusHandleTable* handle_table_create(size_t slots) {
+    NexusHandleTable* table = (NexusHandleTable*)calloc(1, sizeof(NexusHandleTable));
+    if (!table) {
+        return NULL;
+    }
+    
+    table->mask = slots - 1;
+    table->path_slots = calloc(slots, sizeof(*table->path_slots));
+    table->inode_slots = calloc(slots, sizeof(*table->inode_slots));
+    if (!table->path_slots || !table->inode_slots) {
+        free(table->path_slots);
+        free(table->inode_slots);
+        free(table);
+        return NULL;
+    }
+    
+    return table;
+}
+
+static void handle_table_put_key(NexusHandleTable* table, NexusHandleKey* key) {
+    size_t slot = key->hash & table->mask;
+    
+    while (atomic_load_explicit(&table->path_slots[slot], memory_order_relaxed) != NULL) {
+        slot = (slot + 1) & table->mask;
+    }
+    atomic_store_explicit(&table->path_slots[slot], key, memory_order_release);
+}
+
+static void handle_table_put_inode(NexusHandleTable* table, NexusHandleEntry* entry) {
+    size_t slot = handle_inode_hash(entry->dev, entry->ino) & table->mask;
+    
+    while (atomic_load_explicit(&table->inode_slots[slot], memory_order_relaxed) != NULL) {
+        slot = (slot + 1) & table->mask;
+    }
+    atomic_store_explicit(&table->inode_slots[slot], entry, memory_order_release);
+}
+
+static NexusHandleEntry* handle_find_by_path(const NexusHandleTable* table, const char* path) {
+    if (!table) {
+        return NULL;
+    }
+    
+    uint64_t hash = handle_path_hash(path);
+    size_t slot = hash & table->mask;
+    
+    for (;;) {
+        NexusHandleKey* key = atomic_load_explicit(&table->path_slots[slot], memory_order_acquire);
+        if (!key) {
+            return NULL;
+        }
+        if (key->hash == hash && strcmp(key->path, path) == 0) {
+            return key->entry;
+        }
+        slot = (slot + 1) & table->mask;
+    }
+}
+
+static NexusHandleEntry* handle_find_by_inode(const NexusHandleTable* table, dev_t dev, ino_t ino) {
+    if (!table) {
+        return NULL;
+    }
+    
+    size_t slot = handle_inode_hash(dev, ino) & table->mask;
+    
+    for (;;) {
+        NexusHandleEntry* entry = atomic_load_explicit(&table->inode_slots[slot], memory_order_acquire);
+        if (!entry) {
+            return NULL;
+        }
+        if (entry->dev == dev && entry->ino == ino) {
+            return entry;
+        }
+        slot = (slot + 1) & table->mask;
+    }
+}
+
+// Make room for one more entry and its keys; called with the mutex held
+static bool handle_registry_reserve(NexusHandleRegistry* registry, size_t new_keys) {
+    size_t count = atomic_load_explicit(&registry->count, memory_order_relaxed);
+    
+    if (count == registry->capacity) {
+        size_t capacity = registry->capacity ? registry->capacity * 2 : NEXUS_DEFAULT_REGISTRY_SIZE;
+        NexusHandleEntry** entries = realloc(registry->entries, capacity * sizeof(NexusHandleEntry*));
+        if (!entries) {
+            return false;
+        }
+        registry->entries = entries;
+        registry->capacity = capacity;
+    }
+    
+    if (registry->key_count + new_keys > registry->key_capacity) {
+        size_t capacity = registry->key_capacity ? registry->key_capacity * 2 : NEXUS_DEFAULT_REGISTRY_SIZE * 2;
+        NexusHandleKey** keys = realloc(registry->keys, capacity * sizeof(NexusHandleKey*));
+        if (!keys) {
+            return false;
+        }
+        registry->keys = keys;
+        registry->key_capacity = capacity;
+    }
+    
+    // Keep both indexes at most half full
+    NexusHandleTable* table = atomic_load_explicit(&registry->table, memory_order_relaxed);
+    size_t needed = registry->key_count + new_keys;
+    if (table && needed * 2 <= table->mask + 1) {
+        return true;
+    }
+    
+    size_t slots = table ? (table->mask + 1) * 2 : NEXUS_DEFAULT_REGISTRY_SIZE * 4;
+    while (needed * 2 > slots) {
+        slots *= 2;
+    }
+    
+    NexusHandleTable* grown = handle_table_create(slots);
+    if (!grown) {
+        return false;
+    }
+    for (size_t i = 0; i < registry->key_count; i++) {
+        handle_table_put_key(grown, registry->keys[i]);
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (registry->entries[i]->has_inode) {
+            handle_table_put_inode(grown, registry->entries[i]);
+        }
+    }
+    grown->retired = table;
+    atomic_store_explicit(&registry->table, grown, memory_order_release);
+    
+    return true;
+}
+
+static void handle_entry_free(NexusHandleEntry* entry) {
+    if (!entry) {
+        return;
+    }
+    
+    free(entry->path);
+    free(entry->canonical);
+    free(entry->component);
+    free(entry);
+}
+
+/**
+ * @brief Insert a handle unless its library is already registered
+ * 
+ * @param existing Receives the registered handle when the library is already known
+ */
+static NexusResult handle_registry_insert(NexusHandleRegistry* registry, void* handle,
+                                          const char* path, const char* component_id,
+                                          void** existing) {
+    // Resolve the file outside the lock
+    NexusHandleEntry* entry = (NexusHandleEntry*)calloc(1, sizeof(NexusHandleEntry));
+    if (!entry) {
+        return NEXUS_OUT_OF_MEMORY;
+    }
+    
+    struct stat st;
+    entry->handle = handle;
+    entry->path = strdup(path);
+    entry->component = strdup(component_id);
+    entry->canonical = realpath(path, NULL);
+    if (stat(path, &st) == 0) {
+        entry->dev = st.st_dev;
+        entry->ino = st.st_ino;
+        entry->has_inode = true;
+    }
+    if (entry->canonical && strcmp(entry->canonical, path) == 0) {
+        free(entry->canonical);
+        entry->canonical = NULL;
+    }
+    
+    NexusHandleKey* keys[2] = { NULL, NULL };
+    size_t key_count = entry->canonical ? 2 : 1;
+    for (size_t i = 0; i < key_count; i++) {
+        keys[i] = (NexusHandleKey*)malloc(sizeof(NexusHandleKey));
+        if (keys[i]) {
+            keys[i]->path = i == 0 ? entry->path : entry->canonical;
+            keys[i]->entry = entry;
+        }
+    }
+    if (!entry->path || !entry->component || !keys[0] || (key_count == 2 && !keys[1])) {
+        handle_entry_free(entry);
+        free(keys[0]);
+        free(keys[1]);
+        return NEXUS_OUT_OF_MEMORY;
+    }
+    for (size_t i = 0; i < key_count; i++) {
+        keys[i]->hash = handle_path_hash(keys[i]->path);
+    }
+    
+    pthread_mutex_lock(&registry->mutex);
+    
+    NexusHandleTable* table = atomic_load_explicit(&registry->table, memory_order_relaxed);
+    NexusHandleEntry* found = handle_find_by_path(table, entry->path);
+    if (!found && entry->canonical) {
+        found = handle_find_by_path(table, entry->canonical);
+    }
+    if (!found && entry->has_inode) {
+        found = handle_find_by_inode(table, entry->dev, entry->ino);
+    }
+    
+    NexusResult result = NEXUS_SUCCESS;
+    if (found) {
+        if (existing) {
+            *existing = found->handle;
+        }
+        result = NEXUS_ALREADY_EXISTS;
+    } else if (!handle_registry_reserve(registry, key_count)) {
+        result = NEXUS_OUT_OF_MEMORY;
+    } else {
+        table = atomic_load_explicit(&registry->table, memory_order_relaxed);
+        size_t count = atomic_load_explicit(&registry->count, memory_order_relaxed);
+        
+        registry->entries[count] = entry;
+        for (size_t i = 0; i < key_count; i++) {
+            registry->keys[registry->key_count++] = keys[i];
+            handle_table_put_key(table, keys[i]);
+        }
+        if (entry->has_inode) {
+            handle_table_put_inode(table, entry);
+        }
+        atomic_store_explicit(&registry->count, count + 1, memory_order_release);
+    }
+    
+    pthread_mutex_unlock(&registry->mutex);
+    
+    if (result != NEXUS_SUCCESS) {
+        handle_entry_free(entry);
+        free(keys[0]);
+        free(keys[1]);
+    }
+    return result;
+}
  
 // Initialize the handle registry
 struct NexusHandleRegistry* nexus_init_handle_registry(void) {
-    if (g_handle_registry) {
-        return g_handle_registry;
+    NexusHandleRegistry* current = atomic_load_explicit(&g_handle_registry, memory_order_acquire);
+    if (current) {
+        return current;
     }
     
-    struct NexusHandleRegistry* registry = (struct NexusHandleRegistry*)malloc(sizeof(struct NexusHandleRegistry));
+    pthread_mutex_lock(&g_handle_registry_init);
+    current = atomic_load_explicit(&g_handle_registry, memory_order_relaxed);
+    if (current) {
+        pthread_mutex_unlock(&g_handle_registry_init);
+        return current;
+    }
+    
+    struct NexusHandleRegistry* registry = (struct NexusHandleRegistry*)calloc(1, sizeof(struct NexusHandleRegistry));
     if (!registry) {
+        pthread_mutex_unlock(&g_handle_registry_init);
         return NULL;
     }
     
     // Initialize with default values
-    registry->handles = NULL;
-    registry->paths = NULL;
-    registry->components = NULL;
-    registry->count = 0;
-    registry->capacity = 0;
+    atomic_init(&registry->table, NULL);
+    atomic_init(&registry->count, 0);
     
     // Initialize mutex
     pthread_mutex_init(&registry->mutex, NULL);
     
-    g_handle_registry = registry;
+    atomic_store_explicit(&g_handle_registry, registry, memory_order_release);
+    pthread_mutex_unlock(&g_handle_registry_init);
     return registry;
 }
 
@@ -49,13 +358,23 @@ void* nexus_find_component_handle(struct NexusHandleRegistry* registry, const ch
         return NULL;
     }
     
-    for (size_t i = 0; i < registry->count; i++) {
-        if (strcmp(registry->paths[i], path) == 0) {
-            return registry->handles[i];
-        }
+    const NexusHandleTable* table = atomic_load_explicit(&registry->table, memory_order_acquire);
+    if (!table) {
+        return NULL;
     }
     
-    return NULL;
+    NexusHandleEntry* entry = handle_find_by_path(table, path);
+    if (entry) {
+        return entry->handle;
+    }
+    
+    // Another spelling of a registered file, such as a symlink
+    struct stat st;
+    if (stat(path, &st) == 0) {
+        entry = handle_find_by_inode(table, st.st_dev, st.st_ino);
+    }
+    
+    return entry ? entry->handle : NULL;
 }
  
  // Register a component handle
@@ -65,91 +384,57 @@ void* nexus_find_component_handle(struct NexusHandleRegistry* registry, const ch
          return NEXUS_INVALID_PARAMETER;
      }
      
-     // Check if we need to resize
-     if (registry->count >= registry->capacity) {
-         size_t new_capacity = registry->capacity * 2;
-         if (new_capacity == 0) {
-             new_capacity = NEXUS_DEFAULT_REGISTRY_SIZE;
-         }
-         
-         void** new_handles = (void**)realloc(registry->handles, new_capacity * sizeof(void*));
-         if (!new_handles) {
-             return NEXUS_OUT_OF_MEMORY;
-         }
-         
-         char** new_paths = (char**)realloc(registry->paths, new_capacity * sizeof(char*));
-         if (!new_paths) {
-             registry->handles = new_handles; // Keep this update even if the next one fails
-             return NEXUS_OUT_OF_MEMORY;
-         }
-         
-         char** new_components = (char**)realloc(registry->components, new_capacity * sizeof(char*));
-         if (!new_components) {
-             registry->handles = new_handles;
-             registry->paths = new_paths;
-             return NEXUS_OUT_OF_MEMORY;
-         }
-         
-         registry->handles = new_handles;
-         registry->paths = new_paths;
-         registry->components = new_components;
-         registry->capacity = new_capacity;
-     }
-     
-     // Add the new handle
-     registry->handles[registry->count] = handle;
-     registry->paths[registry->count] = strdup(path);
-     registry->components[registry->count] = strdup(component_id);
-     
-     if (!registry->paths[registry->count] || !registry->components[registry->count]) {
-         // Cleanup on error
-         free(registry->paths[registry->count]);
-         free(registry->components[registry->count]);
-         return NEXUS_OUT_OF_MEMORY;
+     return handle_registry_insert(registry, handle, path, component_id, NULL);
+ }
+ 
+ // Get the number of registered libraries
+ size_t nexus_handle_registry_count(const NexusHandleRegistry* registry) {
+     if (!registry) {
+         return 0;
      }
      
-     registry->count++;
-     return NEXUS_SUCCESS;
+     return atomic_load_explicit(&registry->count, memory_order_acquire);
  }
  
  // Forward declaration for NexusComponentInit
  typedef bool (*NexusComponentInit)(NexusContext*);
  typedef void (*NexusComponentCleanup)(NexusContext*);
  
- // Load a component
- extern NexusComponent* nexus_load_component(NexusContext* ctx, const char* path, const char* component_id) {
-     if (!ctx || !path || !component_id) {
-         return NULL;
+ // Open a component library, reusing the registered handle when it is already loaded
+ static void* component_open(NexusContext* ctx, NexusHandleRegistry* registry,
+                             const char* path, const char* component_id) {
+     // Check if the component is already loaded
+     void* handle = nexus_find_component_handle(registry, path);
+     if (handle) {
+         return handle;
      }
      
-     // Ensure we have a handle registry
-     NexusHandleRegistry* registry = nexus_init_handle_registry();
-     if (!registry) {
-         nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to initialize handle registry");
+     // Load the component
+     void* opened = dlopen(path, RTLD_LAZY);
+     if (!opened) {
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to load component: %s", dlerror());
          return NULL;
      }
      
-     // Check if the component is already loaded
-     void* handle = nexus_find_component_handle(registry, path);
-     if (!handle) {
-         // Load the component
-         handle = dlopen(path, RTLD_LAZY);
-         if (!handle) {
-             nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to load component: %s", dlerror());
-             return NULL;
-         }
-         
-         // Register the handle
-         NexusResult result = nexus_register_component_handle(registry, handle, path, component_id);
-         if (result != NEXUS_SUCCESS) {
-             dlclose(handle);
-             nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to register component handle: %s", 
-                      nexus_result_to_string(result));
-             return NULL;
-         }
+     // Register the handle; another thread may have registered the library first
+     NexusResult result = handle_registry_insert(registry, opened, path, component_id, &handle);
+     if (result == NEXUS_ALREADY_EXISTS) {
+         dlclose(opened);
+         return handle;
+     }
+     if (result != NEXUS_SUCCESS) {
+         dlclose(opened);
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to register component handle: %s", 
+                  nexus_result_to_string(result));
+         return NULL;
      }
      
-     // Create the component structure
+     return opened;
+ }
+ 
+ // Create the component structure for an open handle and run its initialization function
+ static NexusComponent* component_init(NexusContext* ctx, void* handle,
+                                       const char* path, const char* component_id) {
      NexusComponent* component = (NexusComponent*)malloc(sizeof(NexusComponent));
      if (!component) {
          // Don't close the handle here, as it might be used by other components
@@ -188,6 +473,490 @@ void* nexus_find_component_handle(struct NexusHandleRegistry* registry, const ch
      return component;
  }
  
+ // Load a component
+ extern NexusComponent* nexus_load_component(NexusContext* ctx, const char* path, const char* component_id) {
+     if (!ctx || !path || !component_id) {
+         return NULL;
+     }
+     
+     // Ensure we have a handle registry
+     NexusHandleRegistry* registry = nexus_init_handle_registry();
+     if (!registry) {
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to initialize handle registry");
+         return NULL;
+     }
+     
+     void* handle = component_open(ctx, registry, path, component_id);
+     if (!handle) {
+         return NULL;
+     }
+     
+     return component_init(ctx, handle, path, component_id);
+ }
+ 
+ /*
+  * Batch loading
+  *
+  * Each component waits on its own dlopen plus each required dependency in
+  * the batch; when that count reaches zero it joins the init queue. Workers
+  * take queued inits before starting another dlopen so the critical path
+  * keeps moving.
+  */
+ 
+ typedef struct {
+     NexusContext* ctx;
+     NexusHandleRegistry* registry;
+     const NexusComponentSpec* specs;
+     size_t count;
+     NexusComponent** components;
+     NexusComponentTiming* timeline;
+     
+     size_t* dependent_start;    // Dependents of i are dependents[dependent_start[i] .. dependent_start[i + 1]]
+     size_t* dependents;
+     size_t* waiting;            // Uninitialized dependencies plus the component's own dlopen
+     void** handles;
+     bool* failed;
+     
+     size_t* open_order;         // Longest chain of dependents first
+     size_t next_open;
+     size_t* ready;              // Init queue; each component enters it at most once
+     size_t ready_head;
+     size_t ready_tail;
+     size_t* failing;            // Scratch stack for failure propagation
+     size_t finished;            // Components initialized or failed
+     NexusResult first_error;
+     
+     struct timespec start;
+     pthread_mutex_t mutex;
+     pthread_cond_t cond;        // Signalled when work is queued or the batch finishes
+ } ComponentBatch;
+ 
+ typedef struct {
+     ComponentBatch* batch;
+     int worker;
+ } ComponentBatchWorker;
+ 
+ static double batch_elapsed_ms(const ComponentBatch* batch) {
+     struct timespec now;
+     clock_gettime(CLOCK_MONOTONIC, &now);
+     return (double)(now.tv_sec - batch->start.tv_sec) * 1e3 +
+            (double)(now.tv_nsec - batch->start.tv_nsec) / 1e6;
+ }
+ 
+ // Fail a component and everything that depends on it; called with the mutex held
+ static void batch_fail(ComponentBatch* batch, size_t index, NexusResult result) {
+     size_t top = 0;
+     
+     batch->failed[index] = true;
+     batch->timeline[index].result = result;
+     batch->finished++;
+     if (batch->first_error == NEXUS_SUCCESS) {
+         batch->first_error = result;
+     }
+     
+     batch->failing[top++] = index;
+     while (top > 0) {
+         size_t i = batch->failing[--top];
+         for (size_t k = batch->dependent_start[i]; k < batch->dependent_start[i + 1]; k++) {
+             size_t j = batch->dependents[k];
+             if (!batch->failed[j]) {
+                 batch->failed[j] = true;
+                 batch->timeline[j].result = NEXUS_DEPENDENCY_ERROR;
+                 batch->finished++;
+                 batch->failing[top++] = j;
+             }
+         }
+     }
+ }
+ 
+ // Count down one thing a component waits on; called with the mutex held
+ static void batch_release(ComponentBatch* batch, size_t index) {
+     if (--batch->waiting[index] == 0 && !batch->failed[index]) {
+         batch->ready[batch->ready_tail++] = index;
+     }
+ }
+ 
+ static void batch_run(ComponentBatch* batch, int worker) {
+     pthread_mutex_lock(&batch->mutex);
+     
+     for (;;) {
+         if (batch->ready_head < batch->ready_tail) {
+             size_t i = batch->ready[batch->ready_head++];
+             const NexusComponentSpec* spec = &batch->specs[i];
+             batch->timeline[i].init_worker = worker;
+             batch->timeline[i].init_start_ms = batch_elapsed_ms(batch);
+             pthread_mutex_unlock(&batch->mutex);
+             
+             NexusComponent* component = component_init(batch->ctx, batch->handles[i], spec->path, spec->id);
+             double end = batch_elapsed_ms(batch);
+             
+             pthread_mutex_lock(&batch->mutex);
+             batch->timeline[i].init_end_ms = end;
+             if (!component) {
+                 batch_fail(batch, i, NEXUS_NOT_INITIALIZED);
+             } else {
+                 batch->components[i] = component;
+                 batch->finished++;
+                 for (size_t k = batch->dependent_start[i]; k < batch->dependent_start[i + 1]; k++) {
+                     batch_release(batch, batch->dependents[k]);
+                 }
+             }
+             pthread_cond_broadcast(&batch->cond);
+             continue;
+         }
+         
+         if (batch->next_open < batch->count) {
+             size_t i = batch->open_order[batch->next_open++];
+             if (batch->failed[i]) {
+                 continue;
+             }
+             
+             const NexusComponentSpec* spec = &batch->specs[i];
+             batch->timeline[i].open_worker = worker;
+             batch->timeline[i].open_start_ms = batch_elapsed_ms(batch);
+             pthread_mutex_unlock(&batch->mutex);
+             
+             void* handle = component_open(batch->ctx, batch->registry, spec->path, spec->id);
+             double end = batch_elapsed_ms(batch);
+             
+             pthread_mutex_lock(&batch->mutex);
+             batch->timeline[i].open_end_ms = end;
+             if (!batch->failed[i]) {
+                 if (!handle) {
+                     batch_fail(batch, i, NEXUS_IO_ERROR);
+                 } else {
+                     batch->handles[i] = handle;
+                     batch_release(batch, i);
+                 }
+             }
+             pthread_cond_broadcast(&batch->cond);
+             continue;
+         }
+         
+         if (batch->finished == batch->count) {
+             break;
+         }
+         pthread_cond_wait(&batch->cond, &batch->mutex);
+     }
+     
+     pthread_mutex_unlock(&batch->mutex);
+ }
+ 
+ static void* batch_worker(void* arg) {
+     ComponentBatchWorker* worker = (ComponentBatchWorker*)arg;
+     batch_run(worker->batch, worker->worker);
+     return NULL;
+ }
+ 
+ // Find a component index by identifier in an open-addressed table of index + 1
+ static size_t batch_find_id(const ComponentBatch* batch, const size_t* slots, size_t mask, const char* id) {
+     size_t slot = handle_path_hash(id) & mask;
+     
+     while (slots[slot] != 0) {
+         if (strcmp(batch->specs[slots[slot] - 1].id, id) == 0) {
+             return slots[slot] - 1;
+         }
+         slot = (slot + 1) & mask;
+     }
+     return SIZE_MAX;
+ }
+ 
+ typedef struct {
+     size_t height;
+     size_t index;
+ } ComponentOpenRank;
+ 
+ static int compare_open_rank(const void* a, const void* b) {
+     const ComponentOpenRank* left = (const ComponentOpenRank*)a;
+     const ComponentOpenRank* right = (const ComponentOpenRank*)b;
+     
+     if (left->height != right->height) {
+         return left->height > right->height ? -1 : 1;
+     }
+     return left->index < right->index ? -1 : (left->index > right->index);
+ }
+ 
+ /**
+  * @brief Build the dependency edges, reject cycles and order the opens
+  * 
+  * @return NEXUS_SUCCESS, or why the batch cannot be scheduled
+  */
+ static NexusResult batch_schedule(ComponentBatch* batch) {
+     size_t count = batch->count;
+     size_t mask = 1;
+     while (mask < count * 2) {
+         mask <<= 1;
+     }
+     mask--;
+     
+     size_t* slots = (size_t*)calloc(mask + 1, sizeof(size_t));
+     size_t* order = (size_t*)malloc(count * sizeof(size_t));
+     size_t* remaining = (size_t*)calloc(count, sizeof(size_t));
+     size_t* height = (size_t*)calloc(count, sizeof(size_t));
+     ComponentOpenRank* ranks = (ComponentOpenRank*)malloc(count * sizeof(ComponentOpenRank));
+     NexusResult result = NEXUS_SUCCESS;
+     
+     if (!slots || !order || !remaining || !height || !ranks) {
+         result = NEXUS_OUT_OF_MEMORY;
+     }
+     
+     // Index identifiers
+     for (size_t i = 0; result == NEXUS_SUCCESS && i < count; i++) {
+         if (batch_find_id(batch, slots, mask, batch->specs[i].id) != SIZE_MAX) {
+             nexus_log(batch->ctx, NEXUS_LOG_ERROR, "Component listed twice: %s", batch->specs[i].id);
+             result = NEXUS_INVALID_PARAMETER;
+             break;
+         }
+         size_t slot = handle_path_hash(batch->specs[i].id) & mask;
+         while (slots[slot] != 0) {
+             slot = (slot + 1) & mask;
+         }
+         slots[slot] = i + 1;
+     }
+     
+     // Count edges, resolving each dependency to an index (SIZE_MAX when skipped)
+     size_t edge_count = 0;
+     size_t* targets = NULL;
+     for (size_t i = 0; result == NEXUS_SUCCESS && i < count; i++) {
+         edge_count += batch->specs[i].dependency_count;
+     }
+     if (result == NEXUS_SUCCESS && edge_count > 0) {
+         targets = (size_t*)malloc(edge_count * sizeof(size_t));
+         batch->dependents = (size_t*)malloc(edge_count * sizeof(size_t));
+         if (!targets || !batch->dependents) {
+             result = NEXUS_OUT_OF_MEMORY;
+         }
+     }
+     
+     size_t edge = 0;
+     for (size_t i = 0; result == NEXUS_SUCCESS && i < count; i++) {
+         const NexusComponentSpec* spec = &batch->specs[i];
+         batch->waiting[i] = 1;
+         
+         for (size_t d = 0; d < spec->dependency_count; d++, edge++) {
+             size_t j = spec->dependencies[d] ? batch_find_id(batch, slots, mask, spec->dependencies[d]) : SIZE_MAX;
+             targets[edge] = j;
+             if (j != SIZE_MAX) {
+                 batch->dependent_start[j + 1]++;
+                 batch->waiting[i]++;
+             } else if (!spec->optional || !spec->optional[d]) {
+                 nexus_log(batch->ctx, NEXUS_LOG_ERROR, "Component %s depends on %s, which is not in the batch",
+                          spec->id, spec->dependencies[d] ? spec->dependencies[d] : "(null)");
+                 result = NEXUS_DEPENDENCY_ERROR;
+                 break;
+             }
+         }
+     }
+     
+     if (result == NEXUS_SUCCESS) {
+         // Reverse edges in CSR form
+         for (size_t i = 0; i < count; i++) {
+             batch->dependent_start[i + 1] += batch->dependent_start[i];
+         }
+         size_t* fill = remaining;
+         memcpy(fill, batch->dependent_start, count * sizeof(size_t));
+         
+         edge = 0;
+         for (size_t i = 0; i < count; i++) {
+             for (size_t d = 0; d < batch->specs[i].dependency_count; d++, edge++) {
+                 if (targets[edge] != SIZE_MAX) {
+                     batch->dependents[fill[targets[edge]]++] = i;
+                 }
+             }
+         }
+         
+         // Kahn's algorithm: a component is ordered once its dependencies are
+         size_t ordered = 0;
+         for (size_t i = 0; i < count; i++) {
+             remaining[i] = batch->waiting[i] - 1;
+             if (remaining[i] == 0) {
+                 order[ordered++] = i;
+             }
+         }
+         for (size_t head = 0; head < ordered; head++) {
+             size_t i = order[head];
+             for (size_t k = batch->dependent_start[i]; k < batch->dependent_start[i + 1]; k++) {
+                 if (--remaining[batch->dependents[k]] == 0) {
+                     order[ordered++] = batch->dependents[k];
+                 }
+             }
+         }
+         
+         if (ordered < count) {
+             nexus_log(batch->ctx, NEXUS_LOG_ERROR, "Dependency cycle among %zu components", count - ordered);
+             result = NEXUS_DEPENDENCY_ERROR;
+         }
+     }
+     
+     if (result == NEXUS_SUCCESS) {
+         // Height: the longest chain of dependents waiting on a component
+         for (size_t n = count; n-- > 0;) {
+             size_t i = order[n];
+             for (size_t k = batch->dependent_start[i]; k < batch->dependent_start[i + 1]; k++) {
+                 size_t above = height[batch->dependents[k]] + 1;
+                 if (above > height[i]) {
+                     height[i] = above;
+                 }
+             }
+         }
+         
+         for (size_t i = 0; i < count; i++) {
+             ranks[i].height = height[i];
+             ranks[i].index = i;
+         }
+         qsort(ranks, count, sizeof(ComponentOpenRank), compare_open_rank);
+         for (size_t i = 0; i < count; i++) {
+             batch->open_order[i] = ranks[i].index;
+         }
+     }
+     
+     free(slots);
+     free(order);
+     free(remaining);
+     free(height);
+     free(ranks);
+     free(targets);
+     return result;
+ }
+ 
+ // Load a set of components concurrently
+ NexusResult nexus_load_components(NexusContext* ctx, const NexusComponentSpec* specs, size_t count,
+                                   size_t max_threads, NexusComponent** components,
+                                   NexusComponentTiming* timeline) {
+     if (!ctx || (count > 0 && (!specs || !components))) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     for (size_t i = 0; i < count; i++) {
+         components[i] = NULL;
+         if (!specs[i].path || !specs[i].id || (specs[i].dependency_count > 0 && !specs[i].dependencies)) {
+             return NEXUS_INVALID_PARAMETER;
+         }
+     }
+     if (count == 0) {
+         return NEXUS_SUCCESS;
+     }
+     
+     // Ensure we have a handle registry
+     NexusHandleRegistry* registry = nexus_init_handle_registry();
+     if (!registry) {
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to initialize handle registry");
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     ComponentBatch batch;
+     memset(&batch, 0, sizeof(batch));
+     batch.ctx = ctx;
+     batch.registry = registry;
+     batch.specs = specs;
+     batch.count = count;
+     batch.components = components;
+     batch.timeline = (NexusComponentTiming*)malloc(count * sizeof(NexusComponentTiming));
+     batch.dependent_start = (size_t*)calloc(count + 1, sizeof(size_t));
+     batch.waiting = (size_t*)calloc(count, sizeof(size_t));
+     batch.handles = (void**)calloc(count, sizeof(void*));
+     batch.failed = (bool*)calloc(count, sizeof(bool));
+     batch.open_order = (size_t*)malloc(count * sizeof(size_t));
+     batch.ready = (size_t*)malloc(count * sizeof(size_t));
+     batch.failing = (size_t*)malloc(count * sizeof(size_t));
+     batch.first_error = NEXUS_SUCCESS;
+     
+     NexusResult result = NEXUS_SUCCESS;
+     if (!batch.timeline || !batch.dependent_start || !batch.waiting || !batch.handles ||
+         !batch.failed || !batch.open_order || !batch.ready || !batch.failing) {
+         result = NEXUS_OUT_OF_MEMORY;
+     } else {
+         result = batch_schedule(&batch);
+     }
+     
+     if (result == NEXUS_SUCCESS) {
+         for (size_t i = 0; i < count; i++) {
+             batch.timeline[i] = (NexusComponentTiming){ -1.0, -1.0, -1.0, -1.0, -1, -1, NEXUS_SUCCESS };
+         }
+         
+         size_t threads = max_threads;
+         if (threads == 0) {
+             long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+             threads = cpus > 0 ? (size_t)cpus : 1;
+         }
+         if (threads > count) {
+             threads = count;
+         }
+         
+         pthread_t* ids = (pthread_t*)malloc(threads * sizeof(pthread_t));
+         ComponentBatchWorker* workers = (ComponentBatchWorker*)malloc(threads * sizeof(ComponentBatchWorker));
+         size_t started = 0;
+         
+         pthread_mutex_init(&batch.mutex, NULL);
+         pthread_cond_init(&batch.cond, NULL);
+         clock_gettime(CLOCK_MONOTONIC, &batch.start);
+         
+         // The calling thread is worker 0
+         for (size_t t = 1; ids && workers && t < threads; t++) {
+             workers[started] = (ComponentBatchWorker){ &batch, (int)t };
+             if (pthread_create(&ids[started], NULL, batch_worker, &workers[started]) != 0) {
+                 break;
+             }
+             started++;
+         }
+         batch_run(&batch, 0);
+         for (size_t t = 0; t < started; t++) {
+             pthread_join(ids[t], NULL);
+         }
+         
+         pthread_cond_destroy(&batch.cond);
+         pthread_mutex_destroy(&batch.mutex);
+         free(ids);
+         free(workers);
+         
+         if (timeline) {
+             memcpy(timeline, batch.timeline, count * sizeof(NexusComponentTiming));
+         }
+         
+         size_t loaded = 0;
+         for (size_t i = 0; i < count; i++) {
+             loaded += components[i] != NULL;
+         }
+         result = loaded == count ? NEXUS_SUCCESS : loaded > 0 ? NEXUS_PARTIAL_SUCCESS : batch.first_error;
+     }
+     
+     free(batch.timeline);
+     free(batch.dependent_start);
+     free(batch.dependents);
+     free(batch.waiting);
+     free(batch.handles);
+     free(batch.failed);
+     free(batch.open_order);
+     free(batch.ready);
+     free(batch.failing);
+     return result;
+ }
+ 
+ static void print_timeline_phase(FILE* out, double start_ms, double end_ms) {
+     if (start_ms < 0 || end_ms < 0) {
+         fprintf(out, " %10s %9s", "-", "-");
+     } else {
+         fprintf(out, " %10.3f %9.3f", start_ms, end_ms - start_ms);
+     }
+ }
+ 
+ // Print a batch startup timeline
+ void nexus_print_component_timeline(FILE* out, const NexusComponentSpec* specs,
+                                     const NexusComponentTiming* timeline, size_t count) {
+     if (!out || !specs || !timeline) {
+         return;
+     }
+     
+     fprintf(out, "%-24s %10s %9s %10s %9s %7s  %s\n",
+             "component", "open at", "open ms", "init at", "init ms", "workers", "result");
+     for (size_t i = 0; i < count; i++) {
+         fprintf(out, "%-24s", specs[i].id);
+         print_timeline_phase(out, timeline[i].open_start_ms, timeline[i].open_end_ms);
+         print_timeline_phase(out, timeline[i].init_start_ms, timeline[i].init_end_ms);
+         fprintf(out, " %3d/%-3d  %s\n", timeline[i].open_worker, timeline[i].init_worker,
+                 nexus_result_to_string(timeline[i].result));
+     }
+ }
+ 
  // Unload a component
  NexusResult nexus_unload_component(NexusContext* ctx, NexusComponent* component) {
      if (!ctx || !component) {
@@ -249,22 +1018,33 @@ void* nexus_find_component_handle(struct NexusHandleRegistry* registry, const ch
      }
      
      // Close all handles
-     for (size_t i = 0; i < registry->count; i++) {
-         dlclose(registry->handles[i]);
-         free(registry->paths[i]);
-         free(registry->components[i]);
+     size_t count = atomic_load(&registry->count);
+     for (size_t i = 0; i < count; i++) {
+         dlclose(registry->entries[i]->handle);
+         handle_entry_free(registry->entries[i]);
+     }
+     for (size_t i = 0; i < registry->key_count; i++) {
+         free(registry->keys[i]);
+     }
+     
+     // Free the published index and every table it replaced
+     NexusHandleTable* table = atomic_load(&registry->table);
+     while (table) {
+         NexusHandleTable* retired = table->retired;
+         free(table->path_slots);
+         free(table->inode_slots);
+         free(table);
+         table = retired;
      }
      
-     free(registry->handles);
-     free(registry->paths);
-     free(registry->components);
+     free(registry->entries);
+     free(registry->keys);
      
      // Destroy mutex
      pthread_mutex_destroy(&registry->mutex);
      
-     if (registry == g_handle_registry) {
-         g_handle_registry = NULL;
-     }
+     NexusHandleRegistry* expected = registry;
+     atomic_compare_exchange_strong(&g_handle_registry, &expected, NULL);
      
      free(registry);
  }
\ No newline at end of file
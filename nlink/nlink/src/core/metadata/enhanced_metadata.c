@@ -4,8 +4,15 @@
 
 #define NEXUS_JSON_EXTERN
 
+// Keys looked up in every symbol definition object
+typedef struct {
+    NexusJsonKey name;
+    NexusJsonKey version;
+    NexusJsonKey type;
+} SymbolKeys;
+
 // Helper function to parse a symbol definition from JSON
-static void parse_symbol_definition(NexusJsonValue* symbol_json, SymbolDefinition* symbol) {
+static void parse_symbol_definition(NexusJsonValue* symbol_json, const SymbolKeys* keys, SymbolDefinition* symbol) {
     // Check if symbol is a string (legacy format) or object (new format)
     if (symbol_json->type == NEXUS_JSON_STRING) {
         // Legacy format: just the name
@@ -14,9 +21,9 @@ static void parse_symbol_definition(NexusJsonValue* symbol_json, SymbolDefinitio
         symbol->type = 0;  // Default to function
     } else if (symbol_json->type == NEXUS_JSON_OBJECT) {
         // New format: {name, version, type}
-        const char* name = nexus_json_object_get_string(symbol_json, "name", NULL);
-        const char* version = nexus_json_object_get_string(symbol_json, "version", "1.0.0");
-        int type = (int)nexus_json_object_get_number(symbol_json, "type", 0);
+        const char* name = nexus_json_object_get_string_key(symbol_json, &keys->name, NULL);
+        const char* version = nexus_json_object_get_string_key(symbol_json, &keys->version, "1.0.0");
+        int type = (int)nexus_json_object_get_number_key(symbol_json, &keys->type, 0);
         
         symbol->name = name ? strdup(name) : strdup("");
         symbol->version = version ? strdup(version) : strdup("1.0.0");
@@ -36,10 +43,13 @@ EnhancedComponentMetadata* nexus_load_enhanced_metadata(const char* metadata_pat
     EnhancedComponentMetadata* metadata = (EnhancedComponentMetadata*)malloc(sizeof(EnhancedComponentMetadata));
     memset(metadata, 0, sizeof(EnhancedComponentMetadata));
     
-    // Parse the JSON file
-    NexusJsonValue* root = nexus_json_parse_file(metadata_path);
+    // Parse the JSON file; every field of interest is copied out, so the
+    // whole document can live in one arena and be dropped at once
+    NexusJsonArena* arena = nexus_json_arena_create(0);
+    NexusJsonValue* root = arena ? nexus_json_parse_file_arena(arena, metadata_path) : NULL;
     if (!root) {
         fprintf(stderr, "Error: Could not parse metadata file: %s\n", metadata_path);
+        nexus_json_arena_destroy(arena);
         free(metadata);
         return NULL;
     }
@@ -66,6 +76,12 @@ EnhancedComponentMetadata* nexus_load_enhanced_metadata(const char* metadata_pat
         metadata->dependencies_count = dependencies->data.array.count;
         metadata->dependencies = (EnhancedDependency*)malloc(metadata->dependencies_count * sizeof(EnhancedDependency));
         
+        // Every dependency object is searched for the same keys
+        const NexusJsonKey key_id = nexus_json_key("id");
+        const NexusJsonKey key_version_req = nexus_json_key("version_req");
+        const NexusJsonKey key_version = nexus_json_key("version");
+        const NexusJsonKey key_optional = nexus_json_key("optional");
+        
         for (size_t i = 0; i < dependencies->data.array.count; i++) {
             NexusJsonValue* dep = dependencies->data.array.items[i];
             
@@ -75,19 +91,23 @@ EnhancedComponentMetadata* nexus_load_enhanced_metadata(const char* metadata_pat
                 metadata->dependencies[i].version_req = NULL;
                 metadata->dependencies[i].optional = false;
                 metadata->dependencies[i].resolved_version = NULL;
+                metadata->dependencies[i].constraint = NULL;
                 
                 // Extract values
-                const char* dep_id = nexus_json_object_get_string(dep, "id", NULL);
+                const char* dep_id = nexus_json_object_get_string_key(dep, &key_id, NULL);
                 if (dep_id) metadata->dependencies[i].id = strdup(dep_id);
                 
                 // Check for version_req (new format) or version (legacy format)
-                const char* dep_version_req = nexus_json_object_get_string(dep, "version_req", NULL);
+                const char* dep_version_req = nexus_json_object_get_string_key(dep, &key_version_req, NULL);
                 if (!dep_version_req) {
-                    dep_version_req = nexus_json_object_get_string(dep, "version", NULL);
+                    dep_version_req = nexus_json_object_get_string_key(dep, &key_version, NULL);
+                }
+                if (dep_version_req) {
+                    metadata->dependencies[i].version_req = strdup(dep_version_req);
+                    metadata->dependencies[i].constraint = semver_constraint_compile(dep_version_req);
                 }
-                if (dep_version_req) metadata->dependencies[i].version_req = strdup(dep_version_req);
                 
-                NexusJsonValue* optional = nexus_json_object_get(dep, "optional");
+                NexusJsonValue* optional = nexus_json_object_get_key(dep, &key_optional);
                 if (optional && optional->type == NEXUS_JSON_BOOL) {
                     metadata->dependencies[i].optional = optional->data.boolean;
                 }
@@ -95,6 +115,12 @@ EnhancedComponentMetadata* nexus_load_enhanced_metadata(const char* metadata_pat
         }
     }
     
+    SymbolKeys symbol_keys = {
+        nexus_json_key("name"),
+        nexus_json_key("version"),
+        nexus_json_key("type")
+    };
+    
     // Process exported symbols
     NexusJsonValue* exported = nexus_json_object_get(root, "exported_symbols");
     if (exported && exported->type == NEXUS_JSON_ARRAY) {
@@ -103,7 +129,7 @@ EnhancedComponentMetadata* nexus_load_enhanced_metadata(const char* metadata_pat
         
         for (size_t i = 0; i < exported->data.array.count; i++) {
             NexusJsonValue* symbol = exported->data.array.items[i];
-            parse_symbol_definition(symbol, &metadata->exported_symbols[i]);
+            parse_symbol_definition(symbol, &symbol_keys, &metadata->exported_symbols[i]);
         }
     }
     
@@ -115,7 +141,7 @@ EnhancedComponentMetadata* nexus_load_enhanced_metadata(const char* metadata_pat
         
         for (size_t i = 0; i < imported->data.array.count; i++) {
             NexusJsonValue* symbol = imported->data.array.items[i];
-            parse_symbol_definition(symbol, &metadata->imported_symbols[i]);
+            parse_symbol_definition(symbol, &symbol_keys, &metadata->imported_symbols[i]);
         }
     }
     
@@ -135,8 +161,8 @@ EnhancedComponentMetadata* nexus_load_enhanced_metadata(const char* metadata_pat
     metadata->last_used = 0;
     metadata->loaded = false;
     
-    // Clean up JSON object
-    nexus_json_free(root);
+    // Clean up JSON document
+    nexus_json_arena_destroy(arena);
     
     return metadata;
 }
@@ -169,21 +195,21 @@ bool nexus_enhanced_metadata_check_version_compatibility(
         return false;
     
     // Find the dependency relationship
-    const char* version_req = NULL;
+    const EnhancedDependency* dep = NULL;
     for (size_t i = 0; i < component->dependencies_count; i++) {
         if (strcmp(component->dependencies[i].id, dependency->id) == 0) {
-            version_req = component->dependencies[i].version_req;
+            dep = &component->dependencies[i];
             break;
         }
     }
     
-    if (!version_req) {
+    if (!dep || !dep->version_req) {
         // No explicit dependency relationship found
         return false;
     }
     
-    // Check if dependency's version satisfies the requirement
-    return semver_satisfies(dependency->version, version_req);
+    // Check the pre-parsed version against the compiled requirement
+    return semver_constraint_matches(dep->constraint, dependency->parsed_version);
 }
 
 // Check if a component satisfies all its dependencies
@@ -210,7 +236,7 @@ bool nexus_enhanced_metadata_check_dependencies(
             if (comp && comp->id && strcmp(comp->id, dep->id) == 0) {
                 // Check version compatibility if specified
                 if (dep->version_req && comp->version) {
-                    if (semver_satisfies(comp->version, dep->version_req)) {
+                    if (semver_constraint_matches(dep->constraint, comp->parsed_version)) {
                         found = true;
                         break;
                     }
@@ -248,6 +274,11 @@ const EnhancedComponentMetadata* nexus_enhanced_metadata_resolve_version(
     const EnhancedComponentMetadata* best_match = NULL;
     int best_match_score = -1;
     
+    // Compile the constraint once for all candidates
+    SemVerConstraint* constraint = semver_constraint_compile(version_constraint);
+    if (!constraint)
+        return NULL;
+    
     // Find all components matching the ID
     for (size_t i = 0; i < num_available_components; i++) {
         const EnhancedComponentMetadata* comp = available_components[i];
@@ -256,7 +287,7 @@ const EnhancedComponentMetadata* nexus_enhanced_metadata_resolve_version(
             continue;
         
         // Check version constraint
-        if (!comp->version || !semver_satisfies(comp->version, version_constraint))
+        if (!comp->version || !semver_constraint_matches(constraint, comp->parsed_version))
             continue;
         
         // Calculate a score for this match (higher is better)
@@ -283,6 +314,7 @@ const EnhancedComponentMetadata* nexus_enhanced_metadata_resolve_version(
         }
     }
     
+    semver_constraint_free(constraint);
     return best_match;
 }
 
@@ -300,6 +332,7 @@ void nexus_free_enhanced_metadata(EnhancedComponentMetadata* metadata) {
         free(metadata->dependencies[i].id);
         free(metadata->dependencies[i].version_req);
         free(metadata->dependencies[i].resolved_version);
+        semver_constraint_free(metadata->dependencies[i].constraint);
     }
     free(metadata->dependencies);
     
@@ -373,6 +406,7 @@ void nexus_enhanced_metadata_add_dependency(
     dep->version_req = version_req ? strdup(version_req) : strdup("*");
     dep->optional = optional;
     dep->resolved_version = NULL;
+    dep->constraint = semver_constraint_compile(dep->version_req);
     
     metadata->dependencies_count++;
 }
@@ -10,10 +10,13 @@ ComponentMetadata* nexus_load_metadata(const char* metadata_path) {
 	ComponentMetadata* metadata = (ComponentMetadata*)malloc(sizeof(ComponentMetadata));
 	memset(metadata, 0, sizeof(ComponentMetadata));
 	
-	// Parse the JSON file
-	NexusJsonValue* root = nexus_json_parse_file(metadata_path);
+	// Parse the JSON file; every field of interest is copied out, so the
+	// whole document can live in one arena and be dropped at once
+	NexusJsonArena* arena = nexus_json_arena_create(0);
+	NexusJsonValue* root = arena ? nexus_json_parse_file_arena(arena, metadata_path) : NULL;
 	if (!root) {
 		fprintf(stderr, "Error: Could not parse metadata file: %s\n", metadata_path);
+		nexus_json_arena_destroy(arena);
 		free(metadata);
 		return NULL;
 	}
@@ -34,6 +37,11 @@ ComponentMetadata* nexus_load_metadata(const char* metadata_path) {
 		metadata->dependencies_count = dependencies->data.array.count;
 		metadata->dependencies = (Dependency*)malloc(metadata->dependencies_count * sizeof(Dependency));
 		
+		// Every dependency object is searched for the same keys
+		const NexusJsonKey key_id = nexus_json_key("id");
+		const NexusJsonKey key_version = nexus_json_key("version");
+		const NexusJsonKey key_optional = nexus_json_key("optional");
+		
 		for (size_t i = 0; i < dependencies->data.array.count; i++) {
 			NexusJsonValue* dep = dependencies->data.array.items[i];
 			
@@ -44,13 +52,13 @@ ComponentMetadata* nexus_load_metadata(const char* metadata_path) {
 				metadata->dependencies[i].optional = false;
 				
 				// Extract values
-				const char* dep_id = nexus_json_object_get_string(dep, "id", NULL);
+				const char* dep_id = nexus_json_object_get_string_key(dep, &key_id, NULL);
 				if (dep_id) metadata->dependencies[i].id = strdup(dep_id);
 				
-				const char* dep_version = nexus_json_object_get_string(dep, "version", NULL);
+				const char* dep_version = nexus_json_object_get_string_key(dep, &key_version, NULL);
 				if (dep_version) metadata->dependencies[i].version = strdup(dep_version);
 				
-				NexusJsonValue* optional = nexus_json_object_get(dep, "optional");
+				NexusJsonValue* optional = nexus_json_object_get_key(dep, &key_optional);
 				if (optional && optional->type == NEXUS_JSON_BOOL) {
 					metadata->dependencies[i].optional = optional->data.boolean;
 				}
@@ -106,8 +114,8 @@ ComponentMetadata* nexus_load_metadata(const char* metadata_path) {
 	metadata->last_used = 0;
 	metadata->loaded = false;
 	
-	// Clean up JSON object
-	nexus_json_free(root);
+	// Clean up JSON document
+	nexus_json_arena_destroy(arena);
 	
 	return metadata;
 }
@@ -0,0 +1,696 @@
+// src/core/metadata/metadata_cache.c
+// Binary on-disk cache of parsed component metadata
+// Author: Implementation Team
+
+#define _GNU_SOURCE
+
+#include "nlink/core/metadata/metadata_cache.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdalign.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*
+ * File layout, every section aligned for the structures it holds:
+ *
+ *   MetadataCacheHeader
+ *   buckets       uint32_t[bucket_mask + 1], entry index + 1 by path hash, 0 if empty
+ *   entries       MetadataCacheEntry[entry_count]
+ *   arrays        dependencies, symbols, SemVer and SemVerConstraint data
+ *   relocations   uint64_t[relocation_count], offsets of the pointer fields
+ *   strings       NUL-terminated, deduplicated
+ *
+ * A pointer field holds the offset of its target from the start of the
+ * file until the cache is opened; NULL pointers are stored as 0 and have
+ * no relocation.
+ */
+
+static const char METADATA_CACHE_MAGIC[8] = { 'N', 'L', 'M', 'E', 'T', 'A', 'C', '\0' };
+
+typedef struct {
+    char magic[8];
+    uint32_t version;               // NEXUS_METADATA_CACHE_VERSION
+    uint32_t layout;                // Structure sizes and byte order of the writer
+    uint64_t file_size;
+    uint64_t entry_count;
+    uint64_t bucket_mask;
+    uint64_t buckets_offset;
+    uint64_t entries_offset;
+    uint64_t relocations_offset;
+    uint64_t relocation_count;
+    uint64_t strings_offset;
+} MetadataCacheHeader;
+
+typedef struct {
+    EnhancedComponentMetadata metadata;
+    const char* source_path;        // JSON file the metadata was loaded from
+    uint64_t path_hash;
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    uint64_t size;
+    uint64_t content_hash;          // FNV-1a of the JSON file
+} MetadataCacheEntry;
+
+struct NexusMetadataCache {
+    unsigned char* base;
+    size_t size;
+    const MetadataCacheHeader* header;
+    const uint32_t* buckets;
+    MetadataCacheEntry* entries;
+};
+
+// Pointer field to patch once the final layout is known
+typedef struct {
+    uint64_t field;                 // Offset of the pointer field
+    uint64_t target;                // Offset of the target, in the string table if is_string
+    bool is_string;
+} CacheFixup;
+
+// Cache file under construction
+typedef struct {
+    unsigned char* data;            // Header, buckets, entries and arrays
+    size_t size;
+    size_t capacity;
+    char* strings;
+    size_t strings_size;
+    size_t strings_capacity;
+    uint32_t* string_slots;         // Deduplication: string offset + 1 by hash
+    size_t string_mask;
+    size_t string_count;
+    CacheFixup* fixups;
+    size_t fixup_count;
+    size_t fixup_capacity;
+    bool failed;
+} CacheImage;
+
+static uint64_t cache_hash_bytes(uint64_t hash, const void* data, size_t length) {
+    const unsigned char* p = (const unsigned char*)data;
+
+    for (size_t i = 0; i < length; i++) {
+        hash ^= p[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static uint64_t cache_hash_string(const char* s) {
+    return cache_hash_bytes(14695981039346656037ULL, s, strlen(s));
+}
+
+// Fingerprint of everything the layout depends on
+static uint32_t cache_layout(void) {
+    const uint64_t sizes[] = {
+        0x0102030405060708ULL,
+        sizeof(void*),
+        sizeof(MetadataCacheEntry),
+        sizeof(EnhancedComponentMetadata),
+        sizeof(EnhancedDependency),
+        sizeof(SymbolDefinition),
+        sizeof(SemVer),
+        sizeof(SemVerConstraint),
+        sizeof(SemVerComparator),
+        sizeof(time_t)
+    };
+    uint64_t hash = cache_hash_bytes(14695981039346656037ULL, sizes, sizeof(sizes));
+    return (uint32_t)(hash ^ (hash >> 32));
+}
+
+// Hash a file's contents
+static bool cache_hash_file(const char* path, uint64_t* hash) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    unsigned char buffer[65536];
+    uint64_t value = 14695981039346656037ULL;
+    ssize_t length;
+    while ((length = read(fd, buffer, sizeof(buffer))) != 0) {
+        if (length < 0) {
+            if (errno == EINTR) continue;
+            close(fd);
+            return false;
+        }
+        value = cache_hash_bytes(value, buffer, (size_t)length);
+    }
+
+    close(fd);
+    *hash = value;
+    return true;
+}
+
+// Reserve zeroed, aligned space in the structure area; returns its offset
+static size_t image_alloc(CacheImage* image, size_t size, size_t align) {
+    size_t offset = (image->size + align - 1) & ~(align - 1);
+
+    if (offset + size > image->capacity) {
+        size_t capacity = image->capacity ? image->capacity : 4096;
+        while (offset + size > capacity) {
+            capacity *= 2;
+        }
+        unsigned char* data = (unsigned char*)realloc(image->data, capacity);
+        if (!data) {
+            image->failed = true;
+            return 0;
+        }
+        image->data = data;
+        image->capacity = capacity;
+    }
+
+    memset(image->data + image->size, 0, offset + size - image->size);
+    image->size = offset + size;
+    return offset;
+}
+
+static void image_fixup(CacheImage* image, size_t field, size_t target, bool is_string) {
+    if (image->failed) {
+        return;
+    }
+
+    if (image->fixup_count == image->fixup_capacity) {
+        size_t capacity = image->fixup_capacity ? image->fixup_capacity * 2 : 256;
+        CacheFixup* fixups = (CacheFixup*)realloc(image->fixups, capacity * sizeof(CacheFixup));
+        if (!fixups) {
+            image->failed = true;
+            return;
+        }
+        image->fixups = fixups;
+        image->fixup_capacity = capacity;
+    }
+
+    image->fixups[image->fixup_count++] = (CacheFixup){ field, target, is_string };
+}
+
+static bool image_grow_strings(CacheImage* image) {
+    size_t slots = image->string_mask ? (image->string_mask + 1) * 2 : 256;
+    uint32_t* table = (uint32_t*)calloc(slots, sizeof(uint32_t));
+    if (!table) {
+        return false;
+    }
+
+    for (size_t i = 0; image->string_mask && i <= image->string_mask; i++) {
+        if (image->string_slots[i] == 0) continue;
+        size_t slot = cache_hash_string(image->strings + image->string_slots[i] - 1) & (slots - 1);
+        while (table[slot] != 0) {
+            slot = (slot + 1) & (slots - 1);
+        }
+        table[slot] = image->string_slots[i];
+    }
+
+    free(image->string_slots);
+    image->string_slots = table;
+    image->string_mask = slots - 1;
+    return true;
+}
+
+// Add a string to the string table, reusing an identical one; returns its offset
+static size_t image_string(CacheImage* image, const char* s) {
+    if ((image->string_count + 1) * 2 > image->string_mask + 1 && !image_grow_strings(image)) {
+        image->failed = true;
+        return 0;
+    }
+
+    size_t slot = cache_hash_string(s) & image->string_mask;
+    while (image->string_slots[slot] != 0) {
+        const char* existing = image->strings + image->string_slots[slot] - 1;
+        if (strcmp(existing, s) == 0) {
+            return image->string_slots[slot] - 1;
+        }
+        slot = (slot + 1) & image->string_mask;
+    }
+
+    // Slots hold 32-bit offsets
+    size_t length = strlen(s) + 1;
+    if (image->strings_size + length >= UINT32_MAX) {
+        image->failed = true;
+        return 0;
+    }
+    if (image->strings_size + length > image->strings_capacity) {
+        size_t capacity = image->strings_capacity ? image->strings_capacity : 4096;
+        while (image->strings_size + length > capacity) {
+            capacity *= 2;
+        }
+        char* strings = (char*)realloc(image->strings, capacity);
+        if (!strings) {
+            image->failed = true;
+            return 0;
+        }
+        image->strings = strings;
+        image->strings_capacity = capacity;
+    }
+
+    size_t offset = image->strings_size;
+    memcpy(image->strings + offset, s, length);
+    image->strings_size += length;
+    image->string_slots[slot] = (uint32_t)offset + 1;
+    image->string_count++;
+    return offset;
+}
+
+// Point the char* field at offset field to a copy of s
+static void image_string_field(CacheImage* image, size_t field, const char* s) {
+    if (s) {
+        size_t offset = image_string(image, s);
+        image_fixup(image, field, offset, true);
+    }
+}
+
+// Serialize a SemVer stored inline at offset
+static void image_semver(CacheImage* image, size_t offset, const SemVer* version) {
+    SemVer copy = *version;
+    copy.prerelease = NULL;
+    copy.build = NULL;
+    memcpy(image->data + offset, &copy, sizeof(SemVer));
+
+    image_string_field(image, offset + offsetof(SemVer, prerelease), version->prerelease);
+    image_string_field(image, offset + offsetof(SemVer, build), version->build);
+}
+
+// Serialize a compiled constraint and point the field at offset field to it
+static void image_constraint(CacheImage* image, size_t field, const SemVerConstraint* constraint) {
+    size_t offset = image_alloc(image, sizeof(SemVerConstraint), alignof(SemVerConstraint));
+    if (image->failed) return;
+    image_fixup(image, field, offset, false);
+
+    SemVerConstraint copy = { NULL, constraint->comparator_count, NULL, constraint->set_count };
+    memcpy(image->data + offset, &copy, sizeof(copy));
+
+    if (constraint->comparator_count > 0) {
+        size_t comparators = image_alloc(image, constraint->comparator_count * sizeof(SemVerComparator),
+                                         alignof(SemVerComparator));
+        if (image->failed) return;
+        image_fixup(image, offset + offsetof(SemVerConstraint, comparators), comparators, false);
+
+        for (size_t i = 0; i < constraint->comparator_count; i++) {
+            size_t at = comparators + i * sizeof(SemVerComparator);
+            memcpy(image->data + at + offsetof(SemVerComparator, op), &constraint->comparators[i].op, sizeof(SemVerOp));
+            image_semver(image, at + offsetof(SemVerComparator, version), &constraint->comparators[i].version);
+        }
+    }
+
+    if (constraint->set_count > 0) {
+        size_t set_ends = image_alloc(image, constraint->set_count * sizeof(size_t), alignof(size_t));
+        if (image->failed) return;
+        image_fixup(image, offset + offsetof(SemVerConstraint, set_ends), set_ends, false);
+        memcpy(image->data + set_ends, constraint->set_ends, constraint->set_count * sizeof(size_t));
+    }
+}
+
+// Serialize a symbol array and point the field at offset field to it
+static void image_symbols(CacheImage* image, size_t field, const SymbolDefinition* symbols, size_t count) {
+    if (!symbols || count == 0) {
+        return;
+    }
+
+    size_t offset = image_alloc(image, count * sizeof(SymbolDefinition), alignof(SymbolDefinition));
+    if (image->failed) return;
+    image_fixup(image, field, offset, false);
+
+    for (size_t i = 0; i < count; i++) {
+        size_t at = offset + i * sizeof(SymbolDefinition);
+        memcpy(image->data + at + offsetof(SymbolDefinition, type), &symbols[i].type, sizeof(int));
+        image_string_field(image, at + offsetof(SymbolDefinition, name), symbols[i].name);
+        image_string_field(image, at + offsetof(SymbolDefinition, version), symbols[i].version);
+    }
+}
+
+// Serialize one component into the entry at offset
+static void image_entry(CacheImage* image, size_t offset, const char* path,
+                        const struct stat* st, uint64_t content_hash,
+                        const EnhancedComponentMetadata* metadata) {
+    size_t base = offset + offsetof(MetadataCacheEntry, metadata);
+
+    // Scalars first; pointer fields are filled in by fixups
+    EnhancedComponentMetadata copy = *metadata;
+    copy.id = copy.version = copy.description = NULL;
+    copy.dependencies = NULL;
+    copy.exported_symbols = copy.imported_symbols = NULL;
+    copy.parsed_version = NULL;
+    if (!metadata->dependencies) copy.dependencies_count = 0;
+    if (!metadata->exported_symbols) copy.exported_count = 0;
+    if (!metadata->imported_symbols) copy.imported_count = 0;
+    memcpy(image->data + base, &copy, sizeof(copy));
+
+    MetadataCacheEntry key;
+    memset(&key, 0, sizeof(key));
+    key.path_hash = cache_hash_string(path);
+    key.mtime_sec = (int64_t)st->st_mtim.tv_sec;
+    key.mtime_nsec = (int64_t)st->st_mtim.tv_nsec;
+    key.size = (uint64_t)st->st_size;
+    key.content_hash = content_hash;
+    memcpy(image->data + offset + offsetof(MetadataCacheEntry, path_hash), &key.path_hash,
+           sizeof(key) - offsetof(MetadataCacheEntry, path_hash));
+
+    image_string_field(image, offset + offsetof(MetadataCacheEntry, source_path), path);
+    image_string_field(image, base + offsetof(EnhancedComponentMetadata, id), metadata->id);
+    image_string_field(image, base + offsetof(EnhancedComponentMetadata, version), metadata->version);
+    image_string_field(image, base + offsetof(EnhancedComponentMetadata, description), metadata->description);
+
+    if (copy.dependencies_count > 0) {
+        size_t dependencies = image_alloc(image, copy.dependencies_count * sizeof(EnhancedDependency),
+                                          alignof(EnhancedDependency));
+        if (image->failed) return;
+        image_fixup(image, base + offsetof(EnhancedComponentMetadata, dependencies), dependencies, false);
+
+        for (size_t i = 0; i < copy.dependencies_count; i++) {
+            const EnhancedDependency* dependency = &metadata->dependencies[i];
+            size_t at = dependencies + i * sizeof(EnhancedDependency);
+            memcpy(image->data + at + offsetof(EnhancedDependency, optional), &dependency->optional, sizeof(bool));
+            image_string_field(image, at + offsetof(EnhancedDependency, id), dependency->id);
+            image_string_field(image, at + offsetof(EnhancedDependency, version_req), dependency->version_req);
+            image_string_field(image, at + offsetof(EnhancedDependency, resolved_version), dependency->resolved_version);
+            if (dependency->constraint) {
+                image_constraint(image, at + offsetof(EnhancedDependency, constraint), dependency->constraint);
+            }
+        }
+    }
+
+    image_symbols(image, base + offsetof(EnhancedComponentMetadata, exported_symbols),
+                  metadata->exported_symbols, copy.exported_count);
+    image_symbols(image, base + offsetof(EnhancedComponentMetadata, imported_symbols),
+                  metadata->imported_symbols, copy.imported_count);
+
+    if (metadata->parsed_version) {
+        size_t version = image_alloc(image, sizeof(SemVer), alignof(SemVer));
+        if (image->failed) return;
+        image_fixup(image, base + offsetof(EnhancedComponentMetadata, parsed_version), version, false);
+        image_semver(image, version, metadata->parsed_version);
+    }
+}
+
+// Write a cache file holding metadata[i] keyed by metadata_paths[i]
+bool nexus_metadata_cache_write(
+    const char* cache_path,
+    const char* const* metadata_paths,
+    const EnhancedComponentMetadata* const* metadata,
+    size_t count
+) {
+    if (!cache_path || (count > 0 && (!metadata_paths || !metadata))) return false;
+
+    // Key every source file as it is now; unreadable ones are left out
+    struct stat* stats = (struct stat*)calloc(count ? count : 1, sizeof(struct stat));
+    uint64_t* hashes = (uint64_t*)calloc(count ? count : 1, sizeof(uint64_t));
+    size_t* order = (size_t*)calloc(count ? count : 1, sizeof(size_t));
+    if (!stats || !hashes || !order) {
+        free(stats);
+        free(hashes);
+        free(order);
+        return false;
+    }
+
+    size_t entries = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (metadata[i] && metadata_paths[i] && stat(metadata_paths[i], &stats[entries]) == 0 &&
+            cache_hash_file(metadata_paths[i], &hashes[entries])) {
+            order[entries++] = i;
+        }
+    }
+
+    size_t buckets = 16;
+    while (buckets < entries * 2) {
+        buckets *= 2;
+    }
+
+    CacheImage image;
+    memset(&image, 0, sizeof(image));
+    image_alloc(&image, sizeof(MetadataCacheHeader), alignof(MetadataCacheHeader));
+    size_t buckets_offset = image_alloc(&image, buckets * sizeof(uint32_t), alignof(uint32_t));
+    size_t entries_offset = image_alloc(&image, (entries ? entries : 1) * sizeof(MetadataCacheEntry),
+                                        alignof(MetadataCacheEntry));
+
+    for (size_t e = 0; e < entries && !image.failed; e++) {
+        size_t i = order[e];
+        image_entry(&image, entries_offset + e * sizeof(MetadataCacheEntry), metadata_paths[i],
+                    &stats[e], hashes[e], metadata[i]);
+
+        if (image.failed) break;
+        uint32_t* table = (uint32_t*)(image.data + buckets_offset);
+        size_t slot = cache_hash_string(metadata_paths[i]) & (buckets - 1);
+        while (table[slot] != 0) {
+            slot = (slot + 1) & (buckets - 1);
+        }
+        table[slot] = (uint32_t)e + 1;
+    }
+
+    // Relocation table and the string table close the file
+    image_string(&image, "");
+    size_t relocations_offset = image_alloc(&image, image.fixup_count * sizeof(uint64_t), alignof(uint64_t));
+    size_t strings_offset = image.size;
+
+    bool written = false;
+    if (!image.failed) {
+        uint64_t* relocations = (uint64_t*)(image.data + relocations_offset);
+        for (size_t i = 0; i < image.fixup_count; i++) {
+            const CacheFixup* fixup = &image.fixups[i];
+            uintptr_t target = (uintptr_t)(fixup->is_string ? strings_offset + fixup->target : fixup->target);
+            memcpy(image.data + fixup->field, &target, sizeof(target));
+            relocations[i] = fixup->field;
+        }
+
+        MetadataCacheHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, METADATA_CACHE_MAGIC, sizeof(header.magic));
+        header.version = NEXUS_METADATA_CACHE_VERSION;
+        header.layout = cache_layout();
+        header.file_size = strings_offset + image.strings_size;
+        header.entry_count = entries;
+        header.bucket_mask = buckets - 1;
+        header.buckets_offset = buckets_offset;
+        header.entries_offset = entries_offset;
+        header.relocations_offset = relocations_offset;
+        header.relocation_count = image.fixup_count;
+        header.strings_offset = strings_offset;
+        memcpy(image.data, &header, sizeof(header));
+
+        // Write beside the target and rename over it
+        size_t temp_length = strlen(cache_path) + 32;
+        char* temp_path = (char*)malloc(temp_length);
+        if (temp_path) {
+            snprintf(temp_path, temp_length, "%s.%ld.tmp", cache_path, (long)getpid());
+            FILE* file = fopen(temp_path, "wb");
+            if (file) {
+                written = fwrite(image.data, 1, image.size, file) == image.size &&
+                          fwrite(image.strings, 1, image.strings_size, file) == image.strings_size;
+                written = (fclose(file) == 0) && written;
+                written = written && rename(temp_path, cache_path) == 0;
+                if (!written) {
+                    unlink(temp_path);
+                }
+            }
+            free(temp_path);
+        }
+    }
+
+    free(image.data);
+    free(image.strings);
+    free(image.string_slots);
+    free(image.fixups);
+    free(stats);
+    free(hashes);
+    free(order);
+    return written;
+}
+
+// Check the header against the mapping and relocate every pointer
+static bool cache_relocate(unsigned char* base, size_t size) {
+    if (size < sizeof(MetadataCacheHeader)) return false;
+
+    const MetadataCacheHeader* header = (const MetadataCacheHeader*)base;
+    if (memcmp(header->magic, METADATA_CACHE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != NEXUS_METADATA_CACHE_VERSION ||
+        header->layout != cache_layout() ||
+        header->file_size != size) {
+        return false;
+    }
+
+    // Sections in order, within the file and aligned
+    uint64_t buckets = header->bucket_mask + 1;
+    if ((buckets & header->bucket_mask) != 0 || buckets > size / sizeof(uint32_t) ||
+        header->entry_count > size / sizeof(MetadataCacheEntry) ||
+        header->relocation_count > size / sizeof(uint64_t) ||
+        header->buckets_offset % alignof(uint32_t) != 0 ||
+        header->entries_offset % alignof(MetadataCacheEntry) != 0 ||
+        header->relocations_offset % alignof(uint64_t) != 0 ||
+        header->buckets_offset + buckets * sizeof(uint32_t) > header->entries_offset ||
+        header->entries_offset + header->entry_count * sizeof(MetadataCacheEntry) > header->relocations_offset ||
+        header->relocations_offset + header->relocation_count * sizeof(uint64_t) > header->strings_offset ||
+        header->strings_offset >= size ||
+        base[size - 1] != '\0') {
+        return false;
+    }
+
+    const uint32_t* table = (const uint32_t*)(base + header->buckets_offset);
+    for (uint64_t i = 0; i < buckets; i++) {
+        if (table[i] > header->entry_count) return false;
+    }
+
+    // Pointer fields live before the relocation table and point into the file
+    const uint64_t* relocations = (const uint64_t*)(base + header->relocations_offset);
+    for (uint64_t i = 0; i < header->relocation_count; i++) {
+        uint64_t field = relocations[i];
+        if (field % alignof(void*) != 0 || field + sizeof(void*) > header->relocations_offset) {
+            return false;
+        }
+
+        uintptr_t target;
+        memcpy(&target, base + field, sizeof(target));
+        if (target == 0 || target >= size) {
+            return false;
+        }
+        target += (uintptr_t)base;
+        memcpy(base + field, &target, sizeof(target));
+    }
+
+    return true;
+}
+
+// Map a cache file
+NexusMetadataCache* nexus_metadata_cache_open(const char* cache_path) {
+    if (!cache_path) return NULL;
+
+    int fd = open(cache_path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+
+    // Private and writable: relocation and usage tracking never reach the file
+    size_t size = (size_t)st.st_size;
+    void* mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) return NULL;
+
+    NexusMetadataCache* cache = (NexusMetadataCache*)malloc(sizeof(NexusMetadataCache));
+    if (!cache || !cache_relocate((unsigned char*)mapping, size)) {
+        free(cache);
+        munmap(mapping, size);
+        return NULL;
+    }
+
+    cache->base = (unsigned char*)mapping;
+    cache->size = size;
+    cache->header = (const MetadataCacheHeader*)mapping;
+    cache->buckets = (const uint32_t*)(cache->base + cache->header->buckets_offset);
+    cache->entries = (MetadataCacheEntry*)(cache->base + cache->header->entries_offset);
+    return cache;
+}
+
+// Find the metadata loaded from a JSON file
+EnhancedComponentMetadata* nexus_metadata_cache_lookup(NexusMetadataCache* cache, const char* metadata_path) {
+    if (!cache || !metadata_path) return NULL;
+
+    uint64_t hash = cache_hash_string(metadata_path);
+    uint64_t mask = cache->header->bucket_mask;
+    MetadataCacheEntry* entry = NULL;
+
+    for (uint64_t slot = hash & mask, probes = 0; probes <= mask; slot = (slot + 1) & mask, probes++) {
+        uint32_t index = cache->buckets[slot];
+        if (index == 0) break;
+
+        MetadataCacheEntry* candidate = &cache->entries[index - 1];
+        if (candidate->path_hash == hash && strcmp(candidate->source_path, metadata_path) == 0) {
+            entry = candidate;
+            break;
+        }
+    }
+    if (!entry) return NULL;
+
+    // Unchanged file, or touched without changing its contents
+    struct stat st;
+    if (stat(metadata_path, &st) != 0 || (uint64_t)st.st_size != entry->size) {
+        return NULL;
+    }
+    if ((int64_t)st.st_mtim.tv_sec == entry->mtime_sec && (int64_t)st.st_mtim.tv_nsec == entry->mtime_nsec) {
+        return &entry->metadata;
+    }
+
+    uint64_t content_hash;
+    if (cache_hash_file(metadata_path, &content_hash) && content_hash == entry->content_hash) {
+        return &entry->metadata;
+    }
+    return NULL;
+}
+
+// Number of cached components
+size_t nexus_metadata_cache_count(const NexusMetadataCache* cache) {
+    return cache ? (size_t)cache->header->entry_count : 0;
+}
+
+// Unmap a cache file
+void nexus_metadata_cache_close(NexusMetadataCache* cache) {
+    if (!cache) return;
+
+    munmap(cache->base, cache->size);
+    free(cache);
+}
+
+// Load metadata for a set of components through a cache file
+NexusMetadataCache* nexus_metadata_cache_load(
+    const char* cache_path,
+    const char* const* metadata_paths,
+    size_t count,
+    EnhancedComponentMetadata** metadata_out
+) {
+    if (!cache_path || (count > 0 && (!metadata_paths || !metadata_out))) return NULL;
+
+    // Warm start: every component found and fresh
+    NexusMetadataCache* cache = nexus_metadata_cache_open(cache_path);
+    size_t misses = 0;
+    for (size_t i = 0; i < count; i++) {
+        metadata_out[i] = nexus_metadata_cache_lookup(cache, metadata_paths[i]);
+        if (!metadata_out[i]) misses++;
+    }
+    if (cache && misses == 0) {
+        return cache;
+    }
+
+    // Parse what is missing and rewrite the cache with everything
+    EnhancedComponentMetadata** parsed = (EnhancedComponentMetadata**)calloc(count ? count : 1, sizeof(EnhancedComponentMetadata*));
+    const EnhancedComponentMetadata** sources = (const EnhancedComponentMetadata**)calloc(count ? count : 1, sizeof(EnhancedComponentMetadata*));
+    if (!parsed || !sources) {
+        free(parsed);
+        free(sources);
+        nexus_metadata_cache_close(cache);
+        return NULL;
+    }
+
+    size_t added = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (!metadata_out[i]) {
+            parsed[i] = nexus_load_enhanced_metadata(metadata_paths[i]);
+            added += parsed[i] != NULL;
+        }
+        sources[i] = metadata_out[i] ? metadata_out[i] : parsed[i];
+    }
+
+    // Nothing new to store: files that fail to parse stay uncached
+    bool rewrite = !cache || added > 0;
+    bool written = rewrite && nexus_metadata_cache_write(cache_path, metadata_paths, sources, count);
+
+    for (size_t i = 0; i < count; i++) {
+        nexus_free_enhanced_metadata(parsed[i]);
+    }
+    free(parsed);
+    free(sources);
+
+    if (!rewrite) {
+        return cache;
+    }
+    nexus_metadata_cache_close(cache);
+    if (!written) {
+        memset(metadata_out, 0, count * sizeof(EnhancedComponentMetadata*));
+        return NULL;
+    }
+
+    cache = nexus_metadata_cache_open(cache_path);
+    for (size_t i = 0; i < count; i++) {
+        metadata_out[i] = nexus_metadata_cache_lookup(cache, metadata_paths[i]);
+    }
+    return cache;
+}
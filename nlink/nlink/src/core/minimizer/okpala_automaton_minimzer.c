@@ -9,10 +9,12 @@
  */
 
  #include "nlink/core/minimizer/okpala_automaton.h"
+ #include "nlink/core/minimizer/okpala_dense.h"
  #include <stdio.h>
  #include <stdlib.h>
  #include <string.h>
  #include <stdbool.h>
+ #include <stdint.h>
  
  /**
   * @brief Check if two states are equivalent
@@ -209,17 +211,18 @@
  }
  
  /**
-  * @brief Minimize an automaton using Okpala's state machine minimization algorithm
+  * @brief Minimize an automaton using Okpala's pairwise equivalence matrix
   * 
-  * This function creates a new minimized automaton based on the input automaton.
+  * This is the original O(n²)-memory minimizer. It is kept as a reference
+  * implementation for differential testing of okpala_minimize_automaton.
   * The original automaton is not modified.
   * 
   * @param automaton The automaton to minimize
   * @param use_boolean_reduction Whether to use boolean reduction for further optimization
   * @return A new minimized automaton, or NULL if minimization failed
   */
- OkpalaAutomaton* okpala_minimize_automaton(OkpalaAutomaton* automaton, 
-                                         bool use_boolean_reduction) {
+ OkpalaAutomaton* okpala_minimize_automaton_reference(OkpalaAutomaton* automaton, 
+                                                   bool use_boolean_reduction) {
      if (!automaton || automaton->state_count == 0) {
          return NULL;
      }
@@ -435,5 +438,354 @@
      }
      free(equivalence_matrix);
      
+     return minimized;
+ }
+ 
+ /*
+  * Partition-refinement minimizer
+  *
+  * The automaton is first compiled to its dense form (okpala_dense.h), so
+  * input symbols are interned integers and transitions are CSR rows of
+  * (symbol, target) pairs per source state. Minimization then follows Valmari
+  * and Lehtinen's formulation of Hopcroft's algorithm, which refines a
+  * partition of the states and a partition of the transitions against each
+  * other and always processes the smaller half of a split set. It runs in
+  * O(m log n) for m transitions, i.e. O(n·k·log n) for a DFA with n states
+  * over k symbols, and needs O(n + m) memory instead of an n×n matrix.
+  *
+  * Missing transitions are not completed with a sink state, so a state
+  * lacking a transition on some symbol is never merged with one that has
+  * it. This is the equivalence okpala_minimize_automaton_reference computes.
+  * When a state has several transitions on one symbol only the first is
+  * considered, matching the reference lookup.
+  */
+ 
+ // Refinable partition of the integers [0, size)
+ typedef struct {
+     uint32_t set_count;     // Number of sets
+     uint32_t* elements;     // Elements grouped by set
+     uint32_t* location;     // Position of each element in elements
+     uint32_t* set_of;       // Set containing each element
+     uint32_t* first;        // First position of each set
+     uint32_t* past;         // One past the last position of each set
+     uint32_t* marked;       // Number of marked elements of each set
+     uint32_t* touched;      // Sets holding marked elements
+     uint32_t touched_count;
+ } RefinablePartition;
+ 
+ // Release a refinable partition
+ static void partition_free(RefinablePartition* partition) {
+     free(partition->elements);
+     free(partition->location);
+     free(partition->set_of);
+     free(partition->first);
+     free(partition->past);
+     free(partition->marked);
+     free(partition->touched);
+ }
+ 
+ // Create a partition holding every element in a single set
+ static bool partition_init(RefinablePartition* partition, uint32_t size) {
+     size_t slots = size ? size : 1;
+ 
+     memset(partition, 0, sizeof(*partition));
+     partition->elements = (uint32_t*)malloc(slots * sizeof(uint32_t));
+     partition->location = (uint32_t*)malloc(slots * sizeof(uint32_t));
+     partition->set_of = (uint32_t*)malloc(slots * sizeof(uint32_t));
+     partition->first = (uint32_t*)malloc(slots * sizeof(uint32_t));
+     partition->past = (uint32_t*)malloc(slots * sizeof(uint32_t));
+     partition->marked = (uint32_t*)calloc(slots, sizeof(uint32_t));
+     partition->touched = (uint32_t*)malloc(slots * sizeof(uint32_t));
+ 
+     if (!partition->elements || !partition->location || !partition->set_of ||
+         !partition->first || !partition->past || !partition->marked ||
+         !partition->touched) {
+         partition_free(partition);
+         return false;
+     }
+ 
+     for (uint32_t i = 0; i < size; i++) {
+         partition->elements[i] = i;
+         partition->location[i] = i;
+         partition->set_of[i] = 0;
+     }
+ 
+     if (size > 0) {
+         partition->first[0] = 0;
+         partition->past[0] = size;
+         partition->set_count = 1;
+     }
+ 
+     return true;
+ }
+ 
+ // Mark an element by moving it to the marked prefix of its set
+ static void partition_mark(RefinablePartition* partition, uint32_t element) {
+     uint32_t set = partition->set_of[element];
+     uint32_t position = partition->location[element];
+     uint32_t boundary = partition->first[set] + partition->marked[set];
+ 
+     if (position < boundary) {
+         return;  // Already marked
+     }
+ 
+     partition->elements[position] = partition->elements[boundary];
+     partition->location[partition->elements[position]] = position;
+     partition->elements[boundary] = element;
+     partition->location[element] = boundary;
+ 
+     if (partition->marked[set]++ == 0) {
+         partition->touched[partition->touched_count++] = set;
+     }
+ }
+ 
+ // Split every touched set into its marked and unmarked parts
+ static void partition_split(RefinablePartition* partition) {
+     while (partition->touched_count > 0) {
+         uint32_t set = partition->touched[--partition->touched_count];
+         uint32_t boundary = partition->first[set] + partition->marked[set];
+ 
+         if (boundary == partition->past[set]) {
+             partition->marked[set] = 0;  // Everything marked, nothing to split
+             continue;
+         }
+ 
+         // The smaller part becomes the new set so that it gets processed
+         uint32_t created = partition->set_count++;
+         if (partition->marked[set] <= partition->past[set] - boundary) {
+             partition->first[created] = partition->first[set];
+             partition->past[created] = boundary;
+             partition->first[set] = boundary;
+         } else {
+             partition->past[created] = partition->past[set];
+             partition->first[created] = boundary;
+             partition->past[set] = boundary;
+         }
+ 
+         for (uint32_t i = partition->first[created]; i < partition->past[created]; i++) {
+             partition->set_of[partition->elements[i]] = created;
+         }
+ 
+         partition->marked[set] = 0;
+         partition->marked[created] = 0;
+     }
+ }
+ 
+ // Copy the quotient automaton described by a state partition
+ static OkpalaAutomaton* build_quotient(const OkpalaAutomaton* automaton,
+                                        const RefinablePartition* blocks) {
+     size_t n = automaton->state_count;
+     uint32_t* class_of_block = (uint32_t*)malloc(blocks->set_count * sizeof(uint32_t));
+     uint32_t* representative = (uint32_t*)malloc(blocks->set_count * sizeof(uint32_t));
+     OkpalaAutomaton* minimized = okpala_automaton_create();
+ 
+     if (!class_of_block || !representative || !minimized) {
+         free(class_of_block);
+         free(representative);
+         okpala_automaton_free(minimized);
+         return NULL;
+     }
+ 
+     // Number classes by their lowest state so q0 is the class of state 0
+     size_t class_count = 0;
+     size_t final_count = 0;
+     memset(class_of_block, 0xff, blocks->set_count * sizeof(uint32_t));
+     for (size_t s = 0; s < n; s++) {
+         uint32_t block = blocks->set_of[s];
+         if (class_of_block[block] == OKPALA_DENSE_NONE) {
+             class_of_block[block] = (uint32_t)class_count;
+             representative[class_count++] = (uint32_t)s;
+             if (automaton->states[s].is_final) {
+                 final_count++;
+             }
+         }
+     }
+ 
+     minimized->states = (OkpalaState*)calloc(class_count, sizeof(OkpalaState));
+     minimized->final_states = final_count ? (OkpalaState**)malloc(final_count * sizeof(OkpalaState*)) : NULL;
+     bool success = minimized->states && (final_count == 0 || minimized->final_states);
+ 
+     if (success) {
+         minimized->state_count = class_count;
+ 
+         for (size_t c = 0; c < class_count && success; c++) {
+             const OkpalaState* rep = &automaton->states[representative[c]];
+             OkpalaState* state = &minimized->states[c];
+             char new_state_id[32];
+ 
+             snprintf(new_state_id, sizeof(new_state_id), "q%zu", c);
+             state->id = strdup(new_state_id);
+             state->is_final = rep->is_final;
+             if (state->is_final) {
+                 minimized->final_states[minimized->final_state_count++] = state;
+             }
+ 
+             if (rep->transition_count > 0) {
+                 state->transitions = (OkpalaState**)malloc(rep->transition_count * sizeof(OkpalaState*));
+                 state->input_symbols = (char**)malloc(rep->transition_count * sizeof(char*));
+                 if (!state->id || !state->transitions || !state->input_symbols) {
+                     success = false;
+                     break;
+                 }
+             }
+ 
+             for (size_t t = 0; t < rep->transition_count; t++) {
+                 size_t target = rep->transitions[t] - automaton->states;
+                 state->input_symbols[t] = strdup(rep->input_symbols[t]);
+                 if (!state->input_symbols[t]) {
+                     success = false;
+                     break;
+                 }
+                 state->transitions[t] = &minimized->states[class_of_block[blocks->set_of[target]]];
+                 state->transition_count++;
+             }
+         }
+ 
+         // The first state added is the initial one, so it always maps to q0
+         minimized->initial_state = &minimized->states[0];
+     }
+ 
+     free(class_of_block);
+     free(representative);
+ 
+     if (!success) {
+         okpala_automaton_free(minimized);
+         return NULL;
+     }
+ 
+     return minimized;
+ }
+ 
+ /**
+  * @brief Minimize an automaton using Hopcroft partition refinement
+  * 
+  * This function creates a new minimized automaton based on the input automaton.
+  * The original automaton is not modified.
+  * 
+  * @param automaton The automaton to minimize
+  * @param use_boolean_reduction Whether to use boolean reduction for further optimization
+  * @return A new minimized automaton, or NULL if minimization failed
+  */
+ OkpalaAutomaton* okpala_minimize_automaton(OkpalaAutomaton* automaton, 
+                                         bool use_boolean_reduction) {
+     if (!automaton || automaton->state_count == 0) {
+         return NULL;
+     }
+ 
+     OkpalaDenseAutomaton* dense = okpala_dense_create(automaton, OKPALA_LAYOUT_CSR);
+     if (!dense) {
+         return NULL;
+     }
+ 
+     uint32_t n = dense->state_count;
+     uint32_t m = dense->transition_count;
+     uint32_t symbol_count = dense->alphabet.count;
+     const uint32_t* head = dense->row_targets;
+     const uint32_t* label = dense->row_symbols;
+     OkpalaAutomaton* minimized = NULL;
+     RefinablePartition blocks;
+     RefinablePartition cords;
+     bool have_blocks = partition_init(&blocks, n);
+     bool have_cords = partition_init(&cords, m);
+     uint32_t* incoming_first = (uint32_t*)calloc((size_t)n + 1, sizeof(uint32_t));
+     uint32_t* incoming = (uint32_t*)malloc((m ? m : 1) * sizeof(uint32_t));
+     uint32_t* label_first = (uint32_t*)calloc((size_t)symbol_count + 1, sizeof(uint32_t));
+     uint32_t* tail = (uint32_t*)malloc((m ? m : 1) * sizeof(uint32_t));
+ 
+     if (!have_blocks || !have_cords || !incoming_first || !incoming || !label_first || !tail) {
+         goto cleanup;
+     }
+ 
+     for (uint32_t s = 0; s < n; s++) {
+         for (uint32_t t = dense->row_offsets[s]; t < dense->row_offsets[s + 1]; t++) {
+             tail[t] = s;
+         }
+     }
+ 
+     // Initial state partition: final and non-final states
+     for (uint32_t s = 0; s < n; s++) {
+         if (automaton->states[s].is_final) {
+             partition_mark(&blocks, s);
+         }
+     }
+     partition_split(&blocks);
+ 
+     // Initial transition partition: one cord per symbol (counting sort)
+     for (uint32_t t = 0; t < m; t++) {
+         label_first[label[t] + 1]++;
+     }
+     for (uint32_t a = 0; a < symbol_count; a++) {
+         label_first[a + 1] += label_first[a];
+     }
+     for (uint32_t t = 0; t < m; t++) {
+         uint32_t a = label[t];
+         uint32_t position = label_first[a] + cords.marked[a]++;
+         cords.elements[position] = t;
+         cords.location[t] = position;
+         cords.set_of[t] = a;
+     }
+     for (uint32_t a = 0; a < symbol_count; a++) {
+         cords.first[a] = label_first[a];
+         cords.past[a] = label_first[a + 1];
+         cords.marked[a] = 0;
+     }
+     cords.set_count = symbol_count;
+ 
+     // Incoming transitions of each state, CSR by head
+     for (uint32_t t = 0; t < m; t++) {
+         incoming_first[head[t] + 1]++;
+     }
+     for (uint32_t s = 0; s < n; s++) {
+         incoming_first[s + 1] += incoming_first[s];
+     }
+     for (uint32_t t = 0; t < m; t++) {
+         incoming[incoming_first[head[t]]++] = t;
+     }
+     for (uint32_t s = n; s > 0; s--) {
+         incoming_first[s] = incoming_first[s - 1];
+     }
+     incoming_first[0] = 0;
+ 
+     // Split blocks by the tails of each cord, then cords by the new blocks.
+     // Block 0 is never used as a splitter: every other set of states is,
+     // and together with the per-symbol cords that suffices.
+     uint32_t next_block = 1;
+     for (uint32_t c = 0; c < cords.set_count; c++) {
+         for (uint32_t i = cords.first[c]; i < cords.past[c]; i++) {
+             partition_mark(&blocks, tail[cords.elements[i]]);
+         }
+         partition_split(&blocks);
+ 
+         for (; next_block < blocks.set_count; next_block++) {
+             for (uint32_t i = blocks.first[next_block]; i < blocks.past[next_block]; i++) {
+                 uint32_t s = blocks.elements[i];
+                 for (uint32_t j = incoming_first[s]; j < incoming_first[s + 1]; j++) {
+                     partition_mark(&cords, incoming[j]);
+                 }
+             }
+             partition_split(&cords);
+         }
+     }
+ 
+     minimized = build_quotient(automaton, &blocks);
+ 
+     // Apply boolean reduction if requested
+     if (minimized && use_boolean_reduction) {
+         apply_boolean_reduction(minimized);
+     }
+ 
+ cleanup:
+     if (have_blocks) {
+         partition_free(&blocks);
+     }
+     if (have_cords) {
+         partition_free(&cords);
+     }
+     free(incoming_first);
+     free(incoming);
+     free(label_first);
+     free(tail);
+     okpala_dense_free(dense);
+ 
      return minimized;
  }
\ No newline at end of file
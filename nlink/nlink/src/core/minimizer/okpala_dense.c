@@ -0,0 +1,480 @@
+/**
+ * @file okpala_dense.c
+ * @brief Compilation and execution of dense Okpala automata
+ * 
+ * Copyright © 2025 OBINexus Computing
+ */
+
+ #include "nlink/core/minimizer/okpala_dense.h"
+ #include <stdlib.h>
+ #include <string.h>
+ 
+ // Smallest alphabet index allocated
+ #define OKPALA_ALPHABET_MIN_CAPACITY 64
+ 
+ // Rows up to this length are sorted by insertion
+ #define OKPALA_ROW_INSERTION_LIMIT 16
+ 
+ // Symbols run between checks for the dead state
+ #define OKPALA_RUN_BLOCK 256
+ 
+ // Hash an input symbol (32-bit FNV-1a)
+ static uint32_t symbol_hash(const char* symbol) {
+     uint32_t hash = 2166136261u;
+ 
+     while (*symbol) {
+         hash ^= (uint8_t)*symbol++;
+         hash *= 16777619u;
+     }
+ 
+     return hash;
+ }
+ 
+ // Find the index slot of a symbol (either its slot or the empty one to use)
+ static size_t alphabet_slot(const OkpalaAlphabet* alphabet, const char* symbol, uint32_t hash) {
+     size_t mask = alphabet->capacity - 1;
+     size_t slot = hash & mask;
+ 
+     while (alphabet->slots[slot] != OKPALA_DENSE_NONE) {
+         uint32_t id = alphabet->slots[slot];
+         if (alphabet->hashes[id] == hash && strcmp(alphabet->symbols[id], symbol) == 0) {
+             break;
+         }
+         slot = (slot + 1) & mask;
+     }
+ 
+     return slot;
+ }
+ 
+ // Release an alphabet
+ static void alphabet_free(OkpalaAlphabet* alphabet) {
+     for (uint32_t i = 0; i < alphabet->count; i++) {
+         free(alphabet->symbols[i]);
+     }
+     free(alphabet->symbols);
+     free(alphabet->hashes);
+     free(alphabet->slots);
+     memset(alphabet, 0, sizeof(*alphabet));
+ }
+ 
+ // Grow the symbol arrays and the index of an alphabet
+ static bool alphabet_grow(OkpalaAlphabet* alphabet) {
+     size_t capacity = alphabet->capacity ? alphabet->capacity * 2 : OKPALA_ALPHABET_MIN_CAPACITY;
+     size_t max_symbols = capacity / 2;
+ 
+     char** symbols = (char**)realloc(alphabet->symbols, max_symbols * sizeof(char*));
+     if (!symbols) {
+         return false;
+     }
+     alphabet->symbols = symbols;
+ 
+     uint32_t* hashes = (uint32_t*)realloc(alphabet->hashes, max_symbols * sizeof(uint32_t));
+     if (!hashes) {
+         return false;
+     }
+     alphabet->hashes = hashes;
+ 
+     uint32_t* slots = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+     if (!slots) {
+         return false;
+     }
+     memset(slots, 0xff, capacity * sizeof(uint32_t));
+ 
+     for (uint32_t id = 0; id < alphabet->count; id++) {
+         size_t slot = alphabet->hashes[id] & (capacity - 1);
+         while (slots[slot] != OKPALA_DENSE_NONE) {
+             slot = (slot + 1) & (capacity - 1);
+         }
+         slots[slot] = id;
+     }
+ 
+     free(alphabet->slots);
+     alphabet->slots = slots;
+     alphabet->capacity = capacity;
+ 
+     return true;
+ }
+ 
+ // Intern a symbol, returning its id or OKPALA_DENSE_NONE on failure
+ static uint32_t alphabet_intern(OkpalaAlphabet* alphabet, const char* symbol) {
+     if ((size_t)alphabet->count * 2 >= alphabet->capacity && !alphabet_grow(alphabet)) {
+         return OKPALA_DENSE_NONE;
+     }
+ 
+     uint32_t hash = symbol_hash(symbol);
+     size_t slot = alphabet_slot(alphabet, symbol, hash);
+     if (alphabet->slots[slot] != OKPALA_DENSE_NONE) {
+         return alphabet->slots[slot];
+     }
+ 
+     char* copy = strdup(symbol);
+     if (!copy) {
+         return OKPALA_DENSE_NONE;
+     }
+ 
+     uint32_t id = alphabet->count++;
+     alphabet->symbols[id] = copy;
+     alphabet->hashes[id] = hash;
+     alphabet->slots[slot] = id;
+ 
+     return id;
+ }
+ 
+ // Order transitions packed as (symbol << 32 | target)
+ static int compare_packed(const void* a, const void* b) {
+     uint64_t x = *(const uint64_t*)a;
+     uint64_t y = *(const uint64_t*)b;
+     return (x > y) - (x < y);
+ }
+ 
+ // Sort one CSR row by symbol
+ static void sort_row(uint64_t* row, size_t length) {
+     if (length > OKPALA_ROW_INSERTION_LIMIT) {
+         qsort(row, length, sizeof(uint64_t), compare_packed);
+         return;
+     }
+ 
+     for (size_t i = 1; i < length; i++) {
+         uint64_t value = row[i];
+         size_t j = i;
+         while (j > 0 && row[j - 1] > value) {
+             row[j] = row[j - 1];
+             j--;
+         }
+         row[j] = value;
+     }
+ }
+ 
+ // Build the flat table from the CSR rows
+ static bool build_table(OkpalaDenseAutomaton* dense) {
+     size_t stride = (size_t)dense->alphabet.count + 1;
+     size_t rows = (size_t)dense->state_count + 1;
+ 
+     if (rows > SIZE_MAX / sizeof(uint32_t) / stride) {
+         return false;
+     }
+ 
+     dense->table = (uint32_t*)malloc(rows * stride * sizeof(uint32_t));
+     if (!dense->table) {
+         return false;
+     }
+     dense->table_stride = (uint32_t)stride;
+ 
+     // Everything not set below leads to the dead state
+     uint32_t dead = dense->state_count;
+     for (size_t i = 0; i < rows * stride; i++) {
+         dense->table[i] = dead;
+     }
+ 
+     for (uint32_t s = 0; s < dense->state_count; s++) {
+         uint32_t* row = &dense->table[(size_t)s * stride];
+         for (uint32_t t = dense->row_offsets[s]; t < dense->row_offsets[s + 1]; t++) {
+             row[dense->row_symbols[t]] = dense->row_targets[t];
+         }
+     }
+ 
+     return true;
+ }
+ 
+ // Compile an automaton into its dense representation
+ OkpalaDenseAutomaton* okpala_dense_create(const OkpalaAutomaton* automaton,
+                                           OkpalaDenseLayout layout) {
+     if (!automaton || automaton->state_count == 0 ||
+         automaton->state_count >= OKPALA_DENSE_NONE - 1) {
+         return NULL;
+     }
+ 
+     size_t n = automaton->state_count;
+     size_t total = 0;
+     for (size_t i = 0; i < n; i++) {
+         total += automaton->states[i].transition_count;
+     }
+     if (total >= OKPALA_DENSE_NONE) {
+         return NULL;
+     }
+ 
+     OkpalaDenseAutomaton* dense = (OkpalaDenseAutomaton*)calloc(1, sizeof(OkpalaDenseAutomaton));
+     if (!dense) {
+         return NULL;
+     }
+ 
+     size_t slots = total ? total : 1;
+     uint32_t* symbol_ids = (uint32_t*)malloc(slots * sizeof(uint32_t));
+     uint64_t* packed = (uint64_t*)malloc(slots * sizeof(uint64_t));
+     uint32_t* seen = NULL;
+     dense->state_count = (uint32_t)n;
+     dense->accepting = (uint8_t*)malloc(n);
+     dense->row_offsets = (uint32_t*)malloc((n + 1) * sizeof(uint32_t));
+ 
+     bool success = symbol_ids && packed && dense->accepting && dense->row_offsets;
+ 
+     // Intern every input symbol
+     size_t position = 0;
+     for (size_t s = 0; s < n && success; s++) {
+         const OkpalaState* state = &automaton->states[s];
+         dense->accepting[s] = state->is_final ? 1 : 0;
+ 
+         for (size_t t = 0; t < state->transition_count; t++) {
+             symbol_ids[position] = alphabet_intern(&dense->alphabet, state->input_symbols[t]);
+             if (symbol_ids[position++] == OKPALA_DENSE_NONE) {
+                 success = false;
+                 break;
+             }
+         }
+     }
+ 
+     if (success) {
+         seen = (uint32_t*)malloc((dense->alphabet.count ? dense->alphabet.count : 1) * sizeof(uint32_t));
+         success = seen != NULL;
+     }
+ 
+     // Pack the first transition of each (state, symbol) pair into CSR rows
+     if (success) {
+         memset(seen, 0xff, dense->alphabet.count * sizeof(uint32_t));
+         position = 0;
+ 
+         uint32_t m = 0;
+         for (size_t s = 0; s < n; s++) {
+             const OkpalaState* state = &automaton->states[s];
+             dense->row_offsets[s] = m;
+ 
+             for (size_t t = 0; t < state->transition_count; t++) {
+                 uint32_t id = symbol_ids[position++];
+                 if (seen[id] == (uint32_t)s) {
+                     continue;
+                 }
+                 seen[id] = (uint32_t)s;
+ 
+                 uint64_t target = (uint64_t)(state->transitions[t] - automaton->states);
+                 packed[m++] = ((uint64_t)id << 32) | target;
+             }
+ 
+             sort_row(&packed[dense->row_offsets[s]], m - dense->row_offsets[s]);
+         }
+         dense->row_offsets[n] = m;
+         dense->transition_count = m;
+ 
+         dense->row_symbols = (uint32_t*)malloc((m ? m : 1) * sizeof(uint32_t));
+         dense->row_targets = (uint32_t*)malloc((m ? m : 1) * sizeof(uint32_t));
+         success = dense->row_symbols && dense->row_targets;
+ 
+         for (uint32_t t = 0; t < m && success; t++) {
+             dense->row_symbols[t] = (uint32_t)(packed[t] >> 32);
+             dense->row_targets[t] = (uint32_t)packed[t];
+         }
+     }
+ 
+     if (success) {
+         OkpalaAlphabet* alphabet = &dense->alphabet;
+         for (size_t b = 0; b < 256; b++) {
+             alphabet->byte_map[b] = alphabet->count;
+         }
+         for (uint32_t id = 0; id < alphabet->count; id++) {
+             const char* symbol = alphabet->symbols[id];
+             if (symbol[0] != '\0' && symbol[1] == '\0') {
+                 alphabet->byte_map[(uint8_t)symbol[0]] = id;
+             }
+         }
+ 
+         // States move when the array grows, so only trust an in-range pointer;
+         // otherwise fall back to the first state added, which is the initial one
+         uintptr_t initial = (uintptr_t)automaton->initial_state;
+         uintptr_t base = (uintptr_t)automaton->states;
+         dense->initial_state = (initial >= base && initial < base + n * sizeof(OkpalaState))
+             ? (uint32_t)((initial - base) / sizeof(OkpalaState)) : 0;
+ 
+         // The flat table pays off once most (state, symbol) pairs are set
+         size_t cells = (n + 1) * ((size_t)alphabet->count + 1);
+         bool flat = layout == OKPALA_LAYOUT_FLAT ||
+                     (layout == OKPALA_LAYOUT_AUTO && cells / 4 <= (size_t)dense->transition_count + n);
+         if (flat) {
+             success = build_table(dense);
+         }
+     }
+ 
+     free(symbol_ids);
+     free(packed);
+     free(seen);
+ 
+     if (!success) {
+         okpala_dense_free(dense);
+         return NULL;
+     }
+ 
+     return dense;
+ }
+ 
+ // Free a dense automaton
+ void okpala_dense_free(OkpalaDenseAutomaton* dense) {
+     if (!dense) {
+         return;
+     }
+ 
+     alphabet_free(&dense->alphabet);
+     free(dense->accepting);
+     free(dense->row_offsets);
+     free(dense->row_symbols);
+     free(dense->row_targets);
+     free(dense->table);
+     free(dense);
+ }
+ 
+ // Look up the interned id of an input symbol
+ uint32_t okpala_dense_symbol(const OkpalaDenseAutomaton* dense, const char* symbol) {
+     if (!dense || !symbol || dense->alphabet.capacity == 0) {
+         return OKPALA_DENSE_NONE;
+     }
+ 
+     size_t slot = alphabet_slot(&dense->alphabet, symbol, symbol_hash(symbol));
+     return dense->alphabet.slots[slot];
+ }
+ 
+ // Intern a sequence of input symbols for the run functions
+ NexusResult okpala_dense_encode(const OkpalaDenseAutomaton* dense,
+                                 const char* const* symbols,
+                                 size_t count,
+                                 uint32_t* ids) {
+     if (!dense || (count > 0 && (!symbols || !ids))) {
+         return NEXUS_ERROR_INVALID_ARGUMENT;
+     }
+ 
+     for (size_t i = 0; i < count; i++) {
+         ids[i] = okpala_dense_symbol(dense, symbols[i]);
+     }
+ 
+     return NEXUS_SUCCESS;
+ }
+ 
+ // Follow a transition through the CSR rows
+ static uint32_t csr_step(const OkpalaDenseAutomaton* dense, uint32_t state, uint32_t symbol) {
+     uint32_t low = dense->row_offsets[state];
+     uint32_t high = dense->row_offsets[state + 1];
+ 
+     while (low < high) {
+         uint32_t mid = low + (high - low) / 2;
+         if (dense->row_symbols[mid] < symbol) {
+             low = mid + 1;
+         } else {
+             high = mid;
+         }
+     }
+ 
+     if (low < dense->row_offsets[state + 1] && dense->row_symbols[low] == symbol) {
+         return dense->row_targets[low];
+     }
+ 
+     return OKPALA_DENSE_NONE;
+ }
+ 
+ // Follow a single transition
+ uint32_t okpala_dense_step(const OkpalaDenseAutomaton* dense, uint32_t state, uint32_t symbol) {
+     if (!dense || state >= dense->state_count || symbol >= dense->alphabet.count) {
+         return OKPALA_DENSE_NONE;
+     }
+ 
+     if (dense->table) {
+         uint32_t next = dense->table[(size_t)state * dense->table_stride + symbol];
+         return next == dense->state_count ? OKPALA_DENSE_NONE : next;
+     }
+ 
+     return csr_step(dense, state, symbol);
+ }
+ 
+ // Run a chunk of symbol ids through the automaton
+ uint32_t okpala_dense_run(const OkpalaDenseAutomaton* dense,
+                           uint32_t state,
+                           const uint32_t* input,
+                           size_t length) {
+     if (!dense || state >= dense->state_count || (length > 0 && !input)) {
+         return OKPALA_DENSE_NONE;
+     }
+ 
+     uint32_t unknown = dense->alphabet.count;
+ 
+     if (!dense->table) {
+         for (size_t i = 0; i < length && state != OKPALA_DENSE_NONE; i++) {
+             state = input[i] < unknown ? csr_step(dense, state, input[i]) : OKPALA_DENSE_NONE;
+         }
+         return state;
+     }
+ 
+     // Flat table: one load per symbol, with the dead state checked per block
+     const uint32_t* table = dense->table;
+     size_t stride = dense->table_stride;
+     uint32_t dead = dense->state_count;
+     size_t i = 0;
+ 
+     while (i < length && state != dead) {
+         size_t end = length - i > OKPALA_RUN_BLOCK ? i + OKPALA_RUN_BLOCK : length;
+         for (; i < end; i++) {
+             uint32_t symbol = input[i] < unknown ? input[i] : unknown;
+             state = table[state * stride + symbol];
+         }
+     }
+ 
+     return state == dead ? OKPALA_DENSE_NONE : state;
+ }
+ 
+ // Run a chunk of bytes through an automaton over single-byte symbols
+ uint32_t okpala_dense_run_bytes(const OkpalaDenseAutomaton* dense,
+                                 uint32_t state,
+                                 const void* input,
+                                 size_t length) {
+     if (!dense || state >= dense->state_count || (length > 0 && !input)) {
+         return OKPALA_DENSE_NONE;
+     }
+ 
+     const uint8_t* bytes = (const uint8_t*)input;
+     const uint32_t* byte_map = dense->alphabet.byte_map;
+ 
+     if (!dense->table) {
+         uint32_t unknown = dense->alphabet.count;
+         for (size_t i = 0; i < length && state != OKPALA_DENSE_NONE; i++) {
+             uint32_t symbol = byte_map[bytes[i]];
+             state = symbol < unknown ? csr_step(dense, state, symbol) : OKPALA_DENSE_NONE;
+         }
+         return state;
+     }
+ 
+     // Unknown bytes map to the catch-all column, so no bounds check is needed
+     const uint32_t* table = dense->table;
+     size_t stride = dense->table_stride;
+     uint32_t dead = dense->state_count;
+     size_t i = 0;
+ 
+     while (i < length && state != dead) {
+         size_t end = length - i > OKPALA_RUN_BLOCK ? i + OKPALA_RUN_BLOCK : length;
+         for (; i < end; i++) {
+             state = table[state * stride + byte_map[bytes[i]]];
+         }
+     }
+ 
+     return state == dead ? OKPALA_DENSE_NONE : state;
+ }
+ 
+ // Check whether a state is accepting
+ bool okpala_dense_is_accepting(const OkpalaDenseAutomaton* dense, uint32_t state) {
+     return dense && state < dense->state_count && dense->accepting[state];
+ }
+ 
+ // Check whether the automaton accepts a whole input of symbol ids
+ bool okpala_dense_accepts(const OkpalaDenseAutomaton* dense,
+                           const uint32_t* input,
+                           size_t length) {
+     if (!dense) {
+         return false;
+     }
+ 
+     return okpala_dense_is_accepting(dense, okpala_dense_run(dense, dense->initial_state, input, length));
+ }
+ 
+ // Check whether the automaton accepts a whole byte input
+ bool okpala_dense_accepts_bytes(const OkpalaDenseAutomaton* dense,
+                                 const void* input,
+                                 size_t length) {
+     if (!dense) {
+         return false;
+     }
+ 
+     return okpala_dense_is_accepting(dense, okpala_dense_run_bytes(dense, dense->initial_state, input, length));
+ }
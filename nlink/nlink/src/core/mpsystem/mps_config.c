@@ -9,9 +9,11 @@
  */
 
 #include "nlink/mpsystem/mps_config.h"
+#include "nlink/mpsystem/mps_dependency.h"
 #include "nlink/core/common/nexus_json.h"
 #include "nlink/core/common/nexus_core.h"
 #include <string.h>
+#include <stdlib.h>
 #include <stdio.h>
 
 // Parse a pipeline configuration from a JSON file
@@ -22,25 +24,194 @@ NexusMPSConfig* mps_parse_pipeline_config(NexusContext* ctx, const char* config_
 
 // Validate a multi-pass pipeline configuration, including cycle detection
 NexusResult mps_validate_pipeline_config(NexusContext* ctx, NexusMPSConfig* config) {
-    // TODO: Implementation
-    return NEXUS_SUCCESS;
+    if (!config) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+
+    if (!config->pipeline_id) {
+        nexus_log(ctx, NEXUS_LOG_ERROR, "Pipeline ID is required");
+        return NEXUS_INVALID_PARAMETER;
+    }
+
+    if (config->max_iteration_count < 0) {
+        nexus_log(ctx, NEXUS_LOG_ERROR, "Pipeline '%s' has a negative iteration limit", config->pipeline_id);
+        return NEXUS_INVALID_PARAMETER;
+    }
+
+    for (size_t i = 0; i < config->component_count; i++) {
+        if (!config->components[i] || !config->components[i]->component_id) {
+            nexus_log(ctx, NEXUS_LOG_ERROR, "Component %zu has no ID", i);
+            return NEXUS_INVALID_PARAMETER;
+        }
+    }
+
+    for (size_t i = 0; i < config->connection_count; i++) {
+        if (!config->connections[i] || !config->connections[i]->source_id || !config->connections[i]->target_id) {
+            nexus_log(ctx, NEXUS_LOG_ERROR, "Connection %zu is missing an endpoint", i);
+            return NEXUS_INVALID_PARAMETER;
+        }
+    }
+
+    // Building the graph checks that every connection names a known component
+    NexusMPSDependencyGraph* graph = mps_create_dependency_graph(ctx, config);
+    if (!graph) {
+        return NEXUS_DEPENDENCY_ERROR;
+    }
+
+    NexusResult result = mps_validate_dependency_graph(ctx, graph);
+    mps_free_dependency_graph(graph);
+
+    return result;
 }
 
 // Check for cycles in component dependencies
+//
+// Each cycle is reported as one strongly connected component; cycles and
+// cycle_count may be NULL when only the answer is needed.
 bool mps_detect_cycles(NexusContext* ctx, NexusMPSConfig* config, NexusCycleInfo** cycles, size_t* cycle_count) {
-    // TODO: Implementation
-    return false;
+    if (cycles) {
+        *cycles = NULL;
+    }
+    if (cycle_count) {
+        *cycle_count = 0;
+    }
+
+    if (!config) {
+        return false;
+    }
+
+    NexusMPSDependencyGraph* graph = mps_create_dependency_graph(ctx, config);
+    if (!graph) {
+        return false;
+    }
+
+    size_t** members = NULL;
+    size_t* member_counts = NULL;
+    size_t group_count = 0;
+    if (mps_find_strongly_connected_components(ctx, graph, &members, &member_counts, &group_count) != NEXUS_SUCCESS) {
+        mps_free_dependency_graph(graph);
+        return false;
+    }
+
+    NexusCycleInfo* found = NULL;
+    size_t found_count = 0;
+
+    for (size_t g = 0; g < group_count; g++) {
+        bool cyclic = member_counts[g] > 1;
+        if (!cyclic) {
+            const NexusMPSDependencyNode* node = &graph->nodes[members[g][0]];
+            for (size_t e = 0; e < node->outgoing_count; e++) {
+                if (graph->edges[node->outgoing_edges[e]].target_idx == members[g][0]) {
+                    cyclic = true;
+                }
+            }
+        }
+
+        if (cyclic && cycles) {
+            NexusCycleInfo* grown = (NexusCycleInfo*)realloc(found, (found_count + 1) * sizeof(NexusCycleInfo));
+            const char** ids = (const char**)malloc(member_counts[g] * sizeof(const char*));
+            if (grown) {
+                found = grown;
+            }
+            if (!grown || !ids) {
+                free(ids);
+                nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to record cycle information");
+                cyclic = false;
+            } else {
+                for (size_t m = 0; m < member_counts[g]; m++) {
+                    ids[m] = graph->nodes[members[g][m]].component_id;
+                }
+                found[found_count].component_ids = ids;
+                found[found_count].component_count = member_counts[g];
+            }
+        }
+
+        if (cyclic) {
+            found_count++;
+        }
+        free(members[g]);
+    }
+
+    free(members);
+    free(member_counts);
+    mps_free_dependency_graph(graph);
+
+    if (cycles) {
+        *cycles = found;
+    }
+    if (cycle_count) {
+        *cycle_count = found_count;
+    }
+
+    return found_count > 0;
+}
+
+// Free cycle information returned by mps_detect_cycles
+void mps_free_cycle_info(NexusCycleInfo* cycles, size_t cycle_count) {
+    if (!cycles) {
+        return;
+    }
+
+    // Component IDs are borrowed from the configuration
+    for (size_t i = 0; i < cycle_count; i++) {
+        free((void*)cycles[i].component_ids);
+    }
+
+    free(cycles);
 }
 
 // Create a default multi-pass pipeline configuration
 NexusMPSConfig* mps_create_default_pipeline_config(void) {
-    // TODO: Implementation
-    return NULL;
+    NexusMPSConfig* config = (NexusMPSConfig*)calloc(1, sizeof(NexusMPSConfig));
+    if (!config) {
+        return NULL;
+    }
+
+    config->pipeline_id = strdup("default_mps_pipeline");
+    config->description = strdup("Default multi-pass pipeline");
+    config->allow_cycles = true;
+    config->max_iteration_count = 0;
+    config->allow_partial_processing = false;
+
+    return config;
 }
 
 // Free multi-pass pipeline configuration resources
 void mps_free_pipeline_config(NexusMPSConfig* config) {
-    // TODO: Implementation
+    if (!config) {
+        return;
+    }
+
+    free((void*)config->pipeline_id);
+    free((void*)config->description);
+
+    for (size_t i = 0; i < config->component_count; i++) {
+        NexusMPSComponentConfig* component = config->components[i];
+        if (!component) {
+            continue;
+        }
+        free((void*)component->component_id);
+        free((void*)component->version_constraint);
+        if (component->component_config && config->component_config_destructor) {
+            config->component_config_destructor(component->component_config);
+        }
+        free(component);
+    }
+    free(config->components);
+
+    for (size_t i = 0; i < config->connection_count; i++) {
+        NexusComponentConnection* connection = config->connections[i];
+        if (!connection) {
+            continue;
+        }
+        free((void*)connection->source_id);
+        free((void*)connection->target_id);
+        free((void*)connection->data_format);
+        free(connection);
+    }
+    free(config->connections);
+
+    free(config);
 }
 
 // Save a multi-pass pipeline configuration to a JSON file
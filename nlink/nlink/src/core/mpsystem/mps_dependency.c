@@ -13,12 +13,257 @@
 #include "nlink/core/common/nexus_loader.h"
 #include <string.h>
 #include <stdlib.h>
+#include <stdint.h>
+
+// Find the node index of a component ID
+static bool find_node_index(const NexusMPSDependencyGraph* graph, const char* component_id, size_t* index) {
+    for (size_t i = 0; i < graph->node_count; i++) {
+        if (strcmp(graph->nodes[i].component_id, component_id) == 0) {
+            *index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Append an edge index to a node's adjacency list
+static bool append_edge_index(size_t** list, size_t* count, size_t edge_idx) {
+    size_t* grown = (size_t*)realloc(*list, (*count + 1) * sizeof(size_t));
+    if (!grown) {
+        return false;
+    }
+    grown[*count] = edge_idx;
+    *list = grown;
+    (*count)++;
+    return true;
+}
+
+// Add a data-flow edge from source to target
+static bool add_flow_edge(NexusMPSDependencyGraph* graph,
+                          size_t source_idx,
+                          size_t target_idx,
+                          const NexusComponentConnection* connection) {
+    size_t edge_idx = graph->edge_count;
+    NexusMPSDependencyEdge* edge = &graph->edges[edge_idx];
+    edge->source_idx = source_idx;
+    edge->target_idx = target_idx;
+    edge->direction = connection->direction;
+    edge->data_format = connection->data_format;
+    edge->optional = connection->optional;
+    graph->edge_count++;
+
+    NexusMPSDependencyNode* source = &graph->nodes[source_idx];
+    NexusMPSDependencyNode* target = &graph->nodes[target_idx];
+    return append_edge_index(&source->outgoing_edges, &source->outgoing_count, edge_idx) &&
+           append_edge_index(&target->incoming_edges, &target->incoming_count, edge_idx);
+}
 
 // Create a dependency graph from multi-pass component metadata
+//
+// Every edge in the graph runs in the direction data flows: a backward
+// connection is stored as target -> source and a bidirectional connection
+// contributes one edge each way.
 NexusMPSDependencyGraph* mps_create_dependency_graph(NexusContext* ctx, 
                                                     const NexusMPSConfig* config) {
-    // TODO: Implementation
-    return NULL;
+    if (!config) {
+        return NULL;
+    }
+
+    NexusMPSDependencyGraph* graph = (NexusMPSDependencyGraph*)calloc(1, sizeof(NexusMPSDependencyGraph));
+    if (!graph) {
+        nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate dependency graph");
+        return NULL;
+    }
+    graph->config = config;
+
+    if (config->component_count > 0) {
+        graph->nodes = (NexusMPSDependencyNode*)calloc(config->component_count, sizeof(NexusMPSDependencyNode));
+        if (!graph->nodes) {
+            nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate dependency nodes");
+            mps_free_dependency_graph(graph);
+            return NULL;
+        }
+    }
+
+    for (size_t i = 0; i < config->component_count; i++) {
+        NexusMPSComponentConfig* component = config->components[i];
+        NexusMPSDependencyNode* node = &graph->nodes[i];
+        node->component_id = component->component_id;
+        node->config = component;
+        node->supports_reentrance = component->supports_reentrance;
+        node->component_group = -1;
+        graph->node_count++;
+    }
+
+    // A bidirectional connection may produce two edges
+    if (config->connection_count > 0) {
+        graph->edges = (NexusMPSDependencyEdge*)calloc(config->connection_count * 2, sizeof(NexusMPSDependencyEdge));
+        if (!graph->edges) {
+            nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate dependency edges");
+            mps_free_dependency_graph(graph);
+            return NULL;
+        }
+    }
+
+    for (size_t i = 0; i < config->connection_count; i++) {
+        const NexusComponentConnection* connection = config->connections[i];
+        size_t source_idx;
+        size_t target_idx;
+
+        if (!find_node_index(graph, connection->source_id, &source_idx) ||
+            !find_node_index(graph, connection->target_id, &target_idx)) {
+            nexus_log(ctx, NEXUS_LOG_ERROR, "Connection '%s' -> '%s' references an unknown component",
+                     connection->source_id, connection->target_id);
+            mps_free_dependency_graph(graph);
+            return NULL;
+        }
+
+        bool ok = true;
+        switch (connection->direction) {
+            case NEXUS_DIRECTION_FORWARD:
+                ok = add_flow_edge(graph, source_idx, target_idx, connection);
+                break;
+            case NEXUS_DIRECTION_BACKWARD:
+                ok = add_flow_edge(graph, target_idx, source_idx, connection);
+                break;
+            case NEXUS_DIRECTION_BIDIRECTIONAL:
+                ok = add_flow_edge(graph, source_idx, target_idx, connection) &&
+                     add_flow_edge(graph, target_idx, source_idx, connection);
+                break;
+        }
+
+        if (!ok) {
+            nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to add dependency edge");
+            mps_free_dependency_graph(graph);
+            return NULL;
+        }
+    }
+
+    nexus_log(ctx, NEXUS_LOG_DEBUG, "Multi-pass dependency graph created with %zu nodes and %zu edges",
+             graph->node_count, graph->edge_count);
+
+    return graph;
+}
+
+// Assign every node to its strongly connected component
+//
+// Iterative Tarjan, so deep chains do not exhaust the stack. Tarjan emits
+// components sinks first; numbers are flipped so that component_group
+// follows a topological order of the condensation.
+static NexusResult compute_scc_groups(NexusMPSDependencyGraph* graph, size_t* group_count) {
+    size_t n = graph->node_count;
+    *group_count = 0;
+    if (n == 0) {
+        return NEXUS_SUCCESS;
+    }
+
+    size_t* index = (size_t*)malloc(n * sizeof(size_t));
+    size_t* lowlink = (size_t*)malloc(n * sizeof(size_t));
+    size_t* stack = (size_t*)malloc(n * sizeof(size_t));
+    size_t* call_node = (size_t*)malloc(n * sizeof(size_t));
+    size_t* call_edge = (size_t*)malloc(n * sizeof(size_t));
+    bool* on_stack = (bool*)calloc(n, sizeof(bool));
+
+    if (!index || !lowlink || !stack || !call_node || !call_edge || !on_stack) {
+        free(index);
+        free(lowlink);
+        free(stack);
+        free(call_node);
+        free(call_edge);
+        free(on_stack);
+        return NEXUS_OUT_OF_MEMORY;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        index[i] = SIZE_MAX;
+    }
+
+    size_t next_index = 0;
+    size_t stack_size = 0;
+    size_t emitted = 0;
+
+    for (size_t root = 0; root < n; root++) {
+        if (index[root] != SIZE_MAX) {
+            continue;
+        }
+
+        size_t depth = 0;
+        call_node[0] = root;
+        call_edge[0] = 0;
+        index[root] = lowlink[root] = next_index++;
+        stack[stack_size++] = root;
+        on_stack[root] = true;
+
+        while (true) {
+            size_t v = call_node[depth];
+            NexusMPSDependencyNode* node = &graph->nodes[v];
+
+            if (call_edge[depth] < node->outgoing_count) {
+                size_t w = graph->edges[node->outgoing_edges[call_edge[depth]++]].target_idx;
+                if (index[w] == SIZE_MAX) {
+                    depth++;
+                    call_node[depth] = w;
+                    call_edge[depth] = 0;
+                    index[w] = lowlink[w] = next_index++;
+                    stack[stack_size++] = w;
+                    on_stack[w] = true;
+                } else if (on_stack[w] && index[w] < lowlink[v]) {
+                    lowlink[v] = index[w];
+                }
+                continue;
+            }
+
+            // v is finished; pop its component if it is a root
+            if (lowlink[v] == index[v]) {
+                size_t w;
+                do {
+                    w = stack[--stack_size];
+                    on_stack[w] = false;
+                    graph->nodes[w].component_group = (int)emitted;
+                } while (w != v);
+                emitted++;
+            }
+
+            if (depth == 0) {
+                break;
+            }
+            depth--;
+            size_t parent = call_node[depth];
+            if (lowlink[v] < lowlink[parent]) {
+                lowlink[parent] = lowlink[v];
+            }
+        }
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        graph->nodes[i].component_group = (int)(emitted - 1 - (size_t)graph->nodes[i].component_group);
+    }
+
+    free(index);
+    free(lowlink);
+    free(stack);
+    free(call_node);
+    free(call_edge);
+    free(on_stack);
+
+    *group_count = emitted;
+    return NEXUS_SUCCESS;
+}
+
+// Check whether a strongly connected component actually contains a cycle
+static bool group_has_cycle(const NexusMPSDependencyGraph* graph, size_t member_count, size_t first_member) {
+    if (member_count > 1) {
+        return true;
+    }
+
+    // A single node is cyclic only if it feeds itself
+    const NexusMPSDependencyNode* node = &graph->nodes[first_member];
+    for (size_t e = 0; e < node->outgoing_count; e++) {
+        if (graph->edges[node->outgoing_edges[e]].target_idx == first_member) {
+            return true;
+        }
+    }
+    return false;
 }
 
 // Resolve bidirectional dependencies
@@ -26,32 +271,214 @@ NexusResult mps_resolve_bidirectional_dependencies(NexusContext* ctx,
                                                   NexusMPSDependencyGraph* graph,
                                                   NexusExecutionGroup*** execution_groups,
                                                   size_t* group_count) {
-    // TODO: Implementation
-    return NEXUS_SUCCESS;
+    if (!graph || !execution_groups || !group_count) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+
+    *execution_groups = NULL;
+    *group_count = 0;
+
+    size_t** members = NULL;
+    size_t* member_counts = NULL;
+    size_t count = 0;
+
+    NexusResult result = mps_find_strongly_connected_components(ctx, graph, &members, &member_counts, &count);
+    if (result != NEXUS_SUCCESS || count == 0) {
+        return result;
+    }
+
+    NexusExecutionGroup** groups = (NexusExecutionGroup**)calloc(count, sizeof(NexusExecutionGroup*));
+    if (!groups) {
+        result = NEXUS_OUT_OF_MEMORY;
+        goto cleanup;
+    }
+
+    for (size_t g = 0; g < count; g++) {
+        NexusExecutionGroup* group = (NexusExecutionGroup*)calloc(1, sizeof(NexusExecutionGroup));
+        if (!group) {
+            mps_free_execution_groups(groups, g);
+            groups = NULL;
+            result = NEXUS_OUT_OF_MEMORY;
+            goto cleanup;
+        }
+        groups[g] = group;
+
+        group->component_ids = (const char**)malloc(member_counts[g] * sizeof(const char*));
+        if (!group->component_ids) {
+            mps_free_execution_groups(groups, g + 1);
+            groups = NULL;
+            result = NEXUS_OUT_OF_MEMORY;
+            goto cleanup;
+        }
+
+        group->component_count = member_counts[g];
+        group->has_cycles = group_has_cycle(graph, member_counts[g], members[g][0]);
+        group->is_forward_only = true;
+
+        for (size_t m = 0; m < member_counts[g]; m++) {
+            const NexusMPSDependencyNode* node = &graph->nodes[members[g][m]];
+            group->component_ids[m] = node->component_id;
+
+            for (size_t e = 0; e < node->incoming_count; e++) {
+                if (graph->edges[node->incoming_edges[e]].direction != NEXUS_DIRECTION_FORWARD) {
+                    group->is_forward_only = false;
+                }
+            }
+        }
+    }
+
+    *execution_groups = groups;
+    *group_count = count;
+
+    nexus_log(ctx, NEXUS_LOG_DEBUG, "Resolved %zu execution groups for %zu components",
+             count, graph->node_count);
+
+cleanup:
+    for (size_t g = 0; g < count; g++) {
+        free(members[g]);
+    }
+    free(members);
+    free(member_counts);
+
+    return result;
 }
 
 // Find strongly connected components (for cycle detection)
+//
+// Groups hold node indices into graph->nodes and are returned in
+// topological order of the condensation: every edge between two groups
+// runs from a lower to a higher group number.
 NexusResult mps_find_strongly_connected_components(NexusContext* ctx,
                                                   NexusMPSDependencyGraph* graph,
-                                                  NexusComponent*** components,
+                                                  size_t*** components,
                                                   size_t** component_counts,
                                                   size_t* group_count) {
-    // TODO: Implementation
+    (void)ctx;
+
+    if (!graph || !components || !component_counts || !group_count) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+
+    *components = NULL;
+    *component_counts = NULL;
+    *group_count = 0;
+
+    size_t count = 0;
+    NexusResult result = compute_scc_groups(graph, &count);
+    if (result != NEXUS_SUCCESS || count == 0) {
+        return result;
+    }
+
+    size_t** groups = (size_t**)calloc(count, sizeof(size_t*));
+    size_t* counts = (size_t*)calloc(count, sizeof(size_t));
+    if (!groups || !counts) {
+        free(groups);
+        free(counts);
+        return NEXUS_OUT_OF_MEMORY;
+    }
+
+    for (size_t i = 0; i < graph->node_count; i++) {
+        counts[graph->nodes[i].component_group]++;
+    }
+
+    for (size_t g = 0; g < count; g++) {
+        groups[g] = (size_t*)malloc(counts[g] * sizeof(size_t));
+        if (!groups[g]) {
+            for (size_t k = 0; k < g; k++) {
+                free(groups[k]);
+            }
+            free(groups);
+            free(counts);
+            return NEXUS_OUT_OF_MEMORY;
+        }
+        counts[g] = 0;
+    }
+
+    // Members keep their configuration order within a group
+    for (size_t i = 0; i < graph->node_count; i++) {
+        size_t g = (size_t)graph->nodes[i].component_group;
+        groups[g][counts[g]++] = i;
+    }
+
+    *components = groups;
+    *component_counts = counts;
+    *group_count = count;
+
     return NEXUS_SUCCESS;
 }
 
 // Check for issues in graph that would prevent execution
 NexusResult mps_validate_dependency_graph(NexusContext* ctx, NexusMPSDependencyGraph* graph) {
-    // TODO: Implementation
-    return NEXUS_SUCCESS;
+    if (!graph || !graph->config) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+
+    for (size_t i = 0; i < graph->node_count; i++) {
+        for (size_t j = i + 1; j < graph->node_count; j++) {
+            if (strcmp(graph->nodes[i].component_id, graph->nodes[j].component_id) == 0) {
+                nexus_log(ctx, NEXUS_LOG_ERROR, "Duplicate component '%s' in multi-pass pipeline",
+                         graph->nodes[i].component_id);
+                return NEXUS_ALREADY_EXISTS;
+            }
+        }
+    }
+
+    if (graph->config->allow_cycles) {
+        return NEXUS_SUCCESS;
+    }
+
+    size_t** members = NULL;
+    size_t* member_counts = NULL;
+    size_t count = 0;
+
+    NexusResult result = mps_find_strongly_connected_components(ctx, graph, &members, &member_counts, &count);
+    if (result != NEXUS_SUCCESS) {
+        return result;
+    }
+
+    for (size_t g = 0; g < count; g++) {
+        if (result == NEXUS_SUCCESS && group_has_cycle(graph, member_counts[g], members[g][0])) {
+            nexus_log(ctx, NEXUS_LOG_ERROR, "Cycle through '%s' in a pipeline that does not allow cycles",
+                     graph->nodes[members[g][0]].component_id);
+            result = NEXUS_DEPENDENCY_ERROR;
+        }
+        free(members[g]);
+    }
+    free(members);
+    free(member_counts);
+
+    return result;
 }
 
 // Free dependency graph resources
 void mps_free_dependency_graph(NexusMPSDependencyGraph* graph) {
-    // TODO: Implementation
+    if (!graph) {
+        return;
+    }
+
+    for (size_t i = 0; i < graph->node_count; i++) {
+        free(graph->nodes[i].incoming_edges);
+        free(graph->nodes[i].outgoing_edges);
+    }
+
+    free(graph->nodes);
+    free(graph->edges);
+    free(graph);
 }
 
 // Free execution group resources
 void mps_free_execution_groups(NexusExecutionGroup** groups, size_t group_count) {
-    // TODO: Implementation
+    if (!groups) {
+        return;
+    }
+
+    // Component IDs are borrowed from the configuration
+    for (size_t i = 0; i < group_count; i++) {
+        if (groups[i]) {
+            free((void*)groups[i]->component_ids);
+            free(groups[i]);
+        }
+    }
+
+    free(groups);
 }
@@ -13,48 +13,185 @@
  #include "nlink/core/common/nexus_core.h"
  #include <string.h>
  #include <stdlib.h>
+ #include <stdio.h>
+ 
+ /* Internal structure for component lifecycle data */
+ typedef struct {
+     NexusMPSComponentLifecycle lifecycle;
+     NexusMPSPipelineComponent* component;
+ } ComponentLifecycleData;
+ 
+ // Get the lifecycle data for a component
+ static ComponentLifecycleData* get_lifecycle_data(NexusMPSPipelineComponent* component) {
+     return (ComponentLifecycleData*)component->component_state;
+ }
  
  // Register lifecycle hooks for a component
  NexusResult mps_register_component_lifecycle(NexusContext* ctx, 
                                             NexusMPSPipelineComponent* component,
                                             NexusMPSComponentLifecycle* lifecycle) {
-     // TODO: Implementation
+     if (!component || !lifecycle) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     nexus_log(ctx, NEXUS_LOG_DEBUG, "Registering lifecycle hooks for component '%s'", 
+              component->component_id);
+     
+     // Update existing lifecycle hooks
+     ComponentLifecycleData* data = get_lifecycle_data(component);
+     if (data) {
+         data->lifecycle = *lifecycle;
+         return NEXUS_SUCCESS;
+     }
+     
+     data = (ComponentLifecycleData*)malloc(sizeof(ComponentLifecycleData));
+     if (!data) {
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate lifecycle data");
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     // The pipeline frees the lifecycle data when it is destroyed
+     data->lifecycle = *lifecycle;
+     data->component = component;
+     component->component_state = data;
+     
      return NEXUS_SUCCESS;
  }
  
  // Call initialization hook for a component
  NexusResult mps_component_initialize(NexusContext* ctx, NexusMPSPipelineComponent* component) {
-     // TODO: Implementation
+     if (!component) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     if (component->is_initialized) {
+         return NEXUS_SUCCESS;
+     }
+     
+     ComponentLifecycleData* data = get_lifecycle_data(component);
+     if (data && data->lifecycle.init_func) {
+         NexusResult result = data->lifecycle.init_func(component, data->lifecycle.user_data);
+         if (result != NEXUS_SUCCESS) {
+             nexus_log(ctx, NEXUS_LOG_ERROR, "Initialization failed for component '%s': %d", 
+                      component->component_id, result);
+             return result;
+         }
+     }
+     
+     component->is_initialized = true;
+     component->execution_count = 0;
+     
      return NEXUS_SUCCESS;
  }
  
  // Call execution hook for a component
+ //
+ // May run on a pipeline worker thread, so failures are returned rather
+ // than logged; the pipeline reports them once the level completes.
  NexusResult mps_component_execute(NexusContext* ctx, 
                                   NexusMPSPipelineComponent* component,
                                   NexusMPSDataStream* input,
                                   NexusMPSDataStream* output,
                                   int iteration) {
-     // TODO: Implementation
-     return NEXUS_SUCCESS;
+     (void)ctx;
+     
+     if (!component || !input || !output) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     if (!component->is_initialized) {
+         return NEXUS_NOT_INITIALIZED;
+     }
+     
+     ComponentLifecycleData* data = get_lifecycle_data(component);
+     NexusResult result;
+     
+     if (data && data->lifecycle.exec_func) {
+         result = data->lifecycle.exec_func(component, input, output, iteration, 
+                                           data->lifecycle.user_data);
+     } else if (component->process_func) {
+         result = component->process_func(component, input, output);
+     } else {
+         result = NEXUS_NOT_FOUND;
+     }
+     
+     component->last_result = result;
+     component->execution_count++;
+     
+     return result;
  }
  
  // Call iteration end hook for a component
  NexusResult mps_component_end_iteration(NexusContext* ctx, 
                                         NexusMPSPipelineComponent* component,
                                         int iteration) {
-     // TODO: Implementation
+     (void)ctx;
+     
+     if (!component) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     ComponentLifecycleData* data = get_lifecycle_data(component);
+     if (data && data->lifecycle.iter_end_func) {
+         return data->lifecycle.iter_end_func(component, iteration, data->lifecycle.user_data);
+     }
+     
      return NEXUS_SUCCESS;
  }
  
  // Call termination hook for a component
  NexusResult mps_component_terminate(NexusContext* ctx, NexusMPSPipelineComponent* component) {
-     // TODO: Implementation
+     if (!component) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     if (!component->is_initialized) {
+         return NEXUS_SUCCESS;
+     }
+     
+     ComponentLifecycleData* data = get_lifecycle_data(component);
+     if (data && data->lifecycle.term_func) {
+         NexusResult result = data->lifecycle.term_func(component, data->lifecycle.user_data);
+         if (result != NEXUS_SUCCESS) {
+             nexus_log(ctx, NEXUS_LOG_ERROR, "Termination failed for component '%s': %d", 
+                      component->component_id, result);
+             return result;
+         }
+     }
+     
+     component->is_initialized = false;
+     
      return NEXUS_SUCCESS;
  }
  
  // Call abort hook for a component
  NexusResult mps_component_abort(NexusContext* ctx, NexusMPSPipelineComponent* component) {
-     // TODO: Implementation
+     if (!component) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     if (!component->is_initialized) {
+         return NEXUS_SUCCESS;
+     }
+     
+     // Fall back to the termination hook if no abort hook is registered
+     ComponentLifecycleData* data = get_lifecycle_data(component);
+     NexusMPSComponentTermFunc hook = NULL;
+     if (data) {
+         hook = data->lifecycle.abort_func ? data->lifecycle.abort_func : data->lifecycle.term_func;
+     }
+     
+     if (hook) {
+         NexusResult result = hook(component, data->lifecycle.user_data);
+         if (result != NEXUS_SUCCESS) {
+             nexus_log(ctx, NEXUS_LOG_ERROR, "Abort failed for component '%s': %d", 
+                      component->component_id, result);
+             return result;
+         }
+     }
+     
+     component->is_initialized = false;
+     
      return NEXUS_SUCCESS;
  }
  
@@ -64,23 +201,87 @@
                                       NexusResult error,
                                       const char* component_id,
                                       int iteration) {
-     // TODO: Implementation
-     return NEXUS_SUCCESS;
+     if (!pipeline) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     nexus_log(ctx, NEXUS_LOG_ERROR, 
+              "Pipeline error: component '%s' failed with result %d in iteration %d", 
+              component_id ? component_id : "unknown", error, iteration);
+     
+     char message[256];
+     snprintf(message, sizeof(message), 
+             "Component '%s' failed with result %d in iteration %d", 
+             component_id ? component_id : "unknown", error, iteration);
+     
+     if (pipeline->error_handler) {
+         pipeline->error_handler(pipeline, error, component_id, message);
+     }
+     
+     return error;
  }
  
  // Save component state for resuming later
  NexusResult mps_component_save_state(NexusContext* ctx,
                                      NexusMPSPipelineComponent* component,
                                      const char* state_path) {
-     // TODO: Implementation
-     return NEXUS_SUCCESS;
+     (void)ctx;
+     
+     if (!component || !state_path) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     ComponentLifecycleData* data = get_lifecycle_data(component);
+     if (!data || !data->lifecycle.save_state_func) {
+         return NEXUS_UNSUPPORTED;
+     }
+     
+     return data->lifecycle.save_state_func(component, state_path, data->lifecycle.user_data);
  }
  
  // Load component state for resuming
  NexusResult mps_component_load_state(NexusContext* ctx,
                                      NexusMPSPipelineComponent* component,
                                      const char* state_path) {
-     // TODO: Implementation
+     (void)ctx;
+     
+     if (!component || !state_path) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     ComponentLifecycleData* data = get_lifecycle_data(component);
+     if (!data || !data->lifecycle.load_state_func) {
+         return NEXUS_UNSUPPORTED;
+     }
+     
+     return data->lifecycle.load_state_func(component, state_path, data->lifecycle.user_data);
+ }
+ 
+ // Apply a state hook to every component, using one file per component
+ static NexusResult for_each_component_state(NexusContext* ctx,
+                                             NexusMPSPipeline* pipeline,
+                                             const char* checkpoint_dir,
+                                             bool save) {
+     if (!pipeline || !checkpoint_dir) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     for (size_t i = 0; i < pipeline->component_count; i++) {
+         NexusMPSPipelineComponent* component = pipeline->components[i];
+         char path[1024];
+         snprintf(path, sizeof(path), "%s/%s.state", checkpoint_dir, component->component_id);
+         
+         NexusResult result = save ? mps_component_save_state(ctx, component, path)
+                                   : mps_component_load_state(ctx, component, path);
+         
+         // Components without state hooks are stateless
+         if (result != NEXUS_SUCCESS && result != NEXUS_UNSUPPORTED) {
+             nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to %s state of component '%s': %d", 
+                      save ? "save" : "load", component->component_id, result);
+             return result;
+         }
+     }
+     
      return NEXUS_SUCCESS;
  }
  
@@ -88,15 +289,13 @@
  NexusResult mps_pipeline_create_checkpoint(NexusContext* ctx,
                                            NexusMPSPipeline* pipeline,
                                            const char* checkpoint_dir) {
-     // TODO: Implementation
-     return NEXUS_SUCCESS;
+     return for_each_component_state(ctx, pipeline, checkpoint_dir, true);
  }
  
  // Restore a pipeline from a checkpoint
  NexusResult mps_pipeline_restore_checkpoint(NexusContext* ctx,
                                             NexusMPSPipeline* pipeline,
                                             const char* checkpoint_dir) {
-     // TODO: Implementation
-     return NEXUS_SUCCESS;
+     return for_each_component_state(ctx, pipeline, checkpoint_dir, false);
  }
  
\ No newline at end of file
@@ -16,31 +16,883 @@
 #include "nlink/core/common/nexus_loader.h"
 #include <string.h>
 #include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+// Outcome of one group's most recent run
+typedef struct MPSGroupRun {
+    NexusResult result;             // First failure, or NEXUS_SUCCESS
+    size_t failed_component;        // Node index of the failing component
+    int failed_iteration;           // Iteration in which it failed
+    int executions;                 // Component executions in the run
+} MPSGroupRun;
+
+// Persistent workers that run the groups of one level concurrently
+typedef struct MPSWorkerPool {
+    pthread_t* threads;
+    size_t thread_count;
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;
+    pthread_cond_t work_done;
+    NexusContext* ctx;
+    NexusMPSPipeline* pipeline;
+    const size_t* batch;            // Group indices of the current level
+    size_t batch_count;
+    size_t next;                    // Next batch entry to claim
+    size_t pending;                 // Batch entries not yet finished
+    bool shutdown;
+} MPSWorkerPool;
+
+struct NexusMPSExecutionState {
+    NexusMPSDataStreamMap* streams; // One stream per graph edge, keyed by endpoints
+    NexusMPSDataStream** edge_streams; // Streams indexed by graph edge
+    NexusMPSDataStream** gathered;  // Per-component input when it has several sources
+    NexusMPSDataStream** outputs;   // Per-component latest output
+    NexusMPSDataStream** scratch;   // Per-component output being produced
+    size_t** members;               // Node indices of each group
+    size_t* member_counts;
+    bool* cyclic;                   // Whether each group must be iterated
+    size_t* level_order;            // Group indices sorted by level
+    size_t* level_starts;           // Offsets into level_order, level_count + 1 entries
+    size_t level_count;
+    size_t max_level_width;
+    MPSGroupRun* runs;
+    MPSWorkerPool* pool;
+    NexusMPSDataStream* input;      // Pipeline input of the current run
+};
+
+static void free_execution_state(NexusMPSExecutionState* state, size_t component_count, size_t group_count);
+static void run_group(NexusContext* ctx, NexusMPSPipeline* pipeline, size_t group_idx,
+                      NexusMPSDataStream** edge_streams);
+
+// Get current time in milliseconds
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+}
+
+// Build streams, group membership and levels for a pipeline
+static NexusMPSExecutionState* build_execution_state(NexusContext* ctx, NexusMPSPipeline* pipeline) {
+    NexusMPSDependencyGraph* graph = pipeline->graph;
+    size_t component_count = pipeline->component_count;
+    size_t group_count = pipeline->group_count;
+
+    NexusMPSExecutionState* state = (NexusMPSExecutionState*)calloc(1, sizeof(NexusMPSExecutionState));
+    if (!state) {
+        return NULL;
+    }
+
+    state->streams = mps_stream_map_create(graph->edge_count);
+    state->edge_streams = (NexusMPSDataStream**)calloc(graph->edge_count + 1, sizeof(NexusMPSDataStream*));
+    state->gathered = (NexusMPSDataStream**)calloc(component_count + 1, sizeof(NexusMPSDataStream*));
+    state->outputs = (NexusMPSDataStream**)calloc(component_count + 1, sizeof(NexusMPSDataStream*));
+    state->scratch = (NexusMPSDataStream**)calloc(component_count + 1, sizeof(NexusMPSDataStream*));
+    state->members = (size_t**)calloc(group_count + 1, sizeof(size_t*));
+    state->member_counts = (size_t*)calloc(group_count + 1, sizeof(size_t));
+    state->cyclic = (bool*)calloc(group_count + 1, sizeof(bool));
+    state->level_order = (size_t*)calloc(group_count + 1, sizeof(size_t));
+    state->level_starts = (size_t*)calloc(group_count + 2, sizeof(size_t));
+    state->runs = (MPSGroupRun*)calloc(group_count + 1, sizeof(MPSGroupRun));
+
+    if (!state->streams || !state->edge_streams || !state->gathered || !state->outputs ||
+        !state->scratch || !state->members || !state->member_counts || !state->cyclic ||
+        !state->level_order || !state->level_starts || !state->runs) {
+        free_execution_state(state, component_count, group_count);
+        return NULL;
+    }
+
+    // One stream per edge; a connection listed twice would need two streams
+    for (size_t e = 0; e < graph->edge_count; e++) {
+        const NexusMPSDependencyEdge* edge = &graph->edges[e];
+        NexusMPSDataStream* stream = mps_stream_create(0);
+        if (!stream) {
+            free_execution_state(state, component_count, group_count);
+            return NULL;
+        }
+
+        NexusResult result = mps_stream_map_add(state->streams,
+                                                graph->nodes[edge->source_idx].component_id,
+                                                graph->nodes[edge->target_idx].component_id,
+                                                stream);
+        if (result != NEXUS_SUCCESS) {
+            if (result == NEXUS_ALREADY_EXISTS) {
+                nexus_log(ctx, NEXUS_LOG_ERROR, "Duplicate connection '%s' -> '%s'",
+                         graph->nodes[edge->source_idx].component_id,
+                         graph->nodes[edge->target_idx].component_id);
+            }
+            mps_stream_destroy(stream);
+            free_execution_state(state, component_count, group_count);
+            return NULL;
+        }
+        state->edge_streams[e] = stream;
+    }
+
+    for (size_t i = 0; i < component_count; i++) {
+        state->outputs[i] = mps_stream_create(0);
+        state->scratch[i] = mps_stream_create(0);
+        if (!state->outputs[i] || !state->scratch[i]) {
+            free_execution_state(state, component_count, group_count);
+            return NULL;
+        }
+    }
+
+    // Group membership by node index; component_group was set while resolving groups
+    for (size_t i = 0; i < component_count; i++) {
+        state->member_counts[graph->nodes[i].component_group]++;
+    }
+    for (size_t g = 0; g < group_count; g++) {
+        state->members[g] = (size_t*)malloc(state->member_counts[g] * sizeof(size_t));
+        if (!state->members[g]) {
+            free_execution_state(state, component_count, group_count);
+            return NULL;
+        }
+        state->member_counts[g] = 0;
+        state->cyclic[g] = pipeline->groups[g]->has_cycles;
+    }
+    for (size_t i = 0; i < component_count; i++) {
+        size_t g = (size_t)graph->nodes[i].component_group;
+        state->members[g][state->member_counts[g]++] = i;
+    }
+
+    // A group's level is the longest path to it in the condensed graph.
+    // Groups are numbered topologically, so predecessors are already done.
+    int* levels = (int*)calloc(group_count + 1, sizeof(int));
+    if (!levels) {
+        free_execution_state(state, component_count, group_count);
+        return NULL;
+    }
+
+    int max_level = -1;
+    for (size_t g = 0; g < group_count; g++) {
+        for (size_t m = 0; m < state->member_counts[g]; m++) {
+            const NexusMPSDependencyNode* node = &graph->nodes[state->members[g][m]];
+            for (size_t e = 0; e < node->incoming_count; e++) {
+                size_t pred = (size_t)graph->nodes[graph->edges[node->incoming_edges[e]].source_idx].component_group;
+                if (pred != g && levels[pred] + 1 > levels[g]) {
+                    levels[g] = levels[pred] + 1;
+                }
+            }
+        }
+        if (levels[g] > max_level) {
+            max_level = levels[g];
+        }
+        pipeline->stats.groups[g].level = levels[g];
+        pipeline->stats.groups[g].component_count = (int)state->member_counts[g];
+    }
+
+    // Counting sort of groups by level
+    state->level_count = (size_t)(max_level + 1);
+    for (size_t g = 0; g < group_count; g++) {
+        state->level_starts[levels[g] + 1]++;
+    }
+    for (size_t l = 0; l < state->level_count; l++) {
+        size_t width = state->level_starts[l + 1];
+        if (width > state->max_level_width) {
+            state->max_level_width = width;
+        }
+        state->level_starts[l + 1] += state->level_starts[l];
+    }
+    size_t* fill = (size_t*)malloc((state->level_count + 1) * sizeof(size_t));
+    if (!fill) {
+        free(levels);
+        free_execution_state(state, component_count, group_count);
+        return NULL;
+    }
+    memcpy(fill, state->level_starts, (state->level_count + 1) * sizeof(size_t));
+    for (size_t g = 0; g < group_count; g++) {
+        state->level_order[fill[levels[g]]++] = g;
+    }
+
+    free(fill);
+    free(levels);
+
+    return state;
+}
+
+// Body of a pool worker thread
+static void* worker_main(void* arg) {
+    MPSWorkerPool* pool = (MPSWorkerPool*)arg;
+
+    pthread_mutex_lock(&pool->lock);
+    while (true) {
+        while (!pool->shutdown && pool->next >= pool->batch_count) {
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+        }
+        if (pool->shutdown) {
+            break;
+        }
+
+        size_t group_idx = pool->batch[pool->next++];
+        pthread_mutex_unlock(&pool->lock);
+
+        run_group(pool->ctx, pool->pipeline, group_idx, pool->pipeline->execution_state->edge_streams);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) {
+            pthread_cond_signal(&pool->work_done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+// Stop and free a worker pool
+static void destroy_worker_pool(MPSWorkerPool* pool) {
+    if (!pool) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t i = 0; i < pool->thread_count; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->work_done);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+// Start enough workers to run the widest level; the caller is one of them
+static MPSWorkerPool* create_worker_pool(NexusContext* ctx, NexusMPSPipeline* pipeline, size_t width) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t threads = cpus > 1 ? (size_t)cpus : 1;
+    if (threads > width) {
+        threads = width;
+    }
+    if (threads <= 1) {
+        return NULL;
+    }
+
+    MPSWorkerPool* pool = (MPSWorkerPool*)calloc(1, sizeof(MPSWorkerPool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->threads = (pthread_t*)malloc((threads - 1) * sizeof(pthread_t));
+    if (!pool->threads) {
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+    pool->ctx = ctx;
+    pool->pipeline = pipeline;
+
+    for (size_t i = 0; i < threads - 1; i++) {
+        if (pthread_create(&pool->threads[i], NULL, worker_main, pool) != 0) {
+            break;
+        }
+        pool->thread_count++;
+    }
+
+    if (pool->thread_count == 0) {
+        destroy_worker_pool(pool);
+        return NULL;
+    }
+
+    nexus_log(ctx, NEXUS_LOG_DEBUG, "Started %zu workers for pipeline '%s'",
+             pool->thread_count, pipeline->pipeline_id ? pipeline->pipeline_id : "unnamed");
+
+    return pool;
+}
+
+// Run the groups of one level, concurrently when a pool is available
+static void run_level(NexusContext* ctx, NexusMPSPipeline* pipeline, const size_t* batch, size_t count) {
+    NexusMPSExecutionState* state = pipeline->execution_state;
+    MPSWorkerPool* pool = state->pool;
+
+    if (!pool || count < 2) {
+        for (size_t i = 0; i < count; i++) {
+            run_group(ctx, pipeline, batch[i], state->edge_streams);
+        }
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->ctx = ctx;
+    pool->batch = batch;
+    pool->batch_count = count;
+    pool->next = 0;
+    pool->pending = count;
+    pthread_cond_broadcast(&pool->work_ready);
+
+    // The calling thread claims groups alongside the workers
+    while (pool->next < pool->batch_count) {
+        size_t group_idx = pool->batch[pool->next++];
+        pthread_mutex_unlock(&pool->lock);
+
+        run_group(ctx, pipeline, group_idx, state->edge_streams);
+
+        pthread_mutex_lock(&pool->lock);
+        pool->pending--;
+    }
+
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+    }
+
+    pool->batch = NULL;
+    pool->batch_count = 0;
+    pool->next = 0;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// Select the input stream of a component
+static NexusMPSDataStream* component_input(NexusMPSPipeline* pipeline,
+                                           size_t idx,
+                                           NexusMPSDataStream** edge_streams,
+                                           NexusMPSDataStream* view,
+                                           NexusResult* result) {
+    NexusMPSExecutionState* state = pipeline->execution_state;
+    const NexusMPSDependencyGraph* graph = pipeline->graph;
+    const NexusMPSDependencyNode* node = &graph->nodes[idx];
+    *result = NEXUS_SUCCESS;
+
+    // Sources read a private view of the pipeline input
+    if (node->incoming_count == 0) {
+        memset(view, 0, sizeof(*view));
+        if (state->input) {
+            view->data = state->input->data;
+            view->size = state->input->size;
+            view->capacity = state->input->size;
+            view->format = state->input->format;
+        }
+        view->owns_data = false;
+        view->state = view->size > 0 ? MPS_STREAM_READY : MPS_STREAM_EMPTY;
+        return view;
+    }
+
+    if (node->incoming_count == 1) {
+        NexusMPSDataStream* stream = edge_streams[node->incoming_edges[0]];
+        stream->position = 0;
+        return stream;
+    }
+
+    // Concatenate all inputs in connection order
+    if (!state->gathered[idx]) {
+        state->gathered[idx] = mps_stream_create(0);
+        if (!state->gathered[idx]) {
+            *result = NEXUS_OUT_OF_MEMORY;
+            return NULL;
+        }
+    }
+
+    NexusMPSDataStream* gathered = state->gathered[idx];
+    mps_stream_clear(gathered);
+    for (size_t e = 0; e < node->incoming_count; e++) {
+        const NexusMPSDataStream* stream = edge_streams[node->incoming_edges[e]];
+        if (stream->size > 0) {
+            *result = mps_stream_write(gathered, stream->data, stream->size);
+            if (*result != NEXUS_SUCCESS) {
+                return NULL;
+            }
+        }
+    }
+    gathered->position = 0;
+
+    return gathered;
+}
+
+// Execute one component and publish its output if it changed
+static NexusResult run_component(NexusContext* ctx,
+                                 NexusMPSPipeline* pipeline,
+                                 size_t idx,
+                                 NexusMPSDataStream** edge_streams,
+                                 int iteration,
+                                 bool* changed) {
+    NexusMPSExecutionState* state = pipeline->execution_state;
+    const NexusMPSDependencyNode* node = &pipeline->graph->nodes[idx];
+    NexusMPSPipelineComponent* component = pipeline->components[idx];
+
+    NexusMPSDataStream view;
+    NexusResult result;
+    NexusMPSDataStream* input = component_input(pipeline, idx, edge_streams, &view, &result);
+    if (!input) {
+        return result;
+    }
+
+    NexusMPSDataStream* output = state->scratch[idx];
+    mps_stream_clear(output);
+
+    double start = now_ms();
+    result = mps_component_execute(ctx, component, input, output, iteration);
+    component->last_execution_time_ms = now_ms() - start;
+
+    if (result != NEXUS_SUCCESS) {
+        return result;
+    }
+
+    // The previous output stays in outputs[idx] until this comparison
+    NexusMPSDataStream* previous = state->outputs[idx];
+    *changed = output->size != previous->size ||
+               (output->size > 0 && memcmp(output->data, previous->data, output->size) != 0);
+
+    state->outputs[idx] = output;
+    state->scratch[idx] = previous;
+
+    if (!*changed) {
+        return NEXUS_SUCCESS;
+    }
+
+    for (size_t e = 0; e < node->outgoing_count; e++) {
+        NexusMPSDataStream* stream = edge_streams[node->outgoing_edges[e]];
+        mps_stream_clear(stream);
+        if (output->size > 0) {
+            result = mps_stream_write(stream, output->data, output->size);
+            if (result != NEXUS_SUCCESS) {
+                return result;
+            }
+        }
+        stream->state = MPS_STREAM_READY;
+    }
+
+    return NEXUS_SUCCESS;
+}
+
+// Run one group to completion on the calling thread
+//
+// Acyclic groups execute once. Cyclic groups are swept Gauss-Seidel style
+// in configuration order, each member seeing the latest output of the
+// others, until a sweep changes no output or the iteration limit is hit.
+static void run_group(NexusContext* ctx, NexusMPSPipeline* pipeline, size_t group_idx,
+                      NexusMPSDataStream** edge_streams) {
+    NexusMPSExecutionState* state = pipeline->execution_state;
+    NexusMPSGroupStats* stats = &pipeline->stats.groups[group_idx];
+    MPSGroupRun* run = &state->runs[group_idx];
+    const size_t* members = state->members[group_idx];
+    size_t member_count = state->member_counts[group_idx];
+    bool cyclic = state->cyclic[group_idx];
+    int limit = pipeline->max_iterations;
+
+    run->result = NEXUS_SUCCESS;
+    run->executions = 0;
+
+    double start = now_ms();
+    int iteration = 0;
+    bool changed;
+
+    do {
+        changed = false;
+
+        for (size_t m = 0; m < member_count; m++) {
+            size_t idx = members[m];
+            NexusMPSPipelineComponent* component = pipeline->components[idx];
+            const NexusMPSComponentConfig* config = pipeline->graph->nodes[idx].config;
+
+            // Optional components that failed to load are skipped
+            if (!component->is_initialized && config->optional) {
+                continue;
+            }
+            if (iteration > 0 && !component->supports_reentrance) {
+                continue;
+            }
+            if (config->max_passes > 0 && iteration >= config->max_passes) {
+                continue;
+            }
+
+            bool component_changed = false;
+            NexusResult result = run_component(ctx, pipeline, idx, edge_streams, iteration, &component_changed);
+            run->executions++;
+
+            if (result != NEXUS_SUCCESS) {
+                run->result = result;
+                run->failed_component = idx;
+                run->failed_iteration = iteration;
+                iteration++;
+                goto done;
+            }
+
+            changed = changed || component_changed;
+        }
+
+        for (size_t m = 0; m < member_count; m++) {
+            NexusMPSPipelineComponent* component = pipeline->components[members[m]];
+            if (!component->is_initialized) {
+                continue;
+            }
+
+            NexusResult result = mps_component_end_iteration(ctx, component, iteration);
+            if (result != NEXUS_SUCCESS) {
+                run->result = result;
+                run->failed_component = members[m];
+                run->failed_iteration = iteration;
+                iteration++;
+                goto done;
+            }
+        }
+
+        iteration++;
+    } while (cyclic && changed && (limit <= 0 || iteration < limit));
+
+done:
+    stats->iterations = iteration;
+    stats->converged = run->result == NEXUS_SUCCESS && (!cyclic || !changed);
+    stats->execution_time_ms = now_ms() - start;
+}
 
 // Create a new multi-pass pipeline from configuration
 NexusMPSPipeline* mps_pipeline_create(NexusContext* ctx, NexusMPSConfig* config) {
-    // TODO: Implementation
-    return NULL;
+    if (!config) {
+        return NULL;
+    }
+
+    nexus_log(ctx, NEXUS_LOG_INFO, "Creating multi-pass pipeline '%s'",
+             config->pipeline_id ? config->pipeline_id : "unnamed");
+
+    NexusResult result = mps_validate_pipeline_config(ctx, config);
+    if (result != NEXUS_SUCCESS) {
+        nexus_log(ctx, NEXUS_LOG_ERROR, "Invalid pipeline configuration: %d", result);
+        return NULL;
+    }
+
+    NexusMPSPipeline* pipeline = (NexusMPSPipeline*)calloc(1, sizeof(NexusMPSPipeline));
+    if (!pipeline) {
+        nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate pipeline");
+        return NULL;
+    }
+
+    pipeline->pipeline_id = config->pipeline_id;
+    pipeline->config = config;
+    pipeline->max_iterations = config->max_iteration_count;
+
+    // Components follow configuration order, so index i is graph node i
+    pipeline->graph = mps_create_dependency_graph(ctx, config);
+    if (!pipeline->graph) {
+        mps_pipeline_destroy(ctx, pipeline);
+        return NULL;
+    }
+
+    pipeline->components = (NexusMPSPipelineComponent**)calloc(config->component_count + 1,
+                                                               sizeof(NexusMPSPipelineComponent*));
+    if (!pipeline->components) {
+        mps_pipeline_destroy(ctx, pipeline);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < config->component_count; i++) {
+        NexusMPSPipelineComponent* component = (NexusMPSPipelineComponent*)calloc(1, sizeof(NexusMPSPipelineComponent));
+        if (!component) {
+            mps_pipeline_destroy(ctx, pipeline);
+            return NULL;
+        }
+
+        component->component_id = config->components[i]->component_id;
+        component->supports_reentrance = config->components[i]->supports_reentrance;
+        component->last_result = NEXUS_SUCCESS;
+        pipeline->components[i] = component;
+        pipeline->component_count++;
+    }
+
+    result = mps_resolve_bidirectional_dependencies(ctx, pipeline->graph, &pipeline->groups, &pipeline->group_count);
+    if (result != NEXUS_SUCCESS) {
+        nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to resolve execution groups: %d", result);
+        mps_pipeline_destroy(ctx, pipeline);
+        return NULL;
+    }
+
+    pipeline->stats.groups = (NexusMPSGroupStats*)calloc(pipeline->group_count + 1, sizeof(NexusMPSGroupStats));
+    if (!pipeline->stats.groups) {
+        mps_pipeline_destroy(ctx, pipeline);
+        return NULL;
+    }
+    pipeline->stats.group_count = pipeline->group_count;
+    pipeline->stats.component_count = (int)pipeline->component_count;
+
+    for (size_t g = 0; g < pipeline->group_count; g++) {
+        if ((int)pipeline->groups[g]->component_count > pipeline->stats.max_group_size) {
+            pipeline->stats.max_group_size = (int)pipeline->groups[g]->component_count;
+        }
+        if (pipeline->groups[g]->has_cycles) {
+            pipeline->stats.cycle_count++;
+        }
+    }
+
+    pipeline->execution_state = build_execution_state(ctx, pipeline);
+    if (!pipeline->execution_state) {
+        nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to build execution state");
+        mps_pipeline_destroy(ctx, pipeline);
+        return NULL;
+    }
+    pipeline->stats.level_count = (int)pipeline->execution_state->level_count;
+
+    nexus_log(ctx, NEXUS_LOG_INFO, "Pipeline has %zu groups on %zu levels (%d cyclic)",
+             pipeline->group_count, pipeline->execution_state->level_count, pipeline->stats.cycle_count);
+
+    return pipeline;
+}
+
+// Load a component library and resolve its processing function
+static NexusResult load_component(NexusContext* ctx, NexusMPSPipeline* pipeline, size_t idx) {
+    NexusMPSPipelineComponent* component = pipeline->components[idx];
+    const NexusMPSComponentConfig* config = pipeline->config->components[idx];
+
+    char path[256];
+    snprintf(path, sizeof(path), "components/%s/lib%s.so",
+            component->component_id, component->component_id);
+
+    component->component = nexus_load_component(ctx, path, component->component_id);
+    if (component->component) {
+        char process_symbol[256];
+        snprintf(process_symbol, sizeof(process_symbol), "%s_process", component->component_id);
+        component->process_func = (NexusMPSProcessFunc)nexus_resolve_component_symbol(
+            ctx, component->component, process_symbol
+        );
+    }
+
+    if (component->process_func) {
+        return NEXUS_SUCCESS;
+    }
+
+    if (config->optional) {
+        nexus_log(ctx, NEXUS_LOG_WARNING, "Optional component '%s' could not be loaded",
+                 component->component_id);
+        return NEXUS_SUCCESS;
+    }
+
+    nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to load component '%s'", component->component_id);
+    return NEXUS_NOT_FOUND;
 }
 
 // Initialize all components in the multi-pass pipeline
+//
+// Components that already have a processing function or lifecycle hooks
+// are used as they are; the rest are loaded from their libraries.
 NexusResult mps_pipeline_initialize(NexusContext* ctx, NexusMPSPipeline* pipeline) {
-    // TODO: Implementation
+    if (!pipeline) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+
+    if (pipeline->is_initialized) {
+        return NEXUS_SUCCESS;
+    }
+
+    for (size_t i = 0; i < pipeline->component_count; i++) {
+        NexusMPSPipelineComponent* component = pipeline->components[i];
+
+        if (!component->process_func && !component->component_state) {
+            NexusResult result = load_component(ctx, pipeline, i);
+            if (result != NEXUS_SUCCESS) {
+                return result;
+            }
+            if (!component->process_func) {
+                continue;
+            }
+        }
+
+        NexusResult result = mps_component_initialize(ctx, component);
+        if (result != NEXUS_SUCCESS) {
+            return result;
+        }
+    }
+
+    // Workers are only needed when some level holds several groups
+    NexusMPSExecutionState* state = pipeline->execution_state;
+    if (!state->pool && state->max_level_width > 1) {
+        state->pool = create_worker_pool(ctx, pipeline, state->max_level_width);
+    }
+
+    pipeline->is_initialized = true;
     return NEXUS_SUCCESS;
 }
 
+// Report the failures of one level; returns false if execution must stop
+static bool report_level_errors(NexusContext* ctx,
+                                NexusMPSPipeline* pipeline,
+                                const size_t* batch,
+                                size_t count,
+                                NexusResult* final_result) {
+    NexusMPSExecutionState* state = pipeline->execution_state;
+    bool proceed = true;
+
+    for (size_t i = 0; i < count; i++) {
+        const MPSGroupRun* run = &state->runs[batch[i]];
+        if (run->result == NEXUS_SUCCESS) {
+            continue;
+        }
+
+        mps_handle_pipeline_error(ctx, pipeline, run->result,
+                                  pipeline->components[run->failed_component]->component_id,
+                                  run->failed_iteration);
+
+        if (pipeline->config->allow_partial_processing) {
+            if (*final_result == NEXUS_SUCCESS) {
+                *final_result = NEXUS_PARTIAL_SUCCESS;
+            }
+        } else {
+            if (proceed) {
+                *final_result = run->result;
+            }
+            proceed = false;
+        }
+    }
+
+    return proceed;
+}
+
 // Execute the multi-pass pipeline with input data
 NexusResult mps_pipeline_execute(NexusContext* ctx, 
                                NexusMPSPipeline* pipeline, 
                                NexusMPSDataStream* input, 
                                NexusMPSDataStream* output) {
-    // TODO: Implementation
-    return NEXUS_SUCCESS;
+    if (!pipeline || !input || !output) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+
+    if (!pipeline->is_initialized) {
+        NexusResult result = mps_pipeline_initialize(ctx, pipeline);
+        if (result != NEXUS_SUCCESS) {
+            nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to initialize pipeline: %d", result);
+            return result;
+        }
+    }
+
+    NexusMPSExecutionState* state = pipeline->execution_state;
+    double start = now_ms();
+
+    // Every run starts from empty connections
+    mps_stream_map_clear(state->streams);
+    for (size_t i = 0; i < pipeline->component_count; i++) {
+        mps_stream_clear(state->outputs[i]);
+        mps_stream_clear(state->scratch[i]);
+    }
+    for (size_t g = 0; g < pipeline->group_count; g++) {
+        pipeline->stats.groups[g].iterations = 0;
+        pipeline->stats.groups[g].execution_time_ms = 0.0;
+        pipeline->stats.groups[g].converged = false;
+        state->runs[g].result = NEXUS_SUCCESS;
+        state->runs[g].executions = 0;
+    }
+    state->input = input;
+
+    NexusResult final_result = NEXUS_SUCCESS;
+    bool proceed = true;
+
+    for (size_t level = 0; level < state->level_count && proceed; level++) {
+        const size_t* batch = state->level_order + state->level_starts[level];
+        size_t count = state->level_starts[level + 1] - state->level_starts[level];
+
+        run_level(ctx, pipeline, batch, count);
+        proceed = report_level_errors(ctx, pipeline, batch, count, &final_result);
+    }
+
+    // Components that feed nothing produce the pipeline output
+    if (proceed) {
+        for (size_t i = 0; i < pipeline->component_count; i++) {
+            const NexusMPSDataStream* result_stream = state->outputs[i];
+            if (pipeline->graph->nodes[i].outgoing_count > 0 || result_stream->size == 0) {
+                continue;
+            }
+
+            NexusResult result = mps_stream_write(output, result_stream->data, result_stream->size);
+            if (result != NEXUS_SUCCESS) {
+                final_result = result;
+                break;
+            }
+        }
+    }
+
+    state->input = NULL;
+
+    // Iterations of a run are those of its longest-running group
+    int iterations = 0;
+    for (size_t g = 0; g < pipeline->group_count; g++) {
+        pipeline->stats.total_component_executions += state->runs[g].executions;
+        if (pipeline->stats.groups[g].iterations > iterations) {
+            iterations = pipeline->stats.groups[g].iterations;
+        }
+    }
+
+    pipeline->current_iteration = iterations;
+    pipeline->stats.total_iterations += iterations;
+    pipeline->stats.total_execution_time_ms += now_ms() - start;
+    if (pipeline->stats.total_iterations > 0) {
+        pipeline->stats.avg_iteration_time_ms =
+            pipeline->stats.total_execution_time_ms / pipeline->stats.total_iterations;
+    }
+
+    return final_result;
+}
+
+// Free execution state resources
+static void free_execution_state(NexusMPSExecutionState* state, size_t component_count, size_t group_count) {
+    if (!state) {
+        return;
+    }
+
+    destroy_worker_pool(state->pool);
+
+    // Edge streams are owned by the map
+    mps_stream_map_destroy(state->streams);
+
+    if (state->gathered && state->outputs && state->scratch) {
+        for (size_t i = 0; i < component_count; i++) {
+            mps_stream_destroy(state->gathered[i]);
+            mps_stream_destroy(state->outputs[i]);
+            mps_stream_destroy(state->scratch[i]);
+        }
+    }
+
+    if (state->members) {
+        for (size_t g = 0; g < group_count; g++) {
+            free(state->members[g]);
+        }
+    }
+
+    free(state->edge_streams);
+    free(state->gathered);
+    free(state->outputs);
+    free(state->scratch);
+    free(state->members);
+    free(state->member_counts);
+    free(state->cyclic);
+    free(state->level_order);
+    free(state->level_starts);
+    free(state->runs);
+    free(state);
 }
 
 // Clean up multi-pass pipeline resources
 void mps_pipeline_destroy(NexusContext* ctx, NexusMPSPipeline* pipeline) {
-    // TODO: Implementation
+    if (!pipeline) {
+        return;
+    }
+
+    // Stop the workers before the components they run go away
+    free_execution_state(pipeline->execution_state, pipeline->component_count, pipeline->group_count);
+
+    for (size_t i = 0; i < pipeline->component_count; i++) {
+        NexusMPSPipelineComponent* component = pipeline->components[i];
+
+        mps_component_terminate(ctx, component);
+        if (component->component) {
+            nexus_unload_component(ctx, component->component);
+        }
+
+        // Lifecycle data registered through mps_register_component_lifecycle
+        free(component->component_state);
+        free(component);
+    }
+    free(pipeline->components);
+
+    mps_free_execution_groups(pipeline->groups, pipeline->group_count);
+    mps_free_dependency_graph(pipeline->graph);
+    free(pipeline->stats.groups);
+
+    // Note: We don't free pipeline->config since it's owned by the caller
+
+    free(pipeline);
 }
 
 // Execute a specific component group in the pipeline
@@ -48,13 +900,71 @@ NexusResult mps_pipeline_execute_group(NexusContext* ctx,
                                       NexusMPSPipeline* pipeline,
                                       NexusExecutionGroup* group,
                                       NexusMPSDataStreamMap* streams) {
-    // TODO: Implementation
+    if (!pipeline || !group || !pipeline->execution_state) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+
+    size_t group_idx = pipeline->group_count;
+    for (size_t g = 0; g < pipeline->group_count; g++) {
+        if (pipeline->groups[g] == group) {
+            group_idx = g;
+            break;
+        }
+    }
+    if (group_idx == pipeline->group_count) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+
+    NexusMPSExecutionState* state = pipeline->execution_state;
+    NexusMPSDataStream** edge_streams = state->edge_streams;
+    const NexusMPSDependencyGraph* graph = pipeline->graph;
+
+    // Resolve every edge against a caller-supplied map
+    if (streams && streams != state->streams) {
+        edge_streams = (NexusMPSDataStream**)calloc(graph->edge_count + 1, sizeof(NexusMPSDataStream*));
+        if (!edge_streams) {
+            return NEXUS_OUT_OF_MEMORY;
+        }
+
+        for (size_t e = 0; e < graph->edge_count; e++) {
+            edge_streams[e] = mps_stream_map_get(streams,
+                                                 graph->nodes[graph->edges[e].source_idx].component_id,
+                                                 graph->nodes[graph->edges[e].target_idx].component_id);
+            if (!edge_streams[e]) {
+                free(edge_streams);
+                return NEXUS_NOT_FOUND;
+            }
+        }
+    }
+
+    run_group(ctx, pipeline, group_idx, edge_streams);
+
+    if (edge_streams != state->edge_streams) {
+        free(edge_streams);
+    }
+
+    const MPSGroupRun* run = &state->runs[group_idx];
+    if (run->result != NEXUS_SUCCESS) {
+        return mps_handle_pipeline_error(ctx, pipeline, run->result,
+                                         pipeline->components[run->failed_component]->component_id,
+                                         run->failed_iteration);
+    }
+
     return NEXUS_SUCCESS;
 }
 
 // Get a component from the pipeline by ID
 NexusMPSPipelineComponent* mps_pipeline_get_component(NexusMPSPipeline* pipeline, const char* component_id) {
-    // TODO: Implementation
+    if (!pipeline || !component_id) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < pipeline->component_count; i++) {
+        if (strcmp(pipeline->components[i]->component_id, component_id) == 0) {
+            return pipeline->components[i];
+        }
+    }
+
     return NULL;
 }
 
@@ -97,15 +1007,21 @@ NexusResult mps_pipeline_remove_connection(NexusContext* ctx,
 
 // Set pipeline-level error handler
 void mps_pipeline_set_error_handler(NexusMPSPipeline* pipeline, NexusMPSPipelineErrorHandler handler) {
-    // TODO: Implementation
+    if (pipeline) {
+        pipeline->error_handler = handler;
+    }
 }
 
 // Set pipeline iteration limit
 void mps_pipeline_set_iteration_limit(NexusMPSPipeline* pipeline, int max_iterations) {
-    // TODO: Implementation
+    if (pipeline) {
+        pipeline->max_iterations = max_iterations > 0 ? max_iterations : 0;
+    }
 }
 
 // Get pipeline execution statistics
 void mps_pipeline_get_stats(NexusMPSPipeline* pipeline, NexusMPSPipelineStats* stats) {
-    // TODO: Implementation
+    if (pipeline && stats) {
+        *stats = pipeline->stats;
+    }
 }
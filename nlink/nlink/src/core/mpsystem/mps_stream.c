@@ -14,39 +14,201 @@
  #include <string.h>
  #include <stdlib.h>
  
+ // Smallest buffer allocated for a stream
+ #define MPS_STREAM_MIN_CAPACITY 128
+ 
+ // Free a metadata entry and its value
+ static void free_metadata_entry(MPSStreamMetadataEntry* entry) {
+     free(entry->key);
+     if (entry->value && entry->free_func) {
+         entry->free_func(entry->value);
+     }
+     free(entry);
+ }
+ 
+ // Free every metadata entry of a stream
+ static void free_metadata(NexusMPSDataStream* stream) {
+     MPSStreamMetadataEntry* entry = stream->metadata;
+     while (entry) {
+         MPSStreamMetadataEntry* next = entry->next;
+         free_metadata_entry(entry);
+         entry = next;
+     }
+     stream->metadata = NULL;
+ }
+ 
+ // Grow a stream to hold at least required_size bytes
+ static NexusResult ensure_stream_capacity(NexusMPSDataStream* stream, size_t required_size) {
+     if (stream->capacity >= required_size) {
+         return NEXUS_SUCCESS;
+     }
+     
+     // Grow by 1.5x or to the required size, whichever is larger
+     size_t new_capacity = stream->capacity * 3 / 2;
+     if (new_capacity < required_size) {
+         new_capacity = required_size;
+     }
+     
+     return mps_stream_resize(stream, new_capacity);
+ }
+ 
  // Create a new multi-pass data stream
  NexusMPSDataStream* mps_stream_create(size_t initial_capacity) {
-     // TODO: Implementation
-     return NULL;
+     if (initial_capacity < MPS_STREAM_MIN_CAPACITY) {
+         initial_capacity = MPS_STREAM_MIN_CAPACITY;
+     }
+     
+     NexusMPSDataStream* stream = (NexusMPSDataStream*)calloc(1, sizeof(NexusMPSDataStream));
+     if (!stream) {
+         return NULL;
+     }
+     
+     stream->data = malloc(initial_capacity);
+     if (!stream->data) {
+         free(stream);
+         return NULL;
+     }
+     
+     stream->capacity = initial_capacity;
+     stream->owns_data = true;
+     stream->state = MPS_STREAM_EMPTY;
+     
+     return stream;
  }
  
  // Create a multi-pass data stream from existing data
  NexusMPSDataStream* mps_stream_create_from_data(const void* data, size_t size, const char* format) {
-     // TODO: Implementation
-     return NULL;
+     if (!data || size == 0) {
+         return NULL;
+     }
+     
+     NexusMPSDataStream* stream = mps_stream_create(size);
+     if (!stream) {
+         return NULL;
+     }
+     
+     memcpy(stream->data, data, size);
+     stream->size = size;
+     stream->state = MPS_STREAM_READY;
+     
+     if (format) {
+         stream->format = strdup(format);
+         if (!stream->format) {
+             mps_stream_destroy(stream);
+             return NULL;
+         }
+     }
+     
+     return stream;
  }
  
  // Resize a multi-pass data stream
  NexusResult mps_stream_resize(NexusMPSDataStream* stream, size_t new_capacity) {
-     // TODO: Implementation
+     if (!stream || new_capacity < stream->size || !stream->owns_data) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     if (new_capacity == stream->capacity) {
+         return NEXUS_SUCCESS;
+     }
+     
+     void* new_data = realloc(stream->data, new_capacity);
+     if (!new_data) {
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     stream->data = new_data;
+     stream->capacity = new_capacity;
+     
      return NEXUS_SUCCESS;
  }
  
  // Write data to a multi-pass stream
  NexusResult mps_stream_write(NexusMPSDataStream* stream, const void* data, size_t size) {
-     // TODO: Implementation
+     if (!stream || !data || size == 0) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     if (stream->state == MPS_STREAM_CLOSED) {
+         return NEXUS_INVALID_OPERATION;
+     }
+     
+     NexusResult result = ensure_stream_capacity(stream, stream->position + size);
+     if (result != NEXUS_SUCCESS) {
+         return result;
+     }
+     
+     memcpy((char*)stream->data + stream->position, data, size);
+     stream->position += size;
+     
+     if (stream->position > stream->size) {
+         stream->size = stream->position;
+     }
+     
+     stream->state = MPS_STREAM_PARTIAL;
+     stream->generation++;
+     
      return NEXUS_SUCCESS;
  }
  
  // Read data from a multi-pass stream
  NexusResult mps_stream_read(NexusMPSDataStream* stream, void* buffer, size_t size, size_t* bytes_read) {
-     // TODO: Implementation
+     if (!stream || !buffer || size == 0) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     size_t available = stream->size > stream->position ? stream->size - stream->position : 0;
+     size_t count = size < available ? size : available;
+     
+     if (count > 0) {
+         memcpy(buffer, (const char*)stream->data + stream->position, count);
+         stream->position += count;
+     }
+     
+     if (stream->position >= stream->size && stream->size > 0) {
+         stream->state = MPS_STREAM_CONSUMED;
+     }
+     
+     if (bytes_read) {
+         *bytes_read = count;
+     }
+     
      return NEXUS_SUCCESS;
  }
  
  // Create a stream map for multi-pass systems
  NexusMPSDataStreamMap* mps_stream_map_create(size_t initial_capacity) {
-     // TODO: Implementation
+     if (initial_capacity == 0) {
+         initial_capacity = 8;
+     }
+     
+     NexusMPSDataStreamMap* map = (NexusMPSDataStreamMap*)calloc(1, sizeof(NexusMPSDataStreamMap));
+     if (!map) {
+         return NULL;
+     }
+     
+     map->entries = (MPSStreamMapEntry*)calloc(initial_capacity, sizeof(MPSStreamMapEntry));
+     if (!map->entries) {
+         free(map);
+         return NULL;
+     }
+     
+     map->capacity = initial_capacity;
+     return map;
+ }
+ 
+ // Find the entry for a connection
+ static MPSStreamMapEntry* find_entry(const NexusMPSDataStreamMap* map,
+                                      const char* source_id,
+                                      const char* target_id) {
+     for (size_t i = 0; i < map->count; i++) {
+         MPSStreamMapEntry* entry = &map->entries[i];
+         if (strcmp(entry->key.source_id, source_id) == 0 &&
+             strcmp(entry->key.target_id, target_id) == 0) {
+             return entry;
+         }
+     }
+     
      return NULL;
  }
  
@@ -55,7 +217,39 @@
                                const char* source_id, 
                                const char* target_id, 
                                NexusMPSDataStream* stream) {
-     // TODO: Implementation
+     if (!map || !source_id || !target_id || !stream) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     if (find_entry(map, source_id, target_id)) {
+         return NEXUS_ALREADY_EXISTS;
+     }
+     
+     if (map->count == map->capacity) {
+         size_t new_capacity = map->capacity * 2;
+         MPSStreamMapEntry* entries = (MPSStreamMapEntry*)realloc(
+             map->entries, new_capacity * sizeof(MPSStreamMapEntry)
+         );
+         if (!entries) {
+             return NEXUS_OUT_OF_MEMORY;
+         }
+         map->entries = entries;
+         map->capacity = new_capacity;
+     }
+     
+     MPSStreamMapEntry* entry = &map->entries[map->count];
+     entry->key.source_id = strdup(source_id);
+     entry->key.target_id = strdup(target_id);
+     if (!entry->key.source_id || !entry->key.target_id) {
+         free(entry->key.source_id);
+         free(entry->key.target_id);
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     // The map takes ownership of the stream
+     entry->stream = stream;
+     map->count++;
+     
      return NEXUS_SUCCESS;
  }
  
@@ -63,8 +257,71 @@
  NexusMPSDataStream* mps_stream_map_get(const NexusMPSDataStreamMap* map,
                                        const char* source_id,
                                        const char* target_id) {
-     // TODO: Implementation
-     return NULL;
+     if (!map || !source_id || !target_id) {
+         return NULL;
+     }
+     
+     MPSStreamMapEntry* entry = find_entry(map, source_id, target_id);
+     return entry ? entry->stream : NULL;
+ }
+ 
+ // Collect the streams whose source (or target) matches an ID
+ static NexusResult collect_streams(const NexusMPSDataStreamMap* map,
+                                    const char* component_id,
+                                    bool as_source,
+                                    NexusMPSDataStream*** streams,
+                                    char*** peer_ids,
+                                    size_t* count) {
+     if (!map || !component_id || !streams || !count) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     *streams = NULL;
+     *count = 0;
+     if (peer_ids) {
+         *peer_ids = NULL;
+     }
+     
+     size_t matches = 0;
+     for (size_t i = 0; i < map->count; i++) {
+         const MPSStreamKey* key = &map->entries[i].key;
+         if (strcmp(as_source ? key->source_id : key->target_id, component_id) == 0) {
+             matches++;
+         }
+     }
+     
+     if (matches == 0) {
+         return NEXUS_SUCCESS;
+     }
+     
+     NexusMPSDataStream** found = (NexusMPSDataStream**)malloc(matches * sizeof(NexusMPSDataStream*));
+     char** ids = peer_ids ? (char**)malloc(matches * sizeof(char*)) : NULL;
+     if (!found || (peer_ids && !ids)) {
+         free(found);
+         free(ids);
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     size_t n = 0;
+     for (size_t i = 0; i < map->count; i++) {
+         const MPSStreamKey* key = &map->entries[i].key;
+         if (strcmp(as_source ? key->source_id : key->target_id, component_id) == 0) {
+             found[n] = map->entries[i].stream;
+             if (ids) {
+                 ids[n] = as_source ? key->target_id : key->source_id;
+             }
+             n++;
+         }
+     }
+     
+     // The arrays belong to the caller; the IDs remain owned by the map
+     *streams = found;
+     if (peer_ids) {
+         *peer_ids = ids;
+     }
+     *count = n;
+     
+     return NEXUS_SUCCESS;
  }
  
  // Get all streams for a component (as source)
@@ -73,8 +330,7 @@
                                         NexusMPSDataStream*** streams,
                                         char*** target_ids,
                                         size_t* count) {
-     // TODO: Implementation
-     return NEXUS_SUCCESS;
+     return collect_streams(map, source_id, true, streams, target_ids, count);
  }
  
  // Get all streams for a component (as target)
@@ -83,29 +339,86 @@
                                         NexusMPSDataStream*** streams,
                                         char*** source_ids,
                                         size_t* count) {
-     // TODO: Implementation
-     return NEXUS_SUCCESS;
+     return collect_streams(map, target_id, false, streams, source_ids, count);
  }
  
  // Clear all streams in the map
  void mps_stream_map_clear(NexusMPSDataStreamMap* map) {
-     // TODO: Implementation
+     if (!map) {
+         return;
+     }
+     
+     for (size_t i = 0; i < map->count; i++) {
+         mps_stream_clear(map->entries[i].stream);
+     }
  }
  
  // Free stream map resources
  void mps_stream_map_destroy(NexusMPSDataStreamMap* map) {
-     // TODO: Implementation
+     if (!map) {
+         return;
+     }
+     
+     for (size_t i = 0; i < map->count; i++) {
+         free(map->entries[i].key.source_id);
+         free(map->entries[i].key.target_id);
+         mps_stream_destroy(map->entries[i].stream);
+     }
+     
+     free(map->entries);
+     free(map);
  }
  
  // Clone a multi-pass stream
  NexusMPSDataStream* mps_stream_clone(const NexusMPSDataStream* stream) {
-     // TODO: Implementation
-     return NULL;
+     if (!stream) {
+         return NULL;
+     }
+     
+     NexusMPSDataStream* clone = mps_stream_create(stream->capacity);
+     if (!clone) {
+         return NULL;
+     }
+     
+     if (stream->size > 0) {
+         memcpy(clone->data, stream->data, stream->size);
+     }
+     clone->size = stream->size;
+     clone->position = stream->position;
+     clone->state = stream->state;
+     clone->generation = stream->generation;
+     
+     if (stream->format) {
+         clone->format = strdup(stream->format);
+         if (!clone->format) {
+             mps_stream_destroy(clone);
+             return NULL;
+         }
+     }
+     
+     // Metadata values are shared, not deep-copied; the clone does not free them
+     for (MPSStreamMetadataEntry* entry = stream->metadata; entry; entry = entry->next) {
+         if (mps_stream_set_metadata(clone, entry->key, entry->value, NULL) != NEXUS_SUCCESS) {
+             mps_stream_destroy(clone);
+             return NULL;
+         }
+     }
+     
+     return clone;
  }
  
  // Get stream metadata
  void* mps_stream_get_metadata(const NexusMPSDataStream* stream, const char* key) {
-     // TODO: Implementation
+     if (!stream || !key) {
+         return NULL;
+     }
+     
+     for (MPSStreamMetadataEntry* entry = stream->metadata; entry; entry = entry->next) {
+         if (strcmp(entry->key, key) == 0) {
+             return entry->value;
+         }
+     }
+     
      return NULL;
  }
  
@@ -114,21 +427,74 @@
                                     const char* key, 
                                     void* value, 
                                     MPSStreamMetadataFreeFunc free_func) {
-     // TODO: Implementation
+     if (!stream || !key) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     // Replace an existing value
+     for (MPSStreamMetadataEntry* entry = stream->metadata; entry; entry = entry->next) {
+         if (strcmp(entry->key, key) == 0) {
+             if (entry->value && entry->free_func && entry->value != value) {
+                 entry->free_func(entry->value);
+             }
+             entry->value = value;
+             entry->free_func = free_func;
+             return NEXUS_SUCCESS;
+         }
+     }
+     
+     MPSStreamMetadataEntry* entry = (MPSStreamMetadataEntry*)malloc(sizeof(MPSStreamMetadataEntry));
+     if (!entry) {
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     entry->key = strdup(key);
+     if (!entry->key) {
+         free(entry);
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     entry->value = value;
+     entry->free_func = free_func;
+     entry->next = stream->metadata;
+     stream->metadata = entry;
+     
      return NEXUS_SUCCESS;
  }
  
  // Clear a stream (reset position but keep capacity)
  void mps_stream_clear(NexusMPSDataStream* stream) {
-     // TODO: Implementation
+     if (!stream) {
+         return;
+     }
+     
+     stream->size = 0;
+     stream->position = 0;
+     stream->state = MPS_STREAM_EMPTY;
  }
  
  // Reset a stream to initial state
  void mps_stream_reset(NexusMPSDataStream* stream) {
-     // TODO: Implementation
+     if (!stream) {
+         return;
+     }
+     
+     mps_stream_clear(stream);
+     free_metadata(stream);
+     stream->generation = 0;
  }
  
  // Free stream resources
  void mps_stream_destroy(NexusMPSDataStream* stream) {
-     // TODO: Implementation
+     if (!stream) {
+         return;
+     }
+     
+     if (stream->data && stream->owns_data) {
+         free(stream->data);
+     }
+     
+     free((void*)stream->format);
+     free_metadata(stream);
+     free(stream);
  }
\ No newline at end of file
@@ -13,6 +13,8 @@
 #include <string.h>
 #include <strings.h>
 #include <ctype.h>
+#include <stdint.h>
+#include <pthread.h>
 #include <regex.h>
  
  /**
@@ -48,132 +50,298 @@ static bool is_regex_pattern(const char* pattern) {
             strchr(pattern, '.') != NULL);    // Any character
 }
  
- /**
-  * @brief Helper function for simple glob matching
-  * 
-  * Matches patterns with:
-  * - * (any number of characters)
-  * - ? (exactly one character)
-  * - [abc] (character class)
-  * 
-  * @param pattern Glob pattern
-  * @param string String to match
-  * @param case_insensitive Whether to ignore case
-  * @return true if matched, false otherwise
-  */
- static bool glob_match(const char* pattern, const char* string, bool case_insensitive) {
-     if (!pattern || !string) return false;
-     
-     // Empty pattern matches only empty string
-     if (*pattern == '\0') return *string == '\0';
-     
-     // Handle wildcard *
-     if (*pattern == '*') {
-         // Skip consecutive *
-         while (*(pattern+1) == '*') pattern++;
-         
-         // * at end of pattern matches everything
-         if (*(pattern+1) == '\0') return true;
-         
-         // Try match with * consuming zero or more characters
-         while (*string) {
-             if (glob_match(pattern+1, string, case_insensitive) ||
-                 glob_match(pattern, string+1, case_insensitive))
-                 return true;
-             string++;
-         }
-         
-         // Try match with * consuming zero characters
-         return glob_match(pattern+1, string, case_insensitive);
-     }
-     
-     // Handle ? (match exactly one char)
-     if (*pattern == '?' && *string != '\0') {
-         return glob_match(pattern+1, string+1, case_insensitive);
-     }
-     
-     // Handle character class [abc]
-     if (*pattern == '[') {
-         const char* end_bracket = strchr(pattern, ']');
-         
-         // Malformed pattern, no closing bracket
-         if (!end_bracket) return false;
-         
-         bool match = false;
-         const char* char_class = pattern + 1;
-         char current = *string;
-         
-         // Handle negated class [^abc]
-         bool negate = *char_class == '^';
-         if (negate) char_class++;
-         
-         // Check if current character is in the class
-         while (char_class < end_bracket) {
-             char class_char = *char_class;
-             
-             // Handle range a-z
-             if (char_class + 2 < end_bracket && *(char_class + 1) == '-') {
-                 char start = class_char;
-                 char end = *(char_class + 2);
-                 
-                 if (case_insensitive) {
-                     current = tolower(current);
-                     start = tolower(start);
-                     end = tolower(end);
-                 }
-                 
-                 if (current >= start && current <= end) {
-                     match = true;
-                     break;
-                 }
-                 
-                 char_class += 3;
-             } else {
-                 // Simple character match
-                 if (case_insensitive) {
-                     if (tolower(current) == tolower(class_char)) {
-                         match = true;
-                         break;
-                     }
-                 } else {
-                     if (current == class_char) {
-                         match = true;
-                         break;
-                     }
-                 }
-                 
-                 char_class++;
-             }
-         }
-         
-         // Apply negation
-         if (negate) match = !match;
-         
-         // If no match in character class, return false
-         if (!match || *string == '\0') return false;
-         
-         // Continue matching after the character class
-         return glob_match(end_bracket + 1, string + 1, case_insensitive);
-     }
-     
-     // Regular character match
-     if (*string != '\0') {
-         bool chars_match;
-         
-         if (case_insensitive) {
-             chars_match = (tolower(*pattern) == tolower(*string));
-         } else {
-             chars_match = (*pattern == *string);
-         }
-         
-         if (chars_match) {
-             return glob_match(pattern+1, string+1, case_insensitive);
-         }
-     }
-     
-     return false;
- }
- 
+/**
+ * @brief Glob instruction kinds
+ */
+typedef enum {
+    GLOB_OP_BYTE,               // One byte (folded when case insensitive)
+    GLOB_OP_ANY,                // ? - any one byte
+    GLOB_OP_CLASS,              // [...] - one byte from a class bitset
+    GLOB_OP_STAR                // * - any run of bytes
+} GlobOpType;
+
+typedef struct {
+    uint8_t type;               // GlobOpType
+    uint8_t byte;               // Byte for GLOB_OP_BYTE
+    uint32_t class_index;       // Class for GLOB_OP_CLASS
+} GlobOp;
+
+/**
+ * @brief Run of fixed-width instructions between two stars
+ */
+typedef struct {
+    size_t first;               // Index of the first instruction
+    size_t length;              // Instructions (and bytes) in the run
+} GlobSegment;
+
+struct NlinkGlobProgram {
+    GlobOp* ops;                // Instructions, consecutive stars collapsed
+    size_t op_count;
+    uint64_t (*classes)[4];     // 256-bit membership set per class
+    size_t class_count;
+    GlobSegment* segments;      // Star-free runs in pattern order
+    size_t segment_count;
+    bool leading_star;          // Pattern starts with *
+    bool trailing_star;         // Pattern ends with *
+    bool never_matches;         // Pattern has an unterminated class
+    bool case_insensitive;
+};
+
+static inline uint8_t glob_fold(uint8_t byte, bool case_insensitive) {
+    return case_insensitive ? (uint8_t)tolower(byte) : byte;
+}
+
+static inline bool glob_class_has(const uint64_t* bits, uint8_t byte) {
+    return (bits[byte >> 6] >> (byte & 63)) & 1;
+}
+
+/**
+ * @brief Fill the bitset for a class body between '[' and ']'
+ *
+ * Membership is computed once per byte using the same rules the
+ * recursive matcher applied on every comparison: an optional leading
+ * '^' negates, "a-z" is an inclusive range, and case folding applies
+ * to both the range ends and the tested byte.
+ */
+static void glob_compile_class(const char* body, const char* end, bool case_insensitive, uint64_t* bits) {
+    bool negate = *body == '^';
+    if (negate) body++;
+
+    memset(bits, 0, 4 * sizeof(uint64_t));
+    for (int c = 1; c < 256; c++) {
+        bool member = false;
+        const char* p = body;
+
+        while (p < end && !member) {
+            if (p + 2 < end && p[1] == '-') {
+                int current = glob_fold((uint8_t)c, case_insensitive);
+                int start = glob_fold((uint8_t)p[0], case_insensitive);
+                int stop = glob_fold((uint8_t)p[2], case_insensitive);
+                member = current >= start && current <= stop;
+                p += 3;
+            } else {
+                member = glob_fold((uint8_t)c, case_insensitive) == glob_fold((uint8_t)*p, case_insensitive);
+                p++;
+            }
+        }
+
+        if (member != negate) {
+            bits[c >> 6] |= (uint64_t)1 << (c & 63);
+        }
+    }
+}
+
+/**
+ * @brief Free a compiled glob program
+ *
+ * @param program Program to free
+ */
+static void glob_program_destroy(NlinkGlobProgram* program) {
+    if (!program) {
+        return;
+    }
+
+    free(program->ops);
+    free(program->classes);
+    free(program->segments);
+    free(program);
+}
+
+/**
+ * @brief Compile a glob pattern
+ *
+ * Supports * (any run of characters), ? (exactly one character) and
+ * [abc], [a-z], [^abc] classes. A '[' without a closing ']' makes the
+ * pattern match nothing.
+ *
+ * @param pattern Glob pattern
+ * @param case_insensitive Whether to ignore case
+ * @return NlinkGlobProgram* Compiled program or NULL on allocation failure
+ */
+static NlinkGlobProgram* glob_program_create(const char* pattern, bool case_insensitive) {
+    NlinkGlobProgram* program = calloc(1, sizeof(NlinkGlobProgram));
+    if (!program) {
+        return NULL;
+    }
+
+    size_t length = strlen(pattern);
+    size_t class_capacity = 0;
+    for (const char* p = pattern; *p; p++) {
+        if (*p == '[') class_capacity++;
+    }
+
+    // Every instruction comes from at least one pattern byte
+    program->ops = malloc((length + 1) * sizeof(GlobOp));
+    program->segments = malloc((length + 1) * sizeof(GlobSegment));
+    program->classes = class_capacity > 0 ? malloc(class_capacity * sizeof(*program->classes)) : NULL;
+    program->case_insensitive = case_insensitive;
+    if (!program->ops || !program->segments || (class_capacity > 0 && !program->classes)) {
+        glob_program_destroy(program);
+        return NULL;
+    }
+
+    const char* p = pattern;
+    while (*p) {
+        GlobOp op = { GLOB_OP_BYTE, 0, 0 };
+
+        if (*p == '*') {
+            while (*p == '*') p++;
+            op.type = GLOB_OP_STAR;
+        } else if (*p == '?') {
+            op.type = GLOB_OP_ANY;
+            p++;
+        } else if (*p == '[') {
+            const char* end_bracket = strchr(p, ']');
+            if (!end_bracket) {
+                program->never_matches = true;
+                break;
+            }
+            op.type = GLOB_OP_CLASS;
+            op.class_index = (uint32_t)program->class_count;
+            glob_compile_class(p + 1, end_bracket, case_insensitive, program->classes[program->class_count++]);
+            p = end_bracket + 1;
+        } else {
+            op.byte = glob_fold((uint8_t)*p, case_insensitive);
+            p++;
+        }
+
+        program->ops[program->op_count++] = op;
+    }
+
+    // Split the instructions into star-free segments
+    size_t first = 0;
+    for (size_t i = 0; i <= program->op_count; i++) {
+        if (i < program->op_count && program->ops[i].type != GLOB_OP_STAR) {
+            continue;
+        }
+        if (i > first) {
+            program->segments[program->segment_count++] = (GlobSegment){ first, i - first };
+        }
+        first = i + 1;
+    }
+    program->leading_star = program->op_count > 0 && program->ops[0].type == GLOB_OP_STAR;
+    program->trailing_star = program->op_count > 0 && program->ops[program->op_count - 1].type == GLOB_OP_STAR;
+
+    return program;
+}
+
+/**
+ * @brief Test whether a segment matches the string at a given offset
+ */
+static bool glob_segment_match_at(const NlinkGlobProgram* program, const GlobSegment* segment,
+                                  const uint8_t* string) {
+    const GlobOp* op = program->ops + segment->first;
+
+    for (size_t i = 0; i < segment->length; i++, op++) {
+        switch (op->type) {
+            case GLOB_OP_BYTE:
+                if (glob_fold(string[i], program->case_insensitive) != op->byte) return false;
+                break;
+            case GLOB_OP_CLASS:
+                if (!glob_class_has(program->classes[op->class_index], string[i])) return false;
+                break;
+            default:
+                break;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Find the leftmost offset in [from, limit] where a segment matches
+ *
+ * @return size_t Offset or (size_t)-1 if the segment does not occur
+ */
+static size_t glob_segment_find(const NlinkGlobProgram* program, const GlobSegment* segment,
+                                const uint8_t* string, size_t from, size_t limit) {
+    const GlobOp* lead = program->ops + segment->first;
+
+    for (size_t offset = from; offset <= limit; offset++) {
+        // Jump straight to the next candidate when the segment starts with a literal
+        if (lead->type == GLOB_OP_BYTE && !program->case_insensitive) {
+            const uint8_t* next = memchr(string + offset, lead->byte, limit - offset + 1);
+            if (!next) break;
+            offset = (size_t)(next - string);
+        }
+        if (glob_segment_match_at(program, segment, string + offset)) {
+            return offset;
+        }
+    }
+
+    return (size_t)-1;
+}
+
+/**
+ * @brief Match a string against a compiled glob
+ *
+ * Every segment is fixed-width, so the first and last segments are
+ * pinned to the ends of the string and each middle segment can take its
+ * leftmost occurrence after the previous one: if any placement works,
+ * the leftmost one does. This is the two-pointer star algorithm without
+ * its backtracking, and it runs in O(n * m) at worst instead of the
+ * exponential time of a recursive matcher.
+ *
+ * @param program Compiled glob
+ * @param string String to match
+ * @return true if matched, false otherwise
+ */
+static bool glob_program_match(const NlinkGlobProgram* program, const char* string) {
+    if (program->never_matches) {
+        return false;
+    }
+
+    const uint8_t* text = (const uint8_t*)string;
+    size_t length = strlen(string);
+    size_t first = 0;
+    size_t last = program->segment_count;
+    size_t position = 0;
+
+    if (program->segment_count == 0) {
+        return program->op_count > 0 || length == 0;
+    }
+
+    // Anchor the first segment at the start
+    if (!program->leading_star) {
+        const GlobSegment* head = &program->segments[0];
+        if (head->length > length || !glob_segment_match_at(program, head, text)) {
+            return false;
+        }
+        position = head->length;
+        first = 1;
+        if (program->segment_count == 1 && !program->trailing_star) {
+            return position == length;
+        }
+    }
+
+    // Anchor the last segment at the end
+    size_t end = length;
+    if (!program->trailing_star && first < last) {
+        const GlobSegment* tail = &program->segments[last - 1];
+        if (tail->length > length - position ||
+            !glob_segment_match_at(program, tail, text + length - tail->length)) {
+            return false;
+        }
+        end = length - tail->length;
+        last--;
+    }
+
+    // Place the middle segments leftmost, in order
+    for (size_t i = first; i < last; i++) {
+        const GlobSegment* segment = &program->segments[i];
+        if (segment->length > end - position) {
+            return false;
+        }
+        size_t offset = glob_segment_find(program, segment, text, position, end - segment->length);
+        if (offset == (size_t)-1) {
+            return false;
+        }
+        position = offset + segment->length;
+    }
+
+    return true;
+}
+
  /**
   * @brief Compile the pattern to its internal representation
   * 
@@ -208,8 +376,16 @@ static bool is_regex_pattern(const char* pattern) {
          return true;
      }
      
-     // Glob patterns don't need compilation (handled by glob_match)
+     // Compile glob pattern
      if (matcher->is_glob) {
+         matcher->compiled.glob = glob_program_create(
+             matcher->pattern,
+             (matcher->flags & NLINK_PATTERN_FLAG_CASE_INSENSITIVE) != 0
+         );
+         if (!matcher->compiled.glob) {
+             return false;
+         }
+         
          matcher->is_compiled = true;
          return true;
      }
@@ -244,10 +420,16 @@ static bool is_regex_pattern(const char* pattern) {
      
      matcher->flags = flags;
      
-     // Determine pattern type
-     if (flags & NLINK_PATTERN_FLAG_REGEX || is_regex_pattern(pattern)) {
+     // Determine pattern type; explicit flags take precedence over detection
+     if (flags & NLINK_PATTERN_FLAG_REGEX) {
+         matcher->is_regex = true;
+     } else if (flags & NLINK_PATTERN_FLAG_GLOB) {
+         matcher->is_glob = true;
+     } else if (flags & NLINK_PATTERN_FLAG_LITERAL) {
+         matcher->is_literal = true;
+     } else if (is_regex_pattern(pattern)) {
          matcher->is_regex = true;
-     } else if (flags & NLINK_PATTERN_FLAG_GLOB || is_glob_pattern(pattern)) {
+     } else if (is_glob_pattern(pattern)) {
          matcher->is_glob = true;
      } else {
          matcher->is_literal = true;
@@ -292,12 +474,8 @@ static bool is_regex_pattern(const char* pattern) {
          int result = regexec(&matcher->compiled.regex, string, 0, NULL, 0);
          return (result == 0);
      } else if (matcher->is_glob) {
-         // Use glob matching
-         return glob_match(
-             matcher->pattern, 
-             string, 
-             (matcher->flags & NLINK_PATTERN_FLAG_CASE_INSENSITIVE) != 0
-         );
+         // Run the compiled glob program
+         return glob_program_match(matcher->compiled.glob, string);
      } else {
          // Simple literal string comparison
          if (matcher->flags & NLINK_PATTERN_FLAG_CASE_INSENSITIVE) {
@@ -382,7 +560,347 @@ static bool is_regex_pattern(const char* pattern) {
          regfree(&matcher->compiled.regex);
      }
      
+     // Free compiled glob if any
+     if (matcher->is_compiled && matcher->is_glob) {
+         glob_program_destroy(matcher->compiled.glob);
+     }
+     
      // Free the matcher itself
      free(matcher);
  }
 
+/**
+ * @brief Pattern set as one bit-parallel (Shift-And) automaton
+ *
+ * Each pattern owns a run of op_count + 1 state bits: bit j means the
+ * first j instructions have matched, and the last bit is the accept
+ * state. A consuming instruction moves its bit one place up, a star
+ * keeps its bit and also enables the next one. Accept bits never move,
+ * so runs cannot leak into each other.
+ *
+ * State vectors reached while matching are cached as DFA states with a
+ * transition row per byte class, so a warm set costs one table lookup
+ * per byte. The cache is bounded and flushed when full; a caller that
+ * finds it locked by another thread steps the bit vectors directly.
+ */
+#define PATTERN_SET_MAX_STATES 1024    // Power of two; the hash index has twice as many slots
+#define PATTERN_SET_STACK_WORDS 32
+#define PATTERN_SET_UNKNOWN (-1)
+
+struct NlinkPatternSet {
+    size_t count;               // Number of patterns
+    size_t words;               // 64-bit words per state vector
+    uint64_t* advance;          // Per byte: states whose instruction accepts it
+    uint64_t* stars;            // States holding a star
+    uint64_t* initial;          // Start states, closed over leading stars
+    size_t* accept_bits;        // Accept state of each pattern
+
+    // Lazy DFA cache over state vectors
+    uint8_t byte_class[256];    // Bytes with identical advance columns share a class
+    size_t class_count;
+    pthread_mutex_t lock;       // Guards everything below
+    uint64_t* vectors;          // State vectors, PATTERN_SET_MAX_STATES * words
+    int32_t* transitions;       // Next state per (state, class) or PATTERN_SET_UNKNOWN
+    bool* dead;                 // States with no live bits
+    uint32_t* buckets;          // Hash index of state ids + 1, 0 if empty
+    size_t state_count;
+};
+
+// Step a state vector over one byte, closing over stars
+static bool pattern_set_step(const NlinkPatternSet* set, const uint64_t* states, uint8_t byte, uint64_t* out) {
+    const size_t words = set->words;
+    const uint64_t* advance = set->advance + (size_t)byte * words;
+    const uint64_t* stars = set->stars;
+    uint64_t carry = 0;
+    uint64_t star_carry = 0;
+    uint64_t live = 0;
+
+    // The state after a star is never a star, so one sweep closes the vector
+    for (size_t w = 0; w < words; w++) {
+        uint64_t moved = states[w] & advance[w];
+        uint64_t next = (moved << 1) | carry | (states[w] & stars[w]);
+        uint64_t starred = next & stars[w];
+        out[w] = next | (starred << 1) | star_carry;
+        carry = moved >> 63;
+        star_carry = starred >> 63;
+        live |= out[w];
+    }
+
+    return live != 0;
+}
+
+static uint64_t pattern_set_hash(const uint64_t* states, size_t words) {
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (size_t w = 0; w < words; w++) {
+        hash ^= states[w];
+        hash *= 1099511628211ULL;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+// Find or add a DFA state; returns PATTERN_SET_UNKNOWN when the cache is full
+static int32_t pattern_set_intern(NlinkPatternSet* set, const uint64_t* states, bool live) {
+    const size_t words = set->words;
+    size_t mask = PATTERN_SET_MAX_STATES * 2 - 1;
+    size_t slot = (size_t)pattern_set_hash(states, words) & mask;
+
+    while (set->buckets[slot] != 0) {
+        uint32_t id = set->buckets[slot] - 1;
+        if (memcmp(set->vectors + (size_t)id * words, states, words * sizeof(uint64_t)) == 0) {
+            return (int32_t)id;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    if (set->state_count == PATTERN_SET_MAX_STATES) {
+        return PATTERN_SET_UNKNOWN;
+    }
+
+    uint32_t id = (uint32_t)set->state_count++;
+    memcpy(set->vectors + (size_t)id * words, states, words * sizeof(uint64_t));
+    for (size_t c = 0; c < set->class_count; c++) {
+        set->transitions[(size_t)id * set->class_count + c] = PATTERN_SET_UNKNOWN;
+    }
+    set->dead[id] = !live;
+    set->buckets[slot] = id + 1;
+    return (int32_t)id;
+}
+
+static void pattern_set_flush(NlinkPatternSet* set) {
+    memset(set->buckets, 0, PATTERN_SET_MAX_STATES * 2 * sizeof(uint32_t));
+    set->state_count = 0;
+}
+
+// Group bytes whose advance columns are identical
+static void pattern_set_compute_classes(NlinkPatternSet* set) {
+    const size_t words = set->words;
+
+    set->class_count = 0;
+    for (int c = 0; c < 256; c++) {
+        const uint64_t* column = set->advance + (size_t)c * words;
+        int match = -1;
+
+        for (int prior = 0; prior < c && match < 0; prior++) {
+            if (memcmp(set->advance + (size_t)prior * words, column, words * sizeof(uint64_t)) == 0) {
+                match = prior;
+            }
+        }
+        set->byte_class[c] = match < 0 ? (uint8_t)set->class_count++ : set->byte_class[match];
+    }
+}
+
+NlinkPatternSet* nlink_pattern_set_create(const char* const* patterns,
+                                          size_t count,
+                                          NlinkPatternFlags flags) {
+    if (!patterns || count == 0) {
+        return NULL;
+    }
+
+    bool case_insensitive = (flags & NLINK_PATTERN_FLAG_CASE_INSENSITIVE) != 0;
+    NlinkGlobProgram** programs = calloc(count, sizeof(NlinkGlobProgram*));
+    NlinkPatternSet* set = calloc(1, sizeof(NlinkPatternSet));
+    size_t bits = 0;
+    bool ok = programs != NULL && set != NULL;
+
+    for (size_t i = 0; ok && i < count; i++) {
+        programs[i] = patterns[i] ? glob_program_create(patterns[i], case_insensitive) : NULL;
+        ok = programs[i] != NULL;
+        if (ok) bits += programs[i]->op_count + 1;
+    }
+
+    if (ok) {
+        set->count = count;
+        set->words = (bits + 63) / 64;
+        set->advance = calloc(256 * set->words, sizeof(uint64_t));
+        set->stars = calloc(set->words, sizeof(uint64_t));
+        set->initial = calloc(set->words, sizeof(uint64_t));
+        set->accept_bits = malloc(count * sizeof(size_t));
+        ok = set->advance && set->stars && set->initial && set->accept_bits;
+    }
+
+    size_t base = 0;
+    for (size_t i = 0; ok && i < count; i++) {
+        const NlinkGlobProgram* program = programs[i];
+
+        for (size_t j = 0; j < program->op_count; j++) {
+            const GlobOp* op = &program->ops[j];
+            size_t bit = base + j;
+            uint64_t mask = (uint64_t)1 << (bit & 63);
+
+            if (op->type == GLOB_OP_STAR) {
+                set->stars[bit >> 6] |= mask;
+                continue;
+            }
+            for (int c = 0; c < 256; c++) {
+                bool accepts = op->type == GLOB_OP_ANY ||
+                    (op->type == GLOB_OP_BYTE && glob_fold((uint8_t)c, case_insensitive) == op->byte) ||
+                    (op->type == GLOB_OP_CLASS && glob_class_has(program->classes[op->class_index], (uint8_t)c));
+                if (accepts) {
+                    set->advance[(size_t)c * set->words + (bit >> 6)] |= mask;
+                }
+            }
+        }
+
+        if (!program->never_matches) {
+            set->initial[base >> 6] |= (uint64_t)1 << (base & 63);
+        }
+        set->accept_bits[i] = base + program->op_count;
+        base += program->op_count + 1;
+    }
+
+    if (ok) {
+        // Close the start states over leading stars
+        uint64_t carry = 0;
+        for (size_t w = 0; w < set->words; w++) {
+            uint64_t starred = set->initial[w] & set->stars[w];
+            set->initial[w] |= (starred << 1) | carry;
+            carry = starred >> 63;
+        }
+
+        pattern_set_compute_classes(set);
+        set->vectors = malloc(PATTERN_SET_MAX_STATES * set->words * sizeof(uint64_t));
+        set->transitions = malloc(PATTERN_SET_MAX_STATES * set->class_count * sizeof(int32_t));
+        set->dead = malloc(PATTERN_SET_MAX_STATES * sizeof(bool));
+        set->buckets = calloc(PATTERN_SET_MAX_STATES * 2, sizeof(uint32_t));
+        ok = set->vectors && set->transitions && set->dead && set->buckets &&
+             pthread_mutex_init(&set->lock, NULL) == 0;
+    }
+
+    for (size_t i = 0; programs && i < count; i++) {
+        glob_program_destroy(programs[i]);
+    }
+    free(programs);
+
+    if (!ok) {
+        // Only reached before the mutex exists, so free the fields directly
+        if (set) {
+            free(set->advance);
+            free(set->stars);
+            free(set->initial);
+            free(set->accept_bits);
+            free(set->vectors);
+            free(set->transitions);
+            free(set->dead);
+            free(set->buckets);
+            free(set);
+        }
+        return NULL;
+    }
+
+    return set;
+}
+
+// Run the cached DFA; returns false if the cache is in use by another thread
+static bool pattern_set_run_cached(NlinkPatternSet* set, const uint8_t* text, uint64_t* result) {
+    const size_t words = set->words;
+    const size_t class_count = set->class_count;
+    uint64_t local[PATTERN_SET_STACK_WORDS];
+    uint64_t* scratch = words <= PATTERN_SET_STACK_WORDS ? local : malloc(words * sizeof(uint64_t));
+
+    if (!scratch || pthread_mutex_trylock(&set->lock) != 0) {
+        if (scratch != local) free(scratch);
+        return false;
+    }
+
+    int32_t id = pattern_set_intern(set, set->initial, true);
+    if (id == PATTERN_SET_UNKNOWN) {
+        pattern_set_flush(set);
+        id = pattern_set_intern(set, set->initial, true);
+    }
+
+    for (; *text && !set->dead[id]; text++) {
+        size_t slot = (size_t)id * class_count + set->byte_class[*text];
+        int32_t next = set->transitions[slot];
+
+        if (next == PATTERN_SET_UNKNOWN) {
+            bool live = pattern_set_step(set, set->vectors + (size_t)id * words, *text, scratch);
+            next = pattern_set_intern(set, scratch, live);
+            if (next == PATTERN_SET_UNKNOWN) {
+                // Start over with only the state we are in
+                pattern_set_flush(set);
+                next = pattern_set_intern(set, scratch, live);
+            } else {
+                set->transitions[slot] = next;
+            }
+        }
+        id = next;
+    }
+
+    memcpy(result, set->vectors + (size_t)id * words, words * sizeof(uint64_t));
+    pthread_mutex_unlock(&set->lock);
+    if (scratch != local) free(scratch);
+    return true;
+}
+
+size_t nlink_pattern_set_match(const NlinkPatternSet* set,
+                               const char* string,
+                               size_t* matches,
+                               size_t max_matches) {
+    if (!set || !string) {
+        return 0;
+    }
+
+    const size_t words = set->words;
+    uint64_t local[PATTERN_SET_STACK_WORDS * 2];
+    uint64_t* states = words <= PATTERN_SET_STACK_WORDS ? local : malloc(words * 2 * sizeof(uint64_t));
+    if (!states) {
+        return 0;
+    }
+
+    // The cache is internal state; matching is logically const
+    if (!pattern_set_run_cached((NlinkPatternSet*)set, (const uint8_t*)string, states)) {
+        uint64_t* current = states;
+        uint64_t* next = states + words;
+
+        memcpy(current, set->initial, words * sizeof(uint64_t));
+        for (const uint8_t* p = (const uint8_t*)string; *p; p++) {
+            bool live = pattern_set_step(set, current, *p, next);
+            uint64_t* swap = current;
+            current = next;
+            next = swap;
+            if (!live) break;
+        }
+        if (current != states) {
+            memcpy(states, current, words * sizeof(uint64_t));
+        }
+    }
+
+    size_t found = 0;
+    for (size_t i = 0; i < set->count; i++) {
+        size_t bit = set->accept_bits[i];
+        if ((states[bit >> 6] >> (bit & 63)) & 1) {
+            if (matches && found < max_matches) {
+                matches[found] = i;
+            }
+            found++;
+        }
+    }
+
+    if (states != local) {
+        free(states);
+    }
+    return found;
+}
+
+size_t nlink_pattern_set_count(const NlinkPatternSet* set) {
+    return set ? set->count : 0;
+}
+
+void nlink_pattern_set_destroy(NlinkPatternSet* set) {
+    if (!set) {
+        return;
+    }
+
+    pthread_mutex_destroy(&set->lock);
+    free(set->advance);
+    free(set->stars);
+    free(set->initial);
+    free(set->accept_bits);
+    free(set->vectors);
+    free(set->transitions);
+    free(set->dead);
+    free(set->buckets);
+    free(set);
+}
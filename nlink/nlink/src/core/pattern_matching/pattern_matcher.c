@@ -4,22 +4,38 @@
  * @copyright Copyright © 2025 OBINexus Computing
  */
 
+#define _GNU_SOURCE
 #include "nlink/core/pattern_matching/pattern_matcher.h"
+#include "nlink/core/pattern_matching/wildcard_matcher.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <ctype.h>
 #include <dirent.h>
 #include <sys/stat.h>
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 
 #define INITIAL_MATCHES_CAPACITY 16
+#define WALK_MAX_COMPONENTS 63              // Component states plus the final state fit in 64 bits
+#define WALK_DIRENT_BUFFER (128 * 1024)     // Bytes requested per getdents64 call
+#define WALK_MAX_THREADS 64
+#define WALK_QUEUE_CAPACITY 64
 
 nlink_pattern_options nlink_pattern_default_options(void) {
     nlink_pattern_options options = {
         .case_sensitive = true,
         .dot_special = true,
         .extended_glob = true,
-        .follow_symlinks = false
+        .follow_symlinks = false,
+        .max_threads = 0
     };
     
     return options;
@@ -69,24 +85,730 @@ static bool add_match(nlink_pattern_result* result, const char* path) {
     return true;
 }
 
-static void process_directory(nlink_pattern_result* result,
-                             const char* base_dir,
-                             const char* pattern,
-                             const char* current_path,
-                             nlink_pattern_options options) {
-    // This is a placeholder implementation
-    // A complete implementation would:
-    // 1. Open the directory
-    // 2. Iterate through each entry
-    // 3. Apply pattern matching to each entry
-    // 4. Recursively process subdirectories as needed
+/*
+ * Compiled path pattern
+ *
+ * The pattern is split at '/' into components and matched as a small
+ * NFA: state i means components 0..i-1 have matched, and state count
+ * means the whole pattern has. A set of states fits in one uint64_t, so
+ * a directory reached by several routes through "**" is read once.
+ */
+
+typedef enum {
+    COMPONENT_LITERAL,          // Plain name, opened without reading the parent
+    COMPONENT_GLOB,             // Name matched with fnmatch
+    COMPONENT_RECURSIVE         // "**": any number of directories
+} ComponentKind;
+
+typedef struct {
+    char* storage;              // Copy of the pattern, split in place
+    char** names;               // Pattern components
+    uint8_t* kinds;             // ComponentKind per component
+    size_t count;
+    int fnmatch_flags;
+    bool dot_special;
+} WalkPattern;
+
+#define WALK_STATE(i) ((uint64_t)1 << (i))
+#define WALK_FINAL(pattern) WALK_STATE((pattern)->count)
+
+static bool component_has_wildcard(const char* name, bool extended) {
+    if (strpbrk(name, "*?[\\") != NULL) {
+        return true;
+    }
+    
+    // Extended glob groups such as +(a|b), @(a|b) and !(a)
+    if (extended) {
+        for (const char* p = name; *p; p++) {
+            if ((*p == '+' || *p == '@' || *p == '!') && p[1] == '(') {
+                return true;
+            }
+        }
+    }
+    
+    return false;
+}
+
+static void walk_pattern_free(WalkPattern* pattern) {
+    free(pattern->storage);
+    free(pattern->names);
+    free(pattern->kinds);
+    memset(pattern, 0, sizeof(WalkPattern));
+}
+
+static bool walk_pattern_init(WalkPattern* pattern, const char* source, nlink_pattern_options options) {
+    memset(pattern, 0, sizeof(WalkPattern));
+    pattern->storage = strdup(source);
+    pattern->names = malloc((WALK_MAX_COMPONENTS + 1) * sizeof(char*));
+    pattern->kinds = malloc(WALK_MAX_COMPONENTS + 1);
+    if (pattern->storage == NULL || pattern->names == NULL || pattern->kinds == NULL) {
+        walk_pattern_free(pattern);
+        return false;
+    }
+    
+    pattern->dot_special = options.dot_special;
+    if (options.dot_special) {
+        pattern->fnmatch_flags |= FNM_PERIOD;
+    }
+#ifdef FNM_CASEFOLD
+    if (!options.case_sensitive) {
+        pattern->fnmatch_flags |= FNM_CASEFOLD;
+    }
+#endif
+#ifdef FNM_EXTMATCH
+    if (options.extended_glob) {
+        pattern->fnmatch_flags |= FNM_EXTMATCH;
+    }
+#endif
+    
+    char* save = NULL;
+    for (char* name = strtok_r(pattern->storage, "/", &save);
+         name != NULL;
+         name = strtok_r(NULL, "/", &save)) {
+        if (strcmp(name, ".") == 0) {
+            continue;
+        }
+        
+        ComponentKind kind = COMPONENT_LITERAL;
+        if (options.extended_glob && strcmp(name, "**") == 0) {
+            kind = COMPONENT_RECURSIVE;
+            
+            // "**/**" is the same as "**"
+            if (pattern->count > 0 && pattern->kinds[pattern->count - 1] == COMPONENT_RECURSIVE) {
+                continue;
+            }
+        } else if (component_has_wildcard(name, options.extended_glob) || !options.case_sensitive) {
+            kind = COMPONENT_GLOB;
+        }
+        
+        if (pattern->count == WALK_MAX_COMPONENTS) {
+            walk_pattern_free(pattern);
+            return false;
+        }
+        pattern->names[pattern->count] = name;
+        pattern->kinds[pattern->count] = (uint8_t)kind;
+        pattern->count++;
+    }
+    
+    return true;
+}
+
+// Add the state after every active "**", which may match no directories
+static uint64_t walk_close(const WalkPattern* pattern, uint64_t states) {
+    for (size_t i = 0; i < pattern->count; i++) {
+        if ((states & WALK_STATE(i)) && pattern->kinds[i] == COMPONENT_RECURSIVE) {
+            states |= WALK_STATE(i + 1);
+        }
+    }
+    
+    return states;
+}
+
+static bool walk_has_recursive(const WalkPattern* pattern, uint64_t states) {
+    for (size_t i = 0; i < pattern->count; i++) {
+        if ((states & WALK_STATE(i)) && pattern->kinds[i] == COMPONENT_RECURSIVE) {
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+// Advance a state set over one path component
+static uint64_t walk_step(const WalkPattern* pattern, uint64_t states, const char* name, bool is_dir) {
+    uint64_t next = 0;
+    
+    for (size_t i = 0; i < pattern->count; i++) {
+        if (!(states & WALK_STATE(i))) {
+            continue;
+        }
+        
+        switch (pattern->kinds[i]) {
+            case COMPONENT_RECURSIVE:
+                if (is_dir && !(pattern->dot_special && name[0] == '.')) {
+                    next |= WALK_STATE(i);
+                }
+                break;
+            case COMPONENT_LITERAL:
+                if (strcmp(pattern->names[i], name) == 0) {
+                    next |= WALK_STATE(i + 1);
+                }
+                break;
+            default:
+                if (fnmatch(pattern->names[i], name, pattern->fnmatch_flags) == 0) {
+                    next |= WALK_STATE(i + 1);
+                }
+                break;
+        }
+    }
+    
+    return walk_close(pattern, next);
+}
+
+/*
+ * Parallel directory walker
+ *
+ * Each work item is a directory and the pattern states it was reached
+ * with. Every worker owns a queue: it pushes and pops subdirectories at
+ * the tail, so its own work proceeds depth first, and idle workers steal
+ * the oldest items from the head of other queues, which tend to be the
+ * largest unexplored subtrees.
+ */
+
+typedef struct {
+    char* path;                 // Directory path, "" for the current directory
+    uint64_t states;            // Pattern states still to match inside it
+} WalkItem;
+
+typedef struct {
+    pthread_mutex_t lock;
+    WalkItem* items;
+    size_t head;                // Thieves take from here
+    size_t tail;                // The owner pushes and pops here
+    size_t capacity;
+} WalkQueue;
+
+typedef struct {
+    dev_t dev;
+    ino_t ino;
+} WalkDirId;
+
+typedef struct {
+    const WalkPattern* pattern;
+    nlink_pattern_options options;
+    nlink_pattern_callback callback;
+    void* user_data;
+    pthread_mutex_t callback_lock;
     
-    // For demonstration, we'll just add the pattern as if it matched
-    char* full_path = join_path(base_dir, pattern);
-    if (full_path != NULL) {
-        add_match(result, full_path);
-        free(full_path);
+    WalkQueue* queues;
+    size_t worker_count;
+    atomic_size_t pending;      // Items queued or being processed
+    atomic_size_t queued;       // Items waiting in a queue
+    atomic_bool stop;           // Callback asked to stop, or an allocation failed
+    atomic_bool failed;
+    pthread_mutex_t idle_lock;
+    pthread_cond_t idle_cond;
+    size_t sleepers;
+    
+    // Directories already read, tracked when following symlinks
+    pthread_mutex_t visited_lock;
+    WalkDirId* visited;
+    size_t visited_count;
+    size_t visited_capacity;
+} WalkContext;
+
+typedef struct {
+    WalkContext* context;
+    size_t index;
+    char* buffer;               // getdents64 buffer
+} WalkWorker;
+
+static void walk_wake(WalkContext* context, bool all) {
+    pthread_mutex_lock(&context->idle_lock);
+    if (all) {
+        pthread_cond_broadcast(&context->idle_cond);
+    } else if (context->sleepers > 0) {
+        pthread_cond_signal(&context->idle_cond);
+    }
+    pthread_mutex_unlock(&context->idle_lock);
+}
+
+static void walk_stop(WalkContext* context, bool failed) {
+    if (failed) {
+        atomic_store(&context->failed, true);
+    }
+    atomic_store(&context->stop, true);
+    walk_wake(context, true);
+}
+
+// Queue a directory on the worker's own queue; takes ownership of path
+static void walk_push(WalkWorker* worker, char* path, uint64_t states) {
+    WalkContext* context = worker->context;
+    WalkQueue* queue = &context->queues[worker->index];
+    bool ok = true;
+    
+    atomic_fetch_add(&context->pending, 1);
+    pthread_mutex_lock(&queue->lock);
+    if (queue->tail == queue->capacity) {
+        if (queue->head > 0) {
+            memmove(queue->items, queue->items + queue->head, (queue->tail - queue->head) * sizeof(WalkItem));
+            queue->tail -= queue->head;
+            queue->head = 0;
+        } else {
+            WalkItem* items = realloc(queue->items, queue->capacity * 2 * sizeof(WalkItem));
+            if (items != NULL) {
+                queue->items = items;
+                queue->capacity *= 2;
+            } else {
+                ok = false;
+            }
+        }
+    }
+    if (ok) {
+        queue->items[queue->tail++] = (WalkItem){ path, states };
+        atomic_fetch_add(&context->queued, 1);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    
+    if (!ok) {
+        free(path);
+        atomic_fetch_sub(&context->pending, 1);
+        walk_stop(context, true);
+        return;
+    }
+    walk_wake(context, false);
+}
+
+// Pop from the worker's own queue, or steal from another
+static bool walk_take(WalkWorker* worker, WalkItem* item) {
+    WalkContext* context = worker->context;
+    
+    for (size_t k = 0; k < context->worker_count; k++) {
+        WalkQueue* queue = &context->queues[(worker->index + k) % context->worker_count];
+        bool found = false;
+        
+        pthread_mutex_lock(&queue->lock);
+        if (queue->head < queue->tail) {
+            *item = k == 0 ? queue->items[--queue->tail] : queue->items[queue->head++];
+            if (queue->head == queue->tail) {
+                queue->head = queue->tail = 0;
+            }
+            found = true;
+        }
+        pthread_mutex_unlock(&queue->lock);
+        
+        if (found) {
+            atomic_fetch_sub(&context->queued, 1);
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+static void walk_report(WalkContext* context, const char* path) {
+    pthread_mutex_lock(&context->callback_lock);
+    if (!atomic_load(&context->stop) && !context->callback(path, context->user_data)) {
+        walk_stop(context, false);
+    }
+    pthread_mutex_unlock(&context->callback_lock);
+}
+
+// Record a directory; returns false if it was already read
+static bool walk_mark_visited(WalkContext* context, dev_t dev, ino_t ino) {
+    bool inserted = true;
+    
+    pthread_mutex_lock(&context->visited_lock);
+    if ((context->visited_count + 1) * 2 > context->visited_capacity) {
+        size_t capacity = context->visited_capacity ? context->visited_capacity * 2 : 256;
+        WalkDirId* table = calloc(capacity, sizeof(WalkDirId));
+        if (table == NULL) {
+            pthread_mutex_unlock(&context->visited_lock);
+            return true;
+        }
+        for (size_t i = 0; i < context->visited_capacity; i++) {
+            WalkDirId id = context->visited[i];
+            if (id.ino == 0) continue;
+            size_t slot = ((uint64_t)id.ino * 0x9E3779B97F4A7C15ULL ^ (uint64_t)id.dev) & (capacity - 1);
+            while (table[slot].ino != 0) slot = (slot + 1) & (capacity - 1);
+            table[slot] = id;
+        }
+        free(context->visited);
+        context->visited = table;
+        context->visited_capacity = capacity;
+    }
+    
+    size_t mask = context->visited_capacity - 1;
+    size_t slot = ((uint64_t)ino * 0x9E3779B97F4A7C15ULL ^ (uint64_t)dev) & mask;
+    while (context->visited[slot].ino != 0) {
+        if (context->visited[slot].ino == ino && context->visited[slot].dev == dev) {
+            inserted = false;
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    if (inserted) {
+        context->visited[slot] = (WalkDirId){ dev, ino };
+        context->visited_count++;
+    }
+    pthread_mutex_unlock(&context->visited_lock);
+    
+    return inserted;
+}
+
+// Whether a directory entry is a directory we may descend into
+static bool walk_entry_is_dir(const WalkContext* context, int dir_fd, const char* name, unsigned char type) {
+    struct stat st;
+    
+    if (type == DT_DIR) {
+        return true;
     }
+    if (type == DT_LNK) {
+        return context->options.follow_symlinks && fstatat(dir_fd, name, &st, 0) == 0 && S_ISDIR(st.st_mode);
+    }
+    if (type == DT_UNKNOWN) {
+        int flags = context->options.follow_symlinks ? 0 : AT_SYMLINK_NOFOLLOW;
+        return fstatat(dir_fd, name, &st, flags) == 0 && S_ISDIR(st.st_mode);
+    }
+    
+    return false;
+}
+
+static void walk_entry(WalkWorker* worker, const WalkItem* item, int dir_fd, bool has_recursive,
+                       const char* name, unsigned char type) {
+    WalkContext* context = worker->context;
+    const WalkPattern* pattern = context->pattern;
+    
+    if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+        return;
+    }
+    
+    // Only "**" needs the entry type before matching
+    int is_dir = has_recursive ? walk_entry_is_dir(context, dir_fd, name, type) : -1;
+    uint64_t next = walk_step(pattern, item->states, name, is_dir == 1);
+    if (next == 0) {
+        return;
+    }
+    
+    char* child = join_path(item->path, name);
+    if (child == NULL) {
+        walk_stop(context, true);
+        return;
+    }
+    
+    if (next & WALK_FINAL(pattern)) {
+        walk_report(context, child);
+    }
+    
+    next &= ~WALK_FINAL(pattern);
+    if (next != 0 && is_dir < 0) {
+        is_dir = walk_entry_is_dir(context, dir_fd, name, type);
+    }
+    if (next != 0 && is_dir == 1) {
+        walk_push(worker, child, next);
+    } else {
+        free(child);
+    }
+}
+
+// Handle a state set made only of literal components without reading the directory
+static void walk_literals(WalkWorker* worker, const WalkItem* item) {
+    WalkContext* context = worker->context;
+    const WalkPattern* pattern = context->pattern;
+    uint64_t remaining = item->states;
+    
+    for (size_t i = 0; i < pattern->count && !atomic_load(&context->stop); i++) {
+        if (!(remaining & WALK_STATE(i))) {
+            continue;
+        }
+        
+        // Several states may name the same entry
+        uint64_t next = 0;
+        for (size_t j = i; j < pattern->count; j++) {
+            if ((remaining & WALK_STATE(j)) && strcmp(pattern->names[j], pattern->names[i]) == 0) {
+                next |= walk_close(pattern, WALK_STATE(j + 1));
+                remaining &= ~WALK_STATE(j);
+            }
+        }
+        
+        struct stat st;
+        char* child = join_path(item->path, pattern->names[i]);
+        if (child == NULL) {
+            walk_stop(context, true);
+            return;
+        }
+        if (stat(child, &st) != 0) {
+            free(child);
+            continue;
+        }
+        
+        if (next & WALK_FINAL(pattern)) {
+            walk_report(context, child);
+        }
+        next &= ~WALK_FINAL(pattern);
+        if (next != 0 && S_ISDIR(st.st_mode)) {
+            walk_push(worker, child, next);
+        } else {
+            free(child);
+        }
+    }
+}
+
+#ifdef __linux__
+struct walk_dirent64 {
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+#endif
+
+static void walk_directory(WalkWorker* worker, const WalkItem* item) {
+    WalkContext* context = worker->context;
+    const WalkPattern* pattern = context->pattern;
+    bool literal_only = true;
+    
+    for (size_t i = 0; i < pattern->count; i++) {
+        if ((item->states & WALK_STATE(i)) && pattern->kinds[i] != COMPONENT_LITERAL) {
+            literal_only = false;
+        }
+    }
+    if (literal_only) {
+        walk_literals(worker, item);
+        return;
+    }
+    
+    int fd = open(item->path[0] != '\0' ? item->path : ".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+    
+    if (context->options.follow_symlinks) {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && !walk_mark_visited(context, st.st_dev, st.st_ino)) {
+            close(fd);
+            return;
+        }
+    }
+    
+    bool has_recursive = walk_has_recursive(pattern, item->states);
+    
+#ifdef __linux__
+    for (;;) {
+        long bytes = syscall(SYS_getdents64, fd, worker->buffer, WALK_DIRENT_BUFFER);
+        if (bytes <= 0) {
+            break;
+        }
+        for (long offset = 0; offset < bytes && !atomic_load(&context->stop); ) {
+            struct walk_dirent64* entry = (struct walk_dirent64*)(worker->buffer + offset);
+            walk_entry(worker, item, fd, has_recursive, entry->d_name, entry->d_type);
+            offset += entry->d_reclen;
+        }
+        if (atomic_load(&context->stop)) {
+            break;
+        }
+    }
+    close(fd);
+#else
+    DIR* dir = fdopendir(fd);
+    if (dir == NULL) {
+        close(fd);
+        return;
+    }
+    for (struct dirent* entry = readdir(dir);
+         entry != NULL && !atomic_load(&context->stop);
+         entry = readdir(dir)) {
+        walk_entry(worker, item, dirfd(dir), has_recursive, entry->d_name, entry->d_type);
+    }
+    closedir(dir);
+#endif
+}
+
+static void* walk_worker_run(void* arg) {
+    WalkWorker* worker = arg;
+    WalkContext* context = worker->context;
+    
+    for (;;) {
+        WalkItem item;
+        if (walk_take(worker, &item)) {
+            if (!atomic_load(&context->stop)) {
+                walk_directory(worker, &item);
+            }
+            free(item.path);
+            if (atomic_fetch_sub(&context->pending, 1) == 1) {
+                walk_wake(context, true);
+            }
+            continue;
+        }
+        
+        pthread_mutex_lock(&context->idle_lock);
+        while (atomic_load(&context->queued) == 0 &&
+               atomic_load(&context->pending) > 0 &&
+               !atomic_load(&context->stop)) {
+            context->sleepers++;
+            pthread_cond_wait(&context->idle_cond, &context->idle_lock);
+            context->sleepers--;
+        }
+        bool done = atomic_load(&context->pending) == 0 || atomic_load(&context->stop);
+        pthread_mutex_unlock(&context->idle_lock);
+        
+        if (done) {
+            break;
+        }
+    }
+    
+    return NULL;
+}
+
+// Split a pattern into the directory to start from and the part to match below it
+static bool walk_resolve_root(const char* pattern, const char* base_dir, bool case_sensitive,
+                              char** root, const char** rest) {
+    bool absolute = pattern[0] == '/';
+    bool explicit_dot = strncmp(pattern, "./", 2) == 0;
+    
+    // A case-folded prefix has to be matched against directory entries
+    char* prefix = case_sensitive ? nlink_wildcard_get_base_dir(pattern) : strdup(absolute ? "" : ".");
+    if (prefix == NULL) {
+        return false;
+    }
+    
+    if (strcmp(prefix, ".") == 0) {
+        *rest = explicit_dot ? pattern + 2 : pattern;
+    } else if (prefix[0] == '\0') {
+        // Wildcard in the first component of an absolute pattern
+        free(prefix);
+        prefix = strdup("/");
+        *rest = pattern + 1;
+    } else {
+        *rest = pattern + strlen(prefix) + 1;
+    }
+    if (prefix == NULL) {
+        return false;
+    }
+    
+    if (absolute || (base_dir == NULL && strcmp(prefix, ".") != 0)) {
+        *root = prefix;
+        return true;
+    }
+    
+    if (base_dir == NULL) {
+        *root = strdup(explicit_dot ? "." : "");
+    } else if (strcmp(prefix, ".") == 0) {
+        *root = strdup(base_dir);
+    } else {
+        *root = join_path(base_dir, prefix);
+    }
+    free(prefix);
+    
+    return *root != NULL;
+}
+
+static size_t walk_thread_count(nlink_pattern_options options) {
+    size_t count = options.max_threads;
+    
+    if (count == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        count = cpus > 0 ? (size_t)cpus : 1;
+    }
+    
+    return count > WALK_MAX_THREADS ? WALK_MAX_THREADS : count;
+}
+
+bool nlink_match_pattern_stream(const char* pattern,
+                                const char* base_dir,
+                                nlink_pattern_options options,
+                                nlink_pattern_callback callback,
+                                void* user_data) {
+    if (pattern == NULL || callback == NULL) {
+        return false;
+    }
+    
+    char* root = NULL;
+    const char* rest = NULL;
+    WalkPattern compiled;
+    if (!walk_resolve_root(pattern, base_dir, options.case_sensitive, &root, &rest)) {
+        return false;
+    }
+    if (!walk_pattern_init(&compiled, rest, options)) {
+        free(root);
+        return false;
+    }
+    
+    uint64_t initial = walk_close(&compiled, WALK_STATE(0)) & ~WALK_FINAL(&compiled);
+    if (initial == 0) {
+        // Nothing left to match below the literal prefix
+        walk_pattern_free(&compiled);
+        free(root);
+        return true;
+    }
+    
+    WalkContext context;
+    memset(&context, 0, sizeof(context));
+    context.pattern = &compiled;
+    context.options = options;
+    context.callback = callback;
+    context.user_data = user_data;
+    context.worker_count = walk_thread_count(options);
+    atomic_init(&context.pending, 0);
+    atomic_init(&context.queued, 0);
+    atomic_init(&context.stop, false);
+    atomic_init(&context.failed, false);
+    pthread_mutex_init(&context.callback_lock, NULL);
+    pthread_mutex_init(&context.idle_lock, NULL);
+    pthread_cond_init(&context.idle_cond, NULL);
+    pthread_mutex_init(&context.visited_lock, NULL);
+    
+    context.queues = calloc(context.worker_count, sizeof(WalkQueue));
+    WalkWorker* workers = calloc(context.worker_count, sizeof(WalkWorker));
+    pthread_t* threads = calloc(context.worker_count, sizeof(pthread_t));
+    bool ok = context.queues != NULL && workers != NULL && threads != NULL;
+    
+    size_t ready = 0;
+    for (; ok && ready < context.worker_count; ready++) {
+        WalkQueue* queue = &context.queues[ready];
+        pthread_mutex_init(&queue->lock, NULL);
+        queue->items = malloc(WALK_QUEUE_CAPACITY * sizeof(WalkItem));
+        queue->capacity = WALK_QUEUE_CAPACITY;
+        workers[ready].context = &context;
+        workers[ready].index = ready;
+        workers[ready].buffer = malloc(WALK_DIRENT_BUFFER);
+        if (queue->items == NULL || workers[ready].buffer == NULL) {
+            ok = false;
+            ready++;
+            break;
+        }
+    }
+    
+    if (ok) {
+        walk_push(&workers[0], root, initial);
+        root = NULL;
+        
+        // The calling thread works as worker 0
+        size_t started = 1;
+        for (; started < context.worker_count; started++) {
+            if (pthread_create(&threads[started], NULL, walk_worker_run, &workers[started]) != 0) {
+                break;
+            }
+        }
+        walk_worker_run(&workers[0]);
+        for (size_t i = 1; i < started; i++) {
+            pthread_join(threads[i], NULL);
+        }
+        
+        // Items left behind by an early stop
+        WalkItem item;
+        while (walk_take(&workers[0], &item)) {
+            free(item.path);
+        }
+        ok = !atomic_load(&context.failed);
+    }
+    
+    for (size_t i = 0; i < ready; i++) {
+        pthread_mutex_destroy(&context.queues[i].lock);
+        free(context.queues[i].items);
+        free(workers[i].buffer);
+    }
+    free(context.queues);
+    free(workers);
+    free(threads);
+    free(context.visited);
+    pthread_mutex_destroy(&context.callback_lock);
+    pthread_mutex_destroy(&context.idle_lock);
+    pthread_cond_destroy(&context.idle_cond);
+    pthread_mutex_destroy(&context.visited_lock);
+    walk_pattern_free(&compiled);
+    free(root);
+    
+    return ok;
+}
+
+static bool collect_match(const char* path, void* user_data) {
+    return add_match((nlink_pattern_result*)user_data, path);
+}
+
+static int compare_paths(const void* a, const void* b) {
+    return strcmp(*(const char* const*)a, *(const char* const*)b);
 }
 
 nlink_pattern_result* nlink_match_pattern(const char* pattern, 
@@ -111,10 +833,13 @@ nlink_pattern_result* nlink_match_pattern(const char* pattern,
     result->count = 0;
     result->capacity = INITIAL_MATCHES_CAPACITY;
     
-    // Process pattern (simplified implementation)
-    const char* base = base_dir != NULL ? base_dir : ".";
-    process_directory(result, base, pattern, "", options);
+    // Callbacks are serialized, so the result needs no lock
+    if (!nlink_match_pattern_stream(pattern, base_dir, options, collect_match, result)) {
+        nlink_pattern_result_free(result);
+        return NULL;
+    }
     
+    qsort(result->matches, result->count, sizeof(char*), compare_paths);
     return result;
 }
 
@@ -134,11 +859,33 @@ void nlink_pattern_result_free(nlink_pattern_result* result) {
 bool nlink_pattern_match_string(const char* pattern, 
                                const char* string,
                                nlink_pattern_options options) {
-    // This is a placeholder implementation
-    // A complete implementation would implement glob pattern matching
+    if (pattern == NULL || string == NULL) {
+        return false;
+    }
+    
+    WalkPattern compiled;
+    char* path = strdup(string);
+    if (path == NULL || !walk_pattern_init(&compiled, pattern, options)) {
+        free(path);
+        return false;
+    }
+    
+    // Every component but the last is a directory
+    uint64_t states = walk_close(&compiled, WALK_STATE(0));
+    char* save = NULL;
+    char* name = strtok_r(path, "/", &save);
+    while (name != NULL && states != 0) {
+        char* following = strtok_r(NULL, "/", &save);
+        if (strcmp(name, ".") != 0) {
+            states = walk_step(&compiled, states, name, following != NULL);
+        }
+        name = following;
+    }
     
-    // For demonstration, just check if pattern appears in string
-    return strstr(string, pattern) != NULL;
+    bool matched = (states & WALK_FINAL(&compiled)) != 0;
+    walk_pattern_free(&compiled);
+    free(path);
+    return matched;
 }
 
 char* nlink_pattern_to_regex(const char* pattern, 
@@ -2,28 +2,1577 @@
  * @file regex_matcher.c
  * @brief Implementation of regular expression matching for NexusLink
  * @copyright Copyright © 2025 OBINexus Computing
+ *
+ * Patterns are parsed to a syntax tree and compiled to a Thompson NFA
+ * program. Matching without captures runs a DFA built from that program:
+ * when the DFA is small it is built completely at compile time, minimized
+ * with the Okpala minimizer and run from a flat table; otherwise it is
+ * built lazily, one transition at a time, into a cache of bounded size.
+ * Match positions and capture groups come from a Pike VM simulation of the
+ * NFA. All three run in time linear in the input, without backtracking.
  */
 
 #include "nlink/core/pattern_matching/regex_matcher.h"
+#include "nlink/core/minimizer/okpala_automaton.h"
+#include "nlink/core/minimizer/okpala_dense.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdint.h>
 #include <ctype.h>
+#include <pthread.h>
+
+#define REGEX_MAX_REPEAT 1000       // Largest bound accepted in {m,n}
+#define REGEX_MAX_DEPTH 1000        // Deepest group nesting accepted
+#define REGEX_MAX_PROGRAM 100000    // Largest NFA program, in instructions
+#define REGEX_TABLE_STATES 256      // Largest DFA built at compile time
+#define REGEX_MAX_FLUSHES 8         // Cache flushes per search before falling back to the NFA
+
+#define REGEX_NONE UINT32_MAX
+
+// NFA instructions; every instruction but JMP and SPLIT continues at pc + 1
+typedef enum {
+    OP_CLASS,       // Consume a byte in classes[x]
+    OP_SPLIT,       // Continue at x, then at lower priority at y
+    OP_JMP,         // Continue at x
+    OP_SAVE,        // Record the position in capture slot x
+    OP_BOL,         // Assert the start of the input (or of a line)
+    OP_EOL,         // Assert the end of the input (or of a line)
+    OP_MATCH        // Accept
+} RegexOp;
+
+typedef struct RegexInst {
+    uint32_t op;
+    uint32_t x;
+    uint32_t y;
+} RegexInst;
+
+// Set of bytes
+typedef struct RegexClass {
+    uint64_t bits[4];
+} RegexClass;
+
+// Compiled NFA program
+//
+// Instructions 0-2 loop over any byte before instruction 3, which starts
+// the pattern, so starting at 0 searches and starting at 3 is anchored.
+typedef struct RegexProgram {
+    RegexInst* code;
+    uint32_t count;
+    uint32_t start;                 // 0, or 3 for patterns anchored at the start
+    uint32_t match;                 // The OP_MATCH instruction
+    RegexClass* classes;
+    uint32_t class_count;
+    uint32_t slot_count;            // Two capture slots per group, group 0 included
+    bool multiline;
+    bool has_bol;
+    bool has_first_bytes;           // Every match starts with a byte in first_bytes
+    RegexClass first_bytes;
+    uint8_t byte_class[256];        // Bytes grouped by how every class treats them
+    uint8_t class_byte[256];        // A byte of each byte class
+    uint32_t byte_class_count;
+} RegexProgram;
+
+// Sparse set of program counters, cleared in constant time
+typedef struct RegexSparseSet {
+    uint32_t* sparse;
+    uint32_t* dense;
+    uint32_t count;
+} RegexSparseSet;
+
+// Lazily built DFA
+//
+// Each state is the set of NFA instructions that can consume the next byte
+// or accept, kept sorted in the pc pool. Transitions are filled in on first
+// use; when the cache would outgrow its memory limit it is flushed and
+// rebuilt from the current state.
+#define DFA_UNKNOWN UINT32_MAX          // Transition not computed yet
+#define DFA_DEAD (UINT32_MAX - 1)       // No match is possible any more
+#define DFA_FULL (UINT32_MAX - 2)       // The cache has no room for the state
+
+#define DFA_AT_BOL 1u                   // The previous byte started a line
+#define DFA_MATCH 2u                    // A match has been found
+#define DFA_MATCH_AT_END 4u             // The input matches if it ends here
+
+typedef struct RegexDfaState {
+    uint32_t offset;                // First pc in the pc pool
+    uint32_t count;                 // Number of pcs
+    uint32_t hash;
+    uint32_t flags;
+} RegexDfaState;
+
+typedef struct RegexDfa {
+    const RegexProgram* program;
+    uint32_t stride;                // Transitions per state, one per byte class
+    RegexDfaState* states;
+    uint32_t state_count;
+    uint32_t state_capacity;
+    uint32_t* next;                 // state_capacity rows of stride transitions
+    uint32_t* pcs;
+    size_t pc_count;
+    size_t pc_capacity;
+    uint32_t* index;                // Open-addressing index of state id + 1
+    size_t index_capacity;
+    size_t memory;                  // Bytes accounted to the current states
+    size_t memory_limit;
+    uint32_t start;
+    RegexSparseSet visited;         // Scratch for building states
+    RegexSparseSet ended;
+    uint32_t* stack;
+    uint32_t* kept;
+    uint32_t* saved;
+    pthread_mutex_t lock;
+} RegexDfa;
+
+// Minimized DFA as a flat table; entries are row offsets, not state ids
+typedef struct RegexTable {
+    uint32_t* rows;
+    uint32_t width;                 // Byte classes + 1; the last column is the end of input
+    uint32_t start;
+    uint32_t accept;
+    uint32_t dead;                  // REGEX_NONE if every state can still match
+    uint32_t state_count;
+} RegexTable;
 
 struct nlink_regex {
     char* pattern;           // Original pattern
     nlink_regex_options options;  // Compilation options
-    void* compiled;          // Compiled regex (implementation-specific)
+    RegexProgram program;    // Compiled NFA
+    RegexTable* table;       // Minimized DFA, or NULL when the DFA is too large
+    RegexDfa* dfa;           // Lazy DFA used when there is no table
 };
 
+static inline bool class_has(const RegexClass* set, uint8_t c) {
+    return (set->bits[c >> 6] >> (c & 63)) & 1;
+}
+
+static inline void class_add(RegexClass* set, uint8_t c) {
+    set->bits[c >> 6] |= (uint64_t)1 << (c & 63);
+}
+
+static void class_add_range(RegexClass* set, int low, int high) {
+    for (int c = low; c <= high; c++) {
+        class_add(set, (uint8_t)c);
+    }
+}
+
+static void class_add_ctype(RegexClass* set, int (*predicate)(int), bool negate) {
+    for (int c = 0; c < 256; c++) {
+        if ((predicate(c) != 0) != negate) {
+            class_add(set, (uint8_t)c);
+        }
+    }
+}
+
+static int is_word(int c) {
+    return isalnum(c) || c == '_';
+}
+
+/*
+ * Parser
+ *
+ * Recursive descent over the pattern, producing a syntax tree whose nodes
+ * live in one array and refer to each other by index. Concatenations and
+ * alternations list their children through the next links.
+ */
+
+typedef enum {
+    NODE_EMPTY,
+    NODE_CLASS,         // value: class index
+    NODE_CONCAT,
+    NODE_ALT,
+    NODE_REPEAT,        // min, max (-1 for no limit), greedy
+    NODE_GROUP,         // value: group number
+    NODE_BOL,
+    NODE_EOL
+} RegexNodeType;
+
+typedef struct RegexNode {
+    uint32_t type;
+    int32_t first;      // First child
+    int32_t next;       // Next sibling
+    int32_t min;
+    int32_t max;
+    uint32_t value;
+    bool greedy;
+} RegexNode;
+
+typedef struct RegexParser {
+    const char* p;
+    nlink_regex_options options;
+    RegexNode* nodes;
+    uint32_t node_count;
+    uint32_t node_capacity;
+    RegexClass* classes;
+    uint32_t class_count;
+    uint32_t class_capacity;
+    uint32_t group_count;
+    uint32_t depth;
+    bool has_bol;
+    bool has_eol;
+    bool failed;
+} RegexParser;
+
+static int32_t regex_node(RegexParser* parser, RegexNodeType type) {
+    if (parser->node_count == parser->node_capacity) {
+        uint32_t capacity = parser->node_capacity ? parser->node_capacity * 2 : 32;
+        RegexNode* nodes = realloc(parser->nodes, capacity * sizeof(RegexNode));
+        if (nodes == NULL) {
+            parser->failed = true;
+            return -1;
+        }
+        parser->nodes = nodes;
+        parser->node_capacity = capacity;
+    }
+
+    RegexNode* node = &parser->nodes[parser->node_count];
+    memset(node, 0, sizeof(RegexNode));
+    node->type = type;
+    node->first = -1;
+    node->next = -1;
+    node->greedy = true;
+    return (int32_t)parser->node_count++;
+}
+
+// Add a class to the program, sharing identical ones
+static int32_t regex_class_node(RegexParser* parser, RegexClass set) {
+    if (parser->options.case_insensitive) {
+        for (int c = 'a'; c <= 'z'; c++) {
+            if (class_has(&set, (uint8_t)c) || class_has(&set, (uint8_t)toupper(c))) {
+                class_add(&set, (uint8_t)c);
+                class_add(&set, (uint8_t)toupper(c));
+            }
+        }
+    }
+
+    uint32_t index = 0;
+    while (index < parser->class_count && memcmp(&parser->classes[index], &set, sizeof(set)) != 0) {
+        index++;
+    }
+
+    if (index == parser->class_count) {
+        if (parser->class_count == parser->class_capacity) {
+            uint32_t capacity = parser->class_capacity ? parser->class_capacity * 2 : 16;
+            RegexClass* classes = realloc(parser->classes, capacity * sizeof(RegexClass));
+            if (classes == NULL) {
+                parser->failed = true;
+                return -1;
+            }
+            parser->classes = classes;
+            parser->class_capacity = capacity;
+        }
+        parser->classes[parser->class_count++] = set;
+    }
+
+    int32_t node = regex_node(parser, NODE_CLASS);
+    if (node >= 0) {
+        parser->nodes[node].value = index;
+    }
+    return node;
+}
+
+// Width of operator op at the current position, or 0 if it is not there
+//
+// Extended syntax writes operators bare; basic syntax escapes all of them
+// except '*', and reads the bare characters as literals.
+static size_t regex_operator(const RegexParser* parser, char op) {
+    const char* p = parser->p;
+    if (parser->options.extended || op == '*') {
+        return *p == op ? 1 : 0;
+    }
+    return (p[0] == '\\' && p[1] == op) ? 2 : 0;
+}
+
+static bool regex_take(RegexParser* parser, char op) {
+    size_t width = regex_operator(parser, op);
+    parser->p += width;
+    return width > 0;
+}
+
+// Parse the escape at the current position into set
+//
+// Returns the escaped byte, or -1 for a class escape such as \d.
+static int regex_parse_escape(RegexParser* parser, RegexClass* set) {
+    char e = parser->p[1];
+    if (e == '\0') {
+        parser->failed = true;
+        return -1;
+    }
+    parser->p += 2;
+
+    int c;
+    switch (e) {
+        case 'd': class_add_ctype(set, isdigit, false); return -1;
+        case 'D': class_add_ctype(set, isdigit, true); return -1;
+        case 'w': class_add_ctype(set, is_word, false); return -1;
+        case 'W': class_add_ctype(set, is_word, true); return -1;
+        case 's': class_add_ctype(set, isspace, false); return -1;
+        case 'S': class_add_ctype(set, isspace, true); return -1;
+        case 'n': c = '\n'; break;
+        case 't': c = '\t'; break;
+        case 'r': c = '\r'; break;
+        case 'f': c = '\f'; break;
+        case 'v': c = '\v'; break;
+        case 'x': {
+            const char* hex = parser->p;
+            if (!isxdigit((unsigned char)hex[0]) || !isxdigit((unsigned char)hex[1])) {
+                parser->failed = true;
+                return -1;
+            }
+            char digits[3] = { hex[0], hex[1], '\0' };
+            c = (int)strtol(digits, NULL, 16);
+            parser->p += 2;
+            break;
+        }
+        default:
+            // Word boundaries, back-references and other letter escapes
+            // are not supported
+            if (isalnum((unsigned char)e)) {
+                parser->failed = true;
+                return -1;
+            }
+            c = (unsigned char)e;
+            break;
+    }
+
+    class_add(set, (uint8_t)c);
+    return c;
+}
+
+// Parse a bracket expression such as [a-z_], [^/] or [[:digit:]]
+static int32_t regex_parse_bracket(RegexParser* parser) {
+    static const struct {
+        const char* name;
+        int (*predicate)(int);
+    } named[] = {
+        { "alpha", isalpha }, { "digit", isdigit }, { "alnum", isalnum }, { "space", isspace },
+        { "upper", isupper }, { "lower", islower }, { "punct", ispunct }, { "xdigit", isxdigit },
+        { "blank", isblank }, { "cntrl", iscntrl }, { "print", isprint }, { "graph", isgraph }
+    };
+    RegexClass set = { { 0 } };
+    bool negate = false;
+    bool first = true;
+
+    parser->p++;
+    if (*parser->p == '^') {
+        negate = true;
+        parser->p++;
+    }
+
+    while (*parser->p != '\0' && (*parser->p != ']' || first)) {
+        first = false;
+
+        if (parser->p[0] == '[' && parser->p[1] == ':') {
+            const char* name = parser->p + 2;
+            const char* end = strstr(name, ":]");
+            size_t i = 0;
+            while (end != NULL && i < sizeof(named) / sizeof(named[0]) &&
+                   (strlen(named[i].name) != (size_t)(end - name) ||
+                    strncmp(named[i].name, name, (size_t)(end - name)) != 0)) {
+                i++;
+            }
+            if (end == NULL || i == sizeof(named) / sizeof(named[0])) {
+                parser->failed = true;
+                return -1;
+            }
+            class_add_ctype(&set, named[i].predicate, false);
+            parser->p = end + 2;
+            continue;
+        }
+
+        int low;
+        if (*parser->p == '\\') {
+            low = regex_parse_escape(parser, &set);
+            if (parser->failed) return -1;
+            if (low < 0) continue;
+        } else {
+            low = (unsigned char)*parser->p++;
+        }
+
+        if (parser->p[0] == '-' && parser->p[1] != ']' && parser->p[1] != '\0') {
+            int high;
+            parser->p++;
+            if (*parser->p == '\\') {
+                RegexClass ignored = { { 0 } };
+                high = regex_parse_escape(parser, &ignored);
+            } else {
+                high = (unsigned char)*parser->p++;
+            }
+            if (parser->failed || high < low) {
+                parser->failed = true;
+                return -1;
+            }
+            class_add_range(&set, low, high);
+        } else {
+            class_add(&set, (uint8_t)low);
+        }
+    }
+
+    if (*parser->p != ']') {
+        parser->failed = true;
+        return -1;
+    }
+    parser->p++;
+
+    if (negate) {
+        for (int i = 0; i < 4; i++) {
+            set.bits[i] = ~set.bits[i];
+        }
+    }
+    return regex_class_node(parser, set);
+}
+
+static int32_t regex_parse_alternation(RegexParser* parser);
+
+static int32_t regex_parse_atom(RegexParser* parser) {
+    RegexClass set = { { 0 } };
+
+    if (regex_take(parser, '(')) {
+        bool capture = true;
+        if (parser->options.extended && parser->p[0] == '?' && parser->p[1] == ':') {
+            capture = false;
+            parser->p += 2;
+        }
+        uint32_t group = capture ? ++parser->group_count : 0;
+
+        if (++parser->depth > REGEX_MAX_DEPTH) {
+            parser->failed = true;
+            return -1;
+        }
+        int32_t inner = regex_parse_alternation(parser);
+        parser->depth--;
+        if (parser->failed || !regex_take(parser, ')')) {
+            parser->failed = true;
+            return -1;
+        }
+
+        if (!capture) {
+            return inner;
+        }
+        int32_t node = regex_node(parser, NODE_GROUP);
+        if (node >= 0) {
+            parser->nodes[node].first = inner;
+            parser->nodes[node].value = group;
+        }
+        return node;
+    }
+
+    // A quantifier needs something to repeat
+    if (regex_operator(parser, '*') || regex_operator(parser, '+') || regex_operator(parser, '?')) {
+        parser->failed = true;
+        return -1;
+    }
+
+    switch (*parser->p) {
+        case '.':
+            parser->p++;
+            for (int i = 0; i < 4; i++) {
+                set.bits[i] = ~(uint64_t)0;
+            }
+            if (!parser->options.dot_all) {
+                set.bits['\n' >> 6] &= ~((uint64_t)1 << ('\n' & 63));
+            }
+            return regex_class_node(parser, set);
+        case '[':
+            return regex_parse_bracket(parser);
+        case '^':
+            parser->p++;
+            parser->has_bol = true;
+            return regex_node(parser, NODE_BOL);
+        case '$':
+            parser->p++;
+            parser->has_eol = true;
+            return regex_node(parser, NODE_EOL);
+        case '\\':
+            regex_parse_escape(parser, &set);
+            return parser->failed ? -1 : regex_class_node(parser, set);
+        default:
+            class_add(&set, (uint8_t)*parser->p++);
+            return regex_class_node(parser, set);
+    }
+}
+
+// Parse {m}, {m,} or {m,n}; extended syntax reads anything else as a literal '{'
+static bool regex_parse_bounds(RegexParser* parser, int32_t* min, int32_t* max) {
+    size_t open = regex_operator(parser, '{');
+    if (open == 0) return false;
+
+    const char* p = parser->p + open;
+    const char* digits = p;
+    long low = 0;
+    long high;
+
+    while (isdigit((unsigned char)*p) && low <= REGEX_MAX_REPEAT) low = low * 10 + (*p++ - '0');
+    bool has_low = p > digits;
+    bool has_comma = *p == ',';
+    if (has_comma) {
+        p++;
+        digits = p;
+        high = 0;
+        while (isdigit((unsigned char)*p) && high <= REGEX_MAX_REPEAT) high = high * 10 + (*p++ - '0');
+        if (p == digits) high = -1;
+    } else {
+        high = low;
+    }
+
+    size_t close = parser->options.extended ? (*p == '}' ? 1 : 0) : (p[0] == '\\' && p[1] == '}' ? 2 : 0);
+    if (close == 0 || (!has_low && (!has_comma || high < 0))) {
+        if (!parser->options.extended) parser->failed = true;
+        return false;
+    }
+    if (low > REGEX_MAX_REPEAT || high > REGEX_MAX_REPEAT || (high >= 0 && high < low)) {
+        parser->failed = true;
+        return false;
+    }
+
+    parser->p = p + close;
+    *min = (int32_t)low;
+    *max = (int32_t)high;
+    return true;
+}
+
+static int32_t regex_parse_repetition(RegexParser* parser) {
+    int32_t atom = regex_parse_atom(parser);
+
+    while (!parser->failed) {
+        int32_t min;
+        int32_t max;
+        if (regex_take(parser, '*')) {
+            min = 0;
+            max = -1;
+        } else if (regex_take(parser, '+')) {
+            min = 1;
+            max = -1;
+        } else if (regex_take(parser, '?')) {
+            min = 0;
+            max = 1;
+        } else if (!regex_parse_bounds(parser, &min, &max)) {
+            break;
+        }
+
+        int32_t node = regex_node(parser, NODE_REPEAT);
+        if (node < 0) break;
+        parser->nodes[node].first = atom;
+        parser->nodes[node].min = min;
+        parser->nodes[node].max = max;
+
+        // A trailing '?' makes the quantifier lazy
+        if (parser->options.extended && *parser->p == '?') {
+            parser->nodes[node].greedy = false;
+            parser->p++;
+        }
+        atom = node;
+    }
+
+    return parser->failed ? -1 : atom;
+}
+
+static int32_t regex_parse_concatenation(RegexParser* parser) {
+    int32_t first = -1;
+    int32_t last = -1;
+
+    while (*parser->p != '\0' && !regex_operator(parser, '|') && !regex_operator(parser, ')')) {
+        int32_t atom = regex_parse_repetition(parser);
+        if (parser->failed) return -1;
+
+        if (first < 0) {
+            first = atom;
+        } else {
+            parser->nodes[last].next = atom;
+        }
+        last = atom;
+    }
+
+    if (first < 0) {
+        return regex_node(parser, NODE_EMPTY);
+    }
+    if (first == last) {
+        return first;
+    }
+
+    int32_t node = regex_node(parser, NODE_CONCAT);
+    if (node >= 0) {
+        parser->nodes[node].first = first;
+    }
+    return node;
+}
+
+static int32_t regex_parse_alternation(RegexParser* parser) {
+    int32_t first = regex_parse_concatenation(parser);
+    if (parser->failed || !regex_operator(parser, '|')) {
+        return first;
+    }
+
+    int32_t last = first;
+    while (regex_take(parser, '|')) {
+        int32_t branch = regex_parse_concatenation(parser);
+        if (parser->failed) return -1;
+        parser->nodes[last].next = branch;
+        last = branch;
+    }
+
+    int32_t node = regex_node(parser, NODE_ALT);
+    if (node >= 0) {
+        parser->nodes[node].first = first;
+    }
+    return node;
+}
+
+/*
+ * Code generation
+ */
+
+typedef struct RegexEmitter {
+    RegexInst* code;
+    uint32_t count;
+    uint32_t capacity;
+    bool failed;
+} RegexEmitter;
+
+static uint32_t regex_emit(RegexEmitter* emitter, RegexOp op, uint32_t x, uint32_t y) {
+    if (emitter->failed || emitter->count >= REGEX_MAX_PROGRAM) {
+        emitter->failed = true;
+        return 0;
+    }
+    if (emitter->count == emitter->capacity) {
+        uint32_t capacity = emitter->capacity ? emitter->capacity * 2 : 64;
+        RegexInst* code = realloc(emitter->code, capacity * sizeof(RegexInst));
+        if (code == NULL) {
+            emitter->failed = true;
+            return 0;
+        }
+        emitter->code = code;
+        emitter->capacity = capacity;
+    }
+
+    RegexInst* inst = &emitter->code[emitter->count];
+    inst->op = op;
+    inst->x = x;
+    inst->y = y;
+    return emitter->count++;
+}
+
+static void regex_compile_node(RegexEmitter* emitter, const RegexNode* nodes, int32_t index) {
+    if (emitter->failed) return;
+    const RegexNode* node = &nodes[index];
+
+    switch (node->type) {
+        case NODE_EMPTY:
+            break;
+
+        case NODE_CLASS:
+            regex_emit(emitter, OP_CLASS, node->value, 0);
+            break;
+
+        case NODE_BOL:
+            regex_emit(emitter, OP_BOL, 0, 0);
+            break;
+
+        case NODE_EOL:
+            regex_emit(emitter, OP_EOL, 0, 0);
+            break;
+
+        case NODE_GROUP:
+            regex_emit(emitter, OP_SAVE, node->value * 2, 0);
+            regex_compile_node(emitter, nodes, node->first);
+            regex_emit(emitter, OP_SAVE, node->value * 2 + 1, 0);
+            break;
+
+        case NODE_CONCAT:
+            for (int32_t child = node->first; child >= 0; child = nodes[child].next) {
+                regex_compile_node(emitter, nodes, child);
+            }
+            break;
+
+        case NODE_ALT: {
+            // Each branch but the last jumps past the others; the jumps
+            // are chained through their targets until the end is known
+            uint32_t jumps = REGEX_NONE;
+            int32_t child = node->first;
+            for (; nodes[child].next >= 0; child = nodes[child].next) {
+                uint32_t split = regex_emit(emitter, OP_SPLIT, 0, 0);
+                regex_compile_node(emitter, nodes, child);
+                uint32_t jump = regex_emit(emitter, OP_JMP, jumps, 0);
+                if (emitter->failed) return;
+                jumps = jump;
+                emitter->code[split].x = split + 1;
+                emitter->code[split].y = emitter->count;
+            }
+            regex_compile_node(emitter, nodes, child);
+            if (emitter->failed) return;
+            while (jumps != REGEX_NONE) {
+                uint32_t previous = emitter->code[jumps].x;
+                emitter->code[jumps].x = emitter->count;
+                jumps = previous;
+            }
+            break;
+        }
+
+        case NODE_REPEAT: {
+            int32_t child = node->first;
+
+            if (node->max < 0 && node->min == 0) {
+                // L: split body, end; body; jmp L
+                uint32_t split = regex_emit(emitter, OP_SPLIT, 0, 0);
+                regex_compile_node(emitter, nodes, child);
+                regex_emit(emitter, OP_JMP, split, 0);
+                if (emitter->failed) return;
+                emitter->code[split].x = node->greedy ? split + 1 : emitter->count;
+                emitter->code[split].y = node->greedy ? emitter->count : split + 1;
+                break;
+            }
+
+            if (node->max < 0) {
+                // min - 1 copies, then L: body; split L, end
+                for (int32_t i = 0; i < node->min - 1; i++) {
+                    regex_compile_node(emitter, nodes, child);
+                }
+                uint32_t loop = emitter->count;
+                regex_compile_node(emitter, nodes, child);
+                uint32_t split = regex_emit(emitter, OP_SPLIT, 0, 0);
+                if (emitter->failed) return;
+                emitter->code[split].x = node->greedy ? loop : split + 1;
+                emitter->code[split].y = node->greedy ? split + 1 : loop;
+                break;
+            }
+
+            // min copies, then max - min nested optional copies whose
+            // skip branches all lead to the end
+            for (int32_t i = 0; i < node->min; i++) {
+                regex_compile_node(emitter, nodes, child);
+            }
+            uint32_t skips = REGEX_NONE;
+            for (int32_t i = node->min; i < node->max; i++) {
+                uint32_t split = regex_emit(emitter, OP_SPLIT, 0, skips);
+                if (emitter->failed) return;
+                skips = split;
+                regex_compile_node(emitter, nodes, child);
+            }
+            while (!emitter->failed && skips != REGEX_NONE) {
+                uint32_t previous = emitter->code[skips].y;
+                emitter->code[skips].x = node->greedy ? skips + 1 : emitter->count;
+                emitter->code[skips].y = node->greedy ? emitter->count : skips + 1;
+                skips = previous;
+            }
+            break;
+        }
+    }
+}
+
+// Split the bytes into classes that every instruction treats alike
+static void regex_compute_byte_classes(RegexProgram* program, bool split_newline) {
+    uint8_t classes[256];
+    uint32_t count = 1;
+    memset(classes, 0, sizeof(classes));
+
+    for (uint32_t i = 0; i <= program->class_count; i++) {
+        RegexClass newline = { { 0 } };
+        const RegexClass* set = &newline;
+        if (i < program->class_count) {
+            set = &program->classes[i];
+        } else if (split_newline) {
+            class_add(&newline, '\n');
+        } else {
+            break;
+        }
+
+        uint16_t remap[2][256];
+        uint32_t refined = 0;
+        memset(remap, 0xff, sizeof(remap));
+        for (int c = 0; c < 256; c++) {
+            uint16_t* slot = &remap[class_has(set, (uint8_t)c)][classes[c]];
+            if (*slot == 0xffff) {
+                *slot = (uint16_t)refined++;
+            }
+            classes[c] = (uint8_t)*slot;
+        }
+        count = refined;
+    }
+
+    memcpy(program->byte_class, classes, sizeof(classes));
+    program->byte_class_count = count;
+    for (int c = 255; c >= 0; c--) {
+        program->class_byte[classes[c]] = (uint8_t)c;
+    }
+}
+
+// Find the bytes a match can start with, unless it can also start with
+// an assertion or be empty
+static void regex_compute_first_bytes(RegexProgram* program) {
+    uint32_t* stack = malloc(((size_t)program->count * 2 + 2) * sizeof(uint32_t));
+    bool* seen = calloc(program->count, sizeof(bool));
+    uint32_t top = 0;
+    bool usable = stack != NULL && seen != NULL;
+
+    memset(&program->first_bytes, 0, sizeof(RegexClass));
+    if (usable) stack[top++] = 3;
+    while (usable && top > 0) {
+        uint32_t pc = stack[--top];
+        if (seen[pc]) continue;
+        seen[pc] = true;
+
+        const RegexInst* inst = &program->code[pc];
+        switch (inst->op) {
+            case OP_CLASS:
+                for (int i = 0; i < 4; i++) {
+                    program->first_bytes.bits[i] |= program->classes[inst->x].bits[i];
+                }
+                break;
+            case OP_SPLIT:
+                stack[top++] = inst->y;
+                stack[top++] = inst->x;
+                break;
+            case OP_JMP:
+                stack[top++] = inst->x;
+                break;
+            case OP_SAVE:
+                stack[top++] = pc + 1;
+                break;
+            default:
+                usable = false;
+                break;
+        }
+    }
+
+    program->has_first_bytes = usable;
+    free(stack);
+    free(seen);
+}
+
+// Parse and compile the pattern into regex->program
+static bool regex_build_program(nlink_regex* regex) {
+    RegexParser parser;
+    RegexEmitter emitter;
+    RegexProgram* program = &regex->program;
+    memset(&parser, 0, sizeof(parser));
+    memset(&emitter, 0, sizeof(emitter));
+    parser.p = regex->pattern;
+    parser.options = regex->options;
+
+    int32_t root = regex_parse_alternation(&parser);
+    if (*parser.p != '\0') {
+        parser.failed = true;  // Unbalanced ')'
+    }
+
+    // The search loop matches any byte, including newlines
+    RegexClass any;
+    memset(&any, 0xff, sizeof(any));
+    int32_t any_node = parser.failed ? -1 : regex_class_node(&parser, any);
+
+    if (!parser.failed && any_node >= 0) {
+        bool anchored = false;
+        if (!regex->options.multiline) {
+            const RegexNode* head = &parser.nodes[root];
+            if (head->type == NODE_CONCAT) head = &parser.nodes[head->first];
+            anchored = head->type == NODE_BOL;
+        }
+
+        regex_emit(&emitter, OP_SPLIT, 3, 1);
+        regex_emit(&emitter, OP_CLASS, parser.nodes[any_node].value, 0);
+        regex_emit(&emitter, OP_JMP, 0, 0);
+        regex_emit(&emitter, OP_SAVE, 0, 0);
+        regex_compile_node(&emitter, parser.nodes, root);
+        regex_emit(&emitter, OP_SAVE, 1, 0);
+        uint32_t match = regex_emit(&emitter, OP_MATCH, 0, 0);
+
+        program->code = emitter.code;
+        program->count = emitter.count;
+        program->start = anchored ? 3 : 0;
+        program->match = match;
+        program->classes = parser.classes;
+        program->class_count = parser.class_count;
+        program->slot_count = (parser.group_count + 1) * 2;
+        program->multiline = regex->options.multiline;
+        program->has_bol = parser.has_bol;
+        regex_compute_byte_classes(program, program->multiline && (parser.has_bol || parser.has_eol));
+        regex_compute_first_bytes(program);
+        parser.classes = NULL;
+        emitter.code = NULL;
+    }
+
+    bool success = !parser.failed && !emitter.failed;
+    if (!success) {
+        free(program->code);
+        free(program->classes);
+        memset(program, 0, sizeof(*program));
+    }
+    free(parser.nodes);
+    free(parser.classes);
+    free(emitter.code);
+    return success;
+}
+
+/*
+ * Lazy DFA
+ */
+
+static bool sparse_set_init(RegexSparseSet* set, uint32_t size) {
+    set->sparse = calloc(size, sizeof(uint32_t));
+    set->dense = malloc(size * sizeof(uint32_t));
+    set->count = 0;
+    return set->sparse != NULL && set->dense != NULL;
+}
+
+static void sparse_set_free(RegexSparseSet* set) {
+    free(set->sparse);
+    free(set->dense);
+}
+
+static inline bool sparse_set_insert(RegexSparseSet* set, uint32_t value) {
+    uint32_t i = set->sparse[value];
+    if (i < set->count && set->dense[i] == value) {
+        return false;
+    }
+    set->sparse[value] = set->count;
+    set->dense[set->count++] = value;
+    return true;
+}
+
+static inline bool sparse_set_contains(const RegexSparseSet* set, uint32_t value) {
+    uint32_t i = set->sparse[value];
+    return i < set->count && set->dense[i] == value;
+}
+
+// Add the instructions reachable from pc without consuming input
+static void dfa_closure(RegexDfa* dfa, RegexSparseSet* set, uint32_t pc, bool at_bol, bool at_eol) {
+    const RegexInst* code = dfa->program->code;
+    uint32_t* stack = dfa->stack;
+    uint32_t top = 0;
+
+    stack[top++] = pc;
+    while (top > 0) {
+        pc = stack[--top];
+        if (!sparse_set_insert(set, pc)) continue;
+
+        const RegexInst* inst = &code[pc];
+        switch (inst->op) {
+            case OP_JMP:
+                stack[top++] = inst->x;
+                break;
+            case OP_SPLIT:
+                stack[top++] = inst->y;
+                stack[top++] = inst->x;
+                break;
+            case OP_SAVE:
+                stack[top++] = pc + 1;
+                break;
+            case OP_BOL:
+                if (at_bol) stack[top++] = pc + 1;
+                break;
+            case OP_EOL:
+                if (at_eol) stack[top++] = pc + 1;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static int compare_pcs(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+static uint32_t dfa_hash(const uint32_t* pcs, uint32_t count, uint32_t flags) {
+    uint32_t hash = 2166136261u ^ flags;
+    for (uint32_t i = 0; i < count; i++) {
+        hash = (hash ^ pcs[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static size_t dfa_state_cost(const RegexDfa* dfa, uint32_t count) {
+    return sizeof(RegexDfaState) + dfa->stride * sizeof(uint32_t) + 2 * sizeof(uint32_t) +
+           count * sizeof(uint32_t);
+}
+
+// Forget every state, keeping the allocations
+static void dfa_flush(RegexDfa* dfa) {
+    dfa->state_count = 0;
+    dfa->pc_count = 0;
+    dfa->memory = 0;
+    dfa->start = DFA_UNKNOWN;
+    memset(dfa->index, 0, dfa->index_capacity * sizeof(uint32_t));
+}
+
+static bool dfa_grow_index(RegexDfa* dfa) {
+    size_t capacity = dfa->index_capacity ? dfa->index_capacity * 2 : 64;
+    uint32_t* index = calloc(capacity, sizeof(uint32_t));
+    if (index == NULL) return false;
+
+    for (uint32_t id = 0; id < dfa->state_count; id++) {
+        size_t slot = dfa->states[id].hash & (capacity - 1);
+        while (index[slot] != 0) slot = (slot + 1) & (capacity - 1);
+        index[slot] = id + 1;
+    }
+    free(dfa->index);
+    dfa->index = index;
+    dfa->index_capacity = capacity;
+    return true;
+}
+
+// Find or add the state for a sorted set of pcs
+static uint32_t dfa_intern(RegexDfa* dfa, const uint32_t* pcs, uint32_t count, uint32_t flags) {
+    uint32_t hash = dfa_hash(pcs, count, flags);
+
+    if (dfa->index_capacity > 0) {
+        size_t mask = dfa->index_capacity - 1;
+        for (size_t slot = hash & mask; dfa->index[slot] != 0; slot = (slot + 1) & mask) {
+            const RegexDfaState* state = &dfa->states[dfa->index[slot] - 1];
+            if (state->hash == hash && state->flags == flags && state->count == count &&
+                memcmp(dfa->pcs + state->offset, pcs, count * sizeof(uint32_t)) == 0) {
+                return dfa->index[slot] - 1;
+            }
+        }
+    }
+
+    size_t cost = dfa_state_cost(dfa, count);
+    if (dfa->memory + cost > dfa->memory_limit) {
+        return DFA_FULL;
+    }
+
+    if (dfa->state_count == dfa->state_capacity) {
+        uint32_t capacity = dfa->state_capacity ? dfa->state_capacity * 2 : 16;
+        RegexDfaState* states = realloc(dfa->states, capacity * sizeof(RegexDfaState));
+        if (states == NULL) return DFA_FULL;
+        dfa->states = states;
+        uint32_t* next = realloc(dfa->next, (size_t)capacity * dfa->stride * sizeof(uint32_t));
+        if (next == NULL) return DFA_FULL;
+        dfa->next = next;
+        dfa->state_capacity = capacity;
+    }
+    if (dfa->pc_count + count > dfa->pc_capacity) {
+        size_t capacity = dfa->pc_capacity ? dfa->pc_capacity * 2 : 256;
+        while (capacity < dfa->pc_count + count) capacity *= 2;
+        uint32_t* grown = realloc(dfa->pcs, capacity * sizeof(uint32_t));
+        if (grown == NULL) return DFA_FULL;
+        dfa->pcs = grown;
+        dfa->pc_capacity = capacity;
+    }
+    if ((size_t)(dfa->state_count + 1) * 2 > dfa->index_capacity && !dfa_grow_index(dfa)) {
+        return DFA_FULL;
+    }
+
+    uint32_t id = dfa->state_count++;
+    RegexDfaState* state = &dfa->states[id];
+    state->offset = (uint32_t)dfa->pc_count;
+    state->count = count;
+    state->hash = hash;
+    state->flags = flags;
+    memcpy(dfa->pcs + dfa->pc_count, pcs, count * sizeof(uint32_t));
+    dfa->pc_count += count;
+    memset(dfa->next + (size_t)id * dfa->stride, 0xff, dfa->stride * sizeof(uint32_t));
+    dfa->memory += cost;
+
+    size_t mask = dfa->index_capacity - 1;
+    size_t slot = hash & mask;
+    while (dfa->index[slot] != 0) slot = (slot + 1) & mask;
+    dfa->index[slot] = id + 1;
+    return id;
+}
+
+// Turn the closure in dfa->visited into a state
+static uint32_t dfa_make_state(RegexDfa* dfa, bool at_bol) {
+    const RegexProgram* program = dfa->program;
+    uint32_t count = 0;
+    bool pending_eol = false;
+
+    for (uint32_t i = 0; i < dfa->visited.count; i++) {
+        uint32_t pc = dfa->visited.dense[i];
+        uint32_t op = program->code[pc].op;
+        if (op == OP_MATCH) {
+            // Every matching state behaves the same: the search is over
+            dfa->kept[0] = pc;
+            return dfa_intern(dfa, dfa->kept, 1, DFA_MATCH);
+        }
+        if (op == OP_CLASS || op == OP_EOL) {
+            dfa->kept[count++] = pc;
+            pending_eol |= op == OP_EOL;
+        }
+    }
+    if (count == 0) {
+        return DFA_DEAD;
+    }
+    qsort(dfa->kept, count, sizeof(uint32_t), compare_pcs);
+
+    uint32_t flags = (at_bol && program->has_bol) ? DFA_AT_BOL : 0;
+    if (pending_eol) {
+        dfa->ended.count = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            if (program->code[dfa->kept[i]].op == OP_EOL) {
+                dfa_closure(dfa, &dfa->ended, dfa->kept[i] + 1, at_bol, true);
+            }
+        }
+        if (sparse_set_contains(&dfa->ended, program->match)) {
+            flags |= DFA_MATCH_AT_END;
+        }
+    }
+    return dfa_intern(dfa, dfa->kept, count, flags);
+}
+
+static uint32_t dfa_start(RegexDfa* dfa) {
+    if (dfa->start == DFA_UNKNOWN) {
+        dfa->visited.count = 0;
+        dfa_closure(dfa, &dfa->visited, dfa->program->start, true, false);
+        uint32_t start = dfa_make_state(dfa, true);
+        if (start == DFA_FULL) return DFA_FULL;
+        dfa->start = start;
+    }
+    return dfa->start;
+}
+
+// Compute and cache the transition of a state on a byte class
+static uint32_t dfa_step(RegexDfa* dfa, uint32_t id, uint32_t byte_class) {
+    const RegexProgram* program = dfa->program;
+    RegexDfaState state = dfa->states[id];
+    const uint32_t* pcs = dfa->pcs + state.offset;
+    uint8_t c = program->class_byte[byte_class];
+    bool newline = program->multiline && c == '\n';
+
+    // Before a newline, line-end assertions hold in multiline mode
+    dfa->ended.count = 0;
+    if (newline) {
+        for (uint32_t i = 0; i < state.count; i++) {
+            if (program->code[pcs[i]].op == OP_EOL) {
+                dfa_closure(dfa, &dfa->ended, pcs[i] + 1, (state.flags & DFA_AT_BOL) != 0, true);
+            }
+        }
+        if (sparse_set_contains(&dfa->ended, program->match)) {
+            // The match ends at the line end, before this byte
+            dfa->visited.count = 0;
+            sparse_set_insert(&dfa->visited, program->match);
+            uint32_t next = dfa_make_state(dfa, newline);
+            if (next != DFA_FULL) {
+                dfa->next[(size_t)id * dfa->stride + byte_class] = next;
+            }
+            return next;
+        }
+    }
+
+    dfa->visited.count = 0;
+    for (uint32_t i = 0; i < state.count + dfa->ended.count; i++) {
+        uint32_t pc = i < state.count ? pcs[i] : dfa->ended.dense[i - state.count];
+        const RegexInst* inst = &program->code[pc];
+        if (inst->op == OP_CLASS && class_has(&program->classes[inst->x], c)) {
+            dfa_closure(dfa, &dfa->visited, pc + 1, newline, false);
+        }
+    }
+
+    uint32_t next = dfa_make_state(dfa, newline);
+    if (next != DFA_FULL) {
+        dfa->next[(size_t)id * dfa->stride + byte_class] = next;
+    }
+    return next;
+}
+
+static void dfa_free(RegexDfa* dfa) {
+    if (dfa == NULL) return;
+    sparse_set_free(&dfa->visited);
+    sparse_set_free(&dfa->ended);
+    free(dfa->states);
+    free(dfa->next);
+    free(dfa->pcs);
+    free(dfa->index);
+    free(dfa->stack);
+    free(dfa->kept);
+    free(dfa->saved);
+    pthread_mutex_destroy(&dfa->lock);
+    free(dfa);
+}
+
+static RegexDfa* dfa_create(const RegexProgram* program, size_t memory_limit) {
+    RegexDfa* dfa = calloc(1, sizeof(RegexDfa));
+    if (dfa == NULL) return NULL;
+
+    dfa->program = program;
+    dfa->stride = program->byte_class_count;
+    dfa->memory_limit = memory_limit;
+    dfa->start = DFA_UNKNOWN;
+    pthread_mutex_init(&dfa->lock, NULL);
+
+    bool ok = sparse_set_init(&dfa->visited, program->count) &&
+              sparse_set_init(&dfa->ended, program->count);
+    dfa->stack = malloc(((size_t)program->count * 2 + 2) * sizeof(uint32_t));
+    dfa->kept = malloc(program->count * sizeof(uint32_t));
+    dfa->saved = malloc(program->count * sizeof(uint32_t));
+    if (!ok || dfa->stack == NULL || dfa->kept == NULL || dfa->saved == NULL) {
+        dfa_free(dfa);
+        return NULL;
+    }
+    return dfa;
+}
+
+// Search with the lazy DFA: 1 on a match, 0 on none, -1 to fall back to the NFA
+static int dfa_search(RegexDfa* dfa, const uint8_t* text, size_t length) {
+    // Another thread is using the cache; the NFA needs no shared state
+    if (pthread_mutex_trylock(&dfa->lock) != 0) {
+        return -1;
+    }
+
+    const uint8_t* byte_class = dfa->program->byte_class;
+    uint32_t flushes = 0;
+    uint32_t state = dfa_start(dfa);
+    size_t i = 0;
+    int result = -1;
+
+    while (state != DFA_FULL) {
+        if (state == DFA_DEAD) {
+            result = 0;
+            break;
+        }
+        uint32_t flags = dfa->states[state].flags;
+        if (flags & DFA_MATCH) {
+            result = 1;
+            break;
+        }
+        if (i == length) {
+            result = (flags & DFA_MATCH_AT_END) != 0;
+            break;
+        }
+
+        uint32_t k = byte_class[text[i]];
+        uint32_t next = dfa->next[(size_t)state * dfa->stride + k];
+        if (next == DFA_UNKNOWN) {
+            next = dfa_step(dfa, state, k);
+        }
+        if (next == DFA_FULL) {
+            // Start over with just the current state. A cache that keeps
+            // filling up is thrashing, and the NFA is then faster.
+            if (++flushes > REGEX_MAX_FLUSHES) break;
+            RegexDfaState current = dfa->states[state];
+            memcpy(dfa->saved, dfa->pcs + current.offset, current.count * sizeof(uint32_t));
+            dfa_flush(dfa);
+            state = dfa_intern(dfa, dfa->saved, current.count, current.flags);
+            continue;
+        }
+
+        state = next;
+        i++;
+    }
+
+    pthread_mutex_unlock(&dfa->lock);
+    return result;
+}
+
+/*
+ * Minimized table
+ *
+ * A DFA with at most REGEX_TABLE_STATES states is built completely at
+ * compile time, handed to the Okpala minimizer as an automaton over byte
+ * class symbols plus an end-of-input symbol, and the minimized automaton
+ * is flattened into a table indexed by byte class.
+ */
+
+static void table_free(RegexTable* table) {
+    if (table == NULL) return;
+    free(table->rows);
+    free(table);
+}
+
+// Express the complete DFA as an OkpalaAutomaton
+static OkpalaAutomaton* table_automaton(const RegexDfa* dfa) {
+    OkpalaAutomaton* automaton = okpala_automaton_create();
+    char from[16];
+    char to[16];
+    char symbol[16];
+    bool ok = automaton != NULL;
+
+    for (uint32_t s = 0; ok && s < dfa->state_count; s++) {
+        snprintf(from, sizeof(from), "s%u", s);
+        ok = okpala_automaton_add_state(automaton, from, (dfa->states[s].flags & DFA_MATCH) != 0) == NEXUS_SUCCESS;
+    }
+    ok = ok && okpala_automaton_add_state(automaton, "dead", false) == NEXUS_SUCCESS;
+    ok = ok && okpala_automaton_add_state(automaton, "accept", true) == NEXUS_SUCCESS;
+
+    for (uint32_t s = 0; ok && s < dfa->state_count + 2; s++) {
+        bool matched = s >= dfa->state_count || (dfa->states[s].flags & DFA_MATCH);
+        if (s < dfa->state_count) {
+            snprintf(from, sizeof(from), "s%u", s);
+        } else {
+            snprintf(from, sizeof(from), "%s", s == dfa->state_count ? "dead" : "accept");
+        }
+
+        for (uint32_t k = 0; ok && k <= dfa->stride; k++) {
+            const char* target = from;  // Dead and matching states absorb all input
+            if (!matched && s < dfa->state_count) {
+                if (k == dfa->stride) {
+                    target = (dfa->states[s].flags & DFA_MATCH_AT_END) ? "accept" : "dead";
+                } else {
+                    uint32_t next = dfa->next[(size_t)s * dfa->stride + k];
+                    if (next == DFA_DEAD) {
+                        target = "dead";
+                    } else {
+                        snprintf(to, sizeof(to), "s%u", next);
+                        target = to;
+                    }
+                }
+            }
+            if (k == dfa->stride) {
+                snprintf(symbol, sizeof(symbol), "end");
+            } else {
+                snprintf(symbol, sizeof(symbol), "c%u", k);
+            }
+            ok = okpala_automaton_add_transition(automaton, from, target, symbol) == NEXUS_SUCCESS;
+        }
+    }
+
+    if (!ok) {
+        okpala_automaton_free(automaton);
+        return NULL;
+    }
+    return automaton;
+}
+
+// Flatten a minimized dense automaton into a byte class table
+static RegexTable* table_flatten(const OkpalaDenseAutomaton* dense, uint32_t classes) {
+    uint32_t width = classes + 1;
+    uint32_t symbols[257];
+    char symbol[16];
+
+    for (uint32_t k = 0; k < width; k++) {
+        if (k == classes) {
+            snprintf(symbol, sizeof(symbol), "end");
+        } else {
+            snprintf(symbol, sizeof(symbol), "c%u", k);
+        }
+        symbols[k] = okpala_dense_symbol(dense, symbol);
+        if (symbols[k] == OKPALA_DENSE_NONE) return NULL;
+    }
+
+    RegexTable* table = calloc(1, sizeof(RegexTable));
+    if (table == NULL) return NULL;
+    table->rows = malloc((size_t)dense->state_count * width * sizeof(uint32_t));
+    if (table->rows == NULL) {
+        free(table);
+        return NULL;
+    }
+
+    table->width = width;
+    table->state_count = dense->state_count;
+    table->start = dense->initial_state * width;
+    table->accept = REGEX_NONE;
+    table->dead = REGEX_NONE;
+
+    for (uint32_t s = 0; s < dense->state_count; s++) {
+        bool absorbing = true;
+        for (uint32_t k = 0; k < width; k++) {
+            uint32_t next = dense->table[(size_t)s * dense->table_stride + symbols[k]];
+            table->rows[(size_t)s * width + k] = next * width;
+            absorbing &= next == s;
+        }
+        if (dense->accepting[s]) {
+            table->accept = s * width;
+        } else if (absorbing) {
+            table->dead = s * width;
+        }
+    }
+
+    if (table->accept == REGEX_NONE) {
+        table_free(table);
+        return NULL;
+    }
+    return table;
+}
+
+// Build the minimized table if the whole DFA fits in REGEX_TABLE_STATES states
+static RegexTable* table_create(RegexDfa* dfa) {
+    if (dfa_start(dfa) == DFA_FULL) return NULL;
+
+    for (uint32_t s = 0; s < dfa->state_count; s++) {
+        if (dfa->states[s].flags & DFA_MATCH) continue;
+        for (uint32_t k = 0; k < dfa->stride; k++) {
+            if (dfa_step(dfa, s, k) == DFA_FULL || dfa->state_count > REGEX_TABLE_STATES) {
+                return NULL;
+            }
+        }
+    }
+
+    OkpalaAutomaton* automaton = table_automaton(dfa);
+    OkpalaAutomaton* minimized = automaton ? okpala_minimize_automaton(automaton, false) : NULL;
+    OkpalaDenseAutomaton* dense = minimized ? okpala_dense_create(minimized, OKPALA_LAYOUT_FLAT) : NULL;
+    RegexTable* table = dense ? table_flatten(dense, dfa->stride) : NULL;
+
+    okpala_dense_free(dense);
+    okpala_automaton_free(minimized);
+    okpala_automaton_free(automaton);
+    return table;
+}
+
+static bool table_search(const RegexTable* table, const uint8_t* byte_class, const uint8_t* text, size_t length) {
+    const uint32_t* rows = table->rows;
+    uint32_t row = table->start;
+
+    for (size_t i = 0; i < length; i++) {
+        row = rows[row + byte_class[text[i]]];
+        if (row == table->accept) return true;
+        if (row == table->dead) return false;
+    }
+    return rows[row + table->width - 1] == table->accept;
+}
+
+/*
+ * Pike VM
+ *
+ * Simulates the NFA with one thread per instruction, kept in priority
+ * order, each carrying its own capture slots. A new thread starts the
+ * pattern at each position, below the threads already running, and a
+ * thread that reaches OP_MATCH cuts off every thread of lower priority.
+ * This gives the leftmost match with Perl's greedy and lazy quantifier
+ * semantics. While no thread is running, positions whose byte cannot
+ * start a match are skipped.
+ */
+
+typedef struct RegexThreads {
+    RegexSparseSet set;
+    size_t* slots;                  // Capture slots of the thread at each pc
+} RegexThreads;
+
+// Stack entry: visit pc, or restore a capture slot once its subtree is done
+typedef struct RegexFrame {
+    uint32_t pc;
+    uint32_t slot;                  // REGEX_NONE to visit pc
+    size_t value;
+} RegexFrame;
+
+typedef struct RegexVm {
+    const RegexProgram* program;
+    const uint8_t* text;
+    size_t length;
+    RegexFrame* stack;
+    size_t* slots;                  // Slots of the thread being followed
+} RegexVm;
+
+static void vm_add_thread(RegexVm* vm, RegexThreads* threads, uint32_t pc, size_t position) {
+    const RegexProgram* program = vm->program;
+    RegexFrame* stack = vm->stack;
+    size_t* slots = vm->slots;
+    uint32_t top = 0;
+
+    stack[top++] = (RegexFrame){ pc, REGEX_NONE, 0 };
+    while (top > 0) {
+        RegexFrame frame = stack[--top];
+        if (frame.slot != REGEX_NONE) {
+            slots[frame.slot] = frame.value;
+            continue;
+        }
+
+        pc = frame.pc;
+        if (!sparse_set_insert(&threads->set, pc)) continue;
+
+        const RegexInst* inst = &program->code[pc];
+        switch (inst->op) {
+            case OP_JMP:
+                stack[top++] = (RegexFrame){ inst->x, REGEX_NONE, 0 };
+                break;
+            case OP_SPLIT:
+                stack[top++] = (RegexFrame){ inst->y, REGEX_NONE, 0 };
+                stack[top++] = (RegexFrame){ inst->x, REGEX_NONE, 0 };
+                break;
+            case OP_SAVE:
+                stack[top++] = (RegexFrame){ 0, inst->x, slots[inst->x] };
+                slots[inst->x] = position;
+                stack[top++] = (RegexFrame){ pc + 1, REGEX_NONE, 0 };
+                break;
+            case OP_BOL:
+                if (position == 0 || (program->multiline && vm->text[position - 1] == '\n')) {
+                    stack[top++] = (RegexFrame){ pc + 1, REGEX_NONE, 0 };
+                }
+                break;
+            case OP_EOL:
+                if (position == vm->length || (program->multiline && vm->text[position] == '\n')) {
+                    stack[top++] = (RegexFrame){ pc + 1, REGEX_NONE, 0 };
+                }
+                break;
+            default:
+                memcpy(threads->slots + (size_t)pc * program->slot_count, slots,
+                       program->slot_count * sizeof(size_t));
+                break;
+        }
+    }
+}
+
+// Find the leftmost match; fills slot_count capture slots
+static bool vm_search(const RegexProgram* program, const uint8_t* text, size_t length, size_t* result) {
+    size_t slot_bytes = (size_t)program->count * program->slot_count * sizeof(size_t);
+    RegexThreads lists[2];
+    RegexVm vm = { program, text, length, NULL, NULL };
+    bool matched = false;
+    bool ok = true;
+
+    for (int i = 0; i < 2; i++) {
+        ok &= sparse_set_init(&lists[i].set, program->count);
+        lists[i].slots = malloc(slot_bytes);
+        ok &= lists[i].slots != NULL;
+    }
+    vm.stack = malloc(((size_t)program->count * 3 + 1) * sizeof(RegexFrame));
+    vm.slots = malloc(program->slot_count * sizeof(size_t));
+
+    if (ok && vm.stack != NULL && vm.slots != NULL) {
+        RegexThreads* current = &lists[0];
+        RegexThreads* next = &lists[1];
+        bool anchored = program->start != 0;
+        current->set.count = 0;
+
+        for (size_t position = 0; ; position++) {
+            // Start the pattern here unless an earlier start already matched
+            if (!matched && (position == 0 || !anchored)) {
+                if (current->set.count == 0 && program->has_first_bytes) {
+                    while (position < length && !class_has(&program->first_bytes, text[position])) {
+                        position++;
+                    }
+                }
+                for (uint32_t s = 0; s < program->slot_count; s++) {
+                    vm.slots[s] = NLINK_REGEX_UNSET;
+                }
+                vm_add_thread(&vm, current, 3, position);
+            }
+            if (current->set.count == 0) break;
+
+            next->set.count = 0;
+
+            for (uint32_t i = 0; i < current->set.count; i++) {
+                uint32_t pc = current->set.dense[i];
+                const RegexInst* inst = &program->code[pc];
+                const size_t* slots = current->slots + (size_t)pc * program->slot_count;
+
+                if (inst->op == OP_MATCH) {
+                    memcpy(result, slots, program->slot_count * sizeof(size_t));
+                    matched = true;
+                    break;
+                }
+                if (inst->op == OP_CLASS && position < length &&
+                    class_has(&program->classes[inst->x], text[position])) {
+                    memcpy(vm.slots, slots, program->slot_count * sizeof(size_t));
+                    vm_add_thread(&vm, next, pc + 1, position + 1);
+                }
+            }
+
+            RegexThreads* swap = current;
+            current = next;
+            next = swap;
+            if (position >= length) break;
+        }
+    }
+
+    for (int i = 0; i < 2; i++) {
+        sparse_set_free(&lists[i].set);
+        free(lists[i].slots);
+    }
+    free(vm.stack);
+    free(vm.slots);
+    return matched;
+}
+
 nlink_regex_options nlink_regex_default_options(void) {
     nlink_regex_options options = {
         .case_insensitive = false,
         .multiline = false,
         .dot_all = false,
-        .extended = true
+        .extended = true,
+        .max_dfa_memory = NLINK_REGEX_DEFAULT_DFA_MEMORY
     };
-    
+
     return options;
 }
 
@@ -31,26 +1580,43 @@ nlink_regex* nlink_regex_compile(const char* pattern, nlink_regex_options option
     if (pattern == NULL) {
         return NULL;
     }
-    
+
     // Allocate regex structure
-    nlink_regex* regex = malloc(sizeof(nlink_regex));
+    nlink_regex* regex = calloc(1, sizeof(nlink_regex));
     if (regex == NULL) {
         return NULL;
     }
-    
+
     // Copy pattern
     regex->pattern = strdup(pattern);
     if (regex->pattern == NULL) {
         free(regex);
         return NULL;
     }
-    
+
     // Store options
+    if (options.max_dfa_memory == 0) {
+        options.max_dfa_memory = NLINK_REGEX_DEFAULT_DFA_MEMORY;
+    }
     regex->options = options;
-    
-    // Compile pattern (placeholder implementation)
-    regex->compiled = NULL;  // Would be a real compilation result
-    
+
+    // Compile the pattern to an NFA program
+    if (!regex_build_program(regex)) {
+        nlink_regex_free(regex);
+        return NULL;
+    }
+
+    // Prefer the minimized table; keep the lazy DFA when it is too large.
+    // Without either, matching still works through the NFA.
+    regex->dfa = dfa_create(&regex->program, options.max_dfa_memory);
+    if (regex->dfa != NULL) {
+        regex->table = table_create(regex->dfa);
+        if (regex->table != NULL) {
+            dfa_free(regex->dfa);
+            regex->dfa = NULL;
+        }
+    }
+
     return regex;
 }
 
@@ -58,47 +1624,88 @@ void nlink_regex_free(nlink_regex* regex) {
     if (regex == NULL) {
         return;
     }
-    
+
     free(regex->pattern);
-    // Free compiled pattern (implementation-specific)
+    free(regex->program.code);
+    free(regex->program.classes);
+    table_free(regex->table);
+    dfa_free(regex->dfa);
     free(regex);
 }
 
-bool nlink_regex_match(nlink_regex* regex, const char* string, nlink_regex_match* match) {
+bool nlink_regex_match(nlink_regex* regex, const char* string, nlink_regex_match_result* match) {
     if (regex == NULL || string == NULL) {
         return false;
     }
-    
-    // This is a placeholder implementation
-    // A complete implementation would use a real regex engine
-    
-    // For demonstration, just check if the pattern appears in the string
-    bool found = strstr(string, regex->pattern) != NULL;
-    
+
+    const uint8_t* text = (const uint8_t*)string;
+    size_t length = strlen(string);
+    const RegexProgram* program = &regex->program;
+
+    // Decide with the DFA first; only positions and groups need the NFA
+    int found = -1;
+    if (regex->table != NULL) {
+        found = table_search(regex->table, program->byte_class, text, length);
+    } else if (regex->dfa != NULL) {
+        found = dfa_search(regex->dfa, text, length);
+    }
+
+    if (found == 0) {
+        return false;
+    }
+    if (found == 1 && match == NULL) {
+        return true;
+    }
+
+    size_t* slots = malloc(program->slot_count * sizeof(size_t));
+    if (slots == NULL) {
+        return false;
+    }
+
+    bool matched = vm_search(program, text, length, slots);
+
     // If caller wants match details and we found a match
-    if (match != NULL && found) {
-        const char* start = strstr(string, regex->pattern);
-        match->start = start - string;
-        match->end = match->start + strlen(regex->pattern);
+    if (match != NULL && matched) {
+        size_t groups = program->slot_count / 2 - 1;
+        match->start = slots[0];
+        match->end = slots[1];
         match->group_count = 0;
         match->group_starts = NULL;
         match->group_ends = NULL;
+
+        if (groups > 0) {
+            match->group_starts = malloc(groups * sizeof(size_t));
+            match->group_ends = malloc(groups * sizeof(size_t));
+            if (match->group_starts != NULL && match->group_ends != NULL) {
+                for (size_t g = 0; g < groups; g++) {
+                    match->group_starts[g] = slots[2 * (g + 1)];
+                    match->group_ends[g] = slots[2 * (g + 1) + 1];
+                }
+                match->group_count = groups;
+            } else {
+                free(match->group_starts);
+                free(match->group_ends);
+                match->group_starts = NULL;
+                match->group_ends = NULL;
+            }
+        }
     }
-    
-    return found;
+
+    free(slots);
+    return matched;
 }
 
-void nlink_regex_match_free(nlink_regex_match* match) {
+void nlink_regex_match_free(nlink_regex_match_result* match) {
     if (match == NULL) {
         return;
     }
-    
+
     free(match->group_starts);
     free(match->group_ends);
     // Don't free match itself - caller owns it
 }
 
-char* nlink_regex_get_group(const char* string, nlink_regex_match* match, size_t group) {
+char* nlink_regex_get_group(const char* string, nlink_regex_match_result* match, size_t group) {
     if (string == NULL || match == NULL) {
         return NULL;
     }
@@ -118,6 +1725,11 @@ char* nlink_regex_get_group(const char* string, nlink_regex_match* match, size_t
         return NULL;
     }
     
+    // Group that took no part in the match
+    if (start == NLINK_REGEX_UNSET) {
+        return NULL;
+    }
+    
     // Extract substring
     size_t length = end - start;
     char* result = malloc(length + 1);
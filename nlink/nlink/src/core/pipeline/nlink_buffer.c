@@ -0,0 +1,147 @@
+/**
+ * @file nlink_buffer.c
+ * @brief Implementation of sized pipeline buffers and buffer pooling
+ * 
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/pipeline/nlink_buffer.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Smallest capacity allocated for a buffer */
+#define NEXUS_BUFFER_MIN_CAPACITY 256
+
+NexusResult nexus_buffer_reserve(NexusBuffer* buffer, size_t capacity) {
+    if (!buffer) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+    
+    if (buffer->capacity >= capacity) {
+        return NEXUS_SUCCESS;
+    }
+    
+    size_t new_capacity = buffer->capacity ? buffer->capacity : NEXUS_BUFFER_MIN_CAPACITY;
+    while (new_capacity < capacity) {
+        new_capacity = new_capacity > SIZE_MAX / 2 ? capacity : new_capacity * 2;
+    }
+    
+    void* data = realloc(buffer->data, new_capacity);
+    if (!data) {
+        return NEXUS_OUT_OF_MEMORY;
+    }
+    
+    buffer->data = data;
+    buffer->capacity = new_capacity;
+    return NEXUS_SUCCESS;
+}
+
+NexusResult nexus_buffer_assign(NexusBuffer* buffer, const void* data, size_t size) {
+    if (!buffer || (size > 0 && !data)) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+    
+    NexusResult result = nexus_buffer_reserve(buffer, size);
+    if (result != NEXUS_SUCCESS) {
+        return result;
+    }
+    
+    if (size > 0) {
+        memcpy(buffer->data, data, size);
+    }
+    buffer->size = size;
+    return NEXUS_SUCCESS;
+}
+
+void nexus_buffer_swap(NexusBuffer* a, NexusBuffer* b) {
+    if (!a || !b) {
+        return;
+    }
+    
+    NexusBuffer tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+void nexus_buffer_free(NexusBuffer* buffer) {
+    if (!buffer) {
+        return;
+    }
+    
+    free(buffer->data);
+    buffer->data = NULL;
+    buffer->size = 0;
+    buffer->capacity = 0;
+}
+
+void nexus_buffer_pool_init(NexusBufferPool* pool) {
+    if (pool) {
+        memset(pool, 0, sizeof(NexusBufferPool));
+    }
+}
+
+NexusResult nexus_buffer_pool_acquire(NexusBufferPool* pool, size_t capacity, NexusBuffer* buffer) {
+    if (!pool || !buffer) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+    
+    memset(buffer, 0, sizeof(NexusBuffer));
+    
+    if (pool->idle_count > 0) {
+        /* Best fit among buffers large enough, else the largest one */
+        size_t best = pool->idle_count;
+        size_t largest = 0;
+        for (size_t i = 0; i < pool->idle_count; i++) {
+            size_t size = pool->idle[i].capacity;
+            if (size >= capacity && (best == pool->idle_count || size < pool->idle[best].capacity)) {
+                best = i;
+            }
+            if (size > pool->idle[largest].capacity) {
+                largest = i;
+            }
+        }
+        
+        size_t chosen = best < pool->idle_count ? best : largest;
+        *buffer = pool->idle[chosen];
+        pool->idle[chosen] = pool->idle[--pool->idle_count];
+        
+        if (buffer->capacity >= capacity) {
+            pool->reuses++;
+            return NEXUS_SUCCESS;
+        }
+    }
+    
+    pool->allocations++;
+    NexusResult result = nexus_buffer_reserve(buffer, capacity ? capacity : NEXUS_BUFFER_MIN_CAPACITY);
+    if (result != NEXUS_SUCCESS) {
+        nexus_buffer_free(buffer);
+    }
+    return result;
+}
+
+void nexus_buffer_pool_release(NexusBufferPool* pool, NexusBuffer* buffer) {
+    if (!buffer) {
+        return;
+    }
+    
+    if (!pool || !buffer->data || pool->idle_count == NEXUS_BUFFER_POOL_SLOTS) {
+        nexus_buffer_free(buffer);
+        return;
+    }
+    
+    buffer->size = 0;
+    pool->idle[pool->idle_count++] = *buffer;
+    memset(buffer, 0, sizeof(NexusBuffer));
+}
+
+void nexus_buffer_pool_cleanup(NexusBufferPool* pool) {
+    if (!pool) {
+        return;
+    }
+    
+    for (size_t i = 0; i < pool->idle_count; i++) {
+        nexus_buffer_free(&pool->idle[i]);
+    }
+    pool->idle_count = 0;
+}
@@ -18,6 +18,7 @@ NlinkPipelineConfig nlink_pipeline_default_config(void) {
     config.enable_caching = true;
     config.max_iterations = 10;  /* Default to 10 iterations max */
     config.schema_path = NULL;
+    config.buffer_size = NLINK_PIPELINE_DEFAULT_BUFFER_SIZE;
     return config;
 }
 
@@ -35,6 +36,7 @@ NlinkPipeline* nlink_pipeline_create(NexusContext* ctx, const NlinkPipelineConfi
     /* Initialize with default values */
     memset(pipeline, 0, sizeof(NlinkPipeline));
     pipeline->ctx = ctx;
+    nexus_buffer_pool_init(&pipeline->pool);
     
     /* Apply configuration if provided */
     if (config) {
@@ -42,6 +44,9 @@ NlinkPipeline* nlink_pipeline_create(NexusContext* ctx, const NlinkPipelineConfi
     } else {
         pipeline->config = nlink_pipeline_default_config();
     }
+    if (pipeline->config.buffer_size == 0) {
+        pipeline->config.buffer_size = NLINK_PIPELINE_DEFAULT_BUFFER_SIZE;
+    }
     
     /* Start with auto mode, will be determined during execution */
     pipeline->active_mode = NLINK_PIPELINE_MODE_AUTO;
@@ -53,14 +58,12 @@ NlinkPipeline* nlink_pipeline_create(NexusContext* ctx, const NlinkPipelineConfi
     return pipeline;
 }
 
-NexusResult nlink_pipeline_add_stage(NlinkPipeline* pipeline, 
-                                    const char* name,
-                                    NlinkPipelineStageFunc func,
-                                    void* user_data) {
-    if (!pipeline || !name || !func) {
-        return NEXUS_INVALID_PARAMETER;
-    }
-    
+static NexusResult append_stage(NlinkPipeline* pipeline,
+                                const char* name,
+                                NlinkPipelineStageFunc func,
+                                NlinkPipelineBufferStageFunc buffer_func,
+                                size_t output_size_hint,
+                                void* user_data) {
     /* Create new stage */
     NlinkPipelineStage* stage = (NlinkPipelineStage*)malloc(sizeof(NlinkPipelineStage));
     if (!stage) {
@@ -76,6 +79,8 @@ NexusResult nlink_pipeline_add_stage(NlinkPipeline* pipeline,
     }
     
     stage->func = func;
+    stage->buffer_func = buffer_func;
+    stage->output_size_hint = output_size_hint;
     stage->user_data = user_data;
     stage->next = NULL;
     
@@ -96,113 +101,203 @@ NexusResult nlink_pipeline_add_stage(NlinkPipeline* pipeline,
     return NEXUS_SUCCESS;
 }
 
-static NexusResult execute_single_pass(NlinkPipeline* pipeline, void* input, void* output) {
+NexusResult nlink_pipeline_add_stage(NlinkPipeline* pipeline, 
+                                    const char* name,
+                                    NlinkPipelineStageFunc func,
+                                    void* user_data) {
+    if (!pipeline || !name || !func) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+    
+    return append_stage(pipeline, name, func, NULL, 0, user_data);
+}
+
+NexusResult nlink_pipeline_add_buffer_stage(NlinkPipeline* pipeline,
+                                           const char* name,
+                                           NlinkPipelineBufferStageFunc func,
+                                           size_t output_size_hint,
+                                           void* user_data) {
+    if (!pipeline || !name || !func) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+    
+    return append_stage(pipeline, name, NULL, func, output_size_hint, user_data);
+}
+
+/* Make an input readable as config.buffer_size bytes for an unsized stage */
+static NexusResult widen_for_unsized(NlinkPipeline* pipeline, NexusBuffer* buffer) {
+    size_t size = pipeline->config.buffer_size;
+    NexusResult result = nexus_buffer_reserve(buffer, size);
+    if (result != NEXUS_SUCCESS) {
+        return result;
+    }
+    
+    if (buffer->size < size) {
+        memset((char*)buffer->data + buffer->size, 0, size - buffer->size);
+        buffer->size = size;
+    }
+    
+    return NEXUS_SUCCESS;
+}
+
+/* Run a single stage from input into output */
+static NexusResult run_stage(NlinkPipeline* pipeline, NlinkPipelineStage* stage,
+                             const NexusBuffer* input, NexusBuffer* output) {
+    size_t expected;
+    if (stage->buffer_func) {
+        expected = stage->output_size_hint ? stage->output_size_hint : input->size;
+    } else {
+        expected = pipeline->config.buffer_size;
+    }
+    
+    NexusResult result = nexus_buffer_reserve(output, expected);
+    if (result != NEXUS_SUCCESS) {
+        return result;
+    }
+    output->size = 0;
+    
+    if (stage->buffer_func) {
+        return stage->buffer_func(input, output, stage->user_data);
+    }
+    
+    /* Unsized stages read and write config.buffer_size bytes */
+    result = stage->func(input->data, output->data, stage->user_data);
+    if (result == NEXUS_SUCCESS) {
+        output->size = expected;
+    }
+    return result;
+}
+
+/*
+ * Run every stage once. Stages alternate between two pooled buffers, each
+ * stage's output becoming the next stage's input without a copy. The first
+ * stage reads the caller's input in place. On success *output receives the
+ * pooled buffer holding the last stage's result.
+ */
+static NexusResult run_chain(NlinkPipeline* pipeline, const NexusBuffer* input,
+                             NexusBuffer* output, unsigned iteration) {
     NexusContext* ctx = pipeline->ctx;
-    NlinkPipelineStage* current = pipeline->first_stage;
-    void* stage_input = input;
-    void* stage_output = NULL;
-    NexusResult result = NEXUS_SUCCESS;
+    NexusBuffer buffers[2];
+    size_t initial = input->size > pipeline->config.buffer_size ? input->size : pipeline->config.buffer_size;
     
-    /* Only need a middle buffer if we have more than one stage */
-    if (pipeline->stage_count > 1) {
-        stage_output = malloc(1024);  /* Simplified: would use appropriate buffer size in real impl */
-        if (!stage_output) {
-            nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate stage output buffer");
-            return NEXUS_OUT_OF_MEMORY;
+    NexusResult result = nexus_buffer_pool_acquire(&pipeline->pool, initial, &buffers[0]);
+    if (result == NEXUS_SUCCESS) {
+        result = nexus_buffer_pool_acquire(&pipeline->pool, initial, &buffers[1]);
+        if (result != NEXUS_SUCCESS) {
+            nexus_buffer_pool_release(&pipeline->pool, &buffers[0]);
         }
-    } else {
-        stage_output = output;  /* Single stage, output directly to final output */
     }
+    if (result != NEXUS_SUCCESS) {
+        nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate stage buffers");
+        return result;
+    }
+    
+    const NexusBuffer* stage_input = input;
+    int next = 0;
     
-    /* Process each stage */
-    while (current && result == NEXUS_SUCCESS) {
-        nexus_log(ctx, NEXUS_LOG_DEBUG, "Executing stage '%s'", current->name);
+    for (NlinkPipelineStage* current = pipeline->first_stage; current; current = current->next) {
+        if (iteration > 0) {
+            nexus_log(ctx, NEXUS_LOG_DEBUG, "Iteration %u: Executing stage '%s'", 
+                      iteration, current->name);
+        } else {
+            nexus_log(ctx, NEXUS_LOG_DEBUG, "Executing stage '%s'", current->name);
+        }
         
-        /* Last stage outputs directly to the final output */
-        void* current_output = current->next ? stage_output : output;
+        /* Unsized stages may read config.buffer_size bytes of their input */
+        if (!current->buffer_func && stage_input->size < pipeline->config.buffer_size) {
+            NexusBuffer* widened = &buffers[1 - next];
+            if (stage_input == input) {
+                result = nexus_buffer_assign(widened, input->data, input->size);
+            }
+            if (result == NEXUS_SUCCESS) {
+                result = widen_for_unsized(pipeline, widened);
+            }
+            stage_input = widened;
+        }
         
-        /* Execute the stage */
-        result = current->func(stage_input, current_output, current->user_data);
+        if (result == NEXUS_SUCCESS) {
+            result = run_stage(pipeline, current, stage_input, &buffers[next]);
+        }
         
         if (result != NEXUS_SUCCESS) {
-            nexus_log(ctx, NEXUS_LOG_ERROR, "Stage '%s' failed with result %d", 
-                      current->name, result);
+            if (iteration > 0) {
+                nexus_log(ctx, NEXUS_LOG_ERROR, "Stage '%s' failed with result %d in iteration %u", 
+                          current->name, result, iteration);
+            } else {
+                nexus_log(ctx, NEXUS_LOG_ERROR, "Stage '%s' failed with result %d", 
+                          current->name, result);
+            }
             break;
         }
         
-        /* Prepare for next stage */
-        if (current->next) {
-            stage_input = stage_output;
-        }
-        
-        current = current->next;
+        /* Hand the output to the next stage */
+        stage_input = &buffers[next];
+        next = 1 - next;
     }
     
-    /* Clean up intermediate buffer */
-    if (pipeline->stage_count > 1 && stage_output != output) {
-        free(stage_output);
+    if (result != NEXUS_SUCCESS) {
+        nexus_buffer_pool_release(&pipeline->pool, &buffers[0]);
+        nexus_buffer_pool_release(&pipeline->pool, &buffers[1]);
+        return result;
+    }
+    
+    *output = buffers[1 - next];
+    nexus_buffer_pool_release(&pipeline->pool, &buffers[next]);
+    return NEXUS_SUCCESS;
+}
+
+static NexusResult execute_single_pass(NlinkPipeline* pipeline, const NexusBuffer* input, NexusBuffer* output) {
+    NexusBuffer final_buffer;
+    NexusResult result = run_chain(pipeline, input, &final_buffer, 0);
+    
+    if (result == NEXUS_SUCCESS) {
+        /* Zero-copy handoff; the caller's previous storage joins the pool */
+        nexus_buffer_swap(output, &final_buffer);
+        nexus_buffer_pool_release(&pipeline->pool, &final_buffer);
     }
     
     return result;
 }
 
-static NexusResult execute_multi_pass(NlinkPipeline* pipeline, void* input, void* output) {
+static NexusResult execute_multi_pass(NlinkPipeline* pipeline, const NexusBuffer* input, NexusBuffer* output) {
     NexusContext* ctx = pipeline->ctx;
     NexusResult result = NEXUS_SUCCESS;
     unsigned iterations = 0;
     bool converged = false;
     
-    /* Create two buffers for ping-pong processing */
-    void* buffer_a = malloc(1024);  /* Simplified: would use appropriate buffer size in real impl */
-    void* buffer_b = malloc(1024);
-    
-    if (!buffer_a || !buffer_b) {
-        nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate processing buffers");
-        free(buffer_a);
-        free(buffer_b);
-        return NEXUS_OUT_OF_MEMORY;
-    }
-    
-    /* Initialize buffer_a with input data */
-    memcpy(buffer_a, input, 1024);  /* Simplified; would use actual size */
+    /* Result of the previous iteration, which is the next iteration's input */
+    NexusBuffer previous = {0};
+    const NexusBuffer* source = input;
     
     /* Process until convergence or max iterations */
     while (!converged && iterations < pipeline->config.max_iterations) {
         iterations++;
-        void* source = (iterations % 2 == 1) ? buffer_a : buffer_b;
-        void* target = (iterations % 2 == 1) ? buffer_b : buffer_a;
         
-        /* Process each stage */
-        NlinkPipelineStage* current = pipeline->first_stage;
-        while (current && result == NEXUS_SUCCESS) {
-            nexus_log(ctx, NEXUS_LOG_DEBUG, "Iteration %u: Executing stage '%s'", 
-                      iterations, current->name);
-            
-            result = current->func(source, target, current->user_data);
-            
-            if (result != NEXUS_SUCCESS) {
-                nexus_log(ctx, NEXUS_LOG_ERROR, "Stage '%s' failed with result %d in iteration %u", 
-                          current->name, result, iterations);
-                break;
-            }
-            
-            current = current->next;
+        NexusBuffer target;
+        result = run_chain(pipeline, source, &target, iterations);
+        if (result != NEXUS_SUCCESS) {
+            break;
         }
         
-        /* Check for convergence (simplified: would use actual comparison) */
-        if (iterations > 1) {
-            /* Compare source and target to detect convergence */
-            if (memcmp(source, target, 1024) == 0) {
-                converged = true;
-                nexus_log(ctx, NEXUS_LOG_INFO, "Pipeline converged after %u iterations", iterations);
-            }
+        /* Converged once an iteration reproduces its own input */
+        if (iterations > 1 && target.size == source->size &&
+            (target.size == 0 || memcmp(source->data, target.data, target.size) == 0)) {
+            converged = true;
+            nexus_log(ctx, NEXUS_LOG_INFO, "Pipeline converged after %u iterations", iterations);
         }
+        
+        nexus_buffer_pool_release(&pipeline->pool, &previous);
+        previous = target;
+        source = &previous;
     }
     
-    /* Copy final result to output */
+    /* Hand the final result to the output */
     if (result == NEXUS_SUCCESS) {
-        void* final_buffer = (iterations % 2 == 0) ? buffer_a : buffer_b;
-        memcpy(output, final_buffer, 1024);  /* Simplified; would use actual size */
+        if (iterations == 0) {
+            result = nexus_buffer_assign(output, input->data, input->size);
+        } else {
+            nexus_buffer_swap(output, &previous);
+        }
         
         if (!converged) {
             nexus_log(ctx, NEXUS_LOG_WARNING, "Pipeline reached maximum iterations (%u) without converging",
@@ -214,27 +309,16 @@ static NexusResult execute_multi_pass(NlinkPipeline* pipeline, void* input, void
     pipeline->last_iterations = iterations;
     
     /* Clean up */
-    free(buffer_a);
-    free(buffer_b);
+    nexus_buffer_pool_release(&pipeline->pool, &previous);
     
     return result;
 }
 
-NexusResult nlink_pipeline_execute(NlinkPipeline* pipeline, void* input, void* output) {
-    if (!pipeline || !input || !output) {
-        return NEXUS_INVALID_PARAMETER;
-    }
-    
+static NexusResult execute_pipeline(NlinkPipeline* pipeline, const NexusBuffer* input, NexusBuffer* output) {
     NexusContext* ctx = pipeline->ctx;
     NexusResult result;
     struct timespec start, end;
     
-    /* Check if we have any stages */
-    if (!pipeline->first_stage) {
-        nexus_log(ctx, NEXUS_LOG_WARNING, "Executing empty pipeline");
-        return NEXUS_SUCCESS;  /* Nothing to do */
-    }
-    
     /* Determine execution mode if set to auto */
     if (pipeline->config.mode == NLINK_PIPELINE_MODE_AUTO) {
         /* Simplified logic: use multi-pass if we have more than 3 stages */
@@ -272,6 +356,47 @@ NexusResult nlink_pipeline_execute(NlinkPipeline* pipeline, void* input, void* o
     return result;
 }
 
+NexusResult nlink_pipeline_execute(NlinkPipeline* pipeline, void* input, void* output) {
+    if (!pipeline || !input || !output) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+    
+    /* Check if we have any stages */
+    if (!pipeline->first_stage) {
+        nexus_log(pipeline->ctx, NEXUS_LOG_WARNING, "Executing empty pipeline");
+        return NEXUS_SUCCESS;  /* Nothing to do */
+    }
+    
+    /* Caller buffers are config.buffer_size bytes; the input is read in place */
+    size_t size = pipeline->config.buffer_size;
+    NexusBuffer in = { input, size, size };
+    NexusBuffer out = {0};
+    
+    NexusResult result = execute_pipeline(pipeline, &in, &out);
+    if (result == NEXUS_SUCCESS) {
+        memcpy(output, out.data, out.size < size ? out.size : size);
+    }
+    nexus_buffer_pool_release(&pipeline->pool, &out);
+    
+    return result;
+}
+
+NexusResult nlink_pipeline_execute_buffer(NlinkPipeline* pipeline,
+                                         const NexusBuffer* input,
+                                         NexusBuffer* output) {
+    if (!pipeline || !input || !output || (input->size > 0 && !input->data)) {
+        return NEXUS_INVALID_PARAMETER;
+    }
+    
+    /* Check if we have any stages */
+    if (!pipeline->first_stage) {
+        nexus_log(pipeline->ctx, NEXUS_LOG_WARNING, "Executing empty pipeline");
+        return nexus_buffer_assign(output, input->data, input->size);
+    }
+    
+    return execute_pipeline(pipeline, input, output);
+}
+
 NlinkPipelineMode nlink_pipeline_get_mode(const NlinkPipeline* pipeline) {
     if (!pipeline) {
         return NLINK_PIPELINE_MODE_AUTO;  /* Default */
@@ -312,6 +437,7 @@ void nlink_pipeline_destroy(NlinkPipeline* pipeline) {
         current = next;
     }
     
-    /* Free the pipeline itself */
+    /* Free pooled buffers and the pipeline itself */
+    nexus_buffer_pool_cleanup(&pipeline->pool);
     free(pipeline);
 }
\ No newline at end of file
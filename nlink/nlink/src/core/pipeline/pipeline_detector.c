@@ -65,9 +65,7 @@
          }
          
          // Check for cycles in the dependency graph
-         NexusCycleInfo* cycles = NULL;
-         size_t cycle_count = 0;
-         bool has_cycles = mps_detect_cycles(ctx, mps_config, &cycles, &cycle_count);
+         bool has_cycles = mps_detect_cycles(ctx, mps_config, NULL, NULL);
          
          // Clean up
          mps_free_pipeline_config(mps_config);
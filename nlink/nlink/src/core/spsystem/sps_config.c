@@ -68,6 +68,25 @@
      // Parse allow_partial_processing flag
      config->allow_partial_processing = nexus_json_get_bool(doc, "allow_partial_processing", false);
      
+     // Parse size_streams_from_high_water flag
+     config->size_streams_from_high_water = nexus_json_get_bool(doc, "size_streams_from_high_water", false);
+     
+     // Parse execution mode
+     const char* execution_mode = nexus_json_get_string(doc, "execution_mode");
+     if (execution_mode && strcmp(execution_mode, "streaming") == 0) {
+         config->execution_mode = NEXUS_PIPELINE_EXECUTE_STREAMING;
+     } else if (execution_mode && strcmp(execution_mode, "threaded") == 0) {
+         config->execution_mode = NEXUS_PIPELINE_EXECUTE_THREADED;
+     } else {
+         config->execution_mode = NEXUS_PIPELINE_EXECUTE_SEQUENTIAL;
+     }
+     
+     // Parse chunk size and queue depth (0 selects the defaults)
+     double chunk_size = nexus_json_get_number(doc, "chunk_size", 0);
+     config->chunk_size = chunk_size > 0 ? (size_t)chunk_size : 0;
+     double queue_depth = nexus_json_get_number(doc, "queue_depth", 0);
+     config->queue_depth = queue_depth > 0 ? (size_t)queue_depth : 0;
+     
      // Parse components array
      NexusJsonArray* components_array = nexus_json_get_array(doc, "components");
      if (components_array) {
@@ -117,6 +136,19 @@
                  // Parse optional flag
                  comp_config->optional = nexus_json_get_bool(comp_obj, "optional", false);
                  
+                 // Parse dependencies
+                 NexusJsonArray* dependencies = nexus_json_get_array(comp_obj, "dependencies");
+                 size_t dependency_count = dependencies ? nexus_json_array_size(dependencies) : 0;
+                 if (dependency_count > 0) {
+                     comp_config->dependencies = (const char**)calloc(dependency_count, sizeof(char*));
+                     for (size_t j = 0; comp_config->dependencies && j < dependency_count; j++) {
+                         const char* dependency = nexus_json_array_get_string(dependencies, j);
+                         if (dependency) {
+                             comp_config->dependencies[comp_config->dependency_count++] = strdup(dependency);
+                         }
+                     }
+                 }
+                 
                  // Parse component-specific configuration
                  NexusJsonObject* comp_config_obj = nexus_json_get_object(comp_obj, "config");
                  if (comp_config_obj && config->component_config_creator) {
@@ -159,6 +191,8 @@
      config->input_format = strdup("binary");
      config->output_format = strdup("binary");
      config->allow_partial_processing = false;
+     config->size_streams_from_high_water = false;
+     config->execution_mode = NEXUS_PIPELINE_EXECUTE_SEQUENTIAL;
      
      return config;
  }
@@ -266,6 +300,11 @@
      free((void*)config->component_id);
      free((void*)config->version_constraint);
      
+     for (size_t i = 0; i < config->dependency_count; i++) {
+         free((void*)config->dependencies[i]);
+     }
+     free((void*)config->dependencies);
+     
      // Free component-specific config using provided destructor
      if (config->component_config && destructor) {
          destructor(config->component_config);
@@ -309,6 +348,22 @@
      }
      
      nexus_json_set_bool(doc, "allow_partial_processing", config->allow_partial_processing);
+     nexus_json_set_bool(doc, "size_streams_from_high_water", config->size_streams_from_high_water);
+     
+     switch (config->execution_mode) {
+         case NEXUS_PIPELINE_EXECUTE_STREAMING:
+             nexus_json_set_string(doc, "execution_mode", "streaming");
+             break;
+         case NEXUS_PIPELINE_EXECUTE_THREADED:
+             nexus_json_set_string(doc, "execution_mode", "threaded");
+             break;
+         default:
+             nexus_json_set_string(doc, "execution_mode", "sequential");
+             break;
+     }
+     
+     nexus_json_set_number(doc, "chunk_size", (double)config->chunk_size);
+     nexus_json_set_number(doc, "queue_depth", (double)config->queue_depth);
      
      // Create components array
      NexusJsonArray* components_array = nexus_json_create_array();
@@ -335,6 +390,16 @@
              
              nexus_json_set_bool(comp_obj, "optional", comp_config->optional);
              
+             if (comp_config->dependency_count > 0) {
+                 NexusJsonArray* dependencies = nexus_json_create_array();
+                 if (dependencies) {
+                     for (size_t j = 0; j < comp_config->dependency_count; j++) {
+                         nexus_json_array_append_string(dependencies, comp_config->dependencies[j]);
+                     }
+                     nexus_json_set_array(comp_obj, "dependencies", dependencies);
+                 }
+             }
+             
              // TODO: Handle component-specific config serialization
              // This would require cooperation with the config creator/destructor
              
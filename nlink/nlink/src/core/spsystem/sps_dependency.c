@@ -11,6 +11,7 @@
  #include "nlink/spsystem/sps_dependency.h"
  #include "nlink/core/common/nexus_core.h"
  #include "nlink/core/common/nexus_loader.h"
+ #include <stdint.h>
  #include <stdlib.h>
  #include <string.h>
  
@@ -18,18 +19,25 @@
  static NexusResult build_dependency_nodes(NexusContext* ctx, 
                                           NexusDependencyGraph* graph,
                                           const NexusPipelineConfig* config);
+ static NexusResult index_dependency_graph(NexusContext* ctx, NexusDependencyGraph* graph);
  static NexusResult topological_sort(NexusContext* ctx, 
                                     NexusDependencyGraph* graph,
                                     const char*** ordered_components,
                                     size_t* component_count);
- static NexusResult visit_node(NexusContext* ctx, 
-                              NexusDependencyGraph* graph,
-                              size_t node_index,
-                              const char*** sorted,
-                              size_t* sorted_count,
-                              size_t* capacity);
- static bool component_has_dependency(NexusDependencyNode* node, const char* dependency_id);
- static NexusResult detect_cycles(NexusContext* ctx, NexusDependencyGraph* graph);
+ static NexusResult report_cycle(NexusContext* ctx, const NexusDependencyGraph* graph);
+ 
+ /**
+  * Hash a component identifier (FNV-1a)
+  */
+ static uint64_t hash_component_id(const char* id) {
+     uint64_t hash = 14695981039346656037ULL;
+     
+     for (const unsigned char* p = (const unsigned char*)id; *p; p++) {
+         hash ^= *p;
+         hash *= 1099511628211ULL;
+     }
+     return hash;
+ }
  
  /**
   * Create a dependency graph from component metadata
@@ -64,8 +72,11 @@
          }
      }
      
-     // Build dependency nodes
+     // Build dependency nodes, then intern their identifiers and edges
      NexusResult result = build_dependency_nodes(ctx, graph, config);
+     if (result == NEXUS_SUCCESS) {
+         result = index_dependency_graph(ctx, graph);
+     }
      if (result != NEXUS_SUCCESS) {
          sps_free_dependency_graph(graph);
          return NULL;
@@ -81,6 +92,8 @@
  static NexusResult build_dependency_nodes(NexusContext* ctx, 
                                           NexusDependencyGraph* graph,
                                           const NexusPipelineConfig* config) {
+     bool declared = false;
+     
      for (size_t i = 0; i < config->component_count; i++) {
          NexusPipelineComponentConfig* comp_config = config->components[i];
          if (!comp_config || !comp_config->component_id) {
@@ -100,42 +113,138 @@
          node->temporary_mark = false;
          node->metadata = comp_config;  // Store a reference to the component config
          
-         // Determine dependencies based on component metadata
-         // This would typically load the component and query its dependencies
-         // For now, we'll use a simplified approach where we load component info
-         
          // Add node to graph
          graph->nodes[graph->node_count++] = node;
-         
-         nexus_log(ctx, NEXUS_LOG_DEBUG, "Added node for component '%s'", comp_config->component_id);
+         declared = declared || comp_config->dependency_count > 0;
      }
      
-     // Now that we have all nodes, establish dependencies
-     // In a real system, this would load each component and query its dependencies
-     // For simplicity, we'll just establish linear dependencies for now
+     // Dependencies come from the configuration; without any, each
+     // component depends on the previous one
      for (size_t i = 0; i < graph->node_count; i++) {
          NexusDependencyNode* node = graph->nodes[i];
+         NexusPipelineComponentConfig* comp_config = (NexusPipelineComponentConfig*)node->metadata;
+         size_t count = declared ? comp_config->dependency_count : (i > 0);
          
-         // For demonstration, create dependencies between adjacent components
-         if (i > 0) {
-             // This component depends on the previous one
-             node->dependencies = (const char**)calloc(1, sizeof(char*));
-             if (!node->dependencies) {
-                 nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate dependencies array");
-                 return NEXUS_OUT_OF_MEMORY;
-             }
-             
+         if (count == 0) {
+             continue;
+         }
+         
+         node->dependencies = (const char**)calloc(count, sizeof(char*));
+         if (!node->dependencies) {
+             nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate dependencies array");
+             return NEXUS_OUT_OF_MEMORY;
+         }
+         
+         if (declared) {
+             memcpy((void*)node->dependencies, comp_config->dependencies, count * sizeof(char*));
+         } else {
              node->dependencies[0] = graph->nodes[i-1]->component_id;
-             node->dependency_count = 1;
-             
-             nexus_log(ctx, NEXUS_LOG_DEBUG, "Component '%s' depends on '%s'", 
-                      node->component_id, node->dependencies[0]);
          }
+         node->dependency_count = count;
      }
      
      return NEXUS_SUCCESS;
  }
  
+ /**
+  * Intern component identifiers and resolve every dependency to a node index
+  */
+ static NexusResult index_dependency_graph(NexusContext* ctx, NexusDependencyGraph* graph) {
+     size_t n = graph->node_count;
+     size_t slots = 16;
+     while (slots < n * 2) {
+         slots *= 2;
+     }
+     
+     size_t edge_count = 0;
+     for (size_t i = 0; i < n; i++) {
+         edge_count += graph->nodes[i]->dependency_count;
+     }
+     
+     graph->id_slots = (size_t*)calloc(slots, sizeof(size_t));
+     graph->id_mask = slots - 1;
+     graph->edge_start = (size_t*)calloc(n + 1, sizeof(size_t));
+     graph->edge_targets = (size_t*)malloc((edge_count ? edge_count : 1) * sizeof(size_t));
+     graph->dependent_start = (size_t*)calloc(n + 2, sizeof(size_t));
+     graph->dependents = (size_t*)malloc((edge_count ? edge_count : 1) * sizeof(size_t));
+     if (!graph->id_slots || !graph->edge_start || !graph->edge_targets ||
+         !graph->dependent_start || !graph->dependents) {
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate dependency index");
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     // Identifier index; a repeated identifier resolves to its first node
+     for (size_t i = 0; i < n; i++) {
+         const char* id = graph->nodes[i]->component_id;
+         size_t slot = hash_component_id(id) & graph->id_mask;
+         bool duplicate = false;
+         
+         while (graph->id_slots[slot] != 0) {
+             if (strcmp(graph->nodes[graph->id_slots[slot] - 1]->component_id, id) == 0) {
+                 duplicate = true;
+                 break;
+             }
+             slot = (slot + 1) & graph->id_mask;
+         }
+         if (!duplicate) {
+             graph->id_slots[slot] = i + 1;
+         }
+     }
+     
+     // Dependencies in CSR form, counting dependents per target on the way
+     size_t edge = 0;
+     for (size_t i = 0; i < n; i++) {
+         NexusDependencyNode* node = graph->nodes[i];
+         graph->edge_start[i] = edge;
+         
+         for (size_t d = 0; d < node->dependency_count; d++, edge++) {
+             size_t target = node->dependencies[d] ? sps_find_dependency_node(graph, node->dependencies[d]) : SIZE_MAX;
+             graph->edge_targets[edge] = target;
+             if (target == SIZE_MAX) {
+                 graph->missing_count++;
+             } else {
+                 graph->dependent_start[target + 2]++;
+             }
+         }
+     }
+     graph->edge_start[n] = edge;
+     
+     // Reverse edges: prefix sums shifted by one serve as fill cursors
+     for (size_t i = 2; i <= n + 1; i++) {
+         graph->dependent_start[i] += graph->dependent_start[i - 1];
+     }
+     for (size_t i = 0; i < n; i++) {
+         for (size_t e = graph->edge_start[i]; e < graph->edge_start[i + 1]; e++) {
+             size_t target = graph->edge_targets[e];
+             if (target != SIZE_MAX) {
+                 graph->dependents[graph->dependent_start[target + 1]++] = i;
+             }
+         }
+     }
+     
+     return NEXUS_SUCCESS;
+ }
+ 
+ /**
+  * Find a node by component identifier
+  */
+ size_t sps_find_dependency_node(const NexusDependencyGraph* graph, const char* component_id) {
+     if (!graph || !graph->id_slots || !component_id) {
+         return SIZE_MAX;
+     }
+     
+     size_t slot = hash_component_id(component_id) & graph->id_mask;
+     while (graph->id_slots[slot] != 0) {
+         size_t index = graph->id_slots[slot] - 1;
+         if (strcmp(graph->nodes[index]->component_id, component_id) == 0) {
+             return index;
+         }
+         slot = (slot + 1) & graph->id_mask;
+     }
+     
+     return SIZE_MAX;
+ }
+ 
  /**
   * Resolve dependencies and provide ordered loading sequence
   */
@@ -153,14 +262,8 @@
      *ordered_components = NULL;
      *component_count = 0;
      
-     // Check for cycles
-     NexusResult result = detect_cycles(ctx, graph);
-     if (result != NEXUS_SUCCESS) {
-         return result;
-     }
-     
-     // Perform topological sort
-     result = topological_sort(ctx, graph, ordered_components, component_count);
+     // Perform topological sort; it also detects cycles
+     NexusResult result = topological_sort(ctx, graph, ordered_components, component_count);
      if (result != NEXUS_SUCCESS) {
          return result;
      }
@@ -172,172 +275,176 @@
  }
  
  /**
-  * Topological sort algorithm
+  * Topological sort (Kahn's algorithm)
   */
  static NexusResult topological_sort(NexusContext* ctx, 
                                     NexusDependencyGraph* graph,
                                     const char*** ordered_components,
                                     size_t* component_count) {
-     // Reset visited flags
-     for (size_t i = 0; i < graph->node_count; i++) {
-         graph->nodes[i]->visited = false;
-         graph->nodes[i]->temporary_mark = false;
-     }
-     
-     // Allocate initial result array
-     size_t capacity = graph->node_count;
-     const char** sorted = (const char**)calloc(capacity, sizeof(char*));
-     if (!sorted) {
+     size_t n = graph->node_count;
+     
+     // Allocate result array and per-node counts of unresolved dependencies
+     const char** sorted = (const char**)calloc(n ? n : 1, sizeof(char*));
+     size_t* queue = (size_t*)malloc((n ? n : 1) * sizeof(size_t));
+     size_t* waiting = (size_t*)calloc(n ? n : 1, sizeof(size_t));
+     if (!sorted || !queue || !waiting) {
+         free(sorted);
+         free(queue);
+         free(waiting);
          nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate sorted components array");
          return NEXUS_OUT_OF_MEMORY;
      }
      
-     size_t sorted_count = 0;
+     size_t queued = 0;
+     for (size_t i = 0; i < n; i++) {
+         for (size_t e = graph->edge_start[i]; e < graph->edge_start[i + 1]; e++) {
+             waiting[i] += graph->edge_targets[e] != SIZE_MAX;
+         }
+         if (waiting[i] == 0) {
+             queue[queued++] = i;
+         }
+     }
      
-     // Visit each unvisited node
-     for (size_t i = 0; i < graph->node_count; i++) {
-         if (!graph->nodes[i]->visited) {
-             NexusResult result = visit_node(ctx, graph, i, &sorted, &sorted_count, &capacity);
-             if (result != NEXUS_SUCCESS) {
-                 free(sorted);
-                 return result;
+     // Release dependents as their last dependency is placed
+     for (size_t head = 0; head < queued; head++) {
+         size_t i = queue[head];
+         sorted[head] = graph->nodes[i]->component_id;
+         graph->nodes[i]->visited = true;
+         
+         for (size_t k = graph->dependent_start[i]; k < graph->dependent_start[i + 1]; k++) {
+             size_t dependent = graph->dependents[k];
+             if (--waiting[dependent] == 0) {
+                 queue[queued++] = dependent;
              }
          }
      }
      
-     // Reverse the array to get dependency order (not reverse topological order)
-     for (size_t i = 0; i < sorted_count / 2; i++) {
-         const char* temp = sorted[i];
-         sorted[i] = sorted[sorted_count - i - 1];
-         sorted[sorted_count - i - 1] = temp;
+     free(queue);
+     free(waiting);
+     
+     // Nodes never released lie on or behind a cycle
+     if (queued < n) {
+         free(sorted);
+         return report_cycle(ctx, graph);
      }
      
      // Set output
      *ordered_components = sorted;
-     *component_count = sorted_count;
+     *component_count = n;
      
      return NEXUS_SUCCESS;
  }
  
  /**
-  * Visit a node in the dependency graph (DFS)
+  * Find one dependency cycle and log its members
+  *
+  * Iterative Tarjan, so long dependency chains do not exhaust the stack.
+  * The first strongly connected component with a cycle is reported.
   */
- static NexusResult visit_node(NexusContext* ctx, 
-                              NexusDependencyGraph* graph,
-                              size_t node_index,
-                              const char*** sorted,
-                              size_t* sorted_count,
-                              size_t* capacity) {
-     NexusDependencyNode* node = graph->nodes[node_index];
-     
-     // Check for cycle
-     if (node->temporary_mark) {
-         nexus_log(ctx, NEXUS_LOG_ERROR, "Dependency cycle detected involving component '%s'",
-                  node->component_id);
-         return NEXUS_DEPENDENCY_CYCLE;
-     }
-     
-     // Skip if already visited
-     if (node->visited) {
-         return NEXUS_SUCCESS;
+ static NexusResult report_cycle(NexusContext* ctx, const NexusDependencyGraph* graph) {
+     size_t n = graph->node_count;
+     size_t* index = (size_t*)malloc(n * sizeof(size_t));
+     size_t* lowlink = (size_t*)malloc(n * sizeof(size_t));
+     size_t* stack = (size_t*)malloc(n * sizeof(size_t));
+     size_t* call_node = (size_t*)malloc(n * sizeof(size_t));
+     size_t* call_edge = (size_t*)malloc(n * sizeof(size_t));
+     bool* on_stack = (bool*)calloc(n, sizeof(bool));
+     
+     if (!index || !lowlink || !stack || !call_node || !call_edge || !on_stack) {
+         free(index);
+         free(lowlink);
+         free(stack);
+         free(call_node);
+         free(call_edge);
+         free(on_stack);
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Dependency cycle detected");
+         return NEXUS_DEPENDENCY_ERROR;
      }
      
-     // Mark temporarily for cycle detection
-     node->temporary_mark = true;
-     
-     // Visit dependencies
-     for (size_t i = 0; i < node->dependency_count; i++) {
-         const char* dep_id = node->dependencies[i];
-         
-         // Find the dependency node
-         for (size_t j = 0; j < graph->node_count; j++) {
-             if (strcmp(graph->nodes[j]->component_id, dep_id) == 0) {
-                 NexusResult result = visit_node(ctx, graph, j, sorted, sorted_count, capacity);
-                 if (result != NEXUS_SUCCESS) {
-                     return result;
-                 }
-                 break;
-             }
-         }
-     }
-     
-     // Mark as visited
-     node->visited = true;
-     node->temporary_mark = false;
-     
-     // Check if we need to resize the sorted array
-     if (*sorted_count >= *capacity) {
-         *capacity *= 2;
-         const char** new_sorted = (const char**)realloc(*sorted, *capacity * sizeof(char*));
-         if (!new_sorted) {
-             nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to resize sorted array");
-             return NEXUS_OUT_OF_MEMORY;
-         }
-         *sorted = new_sorted;
+     for (size_t i = 0; i < n; i++) {
+         index[i] = SIZE_MAX;
      }
      
-     // Add to sorted list
-     (*sorted)[(*sorted_count)++] = node->component_id;
+     size_t next_index = 0;
+     size_t stack_size = 0;
+     bool reported = false;
      
-     return NEXUS_SUCCESS;
- }
- 
- /**
-  * Check if a component has a specific dependency
-  */
- static bool component_has_dependency(NexusDependencyNode* node, const char* dependency_id) {
-     for (size_t i = 0; i < node->dependency_count; i++) {
-         if (strcmp(node->dependencies[i], dependency_id) == 0) {
-             return true;
+     for (size_t root = 0; root < n && !reported; root++) {
+         if (index[root] != SIZE_MAX) {
+             continue;
          }
-     }
-     return false;
- }
- 
- /**
-  * Detect cycles in the dependency graph
-  */
- static NexusResult detect_cycles(NexusContext* ctx, NexusDependencyGraph* graph) {
-     // Reset visited flags
-     for (size_t i = 0; i < graph->node_count; i++) {
-         graph->nodes[i]->visited = false;
-         graph->nodes[i]->temporary_mark = false;
-     }
-     
-     // Check each node for cycles
-     for (size_t i = 0; i < graph->node_count; i++) {
-         if (!graph->nodes[i]->visited) {
-             // Use DFS to detect cycles
-             graph->nodes[i]->temporary_mark = true;
+         
+         size_t depth = 0;
+         call_node[0] = root;
+         call_edge[0] = graph->edge_start[root];
+         index[root] = lowlink[root] = next_index++;
+         stack[stack_size++] = root;
+         on_stack[root] = true;
+         
+         while (!reported) {
+             size_t v = call_node[depth];
              
-             for (size_t j = 0; j < graph->nodes[i]->dependency_count; j++) {
-                 const char* dep_id = graph->nodes[i]->dependencies[j];
+             if (call_edge[depth] < graph->edge_start[v + 1]) {
+                 size_t w = graph->edge_targets[call_edge[depth]++];
+                 if (w == SIZE_MAX) {
+                     continue;
+                 }
+                 if (index[w] == SIZE_MAX) {
+                     depth++;
+                     call_node[depth] = w;
+                     call_edge[depth] = graph->edge_start[w];
+                     index[w] = lowlink[w] = next_index++;
+                     stack[stack_size++] = w;
+                     on_stack[w] = true;
+                 } else if (on_stack[w] && index[w] < lowlink[v]) {
+                     lowlink[v] = index[w];
+                 }
+                 continue;
+             }
+             
+             // v is finished; pop its component if it is a root
+             if (lowlink[v] == index[v]) {
+                 size_t first = stack_size;
+                 do {
+                     first--;
+                     on_stack[stack[first]] = false;
+                 } while (stack[first] != v);
                  
-                 for (size_t k = 0; k < graph->node_count; k++) {
-                     if (strcmp(graph->nodes[k]->component_id, dep_id) == 0) {
-                         if (graph->nodes[k]->temporary_mark) {
-                             nexus_log(ctx, NEXUS_LOG_ERROR, 
-                                     "Dependency cycle detected: %s -> %s",
-                                     graph->nodes[i]->component_id, dep_id);
-                             return NEXUS_DEPENDENCY_CYCLE;
-                         }
-                         
-                         if (!graph->nodes[k]->visited) {
-                             NexusResult result = detect_cycles(ctx, graph);
-                             if (result != NEXUS_SUCCESS) {
-                                 return result;
-                             }
-                         }
+                 bool cyclic = stack_size - first > 1;
+                 for (size_t e = graph->edge_start[v]; !cyclic && e < graph->edge_start[v + 1]; e++) {
+                     cyclic = graph->edge_targets[e] == v;
+                 }
+                 
+                 if (cyclic) {
+                     nexus_log(ctx, NEXUS_LOG_ERROR, "Dependency cycle detected among %zu component(s):",
+                              stack_size - first);
+                     for (size_t k = first; k < stack_size; k++) {
+                         nexus_log(ctx, NEXUS_LOG_ERROR, "  %s", graph->nodes[stack[k]]->component_id);
                      }
+                     reported = true;
                  }
+                 stack_size = first;
              }
              
-             graph->nodes[i]->temporary_mark = false;
-             graph->nodes[i]->visited = true;
+             if (depth == 0) {
+                 break;
+             }
+             depth--;
+             size_t parent = call_node[depth];
+             if (lowlink[v] < lowlink[parent]) {
+                 lowlink[parent] = lowlink[v];
+             }
          }
      }
      
-     return NEXUS_SUCCESS;
+     free(index);
+     free(lowlink);
+     free(stack);
+     free(call_node);
+     free(call_edge);
+     free(on_stack);
+     
+     return NEXUS_DEPENDENCY_ERROR;
  }
  
  /**
@@ -357,28 +464,8 @@
      *missing_deps = NULL;
      *missing_count = 0;
      
-     // Count missing dependencies first
-     size_t total_missing = 0;
-     for (size_t i = 0; i < graph->node_count; i++) {
-         NexusDependencyNode* node = graph->nodes[i];
-         
-         for (size_t j = 0; j < node->dependency_count; j++) {
-             const char* dep_id = node->dependencies[j];
-             bool found = false;
-             
-             // Check if the dependency exists in the graph
-             for (size_t k = 0; k < graph->node_count; k++) {
-                 if (strcmp(graph->nodes[k]->component_id, dep_id) == 0) {
-                     found = true;
-                     break;
-                 }
-             }
-             
-             if (!found) {
-                 total_missing++;
-             }
-         }
-     }
+     // Unresolved dependencies were counted when the graph was indexed
+     size_t total_missing = graph->missing_count;
      
      // If no missing dependencies, we're done
      if (total_missing == 0) {
@@ -401,31 +488,22 @@
              (NexusPipelineComponentConfig*)node->metadata;
          
          for (size_t j = 0; j < node->dependency_count; j++) {
-             const char* dep_id = node->dependencies[j];
-             bool found = false;
-             
-             // Check if the dependency exists in the graph
-             for (size_t k = 0; k < graph->node_count; k++) {
-                 if (strcmp(graph->nodes[k]->component_id, dep_id) == 0) {
-                     found = true;
-                     break;
-                 }
+             if (graph->edge_targets[graph->edge_start[i] + j] != SIZE_MAX) {
+                 continue;
              }
              
-             if (!found) {
-                 (*missing_deps)[index].component_id = node->component_id;
-                 (*missing_deps)[index].missing_dependency = dep_id;
-                 
-                 // Get version constraint if available
-                 (*missing_deps)[index].version_constraint = 
-                     comp_config ? comp_config->version_constraint : NULL;
-                 
-                 // Determine if optional based on component config
-                 (*missing_deps)[index].is_optional = 
-                     comp_config ? comp_config->optional : false;
-                 
-                 index++;
-             }
+             (*missing_deps)[index].component_id = node->component_id;
+             (*missing_deps)[index].missing_dependency = node->dependencies[j];
+             
+             // Get version constraint if available
+             (*missing_deps)[index].version_constraint = 
+                 comp_config ? comp_config->version_constraint : NULL;
+             
+             // Determine if optional based on component config
+             (*missing_deps)[index].is_optional = 
+                 comp_config ? comp_config->optional : false;
+             
+             index++;
          }
      }
      
@@ -461,6 +539,13 @@
          free(graph->nodes);
      }
      
+     // Free the index
+     free(graph->id_slots);
+     free(graph->edge_start);
+     free(graph->edge_targets);
+     free(graph->dependent_start);
+     free(graph->dependents);
+     
      // Free the graph itself
      free(graph);
- }
\ No newline at end of file
+ }
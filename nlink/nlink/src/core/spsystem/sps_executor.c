@@ -0,0 +1,476 @@
+/**
+ * @file sps_executor.c
+ * @brief Thread-per-stage executor for single-pass pipelines
+ *
+ * Each component runs on its own thread. Link k carries chunks into
+ * stage k through a bounded SPSC ring; a second ring on the same link
+ * hands consumed chunk buffers back to the producer, which is what
+ * provides backpressure. The calling thread feeds slices of the input
+ * into link 0 without copying them, and each stage forwards its output
+ * in chunk-sized slices of the buffer it wrote into, so downstream
+ * stages see the same chunking as in streaming execution.
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+ #include "nlink/spsystem/sps_executor.h"
+ #include "nlink/spsystem/sps_lifecycle.h"
+ #include "nlink/core/common/nexus_core.h"
+ #include <pthread.h>
+ #include <sched.h>
+ #include <stdatomic.h>
+ #include <stdlib.h>
+ #include <string.h>
+ #include <time.h>
+ 
+ // Failed polls before a waiting thread starts yielding, then sleeping
+ #define SPS_EXECUTOR_SPIN_LIMIT 128
+ #define SPS_EXECUTOR_YIELD_LIMIT 1024
+ 
+ /* A chunk travelling over a link */
+ typedef struct {
+     const void* data;            // Chunk bytes
+     size_t size;                 // Chunk size
+     NexusDataStream* buffer;     // Buffer holding the bytes, NULL for input slices
+     bool final;                  // End-of-input marker
+ } SpsChunk;
+ 
+ /* Bounded lock-free single-producer/single-consumer ring */
+ typedef struct {
+     SpsChunk* slots;
+     size_t capacity;             // Power of two
+     _Alignas(64) atomic_size_t head;  // Next slot to read, advanced by the consumer
+     _Alignas(64) atomic_size_t tail;  // Next slot to write, advanced by the producer
+ } SpsChunkQueue;
+ 
+ /* Connection between a producer and stage k */
+ typedef struct {
+     SpsChunkQueue data;          // Chunks for the consumer
+     SpsChunkQueue free;          // Consumed buffers for the producer
+     NexusDataStream** buffers;   // Buffers owned by this link
+     size_t buffer_count;
+ } SpsLink;
+ 
+ /* State shared by all stages of one execution */
+ typedef struct {
+     NexusContext* ctx;
+     NexusPipeline* pipeline;
+     NexusDataStream* output;
+     size_t chunk_size;
+     atomic_bool abort;
+ } SpsExecution;
+ 
+ /* One worker thread */
+ typedef struct {
+     SpsExecution* run;
+     NexusPipelineComponent* component;
+     SpsLink* in;
+     SpsLink* out;                // NULL for the last stage
+     NexusResult error;           // First error raised by the component
+     double busy_ms;
+     double idle_ms;
+     double backpressure_ms;
+     pthread_t thread;
+     bool started;
+ } SpsStage;
+ 
+ static double now_ms(void) {
+     struct timespec ts;
+     clock_gettime(CLOCK_MONOTONIC, &ts);
+     return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+ }
+ 
+ static NexusResult queue_init(SpsChunkQueue* queue, size_t min_capacity) {
+     size_t capacity = 2;
+     while (capacity < min_capacity) {
+         capacity *= 2;
+     }
+     
+     queue->slots = (SpsChunk*)calloc(capacity, sizeof(SpsChunk));
+     if (!queue->slots) {
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     queue->capacity = capacity;
+     atomic_init(&queue->head, 0);
+     atomic_init(&queue->tail, 0);
+     return NEXUS_SUCCESS;
+ }
+ 
+ static bool queue_push(SpsChunkQueue* queue, const SpsChunk* chunk) {
+     size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+     size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+     if (tail - head == queue->capacity) {
+         return false;
+     }
+     
+     queue->slots[tail & (queue->capacity - 1)] = *chunk;
+     atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+     return true;
+ }
+ 
+ static bool queue_pop(SpsChunkQueue* queue, SpsChunk* chunk) {
+     size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+     size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+     if (head == tail) {
+         return false;
+     }
+     
+     *chunk = queue->slots[head & (queue->capacity - 1)];
+     atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+     return true;
+ }
+ 
+ // Back off progressively while a queue is empty or full
+ static void queue_backoff(unsigned* polls) {
+     if (++*polls < SPS_EXECUTOR_SPIN_LIMIT) {
+         return;
+     }
+     
+     if (*polls < SPS_EXECUTOR_YIELD_LIMIT) {
+         sched_yield();
+     } else {
+         struct timespec pause = { 0, 50000 };
+         nanosleep(&pause, NULL);
+     }
+ }
+ 
+ // Pop, waiting until a chunk arrives; false if the execution was aborted
+ static bool queue_wait_pop(SpsChunkQueue* queue, SpsChunk* chunk, atomic_bool* abort) {
+     unsigned polls = 0;
+     
+     while (!queue_pop(queue, chunk)) {
+         if (atomic_load_explicit(abort, memory_order_relaxed)) {
+             return false;
+         }
+         queue_backoff(&polls);
+     }
+     
+     return true;
+ }
+ 
+ // Push, waiting until there is room; false if the execution was aborted
+ static bool queue_wait_push(SpsChunkQueue* queue, const SpsChunk* chunk, atomic_bool* abort) {
+     unsigned polls = 0;
+     
+     while (!queue_push(queue, chunk)) {
+         if (atomic_load_explicit(abort, memory_order_relaxed)) {
+             return false;
+         }
+         queue_backoff(&polls);
+     }
+     
+     return true;
+ }
+ 
+ // Set up a link and, unless it is fed by the caller, its chunk buffers
+ static NexusResult link_init(SpsLink* link, size_t depth, size_t chunk_size, bool buffered) {
+     // One slot beyond the buffer count leaves room for the final marker
+     if (queue_init(&link->data, depth + 1) != NEXUS_SUCCESS ||
+         queue_init(&link->free, depth) != NEXUS_SUCCESS) {
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     if (!buffered) {
+         return NEXUS_SUCCESS;
+     }
+     
+     link->buffers = (NexusDataStream**)calloc(depth, sizeof(NexusDataStream*));
+     if (!link->buffers) {
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     for (size_t i = 0; i < depth; i++) {
+         link->buffers[i] = sps_stream_create(chunk_size);
+         if (!link->buffers[i]) {
+             return NEXUS_OUT_OF_MEMORY;
+         }
+         link->buffer_count++;
+         
+         SpsChunk chunk = { NULL, 0, link->buffers[i], false };
+         queue_push(&link->free, &chunk);
+     }
+     
+     return NEXUS_SUCCESS;
+ }
+ 
+ static void link_free(SpsLink* link) {
+     for (size_t i = 0; i < link->buffer_count; i++) {
+         sps_stream_destroy(link->buffers[i]);
+     }
+     free(link->buffers);
+     free(link->data.slots);
+     free(link->free.slots);
+ }
+ 
+ // Forward a filled buffer in chunk-sized slices; the buffer travels with
+ // the last slice, so it comes back only after every slice is consumed
+ static bool forward_output(SpsStage* stage, NexusDataStream* buffer) {
+     SpsExecution* run = stage->run;
+     const uint8_t* data = (const uint8_t*)buffer->data;
+     
+     for (size_t offset = 0; offset < buffer->size; offset += run->chunk_size) {
+         size_t remaining = buffer->size - offset;
+         bool last = remaining <= run->chunk_size;
+         SpsChunk slice = { data + offset, last ? remaining : run->chunk_size,
+                            last ? buffer : NULL, false };
+         
+         // A full link is backpressure as well
+         double start = now_ms();
+         bool pushed = queue_wait_push(&stage->out->data, &slice, &run->abort);
+         stage->backpressure_ms += now_ms() - start;
+         if (!pushed) {
+             return false;
+         }
+     }
+     
+     return true;
+ }
+ 
+ /**
+  * Worker loop of one stage
+  */
+ static void* stage_main(void* arg) {
+     SpsStage* stage = (SpsStage*)arg;
+     SpsExecution* run = stage->run;
+     NexusPipelineComponent* component = stage->component;
+     bool active = component->is_initialized && component->component;
+     NexusDataStream* target = NULL;
+     
+     for (;;) {
+         SpsChunk chunk;
+         double start = now_ms();
+         if (!queue_wait_pop(&stage->in->data, &chunk, &run->abort)) {
+             break;
+         }
+         
+         // Take an empty output buffer; waiting here is backpressure
+         double ready = now_ms();
+         stage->idle_ms += ready - start;
+         
+         if (stage->out && !target) {
+             SpsChunk spare;
+             if (!queue_wait_pop(&stage->out->free, &spare, &run->abort)) {
+                 break;
+             }
+             target = spare.buffer;
+             sps_stream_clear(target);
+             
+             double acquired = now_ms();
+             stage->backpressure_ms += acquired - ready;
+             ready = acquired;
+         }
+         
+         NexusDataStream* dest = stage->out ? target : run->output;
+         size_t mark = dest->size;
+         
+         // Skipped components produce nothing, as in whole-stream execution
+         if (active) {
+             NexusResult result = sps_component_execute_chunk(run->ctx, component,
+                                                              chunk.data, chunk.size,
+                                                              chunk.final, dest);
+             stage->busy_ms += now_ms() - ready;
+             
+             if (result != NEXUS_SUCCESS) {
+                 if (stage->error == NEXUS_SUCCESS) {
+                     stage->error = result;
+                 }
+                 
+                 if (!run->pipeline->config->allow_partial_processing) {
+                     atomic_store(&run->abort, true);
+                     break;
+                 }
+             }
+         }
+         
+         // Hand the consumed buffer back to its producer
+         if (chunk.buffer) {
+             SpsChunk done = { NULL, 0, chunk.buffer, false };
+             queue_push(&stage->in->free, &done);
+         }
+         
+         if (stage->out) {
+             // An empty output keeps its buffer for the next chunk
+             if (target->size > 0) {
+                 if (!forward_output(stage, target)) {
+                     break;
+                 }
+                 target = NULL;
+             }
+             
+             if (chunk.final) {
+                 SpsChunk end = { NULL, 0, NULL, true };
+                 if (!queue_wait_push(&stage->out->data, &end, &run->abort)) {
+                     break;
+                 }
+             }
+         } else if (run->pipeline->chunk_handler && dest->size > mark) {
+             run->pipeline->chunk_handler(run->pipeline, (const uint8_t*)dest->data + mark,
+                                          dest->size - mark, run->pipeline->user_data);
+         }
+         
+         if (chunk.final) {
+             break;
+         }
+     }
+     
+     return NULL;
+ }
+ 
+ /**
+  * Execute the pipeline with one worker thread per component
+  */
+ NexusResult sps_pipeline_execute_threaded(NexusContext* ctx,
+                                          NexusPipeline* pipeline,
+                                          NexusDataStream* input,
+                                          NexusDataStream* output,
+                                          size_t chunk_size,
+                                          size_t queue_depth) {
+     if (!ctx || !pipeline || !input || !output) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     if (chunk_size == 0) {
+         chunk_size = SPS_PIPELINE_DEFAULT_CHUNK_SIZE;
+     }
+     if (queue_depth == 0) {
+         queue_depth = SPS_EXECUTOR_DEFAULT_QUEUE_DEPTH;
+     }
+     
+     nexus_log(ctx, NEXUS_LOG_INFO, "Executing pipeline '%s' on %zu threads",
+              pipeline->pipeline_id ? pipeline->pipeline_id : "unnamed",
+              pipeline->component_count);
+     
+     // Make sure pipeline is initialized
+     if (!pipeline->is_initialized) {
+         NexusResult result = sps_pipeline_initialize(ctx, pipeline);
+         if (result != NEXUS_SUCCESS) {
+             nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to initialize pipeline: %d", result);
+             return result;
+         }
+     }
+     
+     size_t count = pipeline->component_count;
+     if (count == 0) {
+         return NEXUS_SUCCESS;
+     }
+     
+     SpsExecution run;
+     run.ctx = ctx;
+     run.pipeline = pipeline;
+     run.output = output;
+     run.chunk_size = chunk_size;
+     atomic_init(&run.abort, false);
+     
+     SpsLink* links = (SpsLink*)calloc(count, sizeof(SpsLink));
+     SpsStage* stages = (SpsStage*)calloc(count, sizeof(SpsStage));
+     NexusResult result = (links && stages) ? NEXUS_SUCCESS : NEXUS_OUT_OF_MEMORY;
+     
+     // Link 0 carries slices of the input, the others carry stage output
+     for (size_t i = 0; i < count && result == NEXUS_SUCCESS; i++) {
+         result = link_init(&links[i], queue_depth, chunk_size, i > 0);
+     }
+     
+     if (result != NEXUS_SUCCESS) {
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate pipeline stage links");
+     }
+     
+     // Start one worker per component
+     for (size_t i = 0; i < count && result == NEXUS_SUCCESS; i++) {
+         stages[i].run = &run;
+         stages[i].component = pipeline->components[i];
+         stages[i].in = &links[i];
+         stages[i].out = i + 1 < count ? &links[i + 1] : NULL;
+         stages[i].error = NEXUS_SUCCESS;
+         
+         if (pthread_create(&stages[i].thread, NULL, stage_main, &stages[i]) != 0) {
+             nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to start worker for component '%s'",
+                      pipeline->components[i]->component_id);
+             result = NEXUS_OUT_OF_MEMORY;
+             break;
+         }
+         stages[i].started = true;
+     }
+     
+     struct timespec start, end;
+     clock_gettime(CLOCK_MONOTONIC, &start);
+     
+     // Feed the first stage; a full link blocks until it drains
+     size_t chunks = 0;
+     if (result == NEXUS_SUCCESS) {
+         const uint8_t* data = (const uint8_t*)input->data;
+         
+         while (input->position < input->size) {
+             size_t remaining = input->size - input->position;
+             SpsChunk chunk = { data + input->position,
+                                remaining < chunk_size ? remaining : chunk_size,
+                                NULL, false };
+             if (!queue_wait_push(&links[0].data, &chunk, &run.abort)) {
+                 break;
+             }
+             input->position += chunk.size;
+             chunks++;
+         }
+         
+         SpsChunk end_chunk = { NULL, 0, NULL, true };
+         queue_wait_push(&links[0].data, &end_chunk, &run.abort);
+     } else {
+         atomic_store(&run.abort, true);
+     }
+     
+     // Wait for every stage to drain
+     for (size_t i = 0; stages && i < count; i++) {
+         if (stages[i].started) {
+             pthread_join(stages[i].thread, NULL);
+         }
+     }
+     
+     clock_gettime(CLOCK_MONOTONIC, &end);
+     
+     // Collect per-stage statistics and report errors from this thread
+     NexusResult first_error = NEXUS_SUCCESS;
+     for (size_t i = 0; stages && i < count; i++) {
+         NexusPipelineComponent* component = pipeline->components[i];
+         
+         if (stages[i].started) {
+             component->busy_time_ms += stages[i].busy_ms;
+             component->idle_time_ms += stages[i].idle_ms;
+             component->backpressure_time_ms += stages[i].backpressure_ms;
+             component->last_execution_time_ms = stages[i].busy_ms;
+             component->last_result = stages[i].error;
+         }
+         
+         // Drop input gathered by components that stopped before the final chunk
+         sps_stream_destroy(component->chunk_buffer);
+         component->chunk_buffer = NULL;
+         
+         if (stages[i].error != NEXUS_SUCCESS) {
+             sps_handle_pipeline_error(ctx, pipeline, stages[i].error, component->component_id);
+             if (first_error == NEXUS_SUCCESS) {
+                 first_error = stages[i].error;
+             }
+         }
+     }
+     
+     if (links) {
+         for (size_t i = 0; i < count; i++) {
+             link_free(&links[i]);
+         }
+     }
+     free(links);
+     free(stages);
+     
+     if (result == NEXUS_SUCCESS) {
+         pipeline->stats.executions++;
+         pipeline->stats.chunks += chunks;
+     }
+     
+     double elapsed_ms = (end.tv_sec - start.tv_sec) * 1000.0 +
+                       (end.tv_nsec - start.tv_nsec) / 1000000.0;
+     
+     nexus_log(ctx, NEXUS_LOG_INFO,
+              "Pipeline streamed %zu chunks through %zu stages in %.2f ms",
+              chunks, count, elapsed_ms);
+     
+     return first_error != NEXUS_SUCCESS ? first_error : result;
+ }
@@ -148,6 +148,72 @@
      return NEXUS_SYMBOL_NOT_FOUND;
  }
  
+ /**
+  * Call chunk execution hook for a component
+  */
+ NexusResult sps_component_execute_chunk(NexusContext* ctx,
+                                        NexusPipelineComponent* component,
+                                        const void* chunk,
+                                        size_t size,
+                                        bool final,
+                                        NexusDataStream* output) {
+     if (!ctx || !component || !output || (size > 0 && !chunk)) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     // Check if initialized
+     if (!component->is_initialized) {
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Component '%s' not initialized", 
+                  component->component_id);
+         return NEXUS_COMPONENT_NOT_INITIALIZED;
+     }
+     
+     // Call chunk function if registered
+     ComponentLifecycleData* data = get_lifecycle_data(component);
+     if (data && data->lifecycle.chunk_func) {
+         NexusResult result = data->lifecycle.chunk_func(component, chunk, size, final,
+                                                         output, data->lifecycle.user_data);
+         
+         if (result != NEXUS_SUCCESS) {
+             nexus_log(ctx, NEXUS_LOG_ERROR, 
+                      "Chunk execution failed for component '%s': %d", 
+                      component->component_id, result);
+         }
+         
+         return result;
+     }
+     
+     // Gather input for components that can only process a whole stream
+     if (size > 0) {
+         if (!component->chunk_buffer) {
+             component->chunk_buffer = sps_stream_create(size);
+             if (!component->chunk_buffer) {
+                 return NEXUS_OUT_OF_MEMORY;
+             }
+         }
+         
+         NexusResult result = sps_stream_write(component->chunk_buffer, chunk, size);
+         if (result != NEXUS_SUCCESS) {
+             return result;
+         }
+     }
+     
+     if (!final) {
+         return NEXUS_SUCCESS;
+     }
+     
+     // Run the process function once over everything gathered
+     NexusDataStream empty = {0};
+     NexusDataStream* input = component->chunk_buffer ? component->chunk_buffer : &empty;
+     NexusResult result = sps_component_execute(ctx, component, input, output);
+     
+     // The gathered input is not needed past the end of the stream
+     sps_stream_destroy(component->chunk_buffer);
+     component->chunk_buffer = NULL;
+     
+     return result;
+ }
+ 
  /**
   * Call termination hook for a component
   */
@@ -11,11 +11,32 @@
  #include "nlink/spsystem/sps_pipeline.h"
  #include "nlink/spsystem/sps_dependency.h"
  #include "nlink/spsystem/sps_lifecycle.h"
+ #include "nlink/spsystem/sps_executor.h"
  #include "nlink/core/common/nexus_core.h"
  #include "nlink/core/common/nexus_loader.h"
+ #include <pthread.h>
  #include <stdlib.h>
  #include <string.h>
  #include <time.h>
+ #include <unistd.h>
+ 
+ /* Worker pool running the lifecycle calls of one dependency level */
+ typedef struct SpsLifecyclePool {
+     pthread_mutex_t lock;
+     pthread_cond_t work_ready;
+     pthread_cond_t work_done;
+     pthread_t* threads;
+     size_t thread_count;
+     NexusContext* ctx;
+     NexusPipeline* pipeline;
+     bool terminate;                      /* Phase of the current batch */
+     const size_t* batch;                 /* Component indices of the current level */
+     size_t batch_count;
+     size_t next;
+     size_t pending;
+     NexusResult* results;                /* Result per component index */
+     bool shutdown;
+ } SpsLifecyclePool;
  
  /* Forward declarations for internal functions */
  static NexusResult load_components(NexusContext* ctx, NexusPipeline* pipeline);
@@ -30,6 +51,27 @@
                                   const char* component_id, 
                                   const char* message);
  static NexusResult abort_components(NexusContext* ctx, NexusPipeline* pipeline);
+ static size_t schedule_levels(const NexusPipeline* pipeline, size_t** level_starts, size_t** level_order);
+ static SpsLifecyclePool* create_lifecycle_pool(NexusContext* ctx, NexusPipeline* pipeline, size_t width);
+ static void destroy_lifecycle_pool(SpsLifecyclePool* pool);
+ static void run_lifecycle_level(SpsLifecyclePool* pool,
+                                 NexusContext* ctx,
+                                 NexusPipeline* pipeline,
+                                 const size_t* batch,
+                                 size_t count,
+                                 bool terminate,
+                                 NexusResult* results);
+ static NexusResult acquire_streams(NexusPipeline* pipeline, size_t default_capacity);
+ static void record_stream_usage(NexusPipeline* pipeline);
+ static NexusResult push_chunk(NexusContext* ctx,
+                               NexusPipeline* pipeline,
+                               size_t index,
+                               const void* data,
+                               size_t size,
+                               bool final,
+                               NexusDataStream* pipeline_output,
+                               size_t chunk_size,
+                               NexusResult* first_error);
  
  /**
   * Create a new pipeline from configuration
@@ -95,22 +137,35 @@
          return NULL;
      }
      
+     // Level of each graph node: one above its deepest dependency
+     size_t* levels = (size_t*)calloc(graph->node_count ? graph->node_count : 1, sizeof(size_t));
+     if (!levels) {
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate component levels");
+         free(pipeline->components);
+         free(ordered_components);
+         sps_free_dependency_graph(graph);
+         free(pipeline);
+         return NULL;
+     }
+     
      // Create component structures in dependency order
      for (size_t i = 0; i < component_count; i++) {
          const char* component_id = ordered_components[i];
          
-         // Find component config
-         NexusPipelineComponentConfig* comp_config = NULL;
-         for (size_t j = 0; j < config->component_count; j++) {
-             if (strcmp(config->components[j]->component_id, component_id) == 0) {
-                 comp_config = config->components[j];
-                 break;
-             }
+         // Find component config through the graph's identifier index
+         size_t node = sps_find_dependency_node(graph, component_id);
+         if (node == SIZE_MAX) {
+             continue;
          }
+         NexusPipelineComponentConfig* comp_config = 
+             (NexusPipelineComponentConfig*)graph->nodes[node]->metadata;
          
-         // Skip if not found (shouldn't happen)
-         if (!comp_config) {
-             continue;
+         // Dependencies were ordered first, so their levels are final
+         for (size_t e = graph->edge_start[node]; e < graph->edge_start[node + 1]; e++) {
+             size_t dependency = graph->edge_targets[e];
+             if (dependency != SIZE_MAX && levels[dependency] + 1 > levels[node]) {
+                 levels[node] = levels[dependency] + 1;
+             }
          }
          
          // Create component
@@ -126,12 +181,15 @@
          component->component_id = comp_config->component_id;
          component->last_result = NEXUS_SUCCESS;
          component->is_initialized = false;
+         component->init_level = levels[node];
+         component->config = comp_config;
          
          // Add to pipeline
          pipeline->components[pipeline->component_count++] = component;
      }
      
      // Clean up
+     free(levels);
      free(ordered_components);
      sps_free_dependency_graph(graph);
      
@@ -186,16 +244,15 @@
      for (size_t i = 0; i < pipeline->component_count; i++) {
          NexusPipelineComponent* component = pipeline->components[i];
          
+         // Keep libraries loaded by an earlier attempt
+         if (component->component) {
+             continue;
+         }
+         
          nexus_log(ctx, NEXUS_LOG_DEBUG, "Loading component '%s'", component->component_id);
          
-         // Find component config
-         NexusPipelineComponentConfig* comp_config = NULL;
-         for (size_t j = 0; j < pipeline->config->component_count; j++) {
-             if (strcmp(pipeline->config->components[j]->component_id, component->component_id) == 0) {
-                 comp_config = pipeline->config->components[j];
-                 break;
-             }
-         }
+         // Configuration was found through the dependency graph at creation
+         NexusPipelineComponentConfig* comp_config = component->config;
          
          // Skip if not found
          if (!comp_config) {
@@ -258,50 +315,305 @@
  }
  
  /**
-  * Initialize components
+  * Look up whether a component is optional
   */
- static NexusResult initialize_components(NexusContext* ctx, NexusPipeline* pipeline) {
+ static bool component_is_optional(const NexusPipelineComponent* component) {
+     return component->config && component->config->optional;
+ }
+ 
+ /**
+  * Group component indices by dependency level
+  *
+  * Counting sort on init_level; components keep pipeline order within a
+  * level. Returns the number of levels.
+  */
+ static size_t schedule_levels(const NexusPipeline* pipeline, size_t** level_starts, size_t** level_order) {
+     size_t level_count = 0;
      for (size_t i = 0; i < pipeline->component_count; i++) {
-         NexusPipelineComponent* component = pipeline->components[i];
-         
-         // Skip components that weren't loaded
-         if (!component->component) {
-             continue;
+         if (pipeline->components[i]->init_level + 1 > level_count) {
+             level_count = pipeline->components[i]->init_level + 1;
+         }
+     }
+     
+     *level_starts = (size_t*)calloc(level_count + 2, sizeof(size_t));
+     *level_order = (size_t*)malloc((pipeline->component_count ? pipeline->component_count : 1) * sizeof(size_t));
+     if (!*level_starts || !*level_order) {
+         free(*level_starts);
+         free(*level_order);
+         *level_starts = NULL;
+         *level_order = NULL;
+         return 0;
+     }
+     
+     size_t* starts = *level_starts;
+     for (size_t i = 0; i < pipeline->component_count; i++) {
+         starts[pipeline->components[i]->init_level + 2]++;
+     }
+     for (size_t l = 2; l <= level_count + 1; l++) {
+         starts[l] += starts[l - 1];
+     }
+     for (size_t i = 0; i < pipeline->component_count; i++) {
+         (*level_order)[starts[pipeline->components[i]->init_level + 1]++] = i;
+     }
+     
+     return level_count;
+ }
+ 
+ /**
+  * Run the lifecycle call of one component
+  */
+ static NexusResult run_lifecycle_call(NexusContext* ctx, NexusPipelineComponent* component, bool terminate) {
+     if (terminate) {
+         if (!component->is_initialized) {
+             return NEXUS_SUCCESS;
          }
          
-         nexus_log(ctx, NEXUS_LOG_DEBUG, "Initializing component '%s'", 
+         nexus_log(ctx, NEXUS_LOG_DEBUG, "Terminating component '%s'", 
                   component->component_id);
          
-         // Call lifecycle initialization
-         NexusResult result = sps_component_initialize(ctx, component);
-         if (result != NEXUS_SUCCESS) {
+         NexusResult result = sps_component_terminate(ctx, component);
+         component->is_initialized = false;
+         return result;
+     }
+     
+     // Skip components that weren't loaded
+     if (!component->component) {
+         return NEXUS_SUCCESS;
+     }
+     
+     nexus_log(ctx, NEXUS_LOG_DEBUG, "Initializing component '%s'", 
+              component->component_id);
+     
+     struct timespec start, end;
+     clock_gettime(CLOCK_MONOTONIC, &start);
+     
+     NexusResult result = sps_component_initialize(ctx, component);
+     
+     clock_gettime(CLOCK_MONOTONIC, &end);
+     component->init_time_ms = (end.tv_sec - start.tv_sec) * 1000.0 + 
+                              (end.tv_nsec - start.tv_nsec) / 1000000.0;
+     
+     if (result == NEXUS_SUCCESS) {
+         component->is_initialized = true;
+     }
+     
+     return result;
+ }
+ 
+ // Body of a lifecycle pool worker thread
+ static void* lifecycle_worker_main(void* arg) {
+     SpsLifecyclePool* pool = (SpsLifecyclePool*)arg;
+     
+     pthread_mutex_lock(&pool->lock);
+     while (true) {
+         while (!pool->shutdown && pool->next >= pool->batch_count) {
+             pthread_cond_wait(&pool->work_ready, &pool->lock);
+         }
+         if (pool->shutdown) {
+             break;
+         }
+         
+         size_t idx = pool->batch[pool->next++];
+         pthread_mutex_unlock(&pool->lock);
+         
+         pool->results[idx] = run_lifecycle_call(pool->ctx, pool->pipeline->components[idx], pool->terminate);
+         
+         pthread_mutex_lock(&pool->lock);
+         if (--pool->pending == 0) {
+             pthread_cond_signal(&pool->work_done);
+         }
+     }
+     pthread_mutex_unlock(&pool->lock);
+     
+     return NULL;
+ }
+ 
+ // Stop and free a lifecycle pool
+ static void destroy_lifecycle_pool(SpsLifecyclePool* pool) {
+     if (!pool) {
+         return;
+     }
+     
+     pthread_mutex_lock(&pool->lock);
+     pool->shutdown = true;
+     pthread_cond_broadcast(&pool->work_ready);
+     pthread_mutex_unlock(&pool->lock);
+     
+     for (size_t i = 0; i < pool->thread_count; i++) {
+         pthread_join(pool->threads[i], NULL);
+     }
+     
+     pthread_cond_destroy(&pool->work_done);
+     pthread_cond_destroy(&pool->work_ready);
+     pthread_mutex_destroy(&pool->lock);
+     free(pool->threads);
+     free(pool);
+ }
+ 
+ // Start enough workers for the widest level; the caller is one of them
+ static SpsLifecyclePool* create_lifecycle_pool(NexusContext* ctx, NexusPipeline* pipeline, size_t width) {
+     size_t threads = pipeline->config->init_threads;
+     if (threads == 0) {
+         long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+         threads = cpus > 1 ? (size_t)cpus : 1;
+     }
+     if (threads > width) {
+         threads = width;
+     }
+     if (threads <= 1) {
+         return NULL;
+     }
+     
+     SpsLifecyclePool* pool = (SpsLifecyclePool*)calloc(1, sizeof(SpsLifecyclePool));
+     if (!pool) {
+         return NULL;
+     }
+     
+     pool->threads = (pthread_t*)malloc((threads - 1) * sizeof(pthread_t));
+     if (!pool->threads) {
+         free(pool);
+         return NULL;
+     }
+     
+     pthread_mutex_init(&pool->lock, NULL);
+     pthread_cond_init(&pool->work_ready, NULL);
+     pthread_cond_init(&pool->work_done, NULL);
+     pool->pipeline = pipeline;
+     
+     for (size_t i = 0; i < threads - 1; i++) {
+         if (pthread_create(&pool->threads[i], NULL, lifecycle_worker_main, pool) != 0) {
+             break;
+         }
+         pool->thread_count++;
+     }
+     
+     if (pool->thread_count == 0) {
+         destroy_lifecycle_pool(pool);
+         return NULL;
+     }
+     
+     nexus_log(ctx, NEXUS_LOG_DEBUG, "Started %zu lifecycle workers for pipeline '%s'",
+              pool->thread_count, pipeline->pipeline_id ? pipeline->pipeline_id : "unnamed");
+     
+     return pool;
+ }
+ 
+ // Run the lifecycle calls of one level, concurrently when a pool is available
+ static void run_lifecycle_level(SpsLifecyclePool* pool,
+                                 NexusContext* ctx,
+                                 NexusPipeline* pipeline,
+                                 const size_t* batch,
+                                 size_t count,
+                                 bool terminate,
+                                 NexusResult* results) {
+     if (!pool || count < 2) {
+         for (size_t i = 0; i < count; i++) {
+             results[batch[i]] = run_lifecycle_call(ctx, pipeline->components[batch[i]], terminate);
+         }
+         return;
+     }
+     
+     pthread_mutex_lock(&pool->lock);
+     pool->ctx = ctx;
+     pool->terminate = terminate;
+     pool->results = results;
+     pool->batch = batch;
+     pool->batch_count = count;
+     pool->next = 0;
+     pool->pending = count;
+     pthread_cond_broadcast(&pool->work_ready);
+     
+     // The calling thread claims components alongside the workers
+     while (pool->next < pool->batch_count) {
+         size_t idx = pool->batch[pool->next++];
+         pthread_mutex_unlock(&pool->lock);
+         
+         results[idx] = run_lifecycle_call(ctx, pipeline->components[idx], terminate);
+         
+         pthread_mutex_lock(&pool->lock);
+         pool->pending--;
+     }
+     
+     while (pool->pending > 0) {
+         pthread_cond_wait(&pool->work_done, &pool->lock);
+     }
+     
+     pool->batch = NULL;
+     pool->batch_count = 0;
+     pool->next = 0;
+     pthread_mutex_unlock(&pool->lock);
+ }
+ 
+ /**
+  * Initialize components level by level
+  */
+ static NexusResult initialize_components(NexusContext* ctx, NexusPipeline* pipeline) {
+     size_t* level_starts = NULL;
+     size_t* level_order = NULL;
+     size_t level_count = schedule_levels(pipeline, &level_starts, &level_order);
+     NexusResult* results = (NexusResult*)calloc(
+         pipeline->component_count ? pipeline->component_count : 1, sizeof(NexusResult));
+     
+     if (!level_starts || !results) {
+         free(level_starts);
+         free(level_order);
+         free(results);
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to schedule component initialization");
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     size_t width = 0;
+     for (size_t l = 0; l < level_count; l++) {
+         if (level_starts[l + 1] - level_starts[l] > width) {
+             width = level_starts[l + 1] - level_starts[l];
+         }
+     }
+     SpsLifecyclePool* pool = create_lifecycle_pool(ctx, pipeline, width);
+     
+     struct timespec start, end;
+     clock_gettime(CLOCK_MONOTONIC, &start);
+     
+     NexusResult final_result = NEXUS_SUCCESS;
+     
+     for (size_t l = 0; l < level_count && final_result == NEXUS_SUCCESS; l++) {
+         const size_t* batch = level_order + level_starts[l];
+         size_t count = level_starts[l + 1] - level_starts[l];
+         
+         run_lifecycle_level(pool, ctx, pipeline, batch, count, false, results);
+         
+         // A required failure stops before the next level
+         for (size_t i = 0; i < count; i++) {
+             NexusPipelineComponent* component = pipeline->components[batch[i]];
+             NexusResult result = results[batch[i]];
+             if (result == NEXUS_SUCCESS) {
+                 continue;
+             }
+             
              nexus_log(ctx, NEXUS_LOG_ERROR, 
                       "Failed to initialize component '%s': %d", 
                       component->component_id, result);
              
-             // Check if component is optional
-             bool is_optional = false;
-             for (size_t j = 0; j < pipeline->config->component_count; j++) {
-                 if (strcmp(pipeline->config->components[j]->component_id, component->component_id) == 0) {
-                     is_optional = pipeline->config->components[j]->optional;
-                     break;
-                 }
-             }
-             
-             if (is_optional) {
+             if (component_is_optional(component)) {
                  nexus_log(ctx, NEXUS_LOG_WARNING, 
                           "Skipping optional component '%s' due to initialization failure", 
                           component->component_id);
-                 continue;
+             } else if (final_result == NEXUS_SUCCESS) {
+                 final_result = result;
              }
-             
-             return result;
          }
-         
-         component->is_initialized = true;
      }
      
-     return NEXUS_SUCCESS;
+     clock_gettime(CLOCK_MONOTONIC, &end);
+     pipeline->stats.init_levels = level_count;
+     pipeline->stats.init_time_ms = (end.tv_sec - start.tv_sec) * 1000.0 + 
+                                   (end.tv_nsec - start.tv_nsec) / 1000000.0;
+     
+     destroy_lifecycle_pool(pool);
+     free(results);
+     free(level_order);
+     free(level_starts);
+     
+     return final_result;
  }
  
  /**
@@ -363,6 +675,19 @@
          return NEXUS_INVALID_PARAMETER;
      }
      
+     // Dispatch to the configured execution mode
+     switch (pipeline->config->execution_mode) {
+         case NEXUS_PIPELINE_EXECUTE_STREAMING:
+             return sps_pipeline_execute_streaming(ctx, pipeline, input, output,
+                                                   pipeline->config->chunk_size);
+         case NEXUS_PIPELINE_EXECUTE_THREADED:
+             return sps_pipeline_execute_threaded(ctx, pipeline, input, output,
+                                                  pipeline->config->chunk_size,
+                                                  pipeline->config->queue_depth);
+         default:
+             break;
+     }
+     
      nexus_log(ctx, NEXUS_LOG_INFO, "Executing pipeline '%s'", 
               pipeline->pipeline_id ? pipeline->pipeline_id : "unnamed");
      
@@ -379,42 +704,17 @@
      struct timespec start, end;
      clock_gettime(CLOCK_MONOTONIC, &start);
      
-     // Create intermediate streams for component communication
-     NexusDataStream** streams = NULL;
-     
-     if (pipeline->component_count > 1) {
-         streams = (NexusDataStream**)calloc(pipeline->component_count - 1, sizeof(NexusDataStream*));
-         if (!streams) {
-             nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to allocate intermediate streams");
-             return NEXUS_OUT_OF_MEMORY;
-         }
-         
-         // Initialize intermediate streams
-         for (size_t i = 0; i < pipeline->component_count - 1; i++) {
-             streams[i] = sps_stream_create(input->capacity > 0 ? input->capacity : 4096);
-             if (!streams[i]) {
-                 // Free already allocated streams
-                 for (size_t j = 0; j < i; j++) {
-                     sps_stream_destroy(streams[j]);
-                 }
-                 free(streams);
-                 
-                 nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to create intermediate stream %zu", i);
-                 return NEXUS_OUT_OF_MEMORY;
-             }
-             
-             // Set format based on component outputs/inputs
-             if (i == 0 && pipeline->config->input_format) {
-                 streams[i]->format = strdup(pipeline->config->input_format);
-             } else {
-                 // In a real system, we'd determine this from component metadata
-                 streams[i]->format = strdup("binary");
-             }
-         }
+     // Fetch intermediate streams for component communication from the pool
+     NexusResult result = acquire_streams(pipeline, input->capacity > 0 ? input->capacity : 4096);
+     if (result != NEXUS_SUCCESS) {
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to acquire intermediate streams");
+         return result;
      }
      
+     NexusPipelineStreamSlot* slots = pipeline->stream_slots;
+     pipeline->stats.executions++;
+     
      // Process each component
-     NexusResult result = NEXUS_SUCCESS;
      NexusResult final_result = NEXUS_SUCCESS;
      
      for (size_t i = 0; i < pipeline->component_count; i++) {
@@ -434,7 +734,7 @@
              comp_input = input;
          } else {
              // Use previous intermediate stream
-             comp_input = streams[i-1];
+             comp_input = slots[i-1].stream;
          }
          
          if (i == pipeline->component_count - 1) {
@@ -442,7 +742,7 @@
              comp_output = output;
          } else {
              // Output to intermediate stream
-             comp_output = streams[i];
+             comp_output = slots[i].stream;
          }
          
          // Execute component
@@ -480,17 +780,177 @@
      nexus_log(ctx, NEXUS_LOG_INFO, 
               "Pipeline executed in %.2f ms", elapsed_ms);
      
-     // Clean up intermediate streams
-     if (streams) {
-         for (size_t i = 0; i < pipeline->component_count - 1; i++) {
-             if (streams[i]) {
-                 sps_stream_destroy(streams[i]);
+     // Remember how much of each intermediate stream was used
+     record_stream_usage(pipeline);
+     
+     return final_result == NEXUS_SUCCESS ? result : final_result;
+ }
+ 
+ /**
+  * Push one chunk into a component and forward what it produced
+  *
+  * The component's output is handed to the next component in chunk-sized
+  * pieces and then cleared, so each intermediate stream only ever holds
+  * the output of a single chunk.
+  */
+ static NexusResult push_chunk(NexusContext* ctx,
+                               NexusPipeline* pipeline,
+                               size_t index,
+                               const void* data,
+                               size_t size,
+                               bool final,
+                               NexusDataStream* pipeline_output,
+                               size_t chunk_size,
+                               NexusResult* first_error) {
+     NexusPipelineComponent* component = pipeline->components[index];
+     bool last = index == pipeline->component_count - 1;
+     NexusDataStream* output = last ? pipeline_output
+                                    : pipeline->stream_slots[index].stream;
+     size_t mark = output->size;
+     
+     // Skipped components produce nothing, as in whole-stream execution
+     if (component->is_initialized && component->component) {
+         NexusResult result = sps_component_execute_chunk(ctx, component, data, size,
+                                                          final, output);
+         
+         if (result != NEXUS_SUCCESS) {
+             sps_handle_pipeline_error(ctx, pipeline, result, component->component_id);
+             
+             if (*first_error == NEXUS_SUCCESS) {
+                 *first_error = result; // Only store the first error
+             }
+             
+             if (!pipeline->config->allow_partial_processing) {
+                 return result;
              }
          }
-         free(streams);
      }
      
-     return final_result == NEXUS_SUCCESS ? result : final_result;
+     if (last) {
+         if (pipeline->chunk_handler && output->size > mark) {
+             pipeline->chunk_handler(pipeline, (const uint8_t*)output->data + mark,
+                                     output->size - mark, pipeline->user_data);
+         }
+         return NEXUS_SUCCESS;
+     }
+     
+     // Track the peak before the stream is drained
+     NexusPipelineStreamSlot* slot = &pipeline->stream_slots[index];
+     if (output->size > slot->high_water) {
+         slot->high_water = output->size;
+     }
+     if (output->size > pipeline->stats.high_water_size) {
+         pipeline->stats.high_water_size = output->size;
+     }
+     
+     for (size_t offset = 0; offset < output->size; offset += chunk_size) {
+         size_t piece = output->size - offset < chunk_size ? output->size - offset : chunk_size;
+         NexusResult result = push_chunk(ctx, pipeline, index + 1,
+                                         (const uint8_t*)output->data + offset, piece,
+                                         false, pipeline_output, chunk_size, first_error);
+         if (result != NEXUS_SUCCESS) {
+             return result;
+         }
+     }
+     sps_stream_clear(output);
+     
+     if (!final) {
+         return NEXUS_SUCCESS;
+     }
+     
+     return push_chunk(ctx, pipeline, index + 1, NULL, 0, true,
+                       pipeline_output, chunk_size, first_error);
+ }
+ 
+ /**
+  * Execute the pipeline by pushing fixed-size chunks through it
+  */
+ NexusResult sps_pipeline_execute_streaming(NexusContext* ctx,
+                                           NexusPipeline* pipeline,
+                                           NexusDataStream* input,
+                                           NexusDataStream* output,
+                                           size_t chunk_size) {
+     if (!ctx || !pipeline || !input || !output) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     if (chunk_size == 0) {
+         chunk_size = SPS_PIPELINE_DEFAULT_CHUNK_SIZE;
+     }
+     
+     nexus_log(ctx, NEXUS_LOG_INFO, "Executing pipeline '%s' in %zu byte chunks", 
+              pipeline->pipeline_id ? pipeline->pipeline_id : "unnamed", chunk_size);
+     
+     // Make sure pipeline is initialized
+     if (!pipeline->is_initialized) {
+         NexusResult result = sps_pipeline_initialize(ctx, pipeline);
+         if (result != NEXUS_SUCCESS) {
+             nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to initialize pipeline: %d", result);
+             return result;
+         }
+     }
+     
+     if (pipeline->component_count == 0) {
+         return NEXUS_SUCCESS;
+     }
+     
+     // Record start time
+     struct timespec start, end;
+     clock_gettime(CLOCK_MONOTONIC, &start);
+     
+     // Intermediate streams only need to hold one chunk's output
+     NexusResult result = acquire_streams(pipeline, chunk_size);
+     if (result != NEXUS_SUCCESS) {
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to acquire intermediate streams");
+         return result;
+     }
+     
+     pipeline->stats.executions++;
+     
+     NexusResult first_error = NEXUS_SUCCESS;
+     size_t chunks = 0;
+     const uint8_t* data = (const uint8_t*)input->data;
+     
+     while (result == NEXUS_SUCCESS && input->position < input->size) {
+         size_t remaining = input->size - input->position;
+         size_t size = remaining < chunk_size ? remaining : chunk_size;
+         
+         result = push_chunk(ctx, pipeline, 0, data + input->position, size,
+                             false, output, chunk_size, &first_error);
+         input->position += size;
+         chunks++;
+     }
+     
+     // Let every component flush what it still holds
+     if (result == NEXUS_SUCCESS) {
+         result = push_chunk(ctx, pipeline, 0, NULL, 0, true, output, chunk_size, &first_error);
+     }
+     
+     pipeline->stats.chunks += chunks;
+     record_stream_usage(pipeline);
+     
+     // Drop input gathered by components that stopped before the final call
+     for (size_t i = 0; i < pipeline->component_count; i++) {
+         sps_stream_destroy(pipeline->components[i]->chunk_buffer);
+         pipeline->components[i]->chunk_buffer = NULL;
+     }
+     
+     // Record end time
+     clock_gettime(CLOCK_MONOTONIC, &end);
+     
+     // Calculate execution time
+     double elapsed_ms = (end.tv_sec - start.tv_sec) * 1000.0 + 
+                       (end.tv_nsec - start.tv_nsec) / 1000000.0;
+     
+     nexus_log(ctx, NEXUS_LOG_INFO, 
+              "Pipeline streamed %zu chunks in %.2f ms", chunks, elapsed_ms);
+     
+     if (result != NEXUS_SUCCESS) {
+         nexus_log(ctx, NEXUS_LOG_ERROR, 
+                  "Stopping pipeline execution due to component failure");
+     }
+     
+     return first_error != NEXUS_SUCCESS ? first_error : result;
  }
  
  /**
@@ -519,6 +979,7 @@
                  }
                  
                  // Free component structure
+                 sps_stream_destroy(pipeline->components[i]->chunk_buffer);
                  free(pipeline->components[i]);
              }
          }
@@ -526,6 +987,10 @@
          free(pipeline->components);
      }
      
+     // Free pooled intermediate streams
+     sps_pipeline_release_streams(pipeline);
+     free(pipeline->stream_slots);
+     
      // Note: We don't free pipeline->config since it's owned by the caller
      
      // Free pipeline structure
@@ -533,37 +998,201 @@
  }
  
  /**
-  * Terminate components
+  * Set the format of a pooled stream, keeping the current copy if it matches
   */
- static NexusResult terminate_components(NexusContext* ctx, NexusPipeline* pipeline) {
-     NexusResult final_result = NEXUS_SUCCESS;
+ static NexusResult set_stream_format(NexusDataStream* stream, const char* format) {
+     if (stream->format && strcmp(stream->format, format) == 0) {
+         return NEXUS_SUCCESS;
+     }
      
-     for (size_t i = 0; i < pipeline->component_count; i++) {
-         NexusPipelineComponent* component = pipeline->components[i];
-         
-         // Skip components that weren't initialized
-         if (!component->is_initialized) {
-             continue;
+     char* copy = strdup(format);
+     if (!copy) {
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     free((void*)stream->format);
+     stream->format = copy;
+     return NEXUS_SUCCESS;
+ }
+ 
+ /**
+  * Prepare one intermediate stream per component boundary
+  *
+  * Streams are kept in the pipeline between executions and reset rather
+  * than recreated. Slots beyond the current component count are released
+  * but keep their high-water marks for when components are added back.
+  */
+ static NexusResult acquire_streams(NexusPipeline* pipeline, size_t default_capacity) {
+     size_t needed = pipeline->component_count > 1 ? pipeline->component_count - 1 : 0;
+     
+     // Release streams left over from removed components
+     for (size_t i = needed; i < pipeline->stream_slot_count; i++) {
+         if (pipeline->stream_slots[i].stream) {
+             sps_stream_destroy(pipeline->stream_slots[i].stream);
+             pipeline->stream_slots[i].stream = NULL;
+         }
+     }
+     
+     // Grow the slot array for added components
+     if (needed > pipeline->stream_slot_count) {
+         NexusPipelineStreamSlot* slots = (NexusPipelineStreamSlot*)realloc(
+             pipeline->stream_slots, needed * sizeof(NexusPipelineStreamSlot)
+         );
+         if (!slots) {
+             return NEXUS_OUT_OF_MEMORY;
          }
          
-         nexus_log(ctx, NEXUS_LOG_DEBUG, "Terminating component '%s'", 
-                  component->component_id);
+         memset(slots + pipeline->stream_slot_count, 0,
+                (needed - pipeline->stream_slot_count) * sizeof(NexusPipelineStreamSlot));
+         pipeline->stream_slots = slots;
+         pipeline->stream_slot_count = needed;
+     }
+     
+     bool from_high_water = pipeline->config->size_streams_from_high_water;
+     
+     for (size_t i = 0; i < needed; i++) {
+         NexusPipelineStreamSlot* slot = &pipeline->stream_slots[i];
          
-         // Call terminate hook
-         NexusResult result = sps_component_terminate(ctx, component);
-         if (result != NEXUS_SUCCESS) {
-             nexus_log(ctx, NEXUS_LOG_ERROR, 
-                      "Failed to terminate component '%s': %d", 
-                      component->component_id, result);
+         if (slot->stream) {
+             sps_stream_reset(slot->stream);
+             pipeline->stats.stream_reuses++;
+         } else {
+             size_t capacity = default_capacity;
+             if (from_high_water) {
+                 // Slots that have not run yet take the pipeline-wide peak
+                 size_t high_water = slot->high_water ? slot->high_water
+                                                      : pipeline->stats.high_water_size;
+                 if (high_water > 0) {
+                     capacity = high_water;
+                 }
+             }
              
-             if (final_result == NEXUS_SUCCESS) {
-                 final_result = result;
+             slot->stream = sps_stream_create(capacity);
+             if (!slot->stream) {
+                 return NEXUS_OUT_OF_MEMORY;
              }
+             pipeline->stats.stream_allocations++;
          }
+         slot->capacity = slot->stream->capacity;
          
-         component->is_initialized = false;
+         // Set format based on component outputs/inputs
+         // In a real system, we'd determine this from component metadata
+         const char* format = (i == 0 && pipeline->config->input_format)
+                                  ? pipeline->config->input_format
+                                  : "binary";
+         if (set_stream_format(slot->stream, format) != NEXUS_SUCCESS) {
+             return NEXUS_OUT_OF_MEMORY;
+         }
      }
      
+     return NEXUS_SUCCESS;
+ }
+ 
+ /**
+  * Update high-water marks and growth counts of the intermediate streams
+  */
+ static void record_stream_usage(NexusPipeline* pipeline) {
+     size_t used = pipeline->component_count > 1 ? pipeline->component_count - 1 : 0;
+     
+     for (size_t i = 0; i < used && i < pipeline->stream_slot_count; i++) {
+         NexusPipelineStreamSlot* slot = &pipeline->stream_slots[i];
+         if (!slot->stream) {
+             continue;
+         }
+         
+         if (slot->stream->capacity != slot->capacity) {
+             pipeline->stats.stream_growths++;
+         }
+         if (slot->stream->size > slot->high_water) {
+             slot->high_water = slot->stream->size;
+         }
+         if (slot->stream->size > pipeline->stats.high_water_size) {
+             pipeline->stats.high_water_size = slot->stream->size;
+         }
+     }
+ }
+ 
+ /**
+  * Release the pooled intermediate streams of a pipeline
+  */
+ void sps_pipeline_release_streams(NexusPipeline* pipeline) {
+     if (!pipeline) {
+         return;
+     }
+     
+     for (size_t i = 0; i < pipeline->stream_slot_count; i++) {
+         if (pipeline->stream_slots[i].stream) {
+             sps_stream_destroy(pipeline->stream_slots[i].stream);
+             pipeline->stream_slots[i].stream = NULL;
+         }
+     }
+ }
+ 
+ /**
+  * Get pipeline execution statistics
+  */
+ NexusResult sps_pipeline_get_stats(const NexusPipeline* pipeline, NexusPipelineStats* stats) {
+     if (!pipeline || !stats) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+     
+     *stats = pipeline->stats;
+     return NEXUS_SUCCESS;
+ }
+ 
+ /**
+  * Terminate components level by level, dependents first
+  */
+ static NexusResult terminate_components(NexusContext* ctx, NexusPipeline* pipeline) {
+     size_t* level_starts = NULL;
+     size_t* level_order = NULL;
+     size_t level_count = schedule_levels(pipeline, &level_starts, &level_order);
+     NexusResult* results = (NexusResult*)calloc(
+         pipeline->component_count ? pipeline->component_count : 1, sizeof(NexusResult));
+     
+     if (!level_starts || !results) {
+         free(level_starts);
+         free(level_order);
+         free(results);
+         nexus_log(ctx, NEXUS_LOG_ERROR, "Failed to schedule component termination");
+         return NEXUS_OUT_OF_MEMORY;
+     }
+     
+     size_t width = 0;
+     for (size_t l = 0; l < level_count; l++) {
+         if (level_starts[l + 1] - level_starts[l] > width) {
+             width = level_starts[l + 1] - level_starts[l];
+         }
+     }
+     SpsLifecyclePool* pool = create_lifecycle_pool(ctx, pipeline, width);
+     
+     NexusResult final_result = NEXUS_SUCCESS;
+     
+     for (size_t l = level_count; l-- > 0; ) {
+         const size_t* batch = level_order + level_starts[l];
+         size_t count = level_starts[l + 1] - level_starts[l];
+         
+         run_lifecycle_level(pool, ctx, pipeline, batch, count, true, results);
+         
+         for (size_t i = 0; i < count; i++) {
+             NexusResult result = results[batch[i]];
+             if (result != NEXUS_SUCCESS) {
+                 nexus_log(ctx, NEXUS_LOG_ERROR, 
+                          "Failed to terminate component '%s': %d", 
+                          pipeline->components[batch[i]]->component_id, result);
+                 
+                 if (final_result == NEXUS_SUCCESS) {
+                     final_result = result;
+                 }
+             }
+         }
+     }
+     
+     destroy_lifecycle_pool(pool);
+     free(results);
+     free(level_order);
+     free(level_starts);
+     
      return final_result;
  }
  
@@ -706,6 +1335,13 @@
          return NEXUS_OUT_OF_MEMORY;
      }
      
+     // Dependencies are unknown, so initialize after every other level
+     for (size_t i = 0; i <= pipeline->component_count; i++) {
+         if (i != insert_idx && pipeline->components[i]->init_level + 1 > component->init_level) {
+             component->init_level = pipeline->components[i]->init_level + 1;
+         }
+     }
+     
      // Add to the pipeline
      pipeline->components[insert_idx] = component;
      pipeline->component_count++;
@@ -804,6 +1440,7 @@
      }
      
      // Free component resources
+     sps_stream_destroy(component->chunk_buffer);
      free((void*)component->component_id);
      free(component);
      
@@ -831,4 +1468,15 @@
      }
      
      pipeline->error_handler = handler ? handler : default_error_handler;
+ }
+ 
+ /**
+  * Set the output handler for streaming execution
+  */
+ void sps_pipeline_set_chunk_handler(NexusPipeline* pipeline, NexusPipelineChunkHandler handler) {
+     if (!pipeline) {
+         return;
+     }
+     
+     pipeline->chunk_handler = handler;
  }
\ No newline at end of file
@@ -302,6 +302,15 @@
      
      // Reset position to beginning
      stream->position = 0;
+     
+     // Drop metadata left by previous users of the stream
+     StreamMetadataEntry* entry = stream->metadata;
+     while (entry) {
+         StreamMetadataEntry* next = entry->next;
+         free_metadata_entry(entry);
+         entry = next;
+     }
+     stream->metadata = NULL;
  }
  
  /**
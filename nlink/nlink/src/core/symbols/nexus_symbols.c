@@ -10,6 +10,7 @@
  */
 
  #include "nlink/core/symbols/nexus_symbols.h"
+ #include "nlink/core/symbols/symbol_index.h"
  #include <stdio.h>
  #include <stdlib.h>
  #include <string.h>
@@ -36,6 +37,8 @@
  // Initialize a symbol table
  void nexus_symbol_table_init(NexusSymbolTable* table, size_t initial_capacity) {
      table->symbols = (NexusSymbol*)malloc(initial_capacity * sizeof(NexusSymbol));
+     table->index = NULL;
+     table->index_capacity = 0;
      if (!table->symbols) {
          // In case of allocation failure, set capacity to 0
          table->capacity = 0;
@@ -94,6 +97,15 @@
      }
      
      symbol->ref_count = 0;
+     symbol->hash = nexus_symbol_hash(name);
+     
+     // Index the new symbol for O(1) lookups
+     if (nexus_symbol_index_insert(table, table->size - 1) != NEXUS_SUCCESS) {
+         free(symbol->name);
+         free(symbol->component_id);
+         table->size--; // Revert the size increase
+         return NEXUS_OUT_OF_MEMORY;
+     }
      
      return NEXUS_SUCCESS;
  }
@@ -104,13 +116,7 @@
          return NULL;
      }
      
-     for (size_t i = 0; i < table->size; i++) {
-         if (strcmp(table->symbols[i].name, name) == 0) {
-             return &table->symbols[i];
-         }
-     }
-     
-     return NULL;
+     return nexus_symbol_index_find(table, name, nexus_symbol_hash(name));
  }
  
  // Resolve a symbol using the three-tier registry
@@ -119,22 +125,25 @@
          return NULL;
      }
      
+     // Hash once and reuse it for all three tiers
+     uint32_t hash = nexus_symbol_hash(name);
+     
      // First check the exported table (highest priority)
-     NexusSymbol* symbol = nexus_symbol_table_find(&registry->exported, name);
+     NexusSymbol* symbol = nexus_symbol_index_find(&registry->exported, name, hash);
      if (symbol) {
          symbol->ref_count++; // Track usage
          return symbol->address;
      }
      
      // Then check the imported table
-     symbol = nexus_symbol_table_find(&registry->imported, name);
+     symbol = nexus_symbol_index_find(&registry->imported, name, hash);
      if (symbol) {
          symbol->ref_count++; // Track usage
          return symbol->address;
      }
      
      // Finally check the global table
-     symbol = nexus_symbol_table_find(&registry->global, name);
+     symbol = nexus_symbol_index_find(&registry->global, name, hash);
      if (symbol) {
          symbol->ref_count++; // Track usage
          return symbol->address;
@@ -150,25 +159,31 @@
          return NEXUS_INVALID_PARAMETER;
      }
      
-     for (size_t i = 0; i < table->size; i++) {
-         if (strcmp(table->symbols[i].name, name) == 0) {
-             // Free allocated memory
-             free(table->symbols[i].name);
-             free(table->symbols[i].component_id);
-             
-             // Move the last element to this position (if not already the last)
-             if (i < table->size - 1) {
-                 table->symbols[i] = table->symbols[table->size - 1];
-             }
-             
-             // Reduce size
-             table->size--;
-             
-             return NEXUS_SUCCESS;
-         }
+     NexusSymbol* symbol = nexus_symbol_index_find(table, name, nexus_symbol_hash(name));
+     if (!symbol) {
+         return NEXUS_NOT_FOUND;
+     }
+     
+     size_t i = (size_t)(symbol - table->symbols);
+     size_t last = table->size - 1;
+     
+     // Drop the index slot while the symbol is still in place
+     nexus_symbol_index_remove(table, i);
+     
+     // Free allocated memory
+     free(symbol->name);
+     free(symbol->component_id);
+     
+     // Move the last element to this position (if not already the last)
+     if (i < last) {
+         table->symbols[i] = table->symbols[last];
+         nexus_symbol_index_relocate(table, last, i);
      }
      
-     return NEXUS_NOT_FOUND;
+     // Reduce size
+     table->size--;
+     
+     return NEXUS_SUCCESS;
  }
  
  // Count used symbols in a table
@@ -225,8 +240,9 @@
          free(table->symbols[i].component_id);
      }
      
-     // Free the symbols array
+     // Free the symbols array and its index
      free(table->symbols);
+     nexus_symbol_index_free(table);
      
      // Reset table state
      table->symbols = NULL;
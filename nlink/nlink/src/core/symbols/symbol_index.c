@@ -0,0 +1,205 @@
+/**
+ * @file symbol_index.c
+ * @brief Hash index implementation for NexusLink symbol tables
+ *
+ * Linear probing over a power-of-two slot array. Deletion uses backward
+ * shifting so the index never accumulates tombstones, which keeps probe
+ * sequences short under the add/remove churn of component unloading.
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+ #include "nlink/core/symbols/symbol_index.h"
+ #include <stdlib.h>
+ #include <string.h>
+
+ // Smallest index allocated for a table
+ #define NEXUS_SYMBOL_INDEX_MIN_CAPACITY (NEXUS_DEFAULT_TABLE_SIZE * 2)
+
+ // Compute the hash of a symbol name
+ uint32_t nexus_symbol_hash(const char* name) {
+     uint32_t hash = 2166136261u;
+
+     while (*name) {
+         hash ^= (uint8_t)*name++;
+         hash *= 16777619u;
+     }
+
+     return hash;
+ }
+
+ // Place a slot without checking the load factor
+ static void index_place(NexusSymbolIndexSlot* slots, size_t capacity,
+                         uint32_t hash, uint32_t position) {
+     size_t mask = capacity - 1;
+     size_t i = hash & mask;
+
+     while (slots[i].position != NEXUS_SYMBOL_INDEX_EMPTY) {
+         i = (i + 1) & mask;
+     }
+
+     slots[i].hash = hash;
+     slots[i].position = position;
+ }
+
+ // Allocate a new slot array and reinsert every symbol of the table
+ static NexusResult index_resize(NexusSymbolTable* table, size_t new_capacity) {
+     NexusSymbolIndexSlot* slots =
+         (NexusSymbolIndexSlot*)malloc(new_capacity * sizeof(NexusSymbolIndexSlot));
+     if (!slots) {
+         return NEXUS_OUT_OF_MEMORY;
+     }
+
+     for (size_t i = 0; i < new_capacity; i++) {
+         slots[i].position = NEXUS_SYMBOL_INDEX_EMPTY;
+     }
+
+     for (size_t i = 0; i < table->size; i++) {
+         index_place(slots, new_capacity, table->symbols[i].hash, (uint32_t)i);
+     }
+
+     free(table->index);
+     table->index = slots;
+     table->index_capacity = new_capacity;
+
+     return NEXUS_SUCCESS;
+ }
+
+ // Find the slot referring to a position of the symbols array
+ static size_t index_slot_of(const NexusSymbolTable* table, size_t position) {
+     size_t mask = table->index_capacity - 1;
+     size_t i = table->symbols[position].hash & mask;
+
+     while (table->index[i].position != NEXUS_SYMBOL_INDEX_EMPTY) {
+         if (table->index[i].position == position) {
+             return i;
+         }
+         i = (i + 1) & mask;
+     }
+
+     return table->index_capacity;
+ }
+
+ // Index the symbol stored at a position of the symbols array
+ NexusResult nexus_symbol_index_insert(NexusSymbolTable* table, size_t position) {
+     if (!table || position >= table->size || position >= NEXUS_SYMBOL_INDEX_EMPTY) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+
+     // Keep the load factor at or below 1/2; the new symbol is already
+     // counted in table->size, so a resize picks it up as well
+     if (table->size * 2 > table->index_capacity) {
+         size_t new_capacity = table->index_capacity ? table->index_capacity * 2
+                                                     : NEXUS_SYMBOL_INDEX_MIN_CAPACITY;
+         while (table->size * 2 > new_capacity) {
+             new_capacity *= 2;
+         }
+         return index_resize(table, new_capacity);
+     }
+
+     index_place(table->index, table->index_capacity,
+                 table->symbols[position].hash, (uint32_t)position);
+
+     return NEXUS_SUCCESS;
+ }
+
+ // Find a symbol using a precomputed name hash
+ NexusSymbol* nexus_symbol_index_find(const NexusSymbolTable* table,
+                                     const char* name,
+                                     uint32_t hash) {
+     if (!table || !name || table->index_capacity == 0) {
+         return NULL;
+     }
+
+     size_t mask = table->index_capacity - 1;
+     size_t i = hash & mask;
+
+     while (table->index[i].position != NEXUS_SYMBOL_INDEX_EMPTY) {
+         if (table->index[i].hash == hash) {
+             NexusSymbol* symbol = &table->symbols[table->index[i].position];
+             if (strcmp(symbol->name, name) == 0) {
+                 return symbol;
+             }
+         }
+         i = (i + 1) & mask;
+     }
+
+     return NULL;
+ }
+
+ // Drop the index slot referring to a position of the symbols array
+ void nexus_symbol_index_remove(NexusSymbolTable* table, size_t position) {
+     if (!table || table->index_capacity == 0 || position >= table->size) {
+         return;
+     }
+
+     size_t hole = index_slot_of(table, position);
+     if (hole == table->index_capacity) {
+         return;
+     }
+
+     // Backward-shift deletion: pull later entries of the probe run into
+     // the hole unless their home slot lies cyclically in (hole, j]
+     size_t mask = table->index_capacity - 1;
+     size_t j = hole;
+     for (;;) {
+         j = (j + 1) & mask;
+         if (table->index[j].position == NEXUS_SYMBOL_INDEX_EMPTY) {
+             break;
+         }
+
+         size_t home = table->index[j].hash & mask;
+         bool stays = (hole <= j) ? (hole < home && home <= j)
+                                  : (hole < home || home <= j);
+         if (!stays) {
+             table->index[hole] = table->index[j];
+             hole = j;
+         }
+     }
+
+     table->index[hole].position = NEXUS_SYMBOL_INDEX_EMPTY;
+ }
+
+ // Repoint the slot of a symbol that moved within the symbols array
+ void nexus_symbol_index_relocate(NexusSymbolTable* table, size_t from, size_t to) {
+     if (!table || table->index_capacity == 0 || from == to) {
+         return;
+     }
+
+     // The slot is located through the symbol's hash, which now lives at 'to'
+     size_t mask = table->index_capacity - 1;
+     size_t i = table->symbols[to].hash & mask;
+
+     while (table->index[i].position != NEXUS_SYMBOL_INDEX_EMPTY) {
+         if (table->index[i].position == from) {
+             table->index[i].position = (uint32_t)to;
+             return;
+         }
+         i = (i + 1) & mask;
+     }
+ }
+
+ // Rebuild the index from the current symbols array
+ NexusResult nexus_symbol_index_rebuild(NexusSymbolTable* table) {
+     if (!table) {
+         return NEXUS_INVALID_PARAMETER;
+     }
+
+     size_t capacity = NEXUS_SYMBOL_INDEX_MIN_CAPACITY;
+     while (table->size * 2 > capacity) {
+         capacity *= 2;
+     }
+
+     return index_resize(table, capacity);
+ }
+
+ // Release the index of a table
+ void nexus_symbol_index_free(NexusSymbolTable* table) {
+     if (!table) {
+         return;
+     }
+
+     free(table->index);
+     table->index = NULL;
+     table->index_capacity = 0;
+ }
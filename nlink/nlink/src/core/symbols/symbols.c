@@ -10,6 +10,7 @@
  */
 
  #include "nlink/core/symbols/nexus_symbols.h"
+ #include "nlink/core/symbols/symbol_index.h"
  #include <stdio.h>
  #include <stdlib.h>
  #include <string.h>
@@ -24,6 +25,8 @@
      }
      
      table->symbols = (NexusSymbol*)malloc(initial_capacity * sizeof(NexusSymbol));
+     table->index = NULL;
+     table->index_capacity = 0;
      if (!table->symbols) {
          // In case of allocation failure, set capacity to 0
          table->capacity = 0;
@@ -100,6 +103,15 @@
      }
      
      symbol->ref_count = 0;
+     symbol->hash = nexus_symbol_hash(name);
+     
+     // Index the new symbol for O(1) lookups
+     if (nexus_symbol_index_insert(table, table->size - 1) != NEXUS_SUCCESS) {
+         free(symbol->name);
+         free(symbol->component_id);
+         table->size--; // Revert the size increase
+         return NEXUS_OUT_OF_MEMORY;
+     }
      
      return NEXUS_SUCCESS;
  }
@@ -110,13 +122,7 @@
          return NULL;
      }
      
-     for (size_t i = 0; i < table->size; i++) {
-         if (strcmp(table->symbols[i].name, name) == 0) {
-             return &table->symbols[i];
-         }
-     }
-     
-     return NULL;
+     return nexus_symbol_index_find(table, name, nexus_symbol_hash(name));
  }
  
  // Resolve a symbol using the three-tier registry
@@ -125,22 +131,25 @@
          return NULL;
      }
      
+     // Hash once and reuse it for all three tiers
+     uint32_t hash = nexus_symbol_hash(name);
+     
      // First check the exported table (highest priority)
-     NexusSymbol* symbol = nexus_symbol_table_find(&registry->exported, name);
+     NexusSymbol* symbol = nexus_symbol_index_find(&registry->exported, name, hash);
      if (symbol) {
          symbol->ref_count++; // Track usage
          return symbol->address;
      }
      
      // Then check the imported table
-     symbol = nexus_symbol_table_find(&registry->imported, name);
+     symbol = nexus_symbol_index_find(&registry->imported, name, hash);
      if (symbol) {
          symbol->ref_count++; // Track usage
          return symbol->address;
      }
      
      // Finally check the global table
-     symbol = nexus_symbol_table_find(&registry->global, name);
+     symbol = nexus_symbol_index_find(&registry->global, name, hash);
      if (symbol) {
          symbol->ref_count++; // Track usage
          return symbol->address;
@@ -156,25 +165,31 @@
          return NEXUS_INVALID_PARAMETER;
      }
      
-     for (size_t i = 0; i < table->size; i++) {
-         if (strcmp(table->symbols[i].name, name) == 0) {
-             // Free allocated memory
-             free(table->symbols[i].name);
-             free(table->symbols[i].component_id);
-             
-             // Move the last element to this position (if not already the last)
-             if (i < table->size - 1) {
-                 table->symbols[i] = table->symbols[table->size - 1];
-             }
-             
-             // Reduce size
-             table->size--;
-             
-             return NEXUS_SUCCESS;
-         }
+     NexusSymbol* symbol = nexus_symbol_index_find(table, name, nexus_symbol_hash(name));
+     if (!symbol) {
+         return NEXUS_NOT_FOUND;
+     }
+     
+     size_t i = (size_t)(symbol - table->symbols);
+     size_t last = table->size - 1;
+     
+     // Drop the index slot while the symbol is still in place
+     nexus_symbol_index_remove(table, i);
+     
+     // Free allocated memory
+     free(symbol->name);
+     free(symbol->component_id);
+     
+     // Move the last element to this position (if not already the last)
+     if (i < last) {
+         table->symbols[i] = table->symbols[last];
+         nexus_symbol_index_relocate(table, last, i);
      }
      
-     return NEXUS_NOT_FOUND;
+     // Reduce size
+     table->size--;
+     
+     return NEXUS_SUCCESS;
  }
  
  // Count used symbols in a table
@@ -231,8 +246,9 @@
          free(table->symbols[i].component_id);
      }
      
-     // Free the symbols array
+     // Free the symbols array and its index
      free(table->symbols);
+     nexus_symbol_index_free(table);
      
      // Reset table state
      table->symbols = NULL;
@@ -264,22 +280,24 @@
          return NULL;
      }
      
+     uint32_t hash = nexus_symbol_hash(name);
+     
      // First check exported table
-     NexusSymbol* symbol = nexus_symbol_table_find(&registry->exported, name);
+     NexusSymbol* symbol = nexus_symbol_index_find(&registry->exported, name, hash);
      if (symbol && symbol->type == expected_type) {
          symbol->ref_count++;
          return symbol->address;
      }
      
      // Then check imported table
-     symbol = nexus_symbol_table_find(&registry->imported, name);
+     symbol = nexus_symbol_index_find(&registry->imported, name, hash);
      if (symbol && symbol->type == expected_type) {
          symbol->ref_count++;
          return symbol->address;
      }
      
      // Finally check global table
-     symbol = nexus_symbol_table_find(&registry->global, name);
+     symbol = nexus_symbol_index_find(&registry->global, name, hash);
      if (symbol && symbol->type == expected_type) {
          symbol->ref_count++;
          return symbol->address;
@@ -373,7 +391,7 @@
          NexusSymbol* import = &registry->imported.symbols[i];
          
          // Find the exporting component
-         NexusSymbol* exported_symbol = nexus_symbol_table_find(&registry->exported, import->name);
+         NexusSymbol* exported_symbol = nexus_symbol_index_find(&registry->exported, import->name, import->hash);
          
          if (exported_symbol) {
              fprintf(file, "  \"%s\" -> \"%s\" [label=\"%s\"];\n", 
@@ -3,12 +3,18 @@
 // Author: Nnamdi Michael Okpala
 
 #include "nlink/core/symbols/nexus_versioned_symbols.h"
+#include "nlink/core/versioning/semver.h"
+
+// Resolution cache sizing
+#define RESOLUTION_CACHE_INITIAL_CAPACITY 64
+#define RESOLUTION_CACHE_MAX_ENTRIES 65536
 
 // Initialize a versioned symbol table
 void versioned_symbol_table_init(VersionedSymbolTable* table, size_t initial_capacity) {
     table->symbols = (VersionedSymbol*)malloc(initial_capacity * sizeof(VersionedSymbol));
     table->capacity = initial_capacity;
     table->size = 0;
+    table->generation = 0;
 }
 
 // Create a new versioned symbol registry
@@ -24,6 +30,10 @@ VersionedSymbolRegistry* nexus_versioned_registry_create() {
     registry->dependencies = NULL;
     registry->deps_count = 0;
     registry->deps_capacity = 0;
+    registry->deps_generation = 0;
+    
+    // Resolution cache is allocated on first use
+    memset(&registry->cache, 0, sizeof(registry->cache));
     
     return registry;
 }
@@ -52,6 +62,10 @@ void versioned_symbol_table_add(VersionedSymbolTable* table,
     symbol->component_id = strdup(component_id);
     symbol->priority = priority;
     symbol->ref_count = 0;
+    symbol->semver = semver_parse(symbol->version);
+    
+    // Invalidates resolutions cached against this table
+    table->generation++;
 }
 
 // Find all symbols with a given name in a table
@@ -109,6 +123,10 @@ void nexus_add_component_dependency(VersionedSymbolRegistry* registry,
     dep->to_id = strdup(depends_on_id);
     dep->version_req = version_constraint ? strdup(version_constraint) : strdup("*");
     dep->optional = optional;
+    dep->constraint = semver_constraint_compile(dep->version_req);
+    
+    // Priorities and constraints of cached resolutions may have changed
+    registry->deps_generation++;
 }
 
 // Get a component's dependencies
@@ -157,6 +175,25 @@ bool nexus_is_direct_dependency(VersionedSymbolRegistry* registry,
     return false;
 }
 
+// Find the dependency edge between two components
+static const ComponentDependency* find_dependency(VersionedSymbolRegistry* registry,
+                                                  const char* component_id,
+                                                  const char* dependency_id) {
+    for (size_t i = 0; i < registry->deps_count; i++) {
+        ComponentDependency* dep = &registry->dependencies[i];
+        if (strcmp(dep->from_id, component_id) == 0 && 
+            strcmp(dep->to_id, dependency_id) == 0) {
+            return dep;
+        }
+    }
+    return NULL;
+}
+
+// Check a pre-parsed symbol version against a compiled constraint
+static bool symbol_satisfies(const VersionedSymbol* symbol, const SemVerConstraint* constraint) {
+    return symbol->semver && semver_constraint_matches(constraint, symbol->semver);
+}
+
 // Find the version constraint for a dependency relationship
 const char* find_version_constraint(VersionedSymbolRegistry* registry,
                                    const char* component_id,
@@ -171,6 +208,173 @@ const char* find_version_constraint(VersionedSymbolRegistry* registry,
     return NULL;
 }
 
+// Registry state that cached resolutions depend on; the imported table is
+// excluded because resolution only appends to it
+static uint64_t resolution_generation(const VersionedSymbolRegistry* registry) {
+    return registry->global.generation + registry->exported.generation +
+           registry->deps_generation;
+}
+
+// Pack a resolution triple into a single key buffer:
+// name '\0' ('+' constraint | '-') '\0' requesting_component
+static size_t resolution_key_pack(char* buffer, size_t buffer_size,
+                                  const char* name,
+                                  const char* version_constraint,
+                                  const char* requesting_component) {
+    size_t name_len = strlen(name);
+    size_t constraint_len = version_constraint ? strlen(version_constraint) : 0;
+    size_t requester_len = requesting_component ? strlen(requesting_component) : 0;
+    size_t length = name_len + 1 + 1 + constraint_len + 1 + requester_len;
+    
+    if (length > buffer_size) {
+        return length;
+    }
+    
+    char* p = buffer;
+    memcpy(p, name, name_len);
+    p += name_len;
+    *p++ = '\0';
+    *p++ = version_constraint ? '+' : '-';
+    memcpy(p, version_constraint ? version_constraint : "", constraint_len);
+    p += constraint_len;
+    *p++ = '\0';
+    memcpy(p, requesting_component ? requesting_component : "", requester_len);
+    
+    return length;
+}
+
+// FNV-1a over the packed key
+static uint32_t resolution_key_hash(const char* key, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (uint8_t)key[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Free all cache entries, keeping the counters
+static void resolution_cache_clear(VersionedResolutionCache* cache) {
+    for (size_t i = 0; i < cache->capacity; i++) {
+        free(cache->entries[i].key);
+    }
+    free(cache->entries);
+    cache->entries = NULL;
+    cache->count = 0;
+    cache->capacity = 0;
+}
+
+// Find the slot for a key (occupied by that key, or the free slot to use)
+static VersionedResolutionEntry* resolution_cache_slot(VersionedResolutionCache* cache,
+                                                       const char* key,
+                                                       size_t length,
+                                                       uint32_t hash) {
+    size_t mask = cache->capacity - 1;
+    size_t i = hash & mask;
+    
+    while (cache->entries[i].key) {
+        VersionedResolutionEntry* entry = &cache->entries[i];
+        if (entry->hash == hash && entry->key_length == length &&
+            memcmp(entry->key, key, length) == 0) {
+            return entry;
+        }
+        i = (i + 1) & mask;
+    }
+    
+    return &cache->entries[i];
+}
+
+// Double the cache, rehashing the existing entries
+static bool resolution_cache_grow(VersionedResolutionCache* cache) {
+    size_t new_capacity = cache->capacity ? cache->capacity * 2
+                                          : RESOLUTION_CACHE_INITIAL_CAPACITY;
+    VersionedResolutionEntry* entries =
+        (VersionedResolutionEntry*)calloc(new_capacity, sizeof(VersionedResolutionEntry));
+    if (!entries) {
+        return false;
+    }
+    
+    for (size_t i = 0; i < cache->capacity; i++) {
+        VersionedResolutionEntry* entry = &cache->entries[i];
+        if (!entry->key) {
+            continue;
+        }
+        size_t j = entry->hash & (new_capacity - 1);
+        while (entries[j].key) {
+            j = (j + 1) & (new_capacity - 1);
+        }
+        entries[j] = *entry;
+    }
+    
+    free(cache->entries);
+    cache->entries = entries;
+    cache->capacity = new_capacity;
+    return true;
+}
+
+// Remember the outcome of a full resolution
+static void resolution_cache_store(VersionedSymbolRegistry* registry,
+                                   const char* key,
+                                   size_t length,
+                                   uint32_t hash,
+                                   VersionedSymbol* symbol) {
+    VersionedResolutionCache* cache = &registry->cache;
+    
+    // Bound memory by starting over once the cache is full
+    if (cache->count >= RESOLUTION_CACHE_MAX_ENTRIES) {
+        resolution_cache_clear(cache);
+    }
+    
+    // Keep the load factor at or below 1/2
+    if ((cache->count + 1) * 2 > cache->capacity && !resolution_cache_grow(cache)) {
+        return;
+    }
+    
+    VersionedResolutionEntry* entry = resolution_cache_slot(cache, key, length, hash);
+    if (!entry->key) {
+        entry->key = (char*)malloc(length);
+        if (!entry->key) {
+            return;
+        }
+        memcpy(entry->key, key, length);
+        entry->key_length = length;
+        entry->hash = hash;
+        cache->count++;
+    }
+    entry->symbol = symbol;
+}
+
+// Drop all memoized resolutions
+void nexus_versioned_registry_invalidate_cache(VersionedSymbolRegistry* registry) {
+    if (!registry) {
+        return;
+    }
+    
+    if (registry->cache.count > 0) {
+        registry->cache.invalidations++;
+    }
+    resolution_cache_clear(&registry->cache);
+    registry->cache.generation = resolution_generation(registry);
+}
+
+// Get resolution cache counters for a registry
+void nexus_versioned_registry_get_cache_stats(const VersionedSymbolRegistry* registry,
+                                             VersionedResolutionCacheStats* stats) {
+    if (!stats) {
+        return;
+    }
+    
+    memset(stats, 0, sizeof(*stats));
+    if (!registry) {
+        return;
+    }
+    
+    stats->hits = registry->cache.hits;
+    stats->misses = registry->cache.misses;
+    stats->invalidations = registry->cache.invalidations;
+    stats->entries = registry->cache.count;
+}
+
 // The core context-aware symbol resolution function
 void* nexus_resolve_versioned_symbol(VersionedSymbolRegistry* registry,
                                     const char* name,
@@ -179,6 +383,53 @@ void* nexus_resolve_versioned_symbol(VersionedSymbolRegistry* registry,
     VersionedSymbol* best_match = NULL;
     int best_priority = -1;
     
+    // Pack the triple into a stack buffer when it fits
+    char key_buffer[256];
+    char* key = key_buffer;
+    size_t key_length = resolution_key_pack(key_buffer, sizeof(key_buffer), name,
+                                            version_constraint, requesting_component);
+    if (key_length > sizeof(key_buffer)) {
+        key = (char*)malloc(key_length);
+        if (key) {
+            resolution_key_pack(key, key_length, name, version_constraint,
+                                requesting_component);
+        }
+    }
+    uint32_t key_hash = key ? resolution_key_hash(key, key_length) : 0;
+    
+    // Flush entries computed against an older registry state
+    if (registry->cache.generation != resolution_generation(registry)) {
+        nexus_versioned_registry_invalidate_cache(registry);
+    }
+    
+    // Serve repeated resolutions from the cache. The first resolution of
+    // the triple already recorded the import, so only usage is tracked here.
+    if (key && registry->cache.count > 0) {
+        VersionedResolutionEntry* entry =
+            resolution_cache_slot(&registry->cache, key, key_length, key_hash);
+        if (entry->key) {
+            registry->cache.hits++;
+            if (key != key_buffer) {
+                free(key);
+            }
+            if (!entry->symbol) {
+                return NULL;
+            }
+            entry->symbol->ref_count++;
+            return entry->symbol->address;
+        }
+    }
+    registry->cache.misses++;
+    
+    // Compile the requested constraint once for all candidates
+    SemVerConstraint* constraint = NULL;
+    if (version_constraint) {
+        constraint = semver_constraint_compile(version_constraint);
+        if (!constraint) {
+            printf("Invalid version constraint '%s' for symbol '%s'\n", version_constraint, name);
+        }
+    }
+    
     // First check the exported table (usually highest priority)
     VersionedSymbol** exported_symbols;
     size_t exported_count = versioned_symbol_table_find_all(&registry->exported, 
@@ -190,7 +441,7 @@ void* nexus_resolve_versioned_symbol(VersionedSymbolRegistry* registry,
         VersionedSymbol* symbol = exported_symbols[i];
         
         // Check version constraint if specified
-        if (version_constraint && !semver_satisfies(symbol->version, version_constraint)) {
+        if (version_constraint && !(constraint && symbol_satisfies(symbol, constraint))) {
             continue;
         }
         
@@ -199,16 +450,15 @@ void* nexus_resolve_versioned_symbol(VersionedSymbolRegistry* registry,
         // 2. Then consider symbol's own priority
         int effective_priority = symbol->priority;
         
-        if (nexus_is_direct_dependency(registry, requesting_component, symbol->component_id)) {
+        const ComponentDependency* dep = find_dependency(registry, requesting_component,
+                                                         symbol->component_id);
+        if (dep) {
             effective_priority += 1000; // Big boost for direct dependencies
-        }
-        
-        // If we have a direct dependency with a version constraint, check that
-        const char* specific_constraint = find_version_constraint(registry, 
-                                                                requesting_component, 
-                                                                symbol->component_id);
-        if (specific_constraint && !semver_satisfies(symbol->version, specific_constraint)) {
-            continue; // Skip this symbol if it doesn't satisfy the specific constraint
+            
+            // If we have a direct dependency with a version constraint, check that
+            if (!(dep->constraint && symbol_satisfies(symbol, dep->constraint))) {
+                continue; // Skip this symbol if it doesn't satisfy the specific constraint
+            }
         }
         
         if (effective_priority > best_priority) {
@@ -246,6 +496,14 @@ void* nexus_resolve_versioned_symbol(VersionedSymbolRegistry* registry,
         printf("Resolved '%s' version '%s' from component '%s' (priority: %d)\n",
                name, best_match->version, best_match->component_id, best_priority);
         
+        semver_constraint_free(constraint);
+        if (key) {
+            resolution_cache_store(registry, key, key_length, key_hash, best_match);
+            if (key != key_buffer) {
+                free(key);
+            }
+        }
+        
         return best_match->address;
     }
     
@@ -263,7 +521,7 @@ void* nexus_resolve_versioned_symbol(VersionedSymbolRegistry* registry,
         VersionedSymbol* symbol = global_symbols[i];
         
         // Check version constraint if specified
-        if (version_constraint && !semver_satisfies(symbol->version, version_constraint)) {
+        if (version_constraint && !(constraint && symbol_satisfies(symbol, constraint))) {
             continue;
         }
         
@@ -285,6 +543,14 @@ void* nexus_resolve_versioned_symbol(VersionedSymbolRegistry* registry,
         printf("Resolved '%s' version '%s' from global table (priority: %d)\n",
                name, best_match->version, best_priority);
         
+        semver_constraint_free(constraint);
+        if (key) {
+            resolution_cache_store(registry, key, key_length, key_hash, best_match);
+            if (key != key_buffer) {
+                free(key);
+            }
+        }
+        
         return best_match->address;
     }
     
@@ -292,6 +558,16 @@ void* nexus_resolve_versioned_symbol(VersionedSymbolRegistry* registry,
     printf("Failed to resolve symbol '%s' with constraint '%s' for component '%s'\n", 
            name, version_constraint ? version_constraint : "any", requesting_component);
     
+    semver_constraint_free(constraint);
+    
+    // Failed resolutions are cached too; adding a symbol invalidates them
+    if (key) {
+        resolution_cache_store(registry, key, key_length, key_hash, NULL);
+        if (key != key_buffer) {
+            free(key);
+        }
+    }
+    
     return NULL;
 }
 
@@ -572,6 +848,7 @@ void versioned_symbol_table_free(VersionedSymbolTable* table) {
         free(table->symbols[i].name);
         free(table->symbols[i].version);
         free(table->symbols[i].component_id);
+        semver_free(table->symbols[i].semver);
     }
     
     free(table->symbols);
@@ -591,8 +868,11 @@ void nexus_versioned_registry_free(VersionedSymbolRegistry* registry) {
         free(registry->dependencies[i].from_id);
         free(registry->dependencies[i].to_id);
         free(registry->dependencies[i].version_req);
+        semver_constraint_free(registry->dependencies[i].constraint);
     }
     free(registry->dependencies);
     
+    resolution_cache_clear(&registry->cache);
+    
     free(registry);
 }
\ No newline at end of file
@@ -4,10 +4,13 @@
  * @copyright Copyright © 2025 OBINexus Computing
  */
 
+#define _GNU_SOURCE
 #include "nlink/core/tactic/abstraction.h"
+#include "nlink/core/tactic/parallel.h"
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <stdatomic.h>
 
 void** nlink_map(void** items, size_t count, nlink_map_fn map_func, 
                 void* context, size_t* result_size) {
@@ -219,4 +222,328 @@ void** nlink_clone_array(void** items, size_t count) {
     memcpy(result, items, count * sizeof(void*));
     
     return result;
-}
\ No newline at end of file
+}
+
+/*
+ * Parallel variants
+ */
+
+#define PARALLEL_GRAIN 2048         // Items per chunk for map, filter and fold
+#define PARALLEL_COMBINE_GRAIN 64   // Partial results combined per chunk
+#define PARALLEL_SORT_RUN 8192      // Items sorted per chunk before merging
+
+typedef struct parallel_map_job {
+    void** items;
+    void** result;
+    nlink_map_fn map_func;
+    void* context;
+    atomic_bool failed;
+} parallel_map_job;
+
+static void parallel_map_chunk(size_t begin, size_t end, size_t chunk, void* arg) {
+    (void)chunk;
+    parallel_map_job* job = arg;
+
+    for (size_t i = begin; i < end && !atomic_load_explicit(&job->failed, memory_order_relaxed); i++) {
+        job->result[i] = job->map_func(job->items[i], job->context);
+        if (job->result[i] == NULL && job->items[i] != NULL) {
+            atomic_store(&job->failed, true);
+        }
+    }
+}
+
+void** nlink_parallel_map(void** items, size_t count, nlink_map_fn map_func,
+                         void* context, size_t* result_size) {
+    if (result_size != NULL) {
+        *result_size = 0;
+    }
+    if (items == NULL || map_func == NULL || count == 0) {
+        return NULL;
+    }
+
+    parallel_map_job job = {
+        .items = items,
+        .result = malloc(count * sizeof(void*)),
+        .map_func = map_func,
+        .context = context,
+    };
+    if (job.result == NULL) {
+        return NULL;
+    }
+    atomic_init(&job.failed, false);
+
+    nlink_parallel_for(count, PARALLEL_GRAIN, parallel_map_chunk, &job);
+
+    // As in nlink_map, a failed mapping fails the whole map
+    if (atomic_load(&job.failed)) {
+        free(job.result);
+        return NULL;
+    }
+
+    if (result_size != NULL) {
+        *result_size = count;
+    }
+    return job.result;
+}
+
+typedef struct parallel_filter_job {
+    void** items;
+    void** result;
+    unsigned char* keep;        // Predicate result per item
+    size_t* offsets;            // Matches per chunk, then each chunk's offset
+    nlink_filter_fn filter_func;
+    void* context;
+} parallel_filter_job;
+
+static void parallel_filter_count_chunk(size_t begin, size_t end, size_t chunk, void* arg) {
+    parallel_filter_job* job = arg;
+    size_t matches = 0;
+
+    for (size_t i = begin; i < end; i++) {
+        job->keep[i] = job->filter_func(job->items[i], job->context) ? 1 : 0;
+        matches += job->keep[i];
+    }
+
+    job->offsets[chunk] = matches;
+}
+
+static void parallel_filter_scatter_chunk(size_t begin, size_t end, size_t chunk, void* arg) {
+    parallel_filter_job* job = arg;
+    void** out = job->result + job->offsets[chunk];
+
+    for (size_t i = begin; i < end; i++) {
+        if (job->keep[i]) {
+            *out++ = job->items[i];
+        }
+    }
+}
+
+void** nlink_parallel_filter(void** items, size_t count, nlink_filter_fn filter_func,
+                            void* context, size_t* result_size) {
+    if (result_size != NULL) {
+        *result_size = 0;
+    }
+    if (items == NULL || filter_func == NULL || count == 0) {
+        return NULL;
+    }
+
+    size_t chunk_count = nlink_parallel_chunk_count(count, PARALLEL_GRAIN);
+    parallel_filter_job job = {
+        .items = items,
+        .keep = malloc(count),
+        .offsets = malloc(chunk_count * sizeof(size_t)),
+        .filter_func = filter_func,
+        .context = context,
+    };
+    if (job.keep == NULL || job.offsets == NULL) {
+        free(job.keep);
+        free(job.offsets);
+        return NULL;
+    }
+
+    // First pass: evaluate the predicate once per item and count matches per chunk
+    nlink_parallel_for(count, PARALLEL_GRAIN, parallel_filter_count_chunk, &job);
+
+    // Exclusive prefix sum turns the counts into output offsets
+    size_t match_count = 0;
+    for (size_t chunk = 0; chunk < chunk_count; chunk++) {
+        size_t matches = job.offsets[chunk];
+        job.offsets[chunk] = match_count;
+        match_count += matches;
+    }
+
+    // Second pass: every chunk writes its matches at its own offset
+    if (match_count > 0) {
+        job.result = malloc(match_count * sizeof(void*));
+        if (job.result != NULL) {
+            nlink_parallel_for(count, PARALLEL_GRAIN, parallel_filter_scatter_chunk, &job);
+        }
+    }
+
+    free(job.keep);
+    free(job.offsets);
+
+    if (job.result != NULL && result_size != NULL) {
+        *result_size = match_count;
+    }
+    return job.result;
+}
+
+typedef struct parallel_fold_job {
+    void** items;
+    void** partials;            // One accumulator per chunk
+    void* identity;
+    nlink_fold_fn fold_func;
+    nlink_fold_fn combine_func;
+    void* context;
+    size_t stride;              // Distance between combined partials
+} parallel_fold_job;
+
+static void parallel_fold_chunk(size_t begin, size_t end, size_t chunk, void* arg) {
+    parallel_fold_job* job = arg;
+    void* accumulator = job->identity;
+
+    for (size_t i = begin; i < end; i++) {
+        accumulator = job->fold_func(accumulator, job->items[i], job->context);
+    }
+
+    job->partials[chunk] = accumulator;
+}
+
+// Combine partials[2k * stride] with partials[(2k + 1) * stride] for each pair k
+static void parallel_combine_chunk(size_t begin, size_t end, size_t chunk, void* arg) {
+    (void)chunk;
+    parallel_fold_job* job = arg;
+
+    for (size_t pair = begin; pair < end; pair++) {
+        size_t left = pair * 2 * job->stride;
+        job->partials[left] = job->combine_func(job->partials[left],
+                                                job->partials[left + job->stride], job->context);
+    }
+}
+
+void* nlink_parallel_fold(void** items, size_t count, void* identity,
+                         nlink_fold_fn fold_func, nlink_fold_fn combine_func, void* context) {
+    if (items == NULL || fold_func == NULL || count == 0) {
+        return identity;  // Nothing to fold, return identity value
+    }
+
+    size_t chunk_count = nlink_parallel_chunk_count(count, PARALLEL_GRAIN);
+    parallel_fold_job job = {
+        .items = items,
+        .partials = malloc(chunk_count * sizeof(void*)),
+        .identity = identity,
+        .fold_func = fold_func,
+        .combine_func = combine_func != NULL ? combine_func : fold_func,
+        .context = context,
+    };
+    if (job.partials == NULL) {
+        // Folding from identity serially gives the same result
+        return nlink_fold(items, count, identity, fold_func, context);
+    }
+
+    nlink_parallel_for(count, PARALLEL_GRAIN, parallel_fold_chunk, &job);
+
+    // Tree reduction: each level halves the number of partials, keeping their order
+    for (job.stride = 1; job.stride < chunk_count; job.stride *= 2) {
+        size_t pairs = (chunk_count - job.stride + 2 * job.stride - 1) / (2 * job.stride);
+        nlink_parallel_for(pairs, PARALLEL_COMBINE_GRAIN, parallel_combine_chunk, &job);
+    }
+
+    void* result = job.partials[0];
+    free(job.partials);
+    return result;
+}
+
+typedef struct parallel_sort_job {
+    void** source;
+    void** target;
+    size_t count;
+    size_t width;               // Length of the sorted runs being merged
+    struct sort_context sort_ctx;
+} parallel_sort_job;
+
+static void parallel_sort_run_chunk(size_t begin, size_t end, size_t chunk, void* arg) {
+    (void)chunk;
+    parallel_sort_job* job = arg;
+
+    qsort_r(job->source + begin, end - begin, sizeof(void*), sort_compare_wrapper, &job->sort_ctx);
+}
+
+static int sort_compare(const parallel_sort_job* job, void* a, void* b) {
+    return job->sort_ctx.compare(a, b, job->sort_ctx.user_context);
+}
+
+/*
+ * Number of items taken from a when merging the first k items of a and
+ * b, preferring a on ties (the co-rank of k)
+ */
+static size_t merge_co_rank(const parallel_sort_job* job, size_t k,
+                            void** a, size_t a_count, void** b, size_t b_count) {
+    size_t i = k < a_count ? k : a_count;
+    size_t j = k - i;
+    size_t i_low = k > b_count ? k - b_count : 0;
+    size_t j_low = k > a_count ? k - a_count : 0;
+
+    for (;;) {
+        if (i > 0 && j < b_count && sort_compare(job, a[i - 1], b[j]) > 0) {
+            // Too many items from a
+            size_t delta = (i - i_low + 1) / 2;
+            j_low = j;
+            i -= delta;
+            j += delta;
+        } else if (j > 0 && i < a_count && sort_compare(job, b[j - 1], a[i]) >= 0) {
+            // Too many items from b
+            size_t delta = (j - j_low + 1) / 2;
+            i_low = i;
+            i += delta;
+            j -= delta;
+        } else {
+            return i;
+        }
+    }
+}
+
+// Produce target[begin, end) by merging the source runs that cover it
+static void parallel_merge_chunk(size_t begin, size_t end, size_t chunk, void* arg) {
+    (void)chunk;
+    parallel_sort_job* job = arg;
+
+    while (begin < end) {
+        size_t low = begin / (2 * job->width) * (2 * job->width);
+        size_t middle = low + job->width < job->count ? low + job->width : job->count;
+        size_t high = middle + job->width < job->count ? middle + job->width : job->count;
+        size_t stop = end < high ? end : high;
+
+        void** a = job->source + low;
+        void** b = job->source + middle;
+        size_t a_count = middle - low;
+        size_t b_count = high - middle;
+        size_t i = merge_co_rank(job, begin - low, a, a_count, b, b_count);
+        size_t j = begin - low - i;
+
+        for (size_t out = begin; out < stop; out++) {
+            if (j >= b_count || (i < a_count && sort_compare(job, a[i], b[j]) <= 0)) {
+                job->target[out] = a[i++];
+            } else {
+                job->target[out] = b[j++];
+            }
+        }
+
+        begin = stop;
+    }
+}
+
+void nlink_parallel_sort(void** items, size_t count, nlink_compare_fn compare, void* context) {
+    if (items == NULL || compare == NULL || count <= 1) {
+        return;  // Nothing to sort
+    }
+
+    void** buffer = count > PARALLEL_SORT_RUN ? malloc(count * sizeof(void*)) : NULL;
+    if (buffer == NULL) {
+        nlink_sort(items, count, compare, context);
+        return;
+    }
+
+    parallel_sort_job job = {
+        .source = items,
+        .target = buffer,
+        .count = count,
+        .sort_ctx = { .compare = compare, .user_context = context },
+    };
+
+    nlink_parallel_for(count, PARALLEL_SORT_RUN, parallel_sort_run_chunk, &job);
+
+    // Merge runs pairwise, alternating between items and buffer
+    for (job.width = PARALLEL_SORT_RUN; job.width < count; job.width *= 2) {
+        nlink_parallel_for(count, PARALLEL_SORT_RUN, parallel_merge_chunk, &job);
+        void** merged = job.target;
+        job.target = job.source;
+        job.source = merged;
+    }
+
+    if (job.source != items) {
+        memcpy(items, job.source, count * sizeof(void*));
+    }
+    free(buffer);
+}
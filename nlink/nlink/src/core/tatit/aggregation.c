@@ -437,4 +437,144 @@ nlink_aggregation_result* nlink_numerical_summary(void** values, size_t count) {
     result->numeric_avg = sum / count;
     
     return result;
-}
\ No newline at end of file
+}
+
+/*
+ * Typed summaries keep SUMMARY_LANES independent minimum, maximum and sum
+ * accumulators. The inner loop over lanes has no dependency between
+ * iterations, so the compiler can turn it into vector instructions
+ * without reassociating floating-point additions.
+ */
+#define SUMMARY_LANES 8
+
+nlink_aggregation_result* nlink_numerical_summary_double(const double* values, size_t count) {
+    if (values == NULL || count == 0) {
+        return NULL;
+    }
+
+    double lane_min[SUMMARY_LANES];
+    double lane_max[SUMMARY_LANES];
+    double lane_sum[SUMMARY_LANES];
+    for (size_t lane = 0; lane < SUMMARY_LANES; lane++) {
+        lane_min[lane] = values[0];
+        lane_max[lane] = values[0];
+        lane_sum[lane] = 0.0;
+    }
+
+    size_t i = 0;
+    for (; i + SUMMARY_LANES <= count; i += SUMMARY_LANES) {
+        for (size_t lane = 0; lane < SUMMARY_LANES; lane++) {
+            double val = values[i + lane];
+            lane_min[lane] = val < lane_min[lane] ? val : lane_min[lane];
+            lane_max[lane] = val > lane_max[lane] ? val : lane_max[lane];
+            lane_sum[lane] += val;
+        }
+    }
+
+    double min_val = lane_min[0];
+    double max_val = lane_max[0];
+    double sum = 0.0;
+    for (size_t lane = 0; lane < SUMMARY_LANES; lane++) {
+        min_val = lane_min[lane] < min_val ? lane_min[lane] : min_val;
+        max_val = lane_max[lane] > max_val ? lane_max[lane] : max_val;
+        sum += lane_sum[lane];
+    }
+    for (; i < count; i++) {
+        min_val = values[i] < min_val ? values[i] : min_val;
+        max_val = values[i] > max_val ? values[i] : max_val;
+        sum += values[i];
+    }
+
+    nlink_aggregation_result* result = malloc(sizeof(nlink_aggregation_result));
+    double* min = malloc(sizeof(double));
+    double* max = malloc(sizeof(double));
+    double* avg = malloc(sizeof(double));
+
+    if (result == NULL || min == NULL || max == NULL || avg == NULL) {
+        free(min);
+        free(max);
+        free(avg);
+        free(result);
+        return NULL;
+    }
+
+    memset(result, 0, sizeof(nlink_aggregation_result));
+    *min = min_val;
+    *max = max_val;
+    *avg = sum / count;
+
+    result->count = count;
+    result->min = min;
+    result->max = max;
+    result->average = avg;
+    result->numeric_sum = sum;
+    result->numeric_avg = sum / count;
+
+    return result;
+}
+
+nlink_aggregation_result* nlink_numerical_summary_int64(const int64_t* values, size_t count) {
+    if (values == NULL || count == 0) {
+        return NULL;
+    }
+
+    int64_t lane_min[SUMMARY_LANES];
+    int64_t lane_max[SUMMARY_LANES];
+    uint64_t lane_sum[SUMMARY_LANES];  // Unsigned so that overflow wraps
+    for (size_t lane = 0; lane < SUMMARY_LANES; lane++) {
+        lane_min[lane] = values[0];
+        lane_max[lane] = values[0];
+        lane_sum[lane] = 0;
+    }
+
+    size_t i = 0;
+    for (; i + SUMMARY_LANES <= count; i += SUMMARY_LANES) {
+        for (size_t lane = 0; lane < SUMMARY_LANES; lane++) {
+            int64_t val = values[i + lane];
+            lane_min[lane] = val < lane_min[lane] ? val : lane_min[lane];
+            lane_max[lane] = val > lane_max[lane] ? val : lane_max[lane];
+            lane_sum[lane] += (uint64_t)val;
+        }
+    }
+
+    int64_t min_val = lane_min[0];
+    int64_t max_val = lane_max[0];
+    uint64_t sum = 0;
+    for (size_t lane = 0; lane < SUMMARY_LANES; lane++) {
+        min_val = lane_min[lane] < min_val ? lane_min[lane] : min_val;
+        max_val = lane_max[lane] > max_val ? lane_max[lane] : max_val;
+        sum += lane_sum[lane];
+    }
+    for (; i < count; i++) {
+        min_val = values[i] < min_val ? values[i] : min_val;
+        max_val = values[i] > max_val ? values[i] : max_val;
+        sum += (uint64_t)values[i];
+    }
+
+    nlink_aggregation_result* result = malloc(sizeof(nlink_aggregation_result));
+    int64_t* min = malloc(sizeof(int64_t));
+    int64_t* max = malloc(sizeof(int64_t));
+    double* avg = malloc(sizeof(double));
+
+    if (result == NULL || min == NULL || max == NULL || avg == NULL) {
+        free(min);
+        free(max);
+        free(avg);
+        free(result);
+        return NULL;
+    }
+
+    memset(result, 0, sizeof(nlink_aggregation_result));
+    *min = min_val;
+    *max = max_val;
+    *avg = (double)(int64_t)sum / count;
+
+    result->count = count;
+    result->min = min;
+    result->max = max;
+    result->average = avg;
+    result->numeric_sum = (double)(int64_t)sum;
+    result->numeric_avg = *avg;
+
+    return result;
+}
@@ -0,0 +1,227 @@
+/**
+ * @file parallel.c
+ * @brief Implementation of the shared parallel execution backend
+ * @copyright Copyright © 2025 OBINexus Computing
+ *
+ * Worker threads sleep on a condition variable between loops. Starting a
+ * loop publishes a job and bumps a generation counter; every worker then
+ * claims chunks through an atomic index until none remain and reports
+ * back, so the caller knows no worker still references the job when it
+ * returns.
+ */
+
+#include "nlink/core/tactic/parallel.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define PARALLEL_MAX_THREADS 64
+
+typedef struct parallel_job {
+    nlink_parallel_chunk_fn chunk_fn;
+    void* context;
+    size_t count;
+    size_t grain;
+    size_t chunk_count;
+    atomic_size_t next_chunk;
+} parallel_job;
+
+typedef struct parallel_pool {
+    pthread_mutex_t submit_lock;    // Held while a loop runs on the pool
+    pthread_mutex_t lock;           // Guards the fields below
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+    pthread_t* threads;
+    size_t worker_count;            // Started workers, excluding the caller
+    size_t requested;               // Requested thread count (0 = online CPUs)
+    bool started;
+    bool shutdown;
+    parallel_job* job;
+    size_t generation;
+    size_t busy;                    // Workers still running the current job
+} parallel_pool;
+
+static parallel_pool pool = {
+    .submit_lock = PTHREAD_MUTEX_INITIALIZER,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .work_cond = PTHREAD_COND_INITIALIZER,
+    .done_cond = PTHREAD_COND_INITIALIZER,
+};
+
+static size_t resolve_thread_count(size_t requested) {
+    size_t count = requested;
+
+    if (count == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        count = cpus > 0 ? (size_t)cpus : 1;
+    }
+
+    return count > PARALLEL_MAX_THREADS ? PARALLEL_MAX_THREADS : count;
+}
+
+static void run_chunks(parallel_job* job) {
+    size_t chunk;
+    while ((chunk = atomic_fetch_add(&job->next_chunk, 1)) < job->chunk_count) {
+        size_t begin = chunk * job->grain;
+        size_t end = job->count - begin > job->grain ? begin + job->grain : job->count;
+        job->chunk_fn(begin, end, chunk, job->context);
+    }
+}
+
+static void* worker_main(void* arg) {
+    size_t seen = (size_t)(uintptr_t)arg;
+
+    pthread_mutex_lock(&pool.lock);
+    for (;;) {
+        while (!pool.shutdown && pool.generation == seen) {
+            pthread_cond_wait(&pool.work_cond, &pool.lock);
+        }
+        if (pool.shutdown) {
+            break;
+        }
+
+        seen = pool.generation;
+        parallel_job* job = pool.job;
+        pthread_mutex_unlock(&pool.lock);
+
+        run_chunks(job);
+
+        pthread_mutex_lock(&pool.lock);
+        if (--pool.busy == 0) {
+            pthread_cond_signal(&pool.done_cond);
+        }
+    }
+    pthread_mutex_unlock(&pool.lock);
+
+    return NULL;
+}
+
+// Start the workers; called with submit_lock held
+static void start_pool(void) {
+    size_t wanted = resolve_thread_count(pool.requested) - 1;
+    pthread_t* threads = wanted > 0 ? malloc(wanted * sizeof(pthread_t)) : NULL;
+    size_t started = 0;
+
+    pthread_mutex_lock(&pool.lock);
+    size_t generation = pool.generation;
+    pthread_mutex_unlock(&pool.lock);
+
+    // Workers start from the current generation, so they wait for the next job
+    for (; threads != NULL && started < wanted; started++) {
+        if (pthread_create(&threads[started], NULL, worker_main, (void*)(uintptr_t)generation) != 0) {
+            break;
+        }
+    }
+
+    pthread_mutex_lock(&pool.lock);
+    pool.threads = threads;
+    pool.worker_count = started;
+    pool.started = true;
+    pthread_mutex_unlock(&pool.lock);
+}
+
+// Stop and join the workers; called with submit_lock held
+static void stop_pool(void) {
+    pthread_mutex_lock(&pool.lock);
+    if (!pool.started) {
+        pthread_mutex_unlock(&pool.lock);
+        return;
+    }
+    pool.shutdown = true;
+    pthread_cond_broadcast(&pool.work_cond);
+    pthread_mutex_unlock(&pool.lock);
+
+    for (size_t i = 0; i < pool.worker_count; i++) {
+        pthread_join(pool.threads[i], NULL);
+    }
+
+    pthread_mutex_lock(&pool.lock);
+    free(pool.threads);
+    pool.threads = NULL;
+    pool.worker_count = 0;
+    pool.started = false;
+    pool.shutdown = false;
+    pthread_mutex_unlock(&pool.lock);
+}
+
+size_t nlink_parallel_chunk_count(size_t count, size_t grain) {
+    if (grain == 0) {
+        grain = 1;
+    }
+
+    return count / grain + (count % grain != 0);
+}
+
+void nlink_parallel_for(size_t count, size_t grain, nlink_parallel_chunk_fn chunk_fn, void* context) {
+    if (count == 0 || chunk_fn == NULL) {
+        return;
+    }
+
+    parallel_job job = {
+        .chunk_fn = chunk_fn,
+        .context = context,
+        .count = count,
+        .grain = grain > 0 ? grain : 1,
+        .chunk_count = nlink_parallel_chunk_count(count, grain),
+    };
+    atomic_init(&job.next_chunk, 0);
+
+    // Small loops, and loops started while the pool is busy, run inline
+    if (job.chunk_count == 1 || pthread_mutex_trylock(&pool.submit_lock) != 0) {
+        run_chunks(&job);
+        return;
+    }
+
+    if (!pool.started) {
+        start_pool();
+    }
+
+    if (pool.worker_count == 0) {
+        run_chunks(&job);
+        pthread_mutex_unlock(&pool.submit_lock);
+        return;
+    }
+
+    pthread_mutex_lock(&pool.lock);
+    pool.job = &job;
+    pool.busy = pool.worker_count;
+    pool.generation++;
+    pthread_cond_broadcast(&pool.work_cond);
+    pthread_mutex_unlock(&pool.lock);
+
+    run_chunks(&job);
+
+    pthread_mutex_lock(&pool.lock);
+    while (pool.busy > 0) {
+        pthread_cond_wait(&pool.done_cond, &pool.lock);
+    }
+    pool.job = NULL;
+    pthread_mutex_unlock(&pool.lock);
+
+    pthread_mutex_unlock(&pool.submit_lock);
+}
+
+void nlink_parallel_set_threads(size_t thread_count) {
+    pthread_mutex_lock(&pool.submit_lock);
+    stop_pool();
+    pthread_mutex_lock(&pool.lock);
+    pool.requested = thread_count;
+    pthread_mutex_unlock(&pool.lock);
+    pthread_mutex_unlock(&pool.submit_lock);
+}
+
+size_t nlink_parallel_get_threads(void) {
+    pthread_mutex_lock(&pool.lock);
+    size_t count = pool.started ? pool.worker_count + 1 : resolve_thread_count(pool.requested);
+    pthread_mutex_unlock(&pool.lock);
+
+    return count;
+}
+
+void nlink_parallel_shutdown(void) {
+    pthread_mutex_lock(&pool.submit_lock);
+    stop_pool();
+    pthread_mutex_unlock(&pool.submit_lock);
+}
@@ -0,0 +1,694 @@
+/**
+ * @file parallel_traversal.c
+ * @brief Implementation of parallel traversal tactics
+ * @copyright Copyright © 2025 OBINexus Computing
+ *
+ * Work-stealing walks keep one deque of pending nodes per thread: the
+ * owner pops its newest node, so each thread works depth-first, and idle
+ * threads steal the oldest node of another deque, which tends to be the
+ * root of a large subtree. Breadth-first search expands one frontier at a
+ * time with all threads claiming chunks of it.
+ *
+ * Both run on the shared pool from parallel.c: each worker is one chunk
+ * of an nlink_parallel_for loop, so no threads are created per call. A
+ * worker never waits for another worker to start, so the walks finish
+ * even when the pool runs fewer chunks at once than there are workers.
+ */
+
+#include "nlink/core/tactic/traversal.h"
+#include "nlink/core/tactic/parallel.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#define PARALLEL_DEQUE_CAPACITY 256
+#define FRONTIER_CHUNK 64
+
+/**
+ * Growable node array, one per thread for results and frontiers
+ */
+typedef struct node_list {
+    void** items;
+    size_t count;
+    size_t capacity;
+} node_list;
+
+static bool node_list_push(node_list* list, void* node) {
+    if (list->count == list->capacity) {
+        size_t capacity = list->capacity ? list->capacity * 2 : 256;
+        void** items = realloc(list->items, capacity * sizeof(void*));
+        if (items == NULL) {
+            return false;
+        }
+        list->items = items;
+        list->capacity = capacity;
+    }
+
+    list->items[list->count++] = node;
+    return true;
+}
+
+// Copy a list to dest; returns the number of items copied
+static size_t node_list_copy(void** dest, const node_list* list) {
+    if (list->count > 0) {
+        memcpy(dest, list->items, list->count * sizeof(void*));
+    }
+    return list->count;
+}
+
+/**
+ * Per-thread collected results
+ */
+typedef struct result_buffer {
+    node_list nodes;
+    node_list results;
+} result_buffer;
+
+static bool result_buffer_add(result_buffer* buffer, void* node, void* value) {
+    return node_list_push(&buffer->nodes, node) && node_list_push(&buffer->results, value);
+}
+
+/**
+ * Atomic visited bits indexed by node identifier
+ */
+typedef struct visited_bits {
+    _Atomic(uint64_t)* words;
+    size_t node_count;
+} visited_bits;
+
+static bool visited_bits_init(visited_bits* bits, size_t node_count) {
+    size_t words = (node_count + 63) / 64;
+    bits->words = malloc((words ? words : 1) * sizeof(*bits->words));
+    bits->node_count = node_count;
+    if (bits->words == NULL) {
+        return false;
+    }
+
+    for (size_t i = 0; i < words; i++) {
+        atomic_init(&bits->words[i], 0);
+    }
+    return true;
+}
+
+/**
+ * Claim a node; returns 1 if this call set its bit, 0 if it was already
+ * set and -1 if its identifier is out of range
+ */
+static int visited_bits_claim(visited_bits* bits, size_t id) {
+    if (id >= bits->node_count) {
+        return -1;
+    }
+
+    uint64_t mask = (uint64_t)1 << (id % 64);
+    _Atomic(uint64_t)* word = &bits->words[id / 64];
+    if (atomic_load_explicit(word, memory_order_relaxed) & mask) {
+        return 0;
+    }
+
+    return (atomic_fetch_or_explicit(word, mask, memory_order_relaxed) & mask) ? 0 : 1;
+}
+
+// Workers per walk: the configured limit, capped by the shared pool
+static size_t parallel_thread_count(const nlink_parallel_traversal_config* config) {
+    size_t count = nlink_parallel_get_threads();
+
+    if (config->max_threads > 0 && config->max_threads < count) {
+        count = config->max_threads;
+    }
+
+    return count;
+}
+
+/**
+ * Concatenate per-thread result buffers into a traversal result
+ */
+static nlink_traversal_result* merge_results(result_buffer* buffers, size_t count) {
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        total += buffers[i].nodes.count;
+    }
+
+    nlink_traversal_result* result = malloc(sizeof(nlink_traversal_result));
+    if (result == NULL) {
+        return NULL;
+    }
+
+    size_t capacity = total > 0 ? total : 1;
+    result->nodes = malloc(capacity * sizeof(void*));
+    result->results = malloc(capacity * sizeof(void*));
+    if (result->nodes == NULL || result->results == NULL) {
+        nlink_traversal_result_free(result);
+        return NULL;
+    }
+
+    result->count = 0;
+    result->capacity = capacity;
+    for (size_t i = 0; i < count; i++) {
+        node_list_copy(result->results + result->count, &buffers[i].results);
+        result->count += node_list_copy(result->nodes + result->count, &buffers[i].nodes);
+    }
+
+    return result;
+}
+
+static void free_result_buffers(result_buffer* buffers, size_t count) {
+    for (size_t i = 0; buffers != NULL && i < count; i++) {
+        free(buffers[i].nodes.items);
+        free(buffers[i].results.items);
+    }
+    free(buffers);
+}
+
+nlink_parallel_traversal_config* nlink_parallel_traversal_config_create(
+    nlink_visitor_fn visitor,
+    nlink_node_getter_fn get_child,
+    nlink_child_count_fn get_child_count,
+    void* context
+) {
+    if (visitor == NULL || get_child == NULL || get_child_count == NULL) {
+        return NULL;
+    }
+
+    nlink_parallel_traversal_config* config = calloc(1, sizeof(nlink_parallel_traversal_config));
+    if (config == NULL) {
+        return NULL;
+    }
+
+    config->visitor = visitor;
+    config->get_child = get_child;
+    config->get_child_count = get_child_count;
+    config->context = context;
+    config->collect_results = true;  // Default: collect results
+
+    return config;
+}
+
+void nlink_parallel_traversal_config_set_ids(
+    nlink_parallel_traversal_config* config,
+    nlink_node_id_fn get_id,
+    size_t node_count
+) {
+    if (config == NULL) {
+        return;
+    }
+
+    config->get_id = get_id;
+    config->node_count = node_count;
+}
+
+void nlink_parallel_traversal_config_set_threads(
+    nlink_parallel_traversal_config* config,
+    size_t max_threads
+) {
+    if (config == NULL) {
+        return;
+    }
+
+    config->max_threads = max_threads;
+}
+
+void nlink_parallel_traversal_config_free(nlink_parallel_traversal_config* config) {
+    free(config);
+}
+
+/**
+ * Work-stealing walk
+ */
+typedef struct steal_deque {
+    pthread_mutex_t lock;
+    void** items;
+    size_t head;
+    size_t tail;
+    size_t capacity;
+} steal_deque;
+
+typedef struct steal_context {
+    const nlink_parallel_traversal_config* config;
+    visited_bits* visited;      // NULL for tree walks
+    steal_deque* deques;
+    result_buffer* buffers;
+    size_t worker_count;
+    atomic_size_t pending;      // Nodes queued or being expanded
+    atomic_size_t queued;       // Nodes waiting in a deque
+    atomic_bool stop;           // An allocation failed or an identifier was out of range
+    pthread_mutex_t idle_lock;
+    pthread_cond_t idle_cond;
+    atomic_size_t sleepers;     // Workers waiting on idle_cond
+} steal_context;
+
+typedef struct steal_worker {
+    steal_context* context;
+    size_t index;
+} steal_worker;
+
+static void steal_wake(steal_context* context, bool all) {
+    // Sleepers register before checking for work, so none can be missed here
+    if (atomic_load(&context->sleepers) == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&context->idle_lock);
+    if (all) {
+        pthread_cond_broadcast(&context->idle_cond);
+    } else {
+        pthread_cond_signal(&context->idle_cond);
+    }
+    pthread_mutex_unlock(&context->idle_lock);
+}
+
+static void steal_fail(steal_context* context) {
+    atomic_store(&context->stop, true);
+    steal_wake(context, true);
+}
+
+// Queue nodes on the worker's own deque
+static bool steal_push(steal_worker* worker, void** nodes, size_t count) {
+    steal_context* context = worker->context;
+    steal_deque* deque = &context->deques[worker->index];
+    bool ok = true;
+
+    atomic_fetch_add(&context->pending, count);
+    pthread_mutex_lock(&deque->lock);
+    if (deque->tail + count > deque->capacity) {
+        if (deque->head > 0) {
+            memmove(deque->items, deque->items + deque->head, (deque->tail - deque->head) * sizeof(void*));
+            deque->tail -= deque->head;
+            deque->head = 0;
+        }
+        size_t capacity = deque->capacity;
+        while (deque->tail + count > capacity) {
+            capacity *= 2;
+        }
+        if (capacity != deque->capacity) {
+            void** items = realloc(deque->items, capacity * sizeof(void*));
+            if (items != NULL) {
+                deque->items = items;
+                deque->capacity = capacity;
+            } else {
+                ok = false;
+            }
+        }
+    }
+    if (ok) {
+        memcpy(deque->items + deque->tail, nodes, count * sizeof(void*));
+        deque->tail += count;
+        atomic_fetch_add(&context->queued, count);
+    }
+    pthread_mutex_unlock(&deque->lock);
+
+    if (!ok) {
+        atomic_fetch_sub(&context->pending, count);
+        steal_fail(context);
+        return false;
+    }
+    steal_wake(context, count > 1);
+    return true;
+}
+
+// Pop from the worker's own deque, or steal from another
+static bool steal_take(steal_worker* worker, void** node) {
+    steal_context* context = worker->context;
+
+    for (size_t k = 0; k < context->worker_count; k++) {
+        steal_deque* deque = &context->deques[(worker->index + k) % context->worker_count];
+        bool found = false;
+
+        pthread_mutex_lock(&deque->lock);
+        if (deque->head < deque->tail) {
+            *node = k == 0 ? deque->items[--deque->tail] : deque->items[deque->head++];
+            if (deque->head == deque->tail) {
+                deque->head = deque->tail = 0;
+            }
+            found = true;
+        }
+        pthread_mutex_unlock(&deque->lock);
+
+        if (found) {
+            atomic_fetch_sub(&context->queued, 1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Visit a node and queue its unclaimed children
+static void steal_expand(steal_worker* worker, void* node, node_list* children) {
+    steal_context* context = worker->context;
+    const nlink_parallel_traversal_config* config = context->config;
+
+    if (config->should_traverse != NULL && !config->should_traverse(node, config->context)) {
+        return;
+    }
+
+    void* visit_result = config->visitor(node, config->context);
+    if (config->collect_results &&
+        !result_buffer_add(&context->buffers[worker->index], node, visit_result)) {
+        steal_fail(context);
+        return;
+    }
+
+    // Push children in reverse order so the owner pops them first to last
+    children->count = 0;
+    size_t child_count = config->get_child_count(node, config->context);
+    for (size_t i = child_count; i > 0; i--) {
+        void* child = config->get_child(node, i - 1, config->context);
+        if (child == NULL) {
+            continue;
+        }
+        if (context->visited != NULL) {
+            int claimed = visited_bits_claim(context->visited, config->get_id(child, config->context));
+            if (claimed < 0) {
+                steal_fail(context);
+                return;
+            }
+            if (claimed == 0) {
+                continue;
+            }
+        }
+        if (!node_list_push(children, child)) {
+            steal_fail(context);
+            return;
+        }
+    }
+
+    if (children->count > 0) {
+        steal_push(worker, children->items, children->count);
+    }
+}
+
+static void steal_worker_run(steal_worker* worker) {
+    steal_context* context = worker->context;
+    node_list children = { NULL, 0, 0 };
+
+    for (;;) {
+        void* node;
+        if (steal_take(worker, &node)) {
+            if (!atomic_load(&context->stop)) {
+                steal_expand(worker, node, &children);
+            }
+            if (atomic_fetch_sub(&context->pending, 1) == 1) {
+                steal_wake(context, true);
+            }
+            continue;
+        }
+
+        pthread_mutex_lock(&context->idle_lock);
+        atomic_fetch_add(&context->sleepers, 1);
+        while (atomic_load(&context->queued) == 0 &&
+               atomic_load(&context->pending) > 0 &&
+               !atomic_load(&context->stop)) {
+            pthread_cond_wait(&context->idle_cond, &context->idle_lock);
+        }
+        atomic_fetch_sub(&context->sleepers, 1);
+        bool done = atomic_load(&context->pending) == 0 || atomic_load(&context->stop);
+        pthread_mutex_unlock(&context->idle_lock);
+
+        if (done) {
+            break;
+        }
+    }
+
+    free(children.items);
+}
+
+// One chunk of the walk's parallel loop is one worker
+static void steal_chunk(size_t begin, size_t end, size_t chunk, void* arg) {
+    (void)begin;
+    (void)end;
+    steal_worker worker = { arg, chunk };
+    steal_worker_run(&worker);
+}
+
+static nlink_traversal_result* steal_traverse(
+    void* root,
+    const nlink_parallel_traversal_config* config,
+    visited_bits* visited
+) {
+    steal_context context;
+    memset(&context, 0, sizeof(context));
+    context.config = config;
+    context.visited = visited;
+    context.worker_count = parallel_thread_count(config);
+    atomic_init(&context.pending, 0);
+    atomic_init(&context.queued, 0);
+    atomic_init(&context.stop, false);
+    atomic_init(&context.sleepers, 0);
+    pthread_mutex_init(&context.idle_lock, NULL);
+    pthread_cond_init(&context.idle_cond, NULL);
+
+    context.deques = calloc(context.worker_count, sizeof(steal_deque));
+    context.buffers = calloc(context.worker_count, sizeof(result_buffer));
+    bool ok = context.deques != NULL && context.buffers != NULL;
+
+    size_t ready = 0;
+    for (; ok && ready < context.worker_count; ready++) {
+        steal_deque* deque = &context.deques[ready];
+        pthread_mutex_init(&deque->lock, NULL);
+        deque->items = malloc(PARALLEL_DEQUE_CAPACITY * sizeof(void*));
+        deque->capacity = PARALLEL_DEQUE_CAPACITY;
+        if (deque->items == NULL) {
+            ok = false;
+            ready++;
+            break;
+        }
+    }
+
+    nlink_traversal_result* result = NULL;
+    steal_worker first = { &context, 0 };
+    if (ok && steal_push(&first, &root, 1)) {
+        nlink_parallel_for(context.worker_count, 1, steal_chunk, &context);
+
+        if (!atomic_load(&context.stop)) {
+            result = merge_results(context.buffers, context.worker_count);
+        }
+    }
+
+    for (size_t i = 0; i < ready; i++) {
+        pthread_mutex_destroy(&context.deques[i].lock);
+        free(context.deques[i].items);
+    }
+    free(context.deques);
+    free_result_buffers(context.buffers, context.worker_count);
+    pthread_mutex_destroy(&context.idle_lock);
+    pthread_cond_destroy(&context.idle_cond);
+
+    return result;
+}
+
+nlink_traversal_result* nlink_parallel_traverse_tree(
+    void* root,
+    const nlink_parallel_traversal_config* config
+) {
+    if (root == NULL || config == NULL) {
+        return NULL;
+    }
+
+    if (config->get_id == NULL) {
+        return steal_traverse(root, config, NULL);
+    }
+
+    return nlink_parallel_traverse_graph(root, config);
+}
+
+nlink_traversal_result* nlink_parallel_traverse_graph(
+    void* start,
+    const nlink_parallel_traversal_config* config
+) {
+    if (start == NULL || config == NULL || config->get_id == NULL) {
+        return NULL;
+    }
+
+    visited_bits visited;
+    if (!visited_bits_init(&visited, config->node_count)) {
+        return NULL;
+    }
+
+    nlink_traversal_result* result = NULL;
+    if (visited_bits_claim(&visited, config->get_id(start, config->context)) > 0) {
+        result = steal_traverse(start, config, &visited);
+    }
+
+    free(visited.words);
+    return result;
+}
+
+/**
+ * Frontier-parallel breadth-first search
+ */
+typedef struct frontier_context {
+    const nlink_parallel_traversal_config* config;
+    visited_bits visited;
+    node_list frontier;
+    node_list* next;            // Next frontier, one list per thread
+    result_buffer* buffers;     // Results of the current level, one per thread
+    nlink_traversal_result* result;
+    size_t worker_count;
+    atomic_size_t cursor;       // Next unclaimed frontier position
+    atomic_bool failed;
+    bool done;
+} frontier_context;
+
+// Visit one frontier node and claim its unvisited neighbours
+static bool frontier_expand(frontier_context* context, size_t worker, void* node) {
+    const nlink_parallel_traversal_config* config = context->config;
+
+    if (config->should_traverse != NULL && !config->should_traverse(node, config->context)) {
+        return true;
+    }
+
+    void* visit_result = config->visitor(node, config->context);
+    if (config->collect_results &&
+        !result_buffer_add(&context->buffers[worker], node, visit_result)) {
+        return false;
+    }
+
+    size_t adjacent_count = config->get_child_count(node, config->context);
+    for (size_t i = 0; i < adjacent_count; i++) {
+        void* adjacent = config->get_child(node, i, config->context);
+        if (adjacent == NULL) {
+            continue;
+        }
+        int claimed = visited_bits_claim(&context->visited, config->get_id(adjacent, config->context));
+        if (claimed < 0 || (claimed > 0 && !node_list_push(&context->next[worker], adjacent))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Append the level's results and gather the next frontier
+static void frontier_advance(frontier_context* context) {
+    nlink_traversal_result* result = context->result;
+    size_t level_count = 0;
+    size_t next_count = 0;
+    for (size_t i = 0; i < context->worker_count; i++) {
+        level_count += context->buffers[i].nodes.count;
+        next_count += context->next[i].count;
+    }
+
+    if (result->count + level_count > result->capacity) {
+        size_t capacity = result->capacity;
+        while (result->count + level_count > capacity) {
+            capacity *= 2;
+        }
+        void** nodes = realloc(result->nodes, capacity * sizeof(void*));
+        if (nodes != NULL) {
+            result->nodes = nodes;
+        }
+        void** results = nodes != NULL ? realloc(result->results, capacity * sizeof(void*)) : NULL;
+        if (results == NULL) {
+            atomic_store(&context->failed, true);
+            context->done = true;
+            return;
+        }
+        result->results = results;
+        result->capacity = capacity;
+    }
+
+    if (next_count > context->frontier.capacity) {
+        void** items = realloc(context->frontier.items, next_count * sizeof(void*));
+        if (items == NULL) {
+            atomic_store(&context->failed, true);
+            context->done = true;
+            return;
+        }
+        context->frontier.items = items;
+        context->frontier.capacity = next_count;
+    }
+
+    context->frontier.count = 0;
+    for (size_t i = 0; i < context->worker_count; i++) {
+        result_buffer* buffer = &context->buffers[i];
+        node_list_copy(result->results + result->count, &buffer->results);
+        result->count += node_list_copy(result->nodes + result->count, &buffer->nodes);
+        buffer->nodes.count = 0;
+        buffer->results.count = 0;
+
+        context->frontier.count += node_list_copy(context->frontier.items + context->frontier.count, &context->next[i]);
+        context->next[i].count = 0;
+    }
+
+    atomic_store(&context->cursor, 0);
+    context->done = context->frontier.count == 0 || atomic_load(&context->failed);
+}
+
+// One chunk of a level's parallel loop is one worker claiming frontier slices
+static void frontier_chunk(size_t begin, size_t end, size_t chunk, void* arg) {
+    frontier_context* context = arg;
+    (void)end;
+
+    while ((begin = atomic_fetch_add(&context->cursor, FRONTIER_CHUNK)) < context->frontier.count &&
+           !atomic_load(&context->failed)) {
+        size_t stop = begin + FRONTIER_CHUNK < context->frontier.count ? begin + FRONTIER_CHUNK
+                                                                        : context->frontier.count;
+        for (size_t i = begin; i < stop; i++) {
+            if (!frontier_expand(context, chunk, context->frontier.items[i])) {
+                atomic_store(&context->failed, true);
+                break;
+            }
+        }
+    }
+}
+
+nlink_traversal_result* nlink_parallel_traverse_graph_bfs(
+    void* start,
+    const nlink_parallel_traversal_config* config
+) {
+    if (start == NULL || config == NULL || config->get_id == NULL) {
+        return NULL;
+    }
+
+    frontier_context context;
+    memset(&context, 0, sizeof(context));
+    context.config = config;
+    context.worker_count = parallel_thread_count(config);
+    atomic_init(&context.cursor, 0);
+    atomic_init(&context.failed, false);
+
+    if (!visited_bits_init(&context.visited, config->node_count)) {
+        return NULL;
+    }
+
+    context.next = calloc(context.worker_count, sizeof(node_list));
+    context.buffers = calloc(context.worker_count, sizeof(result_buffer));
+    context.result = malloc(sizeof(nlink_traversal_result));
+    if (context.result != NULL) {
+        context.result->nodes = malloc(16 * sizeof(void*));
+        context.result->results = malloc(16 * sizeof(void*));
+        context.result->count = 0;
+        context.result->capacity = 16;
+    }
+
+    bool ok = context.next != NULL && context.buffers != NULL &&
+              context.result != NULL && context.result->nodes != NULL && context.result->results != NULL &&
+              visited_bits_claim(&context.visited, config->get_id(start, config->context)) > 0 &&
+              node_list_push(&context.frontier, start);
+
+    if (ok) {
+        // Each level is one loop on the shared pool; its return is the level barrier
+        while (!context.done) {
+            nlink_parallel_for(context.worker_count, 1, frontier_chunk, &context);
+            frontier_advance(&context);
+        }
+        ok = !atomic_load(&context.failed);
+    }
+
+    for (size_t i = 0; context.next != NULL && i < context.worker_count; i++) {
+        free(context.next[i].items);
+    }
+    free(context.next);
+    free_result_buffers(context.buffers, context.worker_count);
+    free(context.frontier.items);
+    free(context.visited.words);
+
+    if (!ok) {
+        nlink_traversal_result_free(context.result);
+        return NULL;
+    }
+
+    return context.result;
+}
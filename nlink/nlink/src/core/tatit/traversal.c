@@ -7,256 +7,211 @@
 #include "nlink/core/tactic/traversal.h"
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
 #include <assert.h>
 
 /**
- * Queue implementation for breadth-first traversal
+ * Ring buffer of nodes, used as a queue (push back, pop front) for
+ * breadth-first traversal and as a stack (push back, pop back) otherwise
  */
-typedef struct node_queue_item {
-    void* node;
-    struct node_queue_item* next;
-} node_queue_item;
-
-typedef struct node_queue {
-    node_queue_item* head;
-    node_queue_item* tail;
+typedef struct node_ring {
+    void** slots;
+    size_t mask;   // Capacity - 1; capacity is a power of two
+    size_t head;   // Slot of the front node
     size_t size;
-} node_queue;
+} node_ring;
 
-static node_queue* queue_create() {
-    node_queue* queue = malloc(sizeof(node_queue));
-    if (queue == NULL) {
-        return NULL;
+static bool ring_grow(node_ring* ring) {
+    size_t capacity = ring->slots != NULL ? (ring->mask + 1) * 2 : 64;
+    void** slots = malloc(capacity * sizeof(void*));
+    if (slots == NULL) {
+        return false;
     }
     
-    queue->head = NULL;
-    queue->tail = NULL;
-    queue->size = 0;
-    
-    return queue;
-}
-
-static void queue_free(node_queue* queue) {
-    if (queue == NULL) {
-        return;
+    // Unwrap the live nodes to the start of the new buffer
+    for (size_t i = 0; i < ring->size; i++) {
+        slots[i] = ring->slots[(ring->head + i) & ring->mask];
     }
     
-    // Free all items
-    node_queue_item* item = queue->head;
-    while (item != NULL) {
-        node_queue_item* next = item->next;
-        free(item);
-        item = next;
-    }
+    free(ring->slots);
+    ring->slots = slots;
+    ring->mask = capacity - 1;
+    ring->head = 0;
     
-    free(queue);
+    return true;
 }
 
-static bool queue_enqueue(node_queue* queue, void* node) {
-    if (queue == NULL) {
-        return false;
-    }
-    
-    node_queue_item* item = malloc(sizeof(node_queue_item));
-    if (item == NULL) {
-        return false;
-    }
-    
-    item->node = node;
-    item->next = NULL;
-    
-    if (queue->tail == NULL) {
-        // Empty queue
-        queue->head = item;
-        queue->tail = item;
-    } else {
-        // Add to end
-        queue->tail->next = item;
-        queue->tail = item;
+static bool ring_push(node_ring* ring, void* node) {
+    if (ring->slots == NULL || ring->size > ring->mask) {
+        if (!ring_grow(ring)) {
+            return false;
+        }
     }
     
-    queue->size++;
+    ring->slots[(ring->head + ring->size) & ring->mask] = node;
+    ring->size++;
     
     return true;
 }
 
-static void* queue_dequeue(node_queue* queue) {
-    if (queue == NULL || queue->head == NULL) {
+static void* ring_pop_front(node_ring* ring) {
+    if (ring->size == 0) {
         return NULL;
     }
     
-    node_queue_item* item = queue->head;
-    void* node = item->node;
+    void* node = ring->slots[ring->head];
+    ring->head = (ring->head + 1) & ring->mask;
+    ring->size--;
     
-    queue->head = item->next;
-    if (queue->head == NULL) {
-        queue->tail = NULL;
+    return node;
+}
+
+static void* ring_pop_back(node_ring* ring) {
+    if (ring->size == 0) {
+        return NULL;
     }
     
-    free(item);
-    queue->size--;
-    
-    return node;
+    ring->size--;
+    return ring->slots[(ring->head + ring->size) & ring->mask];
 }
 
-static bool queue_is_empty(node_queue* queue) {
-    return queue == NULL || queue->head == NULL;
+static bool ring_is_empty(const node_ring* ring) {
+    return ring->size == 0;
 }
 
 /**
- * Stack implementation for depth-first traversal
+ * Visited node tracking: open-addressing set of node pointers
  */
-typedef struct node_stack_item {
-    void* node;
-    struct node_stack_item* next;
-} node_stack_item;
-
-typedef struct node_stack {
-    node_stack_item* top;
-    size_t size;
-} node_stack;
-
-static node_stack* stack_create() {
-    node_stack* stack = malloc(sizeof(node_stack));
-    if (stack == NULL) {
-        return NULL;
-    }
-    
-    stack->top = NULL;
-    stack->size = 0;
-    
-    return stack;
-}
+typedef struct visited_set {
+    void** slots;  // NULL marks an empty slot
+    size_t mask;
+    size_t count;
+} visited_set;
 
-static void stack_free(node_stack* stack) {
-    if (stack == NULL) {
-        return;
-    }
-    
-    // Free all items
-    node_stack_item* item = stack->top;
-    while (item != NULL) {
-        node_stack_item* next = item->next;
-        free(item);
-        item = next;
-    }
-    
-    free(stack);
+static size_t pointer_hash(const void* node) {
+    uint64_t h = (uint64_t)(uintptr_t)node;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return (size_t)h;
 }
 
-static bool stack_push(node_stack* stack, void* node) {
-    if (stack == NULL) {
+static bool visited_set_grow(visited_set* set) {
+    size_t capacity = set->slots != NULL ? (set->mask + 1) * 2 : 256;
+    void** slots = calloc(capacity, sizeof(void*));
+    if (slots == NULL) {
         return false;
     }
     
-    node_stack_item* item = malloc(sizeof(node_stack_item));
-    if (item == NULL) {
-        return false;
+    size_t mask = capacity - 1;
+    for (size_t i = 0; set->slots != NULL && i <= set->mask; i++) {
+        void* node = set->slots[i];
+        if (node != NULL) {
+            size_t slot = pointer_hash(node) & mask;
+            while (slots[slot] != NULL) {
+                slot = (slot + 1) & mask;
+            }
+            slots[slot] = node;
+        }
     }
     
-    item->node = node;
-    item->next = stack->top;
-    stack->top = item;
-    stack->size++;
+    free(set->slots);
+    set->slots = slots;
+    set->mask = mask;
     
     return true;
 }
 
-static void* stack_pop(node_stack* stack) {
-    if (stack == NULL || stack->top == NULL) {
-        return NULL;
+/**
+ * Add a node to the set
+ *
+ * Returns 1 if the node was added, 0 if it was already present and -1 if
+ * the set could not grow.
+ */
+static int visited_set_add(visited_set* set, void* node) {
+    if (node == NULL) {
+        return 0;
     }
     
-    node_stack_item* item = stack->top;
-    void* node = item->node;
+    // Keep the load factor at or below one half
+    if (set->slots == NULL || (set->count + 1) * 2 > set->mask + 1) {
+        if (!visited_set_grow(set)) {
+            return -1;
+        }
+    }
+    
+    size_t slot = pointer_hash(node) & set->mask;
+    while (set->slots[slot] != NULL) {
+        if (set->slots[slot] == node) {
+            return 0;
+        }
+        slot = (slot + 1) & set->mask;
+    }
     
-    stack->top = item->next;
-    free(item);
-    stack->size--;
+    set->slots[slot] = node;
+    set->count++;
     
-    return node;
-}
-
-static bool stack_is_empty(node_stack* stack) {
-    return stack == NULL || stack->top == NULL;
+    return 1;
 }
 
 /**
- * Visited node tracking
+ * Working storage for one traversal
+ *
+ * One arena is cached between traversals so repeated walks reuse its
+ * buffers; arenas that grew past TRAVERSAL_ARENA_RETAIN_SLOTS are freed
+ * rather than cached.
  */
-typedef struct {
-    void** nodes;
-    size_t count;
-    size_t capacity;
-} visited_set;
+#define TRAVERSAL_ARENA_RETAIN_SLOTS 65536
 
-static visited_set* visited_set_create(size_t initial_capacity) {
-    visited_set* set = malloc(sizeof(visited_set));
-    if (set == NULL) {
-        return NULL;
-    }
-    
-    set->nodes = malloc(initial_capacity * sizeof(void*));
-    if (set->nodes == NULL) {
-        free(set);
-        return NULL;
-    }
-    
-    set->count = 0;
-    set->capacity = initial_capacity;
-    
-    return set;
-}
+typedef struct traversal_arena {
+    node_ring primary;    // Work queue or stack
+    node_ring secondary;  // Output stack for post-order traversal
+    visited_set visited;
+} traversal_arena;
+
+static _Atomic(traversal_arena*) cached_arena = NULL;
 
-static void visited_set_free(visited_set* set) {
-    if (set == NULL) {
+static void arena_free(traversal_arena* arena) {
+    if (arena == NULL) {
         return;
     }
     
-    free(set->nodes);
-    free(set);
+    free(arena->primary.slots);
+    free(arena->secondary.slots);
+    free(arena->visited.slots);
+    free(arena);
 }
 
-static bool visited_set_contains(visited_set* set, void* node) {
-    if (set == NULL || node == NULL) {
-        return false;
+static traversal_arena* arena_acquire(void) {
+    traversal_arena* arena = atomic_exchange(&cached_arena, NULL);
+    if (arena == NULL) {
+        return calloc(1, sizeof(traversal_arena));
     }
     
-    for (size_t i = 0; i < set->count; i++) {
-        if (set->nodes[i] == node) {
-            return true;
-        }
+    arena->primary.head = arena->primary.size = 0;
+    arena->secondary.head = arena->secondary.size = 0;
+    if (arena->visited.count > 0) {
+        memset(arena->visited.slots, 0, (arena->visited.mask + 1) * sizeof(void*));
+        arena->visited.count = 0;
     }
     
-    return false;
+    return arena;
 }
 
-static bool visited_set_add(visited_set* set, void* node) {
-    if (set == NULL || node == NULL) {
-        return false;
-    }
-    
-    // Check if already in set
-    if (visited_set_contains(set, node)) {
-        return true;
+static void arena_release(traversal_arena* arena) {
+    if (arena == NULL) {
+        return;
     }
     
-    // Check if need to resize
-    if (set->count >= set->capacity) {
-        size_t new_capacity = set->capacity * 2;
-        void** new_nodes = realloc(set->nodes, new_capacity * sizeof(void*));
-        if (new_nodes == NULL) {
-            return false;
-        }
-        
-        set->nodes = new_nodes;
-        set->capacity = new_capacity;
+    if (arena->primary.mask >= TRAVERSAL_ARENA_RETAIN_SLOTS ||
+        arena->secondary.mask >= TRAVERSAL_ARENA_RETAIN_SLOTS ||
+        arena->visited.mask >= TRAVERSAL_ARENA_RETAIN_SLOTS) {
+        arena_free(arena);
+        return;
     }
     
-    // Add to set
-    set->nodes[set->count++] = node;
-    
-    return true;
+    arena_free(atomic_exchange(&cached_arena, arena));
 }
 
 /**
@@ -293,15 +248,15 @@ static bool traversal_result_add(nlink_traversal_result* result, void* node, voi
     if (result->count >= result->capacity) {
         size_t new_capacity = result->capacity * 2;
         void** new_nodes = realloc(result->nodes, new_capacity * sizeof(void*));
-        void** new_results = realloc(result->results, new_capacity * sizeof(void*));
-        
-        if (new_nodes == NULL || new_results == NULL) {
-            free(new_nodes);  // May be NULL, free handles that
-            free(new_results);
+        if (new_nodes == NULL) {
             return false;
         }
-        
         result->nodes = new_nodes;
+        
+        void** new_results = realloc(result->results, new_capacity * sizeof(void*));
+        if (new_results == NULL) {
+            return false;
+        }
         result->results = new_results;
         result->capacity = new_capacity;
     }
@@ -394,19 +349,18 @@ static nlink_traversal_result* traverse_pre_order(
         return NULL;
     }
     
-    // Initialize stack
-    node_stack* stack = stack_create();
-    if (stack == NULL) {
+    // Initialize stack with the root node
+    traversal_arena* arena = arena_acquire();
+    if (arena == NULL || !ring_push(&arena->primary, root)) {
+        arena_release(arena);
         nlink_traversal_result_free(result);
         return NULL;
     }
-    
-    // Push root node
-    stack_push(stack, root);
+    node_ring* stack = &arena->primary;
     
     // Traverse tree
-    while (!stack_is_empty(stack)) {
-        void* node = stack_pop(stack);
+    while (!ring_is_empty(stack)) {
+        void* node = ring_pop_back(stack);
         
         // Check if we should traverse this node
         if (config->should_traverse != NULL && !config->should_traverse(node, config->context)) {
@@ -419,7 +373,7 @@ static nlink_traversal_result* traverse_pre_order(
         // Collect result if requested
         if (config->collect_results) {
             if (!traversal_result_add(result, node, visit_result)) {
-                stack_free(stack);
+                arena_release(arena);
                 nlink_traversal_result_free(result);
                 return NULL;
             }
@@ -429,13 +383,15 @@ static nlink_traversal_result* traverse_pre_order(
         size_t child_count = config->get_child_count(node, config->context);
         for (size_t i = child_count; i > 0; i--) {
             void* child = config->get_child(node, i - 1, config->context);
-            if (child != NULL) {
-                stack_push(stack, child);
+            if (child != NULL && !ring_push(stack, child)) {
+                arena_release(arena);
+                nlink_traversal_result_free(result);
+                return NULL;
             }
         }
     }
     
-    stack_free(stack);
+    arena_release(arena);
     return result;
 }
 
@@ -457,43 +413,45 @@ static nlink_traversal_result* traverse_post_order(
     }
     
     // We need two stacks for post-order traversal
-    node_stack* stack1 = stack_create();
-    node_stack* stack2 = stack_create();
-    
-    if (stack1 == NULL || stack2 == NULL) {
+    traversal_arena* arena = arena_acquire();
+    if (arena == NULL || !ring_push(&arena->primary, root)) {
+        arena_release(arena);
         nlink_traversal_result_free(result);
-        stack_free(stack1);
-        stack_free(stack2);
         return NULL;
     }
-    
-    // Push root node
-    stack_push(stack1, root);
+    node_ring* stack1 = &arena->primary;
+    node_ring* stack2 = &arena->secondary;
     
     // Fill stack2 in post-order
-    while (!stack_is_empty(stack1)) {
-        void* node = stack_pop(stack1);
+    while (!ring_is_empty(stack1)) {
+        void* node = ring_pop_back(stack1);
         
         // Check if we should traverse this node
         if (config->should_traverse != NULL && !config->should_traverse(node, config->context)) {
             continue;
         }
         
-        stack_push(stack2, node);
+        if (!ring_push(stack2, node)) {
+            arena_release(arena);
+            nlink_traversal_result_free(result);
+            return NULL;
+        }
         
         // Push children for processing
         size_t child_count = config->get_child_count(node, config->context);
         for (size_t i = 0; i < child_count; i++) {
             void* child = config->get_child(node, i, config->context);
-            if (child != NULL) {
-                stack_push(stack1, child);
+            if (child != NULL && !ring_push(stack1, child)) {
+                arena_release(arena);
+                nlink_traversal_result_free(result);
+                return NULL;
             }
         }
     }
     
     // Process nodes in post-order
-    while (!stack_is_empty(stack2)) {
-        void* node = stack_pop(stack2);
+    while (!ring_is_empty(stack2)) {
+        void* node = ring_pop_back(stack2);
         
         // Visit node
         void* visit_result = config->visitor(node, config->context);
@@ -501,16 +459,14 @@ static nlink_traversal_result* traverse_post_order(
         // Collect result if requested
         if (config->collect_results) {
             if (!traversal_result_add(result, node, visit_result)) {
-                stack_free(stack1);
-                stack_free(stack2);
+                arena_release(arena);
                 nlink_traversal_result_free(result);
                 return NULL;
             }
         }
     }
     
-    stack_free(stack1);
-    stack_free(stack2);
+    arena_release(arena);
     return result;
 }
 
@@ -531,19 +487,18 @@ static nlink_traversal_result* traverse_level_order(
         return NULL;
     }
     
-    // Initialize queue
-    node_queue* queue = queue_create();
-    if (queue == NULL) {
+    // Initialize queue with the root node
+    traversal_arena* arena = arena_acquire();
+    if (arena == NULL || !ring_push(&arena->primary, root)) {
+        arena_release(arena);
         nlink_traversal_result_free(result);
         return NULL;
     }
-    
-    // Enqueue root node
-    queue_enqueue(queue, root);
+    node_ring* queue = &arena->primary;
     
     // Traverse tree
-    while (!queue_is_empty(queue)) {
-        void* node = queue_dequeue(queue);
+    while (!ring_is_empty(queue)) {
+        void* node = ring_pop_front(queue);
         
         // Check if we should traverse this node
         if (config->should_traverse != NULL && !config->should_traverse(node, config->context)) {
@@ -556,7 +511,7 @@ static nlink_traversal_result* traverse_level_order(
         // Collect result if requested
         if (config->collect_results) {
             if (!traversal_result_add(result, node, visit_result)) {
-                queue_free(queue);
+                arena_release(arena);
                 nlink_traversal_result_free(result);
                 return NULL;
             }
@@ -566,13 +521,15 @@ static nlink_traversal_result* traverse_level_order(
         size_t child_count = config->get_child_count(node, config->context);
         for (size_t i = 0; i < child_count; i++) {
             void* child = config->get_child(node, i, config->context);
-            if (child != NULL) {
-                queue_enqueue(queue, child);
+            if (child != NULL && !ring_push(queue, child)) {
+                arena_release(arena);
+                nlink_traversal_result_free(result);
+                return NULL;
             }
         }
     }
     
-    queue_free(queue);
+    arena_release(arena);
     return result;
 }
 
@@ -594,16 +551,17 @@ static nlink_traversal_result* traverse_in_order(
     }
     
     // Initialize stack
-    node_stack* stack = stack_create();
-    if (stack == NULL) {
+    traversal_arena* arena = arena_acquire();
+    if (arena == NULL) {
         nlink_traversal_result_free(result);
         return NULL;
     }
+    node_ring* stack = &arena->primary;
     
     // Traverse tree
     void* current = root;
     
-    while (current != NULL || !stack_is_empty(stack)) {
+    while (current != NULL || !ring_is_empty(stack)) {
         // Reach the leftmost node
         while (current != NULL) {
             // Check if we should traverse this node
@@ -612,7 +570,11 @@ static nlink_traversal_result* traverse_in_order(
                 break;
             }
             
-            stack_push(stack, current);
+            if (!ring_push(stack, current)) {
+                arena_release(arena);
+                nlink_traversal_result_free(result);
+                return NULL;
+            }
             
             // For binary trees, we always expect left child at index 0
             if (config->get_child_count(current, config->context) > 0) {
@@ -622,11 +584,11 @@ static nlink_traversal_result* traverse_in_order(
             }
         }
         
-        if (stack_is_empty(stack)) {
+        if (ring_is_empty(stack)) {
             break;
         }
         
-        current = stack_pop(stack);
+        current = ring_pop_back(stack);
         
         // Visit node
         void* visit_result = config->visitor(current, config->context);
@@ -634,7 +596,7 @@ static nlink_traversal_result* traverse_in_order(
         // Collect result if requested
         if (config->collect_results) {
             if (!traversal_result_add(result, current, visit_result)) {
-                stack_free(stack);
+                arena_release(arena);
                 nlink_traversal_result_free(result);
                 return NULL;
             }
@@ -649,7 +611,7 @@ static nlink_traversal_result* traverse_in_order(
         }
     }
     
-    stack_free(stack);
+    arena_release(arena);
     return result;
 }
 
@@ -876,32 +838,26 @@ nlink_traversal_result* nlink_traverse_graph_dfs(
         return NULL;
     }
     
-    // Initialize stack and visited set
-    node_stack* stack = stack_create();
-    visited_set* visited = visited_set_create(16);
-    
-    if (stack == NULL || visited == NULL) {
+    // Initialize stack and visited set with the start node
+    traversal_arena* arena = arena_acquire();
+    if (arena == NULL || !ring_push(&arena->primary, start) ||
+        visited_set_add(&arena->visited, start) < 0) {
+        arena_release(arena);
         nlink_traversal_result_free(result);
-        stack_free(stack);
-        visited_set_free(visited);
         return NULL;
     }
-    
-    // Push start node
-    stack_push(stack, start);
-    visited_set_add(visited, start);
+    node_ring* stack = &arena->primary;
     
     // Traverse graph
-    while (!stack_is_empty(stack)) {
-        void* node = stack_pop(stack);
+    while (!ring_is_empty(stack)) {
+        void* node = ring_pop_back(stack);
         
         // Visit node
         void* visit_result = visitor(node, context);
         
         // Collect result
         if (!traversal_result_add(result, node, visit_result)) {
-            stack_free(stack);
-            visited_set_free(visited);
+            arena_release(arena);
             nlink_traversal_result_free(result);
             return NULL;
         }
@@ -910,15 +866,16 @@ nlink_traversal_result* nlink_traverse_graph_dfs(
         size_t adjacent_count = get_adjacent_count(node, context);
         for (size_t i = 0; i < adjacent_count; i++) {
             void* adjacent = get_adjacents(node, i, context);
-            if (adjacent != NULL && !visited_set_contains(visited, adjacent)) {
-                stack_push(stack, adjacent);
-                visited_set_add(visited, adjacent);
+            int added = visited_set_add(&arena->visited, adjacent);
+            if (added < 0 || (added > 0 && !ring_push(stack, adjacent))) {
+                arena_release(arena);
+                nlink_traversal_result_free(result);
+                return NULL;
             }
         }
     }
     
-    stack_free(stack);
-    visited_set_free(visited);
+    arena_release(arena);
     return result;
 }
 
@@ -939,32 +896,26 @@ nlink_traversal_result* nlink_traverse_graph_bfs(
         return NULL;
     }
     
-    // Initialize queue and visited set
-    node_queue* queue = queue_create();
-    visited_set* visited = visited_set_create(16);
-    
-    if (queue == NULL || visited == NULL) {
+    // Initialize queue and visited set with the start node
+    traversal_arena* arena = arena_acquire();
+    if (arena == NULL || !ring_push(&arena->primary, start) ||
+        visited_set_add(&arena->visited, start) < 0) {
+        arena_release(arena);
         nlink_traversal_result_free(result);
-        queue_free(queue);
-        visited_set_free(visited);
         return NULL;
     }
-    
-    // Enqueue start node
-    queue_enqueue(queue, start);
-    visited_set_add(visited, start);
+    node_ring* queue = &arena->primary;
     
     // Traverse graph
-    while (!queue_is_empty(queue)) {
-        void* node = queue_dequeue(queue);
+    while (!ring_is_empty(queue)) {
+        void* node = ring_pop_front(queue);
         
         // Visit node
         void* visit_result = visitor(node, context);
         
         // Collect result
         if (!traversal_result_add(result, node, visit_result)) {
-            queue_free(queue);
-            visited_set_free(visited);
+            arena_release(arena);
             nlink_traversal_result_free(result);
             return NULL;
         }
@@ -973,15 +924,16 @@ nlink_traversal_result* nlink_traverse_graph_bfs(
         size_t adjacent_count = get_adjacent_count(node, context);
         for (size_t i = 0; i < adjacent_count; i++) {
             void* adjacent = get_adjacents(node, i, context);
-            if (adjacent != NULL && !visited_set_contains(visited, adjacent)) {
-                queue_enqueue(queue, adjacent);
-                visited_set_add(visited, adjacent);
+            int added = visited_set_add(&arena->visited, adjacent);
+            if (added < 0 || (added > 0 && !ring_push(queue, adjacent))) {
+                arena_release(arena);
+                nlink_traversal_result_free(result);
+                return NULL;
             }
         }
     }
     
-    queue_free(queue);
-    visited_set_free(visited);
+    arena_release(arena);
     return result;
 }
 
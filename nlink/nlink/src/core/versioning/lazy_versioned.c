@@ -6,6 +6,7 @@
 #include "nlink/core/versioning/nexus_lazy_versioned.h"
 #include "nlink/core/versioning/nexus_version.h"
 #include "nlink/core/versioning/lazy_versioned.h"
+#include "nlink/core/versioning/semver.h"
 
 
 // Enhanced implementation of nexus_check_unused_versioned_libraries
@@ -118,6 +119,8 @@ void nexus_check_unused_versioned_libraries(VersionedSymbolRegistry* registry) {
                         free(symbol->name);
                         free(symbol->version);
                         free(symbol->component_id);
+                        semver_free(symbol->semver);
+                        symbol->semver = NULL;
                         symbol->name = NULL;
                         symbol->address = NULL;
                     }
@@ -158,6 +161,9 @@ void nexus_check_unused_versioned_libraries(VersionedSymbolRegistry* registry) {
             }
         }
         registry->exported.size = write_index;
+        
+        // Symbols were removed behind the table API; drop cached resolutions
+        registry->exported.generation++;
     }
     
     // Clean up temporary arrays
@@ -100,66 +100,17 @@ int semver_compare(const SemVer* a, const SemVer* b) {
 
 // Check if a version satisfies a constraint
 bool semver_satisfies(const char* version, const char* constraint) {
+    if (!version || !constraint) return false;
+    
     // Parse both versions
     SemVer* ver = semver_parse(version);
     if (!ver) return false;
     
-    // Handle special constraints
-    if (strcmp(constraint, "*") == 0 || 
-        strcmp(constraint, "latest") == 0) {
-        semver_free(ver);
-        return true;
-    }
+    SemVerConstraint* compiled = semver_constraint_compile(constraint);
+    bool result = compiled && semver_constraint_matches(compiled, ver);
     
-    // Handle range constraints (simplified)
-    char* constraint_copy = strdup(constraint);
-    char* operator = constraint_copy;
-    
-    // Find the version part
-    while (*operator && !isdigit(*operator) && *operator != '*') operator++;
-    
-    // Extract the operator
-    char op_type[3] = {0};
-    if (operator > constraint_copy) {
-        size_t op_len = operator - constraint_copy;
-        if (op_len > 2) op_len = 2;
-        strncpy(op_type, constraint_copy, op_len);
-    }
-    
-    // Parse the constraint version
-    SemVer* cons = semver_parse(operator);
-    if (!cons) {
-        free(constraint_copy);
-        semver_free(ver);
-        return false;
-    }
-    
-    // Do the comparison based on operator
-    bool result = false;
-    int cmp = semver_compare(ver, cons);
-    
-    if (op_type[0] == 0 || strcmp(op_type, "=") == 0) {
-        // Exact match
-        result = (cmp == 0);
-    } else if (strcmp(op_type, ">") == 0) {
-        result = (cmp > 0);
-    } else if (strcmp(op_type, ">=") == 0) {
-        result = (cmp >= 0);
-    } else if (strcmp(op_type, "<") == 0) {
-        result = (cmp < 0);
-    } else if (strcmp(op_type, "<=") == 0) {
-        result = (cmp <= 0);
-    } else if (strcmp(op_type, "^") == 0) {
-        // Compatible with: same major version, greater than or equal to specified version
-        result = (ver->major == cons->major && cmp >= 0);
-    } else if (strcmp(op_type, "~") == 0) {
-        // Compatible with: same major.minor version, greater than or equal to specified version
-        result = (ver->major == cons->major && ver->minor == cons->minor && cmp >= 0);
-    }
-    
-    free(constraint_copy);
+    semver_constraint_free(compiled);
     semver_free(ver);
-    semver_free(cons);
     
     return result;
 }
@@ -171,4 +122,293 @@ void semver_free(SemVer* ver) {
     free(ver->prerelease);
     free(ver->build);
     free(ver);
+}
+
+// Parse one numeric version component, accepting "x"/"X"/"*" as a wildcard
+// Returns false if no component is present
+static bool parse_version_component(const char** p, int* value, bool* wildcard) {
+    if (**p == 'x' || **p == 'X' || **p == '*') {
+        (*p)++;
+        *wildcard = true;
+        *value = 0;
+        return true;
+    }
+    
+    if (!isdigit((unsigned char)**p)) return false;
+    
+    long v = 0;
+    while (isdigit((unsigned char)**p)) {
+        v = v * 10 + (**p - '0');
+        if (v > INT32_MAX) v = INT32_MAX;
+        (*p)++;
+    }
+    *value = (int)v;
+    *wildcard = false;
+    return true;
+}
+
+// Parse a possibly partial version at *p
+// parts receives the number of concrete components (0-3)
+static bool parse_partial_version(const char** p, SemVer* ver, int* parts) {
+    int values[3] = {0, 0, 0};
+    bool wildcard = false;
+    
+    *parts = 0;
+    if (**p == 'v' || **p == 'V') (*p)++;
+    
+    for (int i = 0; i < 3; i++) {
+        if (i > 0) {
+            if (**p != '.') break;
+            (*p)++;
+        }
+        if (!parse_version_component(p, &values[i], &wildcard)) return false;
+        if (wildcard) break;
+        (*parts)++;
+    }
+    
+    // A wildcard swallows any further components ("1.x.x")
+    while (wildcard && **p == '.') {
+        (*p)++;
+        int ignored;
+        bool ignored_wildcard;
+        if (!parse_version_component(p, &ignored, &ignored_wildcard)) return false;
+    }
+    
+    memset(ver, 0, sizeof(SemVer));
+    ver->major = values[0];
+    ver->minor = values[1];
+    ver->patch = values[2];
+    
+    // Pre-release identifiers only apply to full versions
+    if (**p == '-' && *parts == 3) {
+        const char* start = ++(*p);
+        while (**p && **p != '+' && !isspace((unsigned char)**p) && **p != '|') (*p)++;
+        ver->prerelease = (char*)malloc((size_t)(*p - start) + 1);
+        if (!ver->prerelease) return false;
+        memcpy(ver->prerelease, start, (size_t)(*p - start));
+        ver->prerelease[*p - start] = '\0';
+    }
+    
+    // Build metadata does not take part in comparisons
+    if (**p == '+') {
+        while (**p && !isspace((unsigned char)**p) && **p != '|') (*p)++;
+    }
+    
+    return true;
+}
+
+// Append a comparator to a constraint under construction
+static bool constraint_push(SemVerConstraint* constraint, size_t* capacity,
+                            SemVerOp op, const SemVer* version) {
+    if (constraint->comparator_count >= *capacity) {
+        size_t new_capacity = *capacity ? *capacity * 2 : 4;
+        SemVerComparator* comparators = (SemVerComparator*)realloc(
+            constraint->comparators, new_capacity * sizeof(SemVerComparator));
+        if (!comparators) return false;
+        constraint->comparators = comparators;
+        *capacity = new_capacity;
+    }
+    
+    SemVerComparator* comparator = &constraint->comparators[constraint->comparator_count++];
+    comparator->op = op;
+    if (version) {
+        comparator->version = *version;
+    } else {
+        memset(&comparator->version, 0, sizeof(SemVer));
+    }
+    return true;
+}
+
+// Close the current comparator set
+static bool constraint_end_set(SemVerConstraint* constraint) {
+    size_t* set_ends = (size_t*)realloc(constraint->set_ends,
+                                        (constraint->set_count + 1) * sizeof(size_t));
+    if (!set_ends) return false;
+    constraint->set_ends = set_ends;
+    constraint->set_ends[constraint->set_count++] = constraint->comparator_count;
+    return true;
+}
+
+// Upper bound that excludes everything matching a partial version
+// ("1.2" -> 1.3.0, "1" -> 2.0.0)
+static void partial_upper_bound(const SemVer* ver, int parts, SemVer* bound) {
+    memset(bound, 0, sizeof(SemVer));
+    bound->major = ver->major;
+    if (parts == 1) {
+        bound->major = ver->major + 1;
+    } else {
+        bound->minor = ver->minor + 1;
+    }
+}
+
+// Compile a constraint string
+SemVerConstraint* semver_constraint_compile(const char* constraint) {
+    if (!constraint) return NULL;
+    
+    SemVerConstraint* compiled = (SemVerConstraint*)calloc(1, sizeof(SemVerConstraint));
+    if (!compiled) return NULL;
+    
+    size_t capacity = 0;
+    size_t set_start = 0;
+    const char* p = constraint;
+    
+    for (;;) {
+        while (isspace((unsigned char)*p)) p++;
+        
+        // End of a comparator set
+        if (*p == '\0' || *p == '|') {
+            // An empty set ("" or "a || || b") names no version; reject it
+            // as the single-comparator parser did
+            if (compiled->comparator_count == set_start) goto fail;
+            if (!constraint_end_set(compiled)) goto fail;
+            set_start = compiled->comparator_count;
+            
+            if (*p == '\0') break;
+            if (p[1] != '|') goto fail;
+            p += 2;
+            continue;
+        }
+        
+        if (strncmp(p, "latest", 6) == 0) {
+            p += 6;
+            if (!constraint_push(compiled, &capacity, SEMVER_OP_ANY, NULL)) goto fail;
+            continue;
+        }
+        
+        // Operator
+        SemVerOp op = SEMVER_OP_EQ;
+        if (p[0] == '>' && p[1] == '=') { op = SEMVER_OP_GE; p += 2; }
+        else if (p[0] == '<' && p[1] == '=') { op = SEMVER_OP_LE; p += 2; }
+        else if (p[0] == '>') { op = SEMVER_OP_GT; p++; }
+        else if (p[0] == '<') { op = SEMVER_OP_LT; p++; }
+        else if (p[0] == '=') { op = SEMVER_OP_EQ; p++; }
+        else if (p[0] == '^') { op = SEMVER_OP_CARET; p++; }
+        else if (p[0] == '~') { op = SEMVER_OP_TILDE; p++; }
+        
+        while (isspace((unsigned char)*p)) p++;
+        
+        SemVer ver;
+        int parts;
+        if (!parse_partial_version(&p, &ver, &parts)) goto fail;
+        if (*p && !isspace((unsigned char)*p) && *p != '|') {
+            free(ver.prerelease);
+            goto fail;
+        }
+        
+        // Lower partial versions into plain comparators
+        bool ok = true;
+        SemVer bound;
+        if (parts == 0) {
+            // "*", "x", ">=*": no restriction; "<*" and ">*" match nothing
+            op = (op == SEMVER_OP_LT || op == SEMVER_OP_GT) ? SEMVER_OP_NONE : SEMVER_OP_ANY;
+            ok = constraint_push(compiled, &capacity, op, &ver);
+        } else if (parts == 3) {
+            ok = constraint_push(compiled, &capacity, op, &ver);
+        } else if (op == SEMVER_OP_EQ) {
+            partial_upper_bound(&ver, parts, &bound);
+            ok = constraint_push(compiled, &capacity, SEMVER_OP_GE, &ver) &&
+                 constraint_push(compiled, &capacity, SEMVER_OP_LT, &bound);
+        } else if (op == SEMVER_OP_GT) {
+            partial_upper_bound(&ver, parts, &bound);
+            ok = constraint_push(compiled, &capacity, SEMVER_OP_GE, &bound);
+        } else if (op == SEMVER_OP_LE) {
+            partial_upper_bound(&ver, parts, &bound);
+            ok = constraint_push(compiled, &capacity, SEMVER_OP_LT, &bound);
+        } else if (op == SEMVER_OP_TILDE && parts == 1) {
+            ok = constraint_push(compiled, &capacity, SEMVER_OP_CARET, &ver);
+        } else {
+            ok = constraint_push(compiled, &capacity, op, &ver);
+        }
+        
+        if (!ok) {
+            free(ver.prerelease);
+            goto fail;
+        }
+    }
+    
+    return compiled;
+    
+fail:
+    semver_constraint_free(compiled);
+    return NULL;
+}
+
+// Evaluate a single comparator
+static bool comparator_matches(const SemVerComparator* comparator, const SemVer* version) {
+    if (comparator->op == SEMVER_OP_ANY) return true;
+    if (comparator->op == SEMVER_OP_NONE) return false;
+    
+    int cmp = semver_compare(version, &comparator->version);
+    
+    switch (comparator->op) {
+        case SEMVER_OP_EQ:
+            return cmp == 0;
+        case SEMVER_OP_GT:
+            return cmp > 0;
+        case SEMVER_OP_GE:
+            return cmp >= 0;
+        case SEMVER_OP_LT:
+            return cmp < 0;
+        case SEMVER_OP_LE:
+            return cmp <= 0;
+        case SEMVER_OP_CARET:
+            return version->major == comparator->version.major && cmp >= 0;
+        case SEMVER_OP_TILDE:
+            return version->major == comparator->version.major &&
+                   version->minor == comparator->version.minor && cmp >= 0;
+        default:
+            return false;
+    }
+}
+
+// Check if a parsed version satisfies a compiled constraint
+bool semver_constraint_matches(const SemVerConstraint* constraint, const SemVer* version) {
+    if (!constraint || !version) return false;
+    
+    size_t start = 0;
+    for (size_t set = 0; set < constraint->set_count; set++) {
+        size_t end = constraint->set_ends[set];
+        bool satisfied = true;
+        
+        for (size_t i = start; i < end; i++) {
+            if (!comparator_matches(&constraint->comparators[i], version)) {
+                satisfied = false;
+                break;
+            }
+        }
+        
+        if (satisfied) return true;
+        start = end;
+    }
+    
+    return false;
+}
+
+// Filter candidate versions against one compiled constraint
+size_t semver_constraint_filter(const SemVerConstraint* constraint,
+                                const SemVer* const* candidates,
+                                size_t count,
+                                size_t* matches) {
+    if (!constraint || !candidates || !matches) return 0;
+    
+    size_t matched = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (candidates[i] && semver_constraint_matches(constraint, candidates[i])) {
+            matches[matched++] = i;
+        }
+    }
+    
+    return matched;
+}
+
+// Free a compiled constraint
+void semver_constraint_free(SemVerConstraint* constraint) {
+    if (!constraint) return;
+    
+    for (size_t i = 0; i < constraint->comparator_count; i++) {
+        free(constraint->comparators[i].version.prerelease);
+    }
+    free(constraint->comparators);
+    free(constraint->set_ends);
+    free(constraint);
 }
\ No newline at end of file
@@ -0,0 +1,141 @@
+/**
+ * @file bench_handle_registry.c
+ * @brief Component handle lookup throughput
+ *
+ * Registers a set of component paths, then looks them up from one and
+ * several threads through the hash-indexed registry, next to the linear
+ * strcmp scan under a mutex that the registry used before.
+ *
+ * Usage: bench_handle_registry [components] [threads] [rounds]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/common/nexus_loader.h"
+#include <dlfcn.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_COMPONENTS 1000
+#define DEFAULT_THREADS 4
+#define DEFAULT_ROUNDS 5
+#define LOOKUPS_PER_THREAD 200000
+
+typedef struct {
+    char** paths;
+    void** handles;
+    size_t count;
+    pthread_mutex_t mutex;
+} LinearRegistry;
+
+typedef struct {
+    NexusHandleRegistry* registry;
+    LinearRegistry* linear;
+    char** paths;
+    size_t count;
+    size_t seed;
+    size_t found;
+} LookupWorker;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void* linear_find(LinearRegistry* linear, const char* path) {
+    void* handle = NULL;
+
+    pthread_mutex_lock(&linear->mutex);
+    for (size_t i = 0; i < linear->count; i++) {
+        if (strcmp(linear->paths[i], path) == 0) {
+            handle = linear->handles[i];
+            break;
+        }
+    }
+    pthread_mutex_unlock(&linear->mutex);
+    return handle;
+}
+
+static void* lookup_worker(void* arg) {
+    LookupWorker* worker = (LookupWorker*)arg;
+    size_t index = worker->seed;
+
+    for (size_t i = 0; i < LOOKUPS_PER_THREAD; i++) {
+        index = (index * 2654435761u + 1) % worker->count;
+        void* handle = worker->registry
+            ? nexus_find_component_handle(worker->registry, worker->paths[index])
+            : linear_find(worker->linear, worker->paths[index]);
+        if (handle) worker->found++;
+    }
+    return NULL;
+}
+
+/* Best-of-rounds lookups per second for one configuration */
+static double run(NexusHandleRegistry* registry, LinearRegistry* linear, char** paths,
+                  size_t count, size_t threads, size_t rounds) {
+    pthread_t* ids = malloc(threads * sizeof(pthread_t));
+    LookupWorker* workers = malloc(threads * sizeof(LookupWorker));
+    double best = 1e30;
+
+    for (size_t round = 0; round < rounds; round++) {
+        double start = now_seconds();
+        for (size_t t = 0; t < threads; t++) {
+            workers[t] = (LookupWorker){ registry, linear, paths, count, t * 7919, 0 };
+            pthread_create(&ids[t], NULL, lookup_worker, &workers[t]);
+        }
+        for (size_t t = 0; t < threads; t++) {
+            pthread_join(ids[t], NULL);
+            if (workers[t].found != LOOKUPS_PER_THREAD) {
+                fprintf(stderr, "thread %zu missed %zu lookups\n", t, LOOKUPS_PER_THREAD - workers[t].found);
+            }
+        }
+        double elapsed = now_seconds() - start;
+        if (elapsed < best) best = elapsed;
+    }
+
+    free(ids);
+    free(workers);
+    return (double)(threads * LOOKUPS_PER_THREAD) / best;
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? strtoul(argv[1], NULL, 10) : DEFAULT_COMPONENTS;
+    size_t threads = argc > 2 ? strtoul(argv[2], NULL, 10) : DEFAULT_THREADS;
+    size_t rounds = argc > 3 ? strtoul(argv[3], NULL, 10) : DEFAULT_ROUNDS;
+    if (count == 0) count = 1;
+    if (threads == 0) threads = 1;
+
+    NexusHandleRegistry* registry = nexus_init_handle_registry();
+    LinearRegistry linear = { malloc(count * sizeof(char*)), malloc(count * sizeof(void*)), count,
+                              PTHREAD_MUTEX_INITIALIZER };
+    char** paths = malloc(count * sizeof(char*));
+    char buffer[256];
+
+    for (size_t i = 0; i < count; i++) {
+        snprintf(buffer, sizeof(buffer), "/usr/local/lib/nlink/components/module_%zu/libmodule_%zu.so", i, i);
+        paths[i] = strdup(buffer);
+        linear.paths[i] = paths[i];
+        linear.handles[i] = dlopen(NULL, RTLD_LAZY);
+        nexus_register_component_handle(registry, linear.handles[i], paths[i], "module");
+    }
+
+    printf("components: %zu, %d lookups per thread, best of %zu rounds\n", count, LOOKUPS_PER_THREAD, rounds);
+    printf("%-28s %14s %14s\n", "configuration", "1 thread", "threads");
+    printf("%-28s %10.2f M/s %10.2f M/s\n", "hash index, lock-free",
+           run(registry, NULL, paths, count, 1, rounds) / 1e6,
+           run(registry, NULL, paths, count, threads, rounds) / 1e6);
+    printf("%-28s %10.2f M/s %10.2f M/s\n", "linear scan, mutex",
+           run(NULL, &linear, paths, count, 1, rounds) / 1e6,
+           run(NULL, &linear, paths, count, threads, rounds) / 1e6);
+
+    nexus_cleanup_handle_registry(registry);
+    for (size_t i = 0; i < count; i++) free(paths[i]);
+    free(paths);
+    free(linear.paths);
+    free(linear.handles);
+    return 0;
+}
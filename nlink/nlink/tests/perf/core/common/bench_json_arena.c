@@ -0,0 +1,231 @@
+/**
+ * @file bench_json_arena.c
+ * @brief Heap versus arena JSON parsing benchmark
+ *
+ * Reads the component metadata of the unicode_perf test set, converts each
+ * INI-style file to the equivalent JSON document and parses the whole set
+ * repeatedly: once with the heap parser (nexus_json_parse and
+ * nexus_json_free), once into a reused arena, and once into a fresh arena
+ * per document as the metadata loader does.
+ *
+ * Usage: bench_json_arena [component_dir] [rounds]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/common/json.h"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#define DEFAULT_COMPONENT_DIR "unicode_tests/performance/unicode_perf"
+#define DEFAULT_ROUNDS 20000
+#define MAX_DOCUMENTS 1024
+
+typedef struct {
+    char* data;
+    size_t length;
+    size_t capacity;
+} TextBuffer;
+
+static char* documents[MAX_DOCUMENTS];
+static size_t document_count = 0;
+static size_t document_bytes = 0;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void append(TextBuffer* buffer, const char* text, size_t length) {
+    if (buffer->length + length + 1 > buffer->capacity) {
+        buffer->capacity = (buffer->length + length + 1) * 2;
+        buffer->data = (char*)realloc(buffer->data, buffer->capacity);
+    }
+    memcpy(buffer->data + buffer->length, text, length);
+    buffer->length += length;
+    buffer->data[buffer->length] = '\0';
+}
+
+static void append_str(TextBuffer* buffer, const char* text) {
+    append(buffer, text, strlen(text));
+}
+
+static char* trim(char* s) {
+    while (isspace((unsigned char)*s)) s++;
+    char* end = s + strlen(s);
+    while (end > s && isspace((unsigned char)end[-1])) *--end = '\0';
+    return s;
+}
+
+/* Append an INI value as a JSON scalar */
+static void append_value(TextBuffer* buffer, char* value) {
+    size_t length = strlen(value);
+    if (length >= 2 && value[0] == '"' && value[length - 1] == '"') {
+        append(buffer, value, length);
+        return;
+    }
+
+    char* end;
+    strtod(value, &end);
+    if (strcmp(value, "true") == 0 || strcmp(value, "false") == 0 || (length > 0 && *end == '\0')) {
+        append(buffer, value, length);
+        return;
+    }
+
+    append_str(buffer, "\"");
+    for (const char* c = value; *c; c++) {
+        if (*c == '"' || *c == '\\') append_str(buffer, "\\");
+        append(buffer, c, 1);
+    }
+    append_str(buffer, "\"");
+}
+
+/* Convert "[section]" / "key = value" metadata into a JSON object of objects */
+static char* ini_to_json(FILE* file) {
+    TextBuffer json = { NULL, 0, 0 };
+    char line[1024];
+    bool in_section = false;
+    bool first_section = true;
+    bool first_key = true;
+
+    append_str(&json, "{");
+    while (fgets(line, sizeof(line), file)) {
+        char* text = trim(line);
+        if (*text == '\0' || *text == '#' || *text == ';') continue;
+
+        if (*text == '[') {
+            char* close = strchr(text, ']');
+            if (!close) continue;
+            *close = '\0';
+            append_str(&json, in_section ? "}," : (first_section ? "" : ","));
+            append_str(&json, "\n  \"");
+            append_str(&json, trim(text + 1));
+            append_str(&json, "\": {");
+            in_section = true;
+            first_section = false;
+            first_key = true;
+            continue;
+        }
+
+        char* equals = strchr(text, '=');
+        if (!equals || !in_section) continue;
+        *equals = '\0';
+
+        append_str(&json, first_key ? "\n    \"" : ",\n    \"");
+        append_str(&json, trim(text));
+        append_str(&json, "\": ");
+        append_value(&json, trim(equals + 1));
+        first_key = false;
+    }
+    append_str(&json, in_section ? "}\n}" : "}");
+
+    return json.data;
+}
+
+/* Load every metadata file under a directory */
+static void load_documents(const char* path) {
+    DIR* dir = opendir(path);
+    if (!dir) return;
+
+    struct dirent* entry;
+    while ((entry = readdir(dir)) && document_count < MAX_DOCUMENTS) {
+        if (entry->d_name[0] == '.') continue;
+
+        char child[4096];
+        snprintf(child, sizeof(child), "%s/%s", path, entry->d_name);
+
+        struct stat st;
+        if (stat(child, &st) != 0) continue;
+
+        if (S_ISDIR(st.st_mode)) {
+            load_documents(child);
+        } else if (strstr(entry->d_name, ".txt") || strstr(entry->d_name, ".nlink")) {
+            FILE* file = fopen(child, "r");
+            if (!file) continue;
+            char* json = ini_to_json(file);
+            fclose(file);
+
+            documents[document_count++] = json;
+            document_bytes += strlen(json);
+        }
+    }
+
+    closedir(dir);
+}
+
+int main(int argc, char* argv[]) {
+    const char* component_dir = argc > 1 ? argv[1] : DEFAULT_COMPONENT_DIR;
+    size_t rounds = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : DEFAULT_ROUNDS;
+    if (rounds == 0) {
+        rounds = DEFAULT_ROUNDS;
+    }
+
+    load_documents(component_dir);
+    if (document_count == 0) {
+        fprintf(stderr, "No metadata found under %s\n", component_dir);
+        return 1;
+    }
+
+    printf("Loaded %zu documents (%zu bytes of JSON) from %s\n",
+           document_count, document_bytes, component_dir);
+
+    size_t parsed = 0;
+    size_t expected = rounds * document_count;
+
+    /* Heap parser: one allocation per value, key and string */
+    double start = now_seconds();
+    for (size_t r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < document_count; i++) {
+            NexusJsonValue* root = nexus_json_parse(documents[i]);
+            if (root) {
+                parsed++;
+                nexus_json_free(root);
+            }
+        }
+    }
+    double heap_time = now_seconds() - start;
+
+    /* One arena reset between documents: no allocation in steady state */
+    NexusJsonArena* arena = nexus_json_arena_create(0);
+    start = now_seconds();
+    for (size_t r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < document_count; i++) {
+            if (nexus_json_parse_arena(arena, documents[i])) {
+                parsed++;
+            }
+            nexus_json_arena_reset(arena);
+        }
+    }
+    double reuse_time = now_seconds() - start;
+    nexus_json_arena_destroy(arena);
+
+    /* A fresh arena per document, as nexus_load_metadata does */
+    start = now_seconds();
+    for (size_t r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < document_count; i++) {
+            NexusJsonArena* doc_arena = nexus_json_arena_create(0);
+            if (nexus_json_parse_arena(doc_arena, documents[i])) {
+                parsed++;
+            }
+            nexus_json_arena_destroy(doc_arena);
+        }
+    }
+    double fresh_time = now_seconds() - start;
+
+    double megabytes = (double)document_bytes * (double)rounds / (1024.0 * 1024.0);
+    printf("Heap parser:     %8.1f MB/s %10.0f docs/s\n",
+           megabytes / heap_time, expected / heap_time);
+    printf("Arena (reused):  %8.1f MB/s %10.0f docs/s (%.1fx)\n",
+           megabytes / reuse_time, expected / reuse_time, heap_time / reuse_time);
+    printf("Arena (per doc): %8.1f MB/s %10.0f docs/s (%.1fx)\n",
+           megabytes / fresh_time, expected / fresh_time, heap_time / fresh_time);
+    printf("Parsed: %zu/%zu\n", parsed, 3 * expected);
+
+    for (size_t i = 0; i < document_count; i++) {
+        free(documents[i]);
+    }
+
+    return parsed == 3 * expected ? 0 : 1;
+}
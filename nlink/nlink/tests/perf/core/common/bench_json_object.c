@@ -0,0 +1,88 @@
+/**
+ * @file bench_json_object.c
+ * @brief JSON object key lookup benchmark
+ *
+ * Builds objects of 10 to 10,000 keys and looks every key up repeatedly
+ * three ways: the linear strcmp scan nexus_json_object_get used to do,
+ * nexus_json_object_get (which hashes the key once per call), and
+ * nexus_json_object_get_key with keys hashed ahead of time.
+ *
+ * Usage: bench_json_object [lookups_per_size]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/common/json.h"
+#include <time.h>
+
+#define DEFAULT_LOOKUPS 2000000
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* The lookup as it was before objects were indexed */
+static NexusJsonValue* linear_get(NexusJsonValue* object, const char* key) {
+    for (size_t i = 0; i < object->data.object.count; i++) {
+        if (strcmp(object->data.object.keys[i], key) == 0) {
+            return object->data.object.values[i];
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char* argv[]) {
+    size_t lookups = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_LOOKUPS;
+    if (lookups == 0) lookups = DEFAULT_LOOKUPS;
+
+    static const size_t sizes[] = { 10, 100, 1000, 10000 };
+    printf("%8s %14s %14s %14s\n", "keys", "linear/s", "get/s", "get_key/s");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t count = sizes[s];
+        NexusJsonValue* object = nexus_json_object();
+        char** names = (char**)malloc(count * sizeof(char*));
+        NexusJsonKey* keys = (NexusJsonKey*)malloc(count * sizeof(NexusJsonKey));
+
+        for (size_t i = 0; i < count; i++) {
+            char name[48];
+            snprintf(name, sizeof(name), "component.field_%zu", i);
+            nexus_json_object_add(object, name, nexus_json_number((double)i));
+            names[i] = object->data.object.keys[i];
+            keys[i] = nexus_json_key(names[i]);
+        }
+
+        /* The linear scan is quadratic overall, so it gets fewer lookups */
+        size_t linear_lookups = lookups / (count / 10 + 1);
+        size_t hits = 0;
+
+        double start = now_seconds();
+        for (size_t i = 0; i < linear_lookups; i++) {
+            hits += linear_get(object, names[(i * 7919) % count]) != NULL;
+        }
+        double linear_rate = (double)linear_lookups / (now_seconds() - start);
+
+        start = now_seconds();
+        for (size_t i = 0; i < lookups; i++) {
+            hits += nexus_json_object_get(object, names[(i * 7919) % count]) != NULL;
+        }
+        double get_rate = (double)lookups / (now_seconds() - start);
+
+        start = now_seconds();
+        for (size_t i = 0; i < lookups; i++) {
+            hits += nexus_json_object_get_key(object, &keys[(i * 7919) % count]) != NULL;
+        }
+        double key_rate = (double)lookups / (now_seconds() - start);
+
+        printf("%8zu %14.0f %14.0f %14.0f%s\n", count, linear_rate, get_rate, key_rate,
+               hits == linear_lookups + 2 * lookups ? "" : "  (missed keys)");
+
+        nexus_json_free(object);
+        free(names);
+        free(keys);
+    }
+
+    return 0;
+}
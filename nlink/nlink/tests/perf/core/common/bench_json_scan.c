@@ -0,0 +1,98 @@
+/**
+ * @file bench_json_scan.c
+ * @brief Large pipeline configuration parsing benchmark
+ *
+ * Generates a pretty-printed pipeline.json with one stage object per
+ * component, mixing identifiers, escaped paths, integers and decimals, and
+ * reports the best-round throughput of the heap and arena parsers. Run it
+ * against two builds to compare scanning and number parsing changes.
+ *
+ * Usage: bench_json_scan [components] [rounds]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/common/json.h"
+#include <time.h>
+
+#define DEFAULT_COMPONENTS 20000
+#define DEFAULT_ROUNDS 20
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* Pretty-printed pipeline.json with one stage object per component */
+static char* generate_pipeline(size_t components) {
+    size_t capacity = components * 512 + 256;
+    char* text = (char*)malloc(capacity);
+    size_t length = 0;
+
+    length += (size_t)snprintf(text + length, capacity - length,
+                               "{\n  \"pipeline_id\": \"bench\",\n"
+                               "  \"description\": \"Generated \\\"benchmark\\\" pipeline\",\n"
+                               "  \"components\": [\n");
+    for (size_t i = 0; i < components; i++) {
+        length += (size_t)snprintf(text + length, capacity - length,
+                                   "    {\n"
+                                   "      \"component_id\": \"stage_%zu\",\n"
+                                   "      \"version_constraint\": \"^1.%zu.0\",\n"
+                                   "      \"path\": \"lib\\\\components\\\\stage_%zu.so\",\n"
+                                   "      \"optional\": %s,\n"
+                                   "      \"priority\": %zu,\n"
+                                   "      \"weight\": %zu.25,\n"
+                                   "      \"dependencies\": [\"stage_%zu\", \"stage_%zu\"]\n"
+                                   "    }%s\n",
+                                   i, i % 32, i, i % 3 ? "false" : "true", i % 10, i,
+                                   i / 2, i / 3, i + 1 < components ? "," : "");
+    }
+    snprintf(text + length, capacity - length, "  ]\n}\n");
+    return text;
+}
+
+int main(int argc, char* argv[]) {
+    size_t components = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_COMPONENTS;
+    size_t rounds = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : DEFAULT_ROUNDS;
+    if (components == 0) components = DEFAULT_COMPONENTS;
+    if (rounds == 0) rounds = DEFAULT_ROUNDS;
+
+    char* text = generate_pipeline(components);
+    double megabytes = (double)strlen(text) / (1024.0 * 1024.0);
+    printf("Document: %zu components, %.1f MB\n", components, megabytes);
+
+    /* Best round rather than the mean, to keep scheduler noise out */
+    size_t parsed = 0;
+    double heap_best = 1e30;
+    for (size_t r = 0; r < rounds; r++) {
+        double start = now_seconds();
+        NexusJsonValue* root = nexus_json_parse(text);
+        double elapsed = now_seconds() - start;
+        if (root) {
+            parsed++;
+            nexus_json_free(root);
+        }
+        if (elapsed < heap_best) heap_best = elapsed;
+    }
+
+    NexusJsonArena* arena = nexus_json_arena_create(0);
+    double arena_best = 1e30;
+    for (size_t r = 0; r < rounds; r++) {
+        double start = now_seconds();
+        if (nexus_json_parse_arena(arena, text)) {
+            parsed++;
+        }
+        double elapsed = now_seconds() - start;
+        nexus_json_arena_reset(arena);
+        if (elapsed < arena_best) arena_best = elapsed;
+    }
+    nexus_json_arena_destroy(arena);
+
+    printf("Heap parser:  %8.1f MB/s\n", megabytes / heap_best);
+    printf("Arena parser: %8.1f MB/s\n", megabytes / arena_best);
+    printf("Parsed: %zu/%zu\n", parsed, 2 * rounds);
+
+    free(text);
+    return parsed == 2 * rounds ? 0 : 1;
+}
@@ -0,0 +1,171 @@
+/**
+ * @file bench_json_writer.c
+ * @brief Streaming JSON output benchmark
+ *
+ * Writes a telemetry-style event log to /dev/null three ways: through the
+ * writer's event API with its bounded buffer, by serializing a value tree
+ * through the writer, and with the per-field fprintf calls event exporters
+ * have used. Also times number formatting against snprintf("%.17g").
+ * Reports the best-round throughput of each.
+ *
+ * Usage: bench_json_writer [events] [rounds]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/common/json.h"
+#include <fcntl.h>
+#include <time.h>
+
+#define DEFAULT_EVENTS 200000
+#define DEFAULT_ROUNDS 10
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* Event log through the writer; returns the bytes written */
+static size_t write_events(int fd, size_t events) {
+    static char buffer[NEXUS_JSON_WRITER_BUFFER];
+    NexusJsonWriter writer;
+    size_t bytes = 0;
+
+    nexus_json_writer_init_fd(&writer, fd, buffer, sizeof(buffer), 2);
+    nexus_json_writer_begin_object(&writer);
+    nexus_json_writer_key(&writer, "events");
+    nexus_json_writer_begin_array(&writer);
+    for (size_t i = 0; i < events; i++) {
+        nexus_json_writer_begin_object(&writer);
+        nexus_json_writer_key(&writer, "id");
+        nexus_json_writer_integer(&writer, (int64_t)i);
+        nexus_json_writer_key(&writer, "component");
+        nexus_json_writer_string(&writer, i % 2 ? "tokenizer" : "parser");
+        nexus_json_writer_key(&writer, "timestamp");
+        nexus_json_writer_number(&writer, 1700000000.0 + (double)i * 0.001);
+        nexus_json_writer_key(&writer, "latency_ms");
+        nexus_json_writer_number(&writer, (double)(i % 997) * 0.125);
+        nexus_json_writer_key(&writer, "ok");
+        nexus_json_writer_bool(&writer, i % 7 != 0);
+        nexus_json_writer_end_object(&writer);
+
+        // Count bytes before each flush resets the buffer
+        if (writer.capacity - writer.length < 256) {
+            bytes += writer.length;
+            nexus_json_writer_flush(&writer);
+        }
+    }
+    nexus_json_writer_end_array(&writer);
+    nexus_json_writer_end_object(&writer);
+    bytes += writer.length;
+    nexus_json_writer_finish(&writer);
+    return bytes;
+}
+
+/* The same events with one fprintf per field */
+static void fprintf_events(FILE* file, size_t events) {
+    fprintf(file, "{\n  \"events\": [\n");
+    for (size_t i = 0; i < events; i++) {
+        fprintf(file, "    {\n");
+        fprintf(file, "      \"id\": %zu,\n", i);
+        fprintf(file, "      \"component\": \"%s\",\n", i % 2 ? "tokenizer" : "parser");
+        fprintf(file, "      \"timestamp\": %.17g,\n", 1700000000.0 + (double)i * 0.001);
+        fprintf(file, "      \"latency_ms\": %.17g,\n", (double)(i % 997) * 0.125);
+        fprintf(file, "      \"ok\": %s\n", i % 7 != 0 ? "true" : "false");
+        fprintf(file, "    }%s\n", i + 1 < events ? "," : "");
+    }
+    fprintf(file, "  ]\n}");
+    fflush(file);
+}
+
+static NexusJsonValue* build_tree(size_t events) {
+    NexusJsonValue* list = nexus_json_array();
+    for (size_t i = 0; i < events; i++) {
+        NexusJsonValue* event = nexus_json_object();
+        nexus_json_object_add(event, "id", nexus_json_number((double)i));
+        nexus_json_object_add(event, "component", nexus_json_string(i % 2 ? "tokenizer" : "parser"));
+        nexus_json_object_add(event, "timestamp", nexus_json_number(1700000000.0 + (double)i * 0.001));
+        nexus_json_object_add(event, "latency_ms", nexus_json_number((double)(i % 997) * 0.125));
+        nexus_json_object_add(event, "ok", nexus_json_bool(i % 7 != 0));
+        nexus_json_array_add(list, event);
+    }
+    NexusJsonValue* root = nexus_json_object();
+    nexus_json_object_add(root, "events", list);
+    return root;
+}
+
+int main(int argc, char* argv[]) {
+    size_t events = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_EVENTS;
+    size_t rounds = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : DEFAULT_ROUNDS;
+    if (events == 0) events = DEFAULT_EVENTS;
+    if (rounds == 0) rounds = DEFAULT_ROUNDS;
+
+    int fd = open("/dev/null", O_WRONLY);
+    FILE* null_file = fopen("/dev/null", "w");
+    if (fd < 0 || !null_file) {
+        fprintf(stderr, "cannot open /dev/null\n");
+        return 1;
+    }
+
+    NexusJsonValue* tree = build_tree(events);
+    char* reference = nexus_json_to_string(tree, true);
+    size_t tree_bytes = strlen(reference);
+    free(reference);
+
+    double best_events = 1e30, best_tree = 1e30, best_fprintf = 1e30;
+    size_t event_bytes = 0;
+    for (size_t r = 0; r < rounds; r++) {
+        double start = now_seconds();
+        event_bytes = write_events(fd, events);
+        double elapsed = now_seconds() - start;
+        if (elapsed < best_events) best_events = elapsed;
+
+        NexusJsonWriter writer;
+        start = now_seconds();
+        nexus_json_writer_init_fd(&writer, fd, NULL, 0, 2);
+        nexus_json_writer_value(&writer, tree);
+        nexus_json_writer_finish(&writer);
+        elapsed = now_seconds() - start;
+        if (elapsed < best_tree) best_tree = elapsed;
+
+        start = now_seconds();
+        fprintf_events(null_file, events);
+        elapsed = now_seconds() - start;
+        if (elapsed < best_fprintf) best_fprintf = elapsed;
+    }
+
+    printf("events: %zu, output: %.1f MB, writer buffer: %d KB\n",
+           events, (double)event_bytes / 1e6, NEXUS_JSON_WRITER_BUFFER / 1024);
+    printf("writer events:  %8.1f MB/s\n", (double)event_bytes / best_events / 1e6);
+    printf("writer tree:    %8.1f MB/s\n", (double)tree_bytes / best_tree / 1e6);
+    printf("fprintf fields: %8.1f MB/s (output sized as writer events)\n", (double)event_bytes / best_fprintf / 1e6);
+
+    // Number formatting alone
+    size_t count = events * 10;
+    double best_format = 1e30, best_snprintf = 1e30;
+    volatile size_t sink = 0;
+    for (size_t r = 0; r < rounds; r++) {
+        char text[32];
+        double start = now_seconds();
+        for (size_t i = 0; i < count; i++) {
+            sink += nexus_json_format_number(text, (double)i / 100.0);
+        }
+        double elapsed = now_seconds() - start;
+        if (elapsed < best_format) best_format = elapsed;
+
+        start = now_seconds();
+        for (size_t i = 0; i < count; i++) {
+            sink += (size_t)snprintf(text, sizeof(text), "%.17g", (double)i / 100.0);
+        }
+        elapsed = now_seconds() - start;
+        if (elapsed < best_snprintf) best_snprintf = elapsed;
+    }
+    printf("format_number:  %8.1f M/s\n", (double)count / best_format / 1e6);
+    printf("snprintf %%.17g: %8.1f M/s\n", (double)count / best_snprintf / 1e6);
+
+    nexus_json_free(tree);
+    fclose(null_file);
+    close(fd);
+    return 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file bench_metadata_cache.c
+ * @brief Cold versus warm component metadata startup
+ *
+ * Generates metadata JSON files for a set of components, then times
+ * loading all of them three ways: parsing every file, a cold start that
+ * parses and writes the binary cache, and a warm start that maps the
+ * cache. Files stay in the page cache, so the difference is parsing and
+ * allocation.
+ *
+ * Usage: bench_metadata_cache [components] [rounds]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/metadata/metadata_cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define DEFAULT_COMPONENTS 200
+#define DEFAULT_ROUNDS 5
+#define DEPENDENCIES 4
+#define SYMBOLS 24
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void write_component(const char* path, size_t index, size_t count) {
+    FILE* file = fopen(path, "w");
+    if (!file) return;
+
+    fprintf(file, "{\n  \"id\": \"component_%zu\",\n  \"version\": \"1.%zu.%zu\",\n", index, index % 10, index % 7);
+    fprintf(file, "  \"description\": \"Generated component %zu for the metadata cache benchmark\",\n", index);
+    fprintf(file, "  \"dependencies\": [\n");
+    for (size_t d = 0; d < DEPENDENCIES; d++) {
+        fprintf(file, "    {\"id\": \"component_%zu\", \"version_req\": \">=1.%zu <2.0 || ^3.0.0\", \"optional\": %s}%s\n",
+                (index + d + 1) % count, d, d == 3 ? "true" : "false", d + 1 < DEPENDENCIES ? "," : "");
+    }
+    fprintf(file, "  ],\n  \"exported_symbols\": [\n");
+    for (size_t s = 0; s < SYMBOLS; s++) {
+        fprintf(file, "    {\"name\": \"component_%zu_function_%zu\", \"version\": \"1.%zu.0\", \"type\": %zu}%s\n",
+                index, s, s % 3, s % 4, s + 1 < SYMBOLS ? "," : "");
+    }
+    fprintf(file, "  ],\n  \"imported_symbols\": [\n");
+    for (size_t s = 0; s < SYMBOLS / 2; s++) {
+        fprintf(file, "    {\"name\": \"component_%zu_function_%zu\", \"version\": \"^1.0.0\", \"type\": 0}%s\n",
+                (index + 1) % count, s, s + 1 < SYMBOLS / 2 ? "," : "");
+    }
+    fprintf(file, "  ],\n  \"memory_footprint\": %zu,\n  \"avg_load_time_ms\": 0.25\n}\n", 4096 + index);
+    fclose(file);
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? strtoul(argv[1], NULL, 10) : DEFAULT_COMPONENTS;
+    size_t rounds = argc > 2 ? strtoul(argv[2], NULL, 10) : DEFAULT_ROUNDS;
+    if (count == 0) count = 1;
+    if (rounds == 0) rounds = 1;
+
+    char dir[] = "/tmp/nlink_metadata_bench_XXXXXX";
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+
+    char cache_path[256];
+    snprintf(cache_path, sizeof(cache_path), "%s/metadata.cache", dir);
+    char** paths = malloc(count * sizeof(char*));
+    EnhancedComponentMetadata** metadata = malloc(count * sizeof(EnhancedComponentMetadata*));
+    for (size_t i = 0; i < count; i++) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s/component_%zu.json", dir, i);
+        paths[i] = strdup(path);
+        write_component(paths[i], i, count);
+    }
+
+    double best[3] = { 1e30, 1e30, 1e30 };
+    for (size_t round = 0; round < rounds; round++) {
+        // Parse every file, as startup does today
+        double start = now_seconds();
+        for (size_t i = 0; i < count; i++) {
+            metadata[i] = nexus_load_enhanced_metadata(paths[i]);
+        }
+        double elapsed = now_seconds() - start;
+        for (size_t i = 0; i < count; i++) {
+            nexus_free_enhanced_metadata(metadata[i]);
+        }
+        if (elapsed < best[0]) best[0] = elapsed;
+
+        // Cold start: parse, write the cache and map it
+        unlink(cache_path);
+        start = now_seconds();
+        NexusMetadataCache* cache = nexus_metadata_cache_load(cache_path, (const char* const*)paths, count, metadata);
+        elapsed = now_seconds() - start;
+        if (!cache || nexus_metadata_cache_count(cache) != count) {
+            fprintf(stderr, "cold start cached %zu of %zu components\n", nexus_metadata_cache_count(cache), count);
+        }
+        nexus_metadata_cache_close(cache);
+        if (elapsed < best[1]) best[1] = elapsed;
+
+        // Warm start: map the cache and validate every entry
+        start = now_seconds();
+        cache = nexus_metadata_cache_load(cache_path, (const char* const*)paths, count, metadata);
+        elapsed = now_seconds() - start;
+        for (size_t i = 0; i < count; i++) {
+            if (!metadata[i]) {
+                fprintf(stderr, "warm start missed %s\n", paths[i]);
+                break;
+            }
+        }
+        nexus_metadata_cache_close(cache);
+        if (elapsed < best[2]) best[2] = elapsed;
+    }
+
+    printf("components: %zu, best of %zu rounds\n", count, rounds);
+    printf("%-32s %10s %14s\n", "startup", "total ms", "us/component");
+    printf("%-32s %10.3f %14.2f\n", "parse JSON", best[0] * 1e3, best[0] * 1e6 / (double)count);
+    printf("%-32s %10.3f %14.2f\n", "cold: parse, write cache, map", best[1] * 1e3, best[1] * 1e6 / (double)count);
+    printf("%-32s %10.3f %14.2f\n", "warm: map cache", best[2] * 1e3, best[2] * 1e6 / (double)count);
+
+    unlink(cache_path);
+    for (size_t i = 0; i < count; i++) {
+        unlink(paths[i]);
+        free(paths[i]);
+    }
+    rmdir(dir);
+    free(paths);
+    free(metadata);
+    return 0;
+}
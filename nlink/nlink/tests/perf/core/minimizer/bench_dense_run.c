@@ -0,0 +1,129 @@
+/**
+ * @file bench_dense_run.c
+ * @brief Dense automaton execution benchmark
+ *
+ * Streams random input through a generated DFA three ways: the pointer and
+ * strcmp walk over OkpalaState transitions, the dense CSR layout and the
+ * dense flat table, and reports throughput in input symbols per second.
+ *
+ * Usage: bench_dense_run [input_megabytes]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/minimizer/okpala_automaton.h"
+#include "nlink/core/minimizer/okpala_dense.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define STATE_COUNT 1024
+#define SYMBOL_COUNT 16
+#define DEFAULT_INPUT_MB 64
+#define POINTER_INPUT_LIMIT (4u << 20)
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* Complete DFA over the bytes 'a'..'p' with random transitions */
+static OkpalaAutomaton* generate_dfa(unsigned int seed) {
+    OkpalaAutomaton* automaton = okpala_automaton_create();
+    char id[32];
+    char symbol[2] = { 0, 0 };
+
+    for (size_t i = 0; i < STATE_COUNT; i++) {
+        snprintf(id, sizeof(id), "s%zu", i);
+        okpala_automaton_add_state(automaton, id, (i % 7) == 0);
+    }
+
+    for (size_t i = 0; i < STATE_COUNT; i++) {
+        char target[32];
+        snprintf(id, sizeof(id), "s%zu", i);
+        for (size_t c = 0; c < SYMBOL_COUNT; c++) {
+            seed = seed * 1103515245u + 12345u;
+            snprintf(target, sizeof(target), "s%u", (seed >> 8) % STATE_COUNT);
+            symbol[0] = (char)('a' + c);
+            okpala_automaton_add_transition(automaton, id, target, symbol);
+        }
+    }
+
+    return automaton;
+}
+
+/* Execution as it had to be done on OkpalaAutomaton directly */
+static OkpalaState* pointer_run(OkpalaAutomaton* automaton, const char* input, size_t length) {
+    OkpalaState* state = &automaton->states[0];
+    char symbol[2] = { 0, 0 };
+
+    for (size_t i = 0; i < length && state; i++) {
+        OkpalaState* next = NULL;
+        symbol[0] = input[i];
+        for (size_t t = 0; t < state->transition_count; t++) {
+            if (strcmp(state->input_symbols[t], symbol) == 0) {
+                next = state->transitions[t];
+                break;
+            }
+        }
+        state = next;
+    }
+
+    return state;
+}
+
+int main(int argc, char* argv[]) {
+    size_t megabytes = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_INPUT_MB;
+    size_t length = (megabytes ? megabytes : DEFAULT_INPUT_MB) << 20;
+    size_t pointer_length = length < POINTER_INPUT_LIMIT ? length : POINTER_INPUT_LIMIT;
+
+    OkpalaAutomaton* automaton = generate_dfa(42);
+    OkpalaDenseAutomaton* flat = okpala_dense_create(automaton, OKPALA_LAYOUT_FLAT);
+    OkpalaDenseAutomaton* csr = okpala_dense_create(automaton, OKPALA_LAYOUT_CSR);
+    char* input = (char*)malloc(length);
+    if (!flat || !csr || !input) {
+        fprintf(stderr, "Setup failed\n");
+        return 1;
+    }
+
+    unsigned int seed = 7;
+    for (size_t i = 0; i < length; i++) {
+        seed = seed * 1103515245u + 12345u;
+        input[i] = (char)('a' + (seed >> 16) % SYMBOL_COUNT);
+    }
+
+    double start = now_seconds();
+    OkpalaState* pointer_end = pointer_run(automaton, input, pointer_length);
+    double pointer_rate = pointer_length / (now_seconds() - start);
+
+    start = now_seconds();
+    uint32_t csr_end = okpala_dense_run_bytes(csr, csr->initial_state, input, length);
+    double csr_rate = length / (now_seconds() - start);
+
+    start = now_seconds();
+    uint32_t flat_end = okpala_dense_run_bytes(flat, flat->initial_state, input, length);
+    double flat_rate = length / (now_seconds() - start);
+
+    uint32_t check_end = okpala_dense_run_bytes(flat, flat->initial_state, input, pointer_length);
+
+    printf("Automaton: %d states, %d symbols, input %zu MB\n", STATE_COUNT, SYMBOL_COUNT, length >> 20);
+    printf("Pointer walk: %12.0f symbols/s\n", pointer_rate);
+    printf("Dense CSR:    %12.0f symbols/s (%.1fx)\n", csr_rate, csr_rate / pointer_rate);
+    printf("Dense flat:   %12.0f symbols/s (%.1fx)\n", flat_rate, flat_rate / pointer_rate);
+
+    int failures = 0;
+    if (csr_end != flat_end || !pointer_end ||
+        (uint32_t)(pointer_end - automaton->states) != check_end) {
+        fprintf(stderr, "Runs disagree\n");
+        failures++;
+    }
+
+    free(input);
+    okpala_dense_free(flat);
+    okpala_dense_free(csr);
+    okpala_automaton_free(automaton);
+
+    return failures ? 1 : 0;
+}
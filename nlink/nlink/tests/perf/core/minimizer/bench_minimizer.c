@@ -0,0 +1,154 @@
+/**
+ * @file bench_minimizer.c
+ * @brief Automaton minimization benchmark
+ *
+ * Generates DFAs from 1k to 1M states with known redundancy and compares
+ * the partition-refinement okpala_minimize_automaton against the pairwise
+ * matrix okpala_minimize_automaton_reference. The reference needs O(n²)
+ * memory, so it only runs up to a size limit; where both run, their
+ * results are checked for equality.
+ *
+ * Usage: bench_minimizer [reference_limit]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/minimizer/okpala_automaton.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SYMBOL_COUNT 4
+#define COPIES 8
+#define DEFAULT_REFERENCE_LIMIT 4096
+
+static const char* const SYMBOLS[SYMBOL_COUNT] = { "a", "b", "c", "d" };
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/*
+ * Build a complete DFA of n states made of COPIES interleaved copies of a
+ * random base DFA. Each transition targets a random copy of the base target,
+ * so the minimal automaton has at most n / COPIES states. The states array is
+ * filled directly because okpala_automaton_add_state looks up ids linearly.
+ */
+static OkpalaAutomaton* generate_dfa(size_t n, unsigned int seed) {
+    size_t base = n / COPIES ? n / COPIES : 1;
+    OkpalaAutomaton* automaton = okpala_automaton_create();
+    automaton->states = (OkpalaState*)calloc(n, sizeof(OkpalaState));
+    automaton->final_states = (OkpalaState**)malloc(n * sizeof(OkpalaState*));
+    automaton->state_count = n;
+    automaton->initial_state = &automaton->states[0];
+
+    size_t* base_target = (size_t*)malloc(base * SYMBOL_COUNT * sizeof(size_t));
+    for (size_t i = 0; i < base * SYMBOL_COUNT; i++) {
+        seed = seed * 1103515245u + 12345u;
+        base_target[i] = (seed >> 8) % base;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        OkpalaState* state = &automaton->states[i];
+        size_t b = i % base;
+        char id[32];
+
+        snprintf(id, sizeof(id), "s%zu", i);
+        state->id = strdup(id);
+        state->is_final = (b % 5) == 0;
+        if (state->is_final) {
+            automaton->final_states[automaton->final_state_count++] = state;
+        }
+
+        state->transitions = (OkpalaState**)malloc(SYMBOL_COUNT * sizeof(OkpalaState*));
+        state->input_symbols = (char**)malloc(SYMBOL_COUNT * sizeof(char*));
+        for (size_t c = 0; c < SYMBOL_COUNT; c++) {
+            seed = seed * 1103515245u + 12345u;
+            size_t copy = (seed >> 8) % COPIES;
+            size_t target = base_target[b * SYMBOL_COUNT + c] + copy * base;
+            if (target >= n) {
+                target = base_target[b * SYMBOL_COUNT + c];
+            }
+            state->transitions[c] = &automaton->states[target];
+            state->input_symbols[c] = strdup(SYMBOLS[c]);
+        }
+        state->transition_count = SYMBOL_COUNT;
+    }
+
+    free(base_target);
+    return automaton;
+}
+
+/* Compare two minimized automata state by state */
+static int same_automaton(const OkpalaAutomaton* a, const OkpalaAutomaton* b) {
+    if (a->state_count != b->state_count) {
+        return 0;
+    }
+
+    for (size_t i = 0; i < a->state_count; i++) {
+        const OkpalaState* x = &a->states[i];
+        const OkpalaState* y = &b->states[i];
+        if (x->is_final != y->is_final || x->transition_count != y->transition_count) {
+            return 0;
+        }
+        for (size_t j = 0; j < x->transition_count; j++) {
+            if (strcmp(x->input_symbols[j], y->input_symbols[j]) != 0 ||
+                x->transitions[j] - a->states != y->transitions[j] - b->states) {
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    static const size_t sizes[] = { 1000, 4000, 16000, 64000, 256000, 1000000 };
+    size_t reference_limit = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10)
+                                      : DEFAULT_REFERENCE_LIMIT;
+    int failures = 0;
+
+    printf("%10s %10s %14s %14s %8s\n", "states", "minimal", "hopcroft ms", "reference ms", "speedup");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t n = sizes[s];
+        OkpalaAutomaton* automaton = generate_dfa(n, (unsigned int)(n * 2654435761u));
+
+        double start = now_seconds();
+        OkpalaAutomaton* minimized = okpala_minimize_automaton(automaton, false);
+        double hopcroft_time = now_seconds() - start;
+
+        if (!minimized) {
+            fprintf(stderr, "Minimization failed for %zu states\n", n);
+            okpala_automaton_free(automaton);
+            return 1;
+        }
+
+        if (n <= reference_limit) {
+            start = now_seconds();
+            OkpalaAutomaton* reference = okpala_minimize_automaton_reference(automaton, false);
+            double reference_time = now_seconds() - start;
+
+            if (!reference || !same_automaton(minimized, reference)) {
+                fprintf(stderr, "Results differ for %zu states\n", n);
+                failures++;
+            }
+
+            printf("%10zu %10zu %14.3f %14.3f %7.1fx\n", n, minimized->state_count,
+                   hopcroft_time * 1000.0, reference_time * 1000.0,
+                   reference_time / hopcroft_time);
+            okpala_automaton_free(reference);
+        } else {
+            printf("%10zu %10zu %14.3f %14s %8s\n", n, minimized->state_count,
+                   hopcroft_time * 1000.0, "-", "-");
+        }
+
+        okpala_automaton_free(minimized);
+        okpala_automaton_free(automaton);
+    }
+
+    return failures ? 1 : 0;
+}
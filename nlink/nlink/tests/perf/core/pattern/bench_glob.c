@@ -0,0 +1,169 @@
+/**
+ * @file bench_glob.c
+ * @brief Glob matching throughput over component path lists
+ *
+ * Matches a generated list of component library paths against single
+ * globs (compiled programs next to fnmatch), then against a set of globs
+ * three ways: one pass through an NlinkPatternSet, one compiled matcher
+ * per glob, and fnmatch per glob.
+ *
+ * Usage: bench_glob [paths] [rounds]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/pattern/matcher.h"
+#include <fnmatch.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_PATHS 100000
+#define DEFAULT_ROUNDS 5
+#define SET_PATTERNS 32
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static char** generate_paths(size_t count, size_t* total_bytes) {
+    static const char* names[] = { "tokenizer", "parser", "lexer", "minimizer", "symbols", "pipeline", "loader" };
+    static const char* roots[] = { "lib/components", "build/out/lib", "/usr/local/lib/nlink", "src/core" };
+    char** paths = malloc(count * sizeof(char*));
+    char buffer[256];
+
+    *total_bytes = 0;
+    for (size_t i = 0; i < count; i++) {
+        const char* name = names[i % 7];
+        const char* root = roots[(i / 7) % 4];
+        if (i % 5 == 4) {
+            snprintf(buffer, sizeof(buffer), "%s/%s_%zu/%s_impl.c", root, name, i, name);
+        } else {
+            snprintf(buffer, sizeof(buffer), "%s/%s_%zu/lib%s.so.%zu.%zu", root, name, i, name, i % 4, i % 17);
+        }
+        paths[i] = strdup(buffer);
+        *total_bytes += strlen(buffer);
+    }
+    return paths;
+}
+
+static void report(const char* label, size_t matches, size_t bytes, double seconds) {
+    printf("%-36s %8zu %8.1f MB/s\n", label, matches, (double)bytes / seconds / 1e6);
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_PATHS;
+    size_t rounds = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : DEFAULT_ROUNDS;
+    if (count == 0) count = DEFAULT_PATHS;
+    if (rounds == 0) rounds = DEFAULT_ROUNDS;
+
+    static const char* patterns[] = {
+        "lib/components/*.so*",
+        "*/lib*.so.[0-3].1?",
+        "*_[0-9]*[0-9]/*_impl.c",
+        "*a*a*a*a*a*a*x"
+    };
+
+    size_t total_bytes;
+    char** paths = generate_paths(count, &total_bytes);
+
+    printf("paths: %zu, %.1f MB, best of %zu rounds\n", count, (double)total_bytes / 1e6, rounds);
+    printf("%-36s %8s %8s %8s\n", "pattern", "matches", "nlink", "fnmatch");
+
+    for (size_t p = 0; p < sizeof(patterns) / sizeof(patterns[0]); p++) {
+        NlinkPatternMatcher* matcher = nlink_pattern_create(patterns[p], NLINK_PATTERN_FLAG_GLOB);
+        double best[2] = { 1e30, 1e30 };
+        size_t matches[2] = { 0, 0 };
+
+        for (size_t r = 0; r < rounds; r++) {
+            double start = now_seconds();
+            matches[0] = 0;
+            for (size_t i = 0; i < count; i++) {
+                matches[0] += nlink_pattern_match(matcher, paths[i]);
+            }
+            double elapsed = now_seconds() - start;
+            if (elapsed < best[0]) best[0] = elapsed;
+
+            start = now_seconds();
+            matches[1] = 0;
+            for (size_t i = 0; i < count; i++) {
+                matches[1] += fnmatch(patterns[p], paths[i], 0) == 0;
+            }
+            elapsed = now_seconds() - start;
+            if (elapsed < best[1]) best[1] = elapsed;
+        }
+
+        if (matches[0] != matches[1]) {
+            fprintf(stderr, "match counts differ for %s: %zu %zu\n", patterns[p], matches[0], matches[1]);
+        }
+        printf("%-36s %8zu %8.1f MB/s %8.1f MB/s\n", patterns[p], matches[0],
+               (double)total_bytes / best[0] / 1e6, (double)total_bytes / best[1] / 1e6);
+        nlink_pattern_destroy(matcher);
+    }
+
+    // A rule table: one glob per component name and file kind
+    static const char* names[] = { "tokenizer", "parser", "lexer", "minimizer", "symbols", "pipeline", "loader", "router" };
+    static const char* kinds[] = { "*/%s_*/lib%s.so.*", "*/%s_*/%s_impl.c", "lib/*/%s_[0-9]*/*%s*", "src/core/%s_*1/*%s.so.?.*" };
+    char storage[SET_PATTERNS][96];
+    const char* set_patterns[SET_PATTERNS];
+    NlinkPatternMatcher* matchers[SET_PATTERNS];
+    for (size_t i = 0; i < SET_PATTERNS; i++) {
+        snprintf(storage[i], sizeof(storage[i]), kinds[i / 8], names[i % 8], names[i % 8]);
+        set_patterns[i] = storage[i];
+        matchers[i] = nlink_pattern_create(storage[i], NLINK_PATTERN_FLAG_GLOB);
+    }
+    NlinkPatternSet* set = nlink_pattern_set_create(set_patterns, SET_PATTERNS, NLINK_PATTERN_FLAG_NONE);
+
+    double best[3] = { 1e30, 1e30, 1e30 };
+    size_t matches[3] = { 0, 0, 0 };
+    for (size_t r = 0; r < rounds; r++) {
+        double start = now_seconds();
+        matches[0] = 0;
+        for (size_t i = 0; i < count; i++) {
+            matches[0] += nlink_pattern_set_match(set, paths[i], NULL, 0);
+        }
+        double elapsed = now_seconds() - start;
+        if (elapsed < best[0]) best[0] = elapsed;
+
+        start = now_seconds();
+        matches[1] = 0;
+        for (size_t i = 0; i < count; i++) {
+            for (size_t j = 0; j < SET_PATTERNS; j++) {
+                matches[1] += nlink_pattern_match(matchers[j], paths[i]);
+            }
+        }
+        elapsed = now_seconds() - start;
+        if (elapsed < best[1]) best[1] = elapsed;
+
+        start = now_seconds();
+        matches[2] = 0;
+        for (size_t i = 0; i < count; i++) {
+            for (size_t j = 0; j < SET_PATTERNS; j++) {
+                matches[2] += fnmatch(set_patterns[j], paths[i], 0) == 0;
+            }
+        }
+        elapsed = now_seconds() - start;
+        if (elapsed < best[2]) best[2] = elapsed;
+    }
+
+    if (matches[0] != matches[1] || matches[0] != matches[2]) {
+        fprintf(stderr, "set match counts differ: %zu %zu %zu\n", matches[0], matches[1], matches[2]);
+    }
+    printf("\n%d globs per path\n", SET_PATTERNS);
+    report("pattern set, one pass", matches[0], total_bytes, best[0]);
+    report("compiled matcher per glob", matches[1], total_bytes, best[1]);
+    report("fnmatch per glob", matches[2], total_bytes, best[2]);
+
+    nlink_pattern_set_destroy(set);
+    for (size_t i = 0; i < SET_PATTERNS; i++) {
+        nlink_pattern_destroy(matchers[i]);
+    }
+    for (size_t i = 0; i < count; i++) {
+        free(paths[i]);
+    }
+    free(paths);
+    return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file bench_pattern_walk.c
+ * @brief Directory walk throughput for glob component discovery
+ *
+ * Builds a synthetic monorepo under /tmp (modules, each with nested
+ * source directories and built libraries) and finds files in it with
+ * nftw plus fnmatch on every path, then with nlink_match_pattern_stream
+ * on one thread and on every online CPU. The second pattern has a
+ * literal module directory and shows prefix pruning.
+ *
+ * Usage: bench_pattern_walk [modules] [rounds]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#define _XOPEN_SOURCE 700
+#include "nlink/core/pattern_matching/pattern_matcher.h"
+#include <fnmatch.h>
+#include <ftw.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define DEFAULT_MODULES 200
+#define DEFAULT_ROUNDS 5
+
+static const char* nftw_pattern;
+static size_t nftw_prefix;
+static size_t nftw_matches;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void touch(const char* path) {
+    FILE* file = fopen(path, "w");
+    if (file) fclose(file);
+}
+
+static size_t build_tree(const char* root, size_t modules) {
+    char path[512];
+    size_t files = 0;
+
+    for (size_t m = 0; m < modules; m++) {
+        snprintf(path, sizeof(path), "%s/module_%zu", root, m);
+        mkdir(path, 0755);
+        for (size_t d = 0; d < 8; d++) {
+            snprintf(path, sizeof(path), "%s/module_%zu/src_%zu", root, m, d);
+            mkdir(path, 0755);
+            for (size_t f = 0; f < 16; f++) {
+                snprintf(path, sizeof(path), "%s/module_%zu/src_%zu/file_%zu.%s", root, m, d, f, f % 4 ? "c" : "h");
+                touch(path);
+                files++;
+            }
+        }
+        snprintf(path, sizeof(path), "%s/module_%zu/build", root, m);
+        mkdir(path, 0755);
+        for (size_t f = 0; f < 4; f++) {
+            snprintf(path, sizeof(path), "%s/module_%zu/build/libmodule_%zu_%zu.so", root, m, m, f);
+            touch(path);
+            files++;
+        }
+    }
+    return files;
+}
+
+static int nftw_visit(const char* path, const struct stat* st, int type, struct FTW* ftw) {
+    (void)st;
+    (void)ftw;
+    if (type == FTW_F && fnmatch(nftw_pattern, path + nftw_prefix, FNM_PATHNAME | FNM_PERIOD) == 0) {
+        nftw_matches++;
+    }
+    return 0;
+}
+
+static bool count_match(const char* path, void* user_data) {
+    (void)path;
+    (*(size_t*)user_data)++;
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    size_t modules = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_MODULES;
+    size_t rounds = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : DEFAULT_ROUNDS;
+    if (modules == 0) modules = DEFAULT_MODULES;
+    if (rounds == 0) rounds = DEFAULT_ROUNDS;
+
+    char root[] = "/tmp/nlink_walk_bench_XXXXXX";
+    if (!mkdtemp(root)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    size_t files = build_tree(root, modules);
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    /* nftw cannot prune, so it sees the same tree for both patterns */
+    static const char* patterns[][2] = {
+        { "**/build/*.so", "*/build/*.so" },
+        { "module_7/**/*.h", "module_7/*/*.h" }
+    };
+
+    printf("tree: %zu files in %zu modules, %ld CPUs, best of %zu rounds\n", files, modules, cpus, rounds);
+    printf("%-20s %8s %10s %10s %10s\n", "pattern", "matches", "nftw", "1 thread", "all CPUs");
+
+    for (size_t p = 0; p < 2; p++) {
+        double best[3] = { 1e30, 1e30, 1e30 };
+        size_t matches[3] = { 0, 0, 0 };
+
+        for (size_t r = 0; r < rounds; r++) {
+            double start = now_seconds();
+            nftw_pattern = patterns[p][1];
+            nftw_prefix = strlen(root) + 1;
+            nftw_matches = 0;
+            nftw(root, nftw_visit, 64, FTW_PHYS);
+            matches[0] = nftw_matches;
+            double elapsed = now_seconds() - start;
+            if (elapsed < best[0]) best[0] = elapsed;
+
+            for (size_t mode = 1; mode < 3; mode++) {
+                nlink_pattern_options options = nlink_pattern_default_options();
+                options.max_threads = mode == 1 ? 1 : 0;
+                matches[mode] = 0;
+                start = now_seconds();
+                nlink_match_pattern_stream(patterns[p][0], root, options, count_match, &matches[mode]);
+                elapsed = now_seconds() - start;
+                if (elapsed < best[mode]) best[mode] = elapsed;
+            }
+        }
+
+        if (matches[0] != matches[1] || matches[1] != matches[2]) {
+            fprintf(stderr, "match counts differ for %s: %zu %zu %zu\n",
+                    patterns[p][0], matches[0], matches[1], matches[2]);
+        }
+        printf("%-20s %8zu %7.2f ms %7.2f ms %7.2f ms\n", patterns[p][0], matches[1],
+               best[0] * 1e3, best[1] * 1e3, best[2] * 1e3);
+    }
+
+    char command[128];
+    snprintf(command, sizeof(command), "rm -rf '%s'", root);
+    return system(command) == 0 ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file bench_regex.c
+ * @brief Regular expression throughput over component path lists
+ *
+ * Generates a list of component library paths and matches it against a set
+ * of patterns, reporting the best-round throughput of nlink_regex_match
+ * with and without match positions next to POSIX regexec. The patterns
+ * cover anchored, alternation, counted repetition, captures, and a
+ * pattern whose DFA is too large to build up front and runs from the
+ * lazy cache.
+ *
+ * Usage: bench_regex [paths] [rounds]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/pattern_matching/regex_matcher.h"
+#include <regex.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_PATHS 100000
+#define DEFAULT_ROUNDS 5
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static char** generate_paths(size_t count, size_t* total_bytes) {
+    static const char* names[] = { "tokenizer", "parser", "lexer", "minimizer", "symbols", "pipeline", "loader" };
+    static const char* roots[] = { "lib/components", "build/out/lib", "/usr/local/lib/nlink", "src/core" };
+    char** paths = malloc(count * sizeof(char*));
+    char buffer[256];
+
+    *total_bytes = 0;
+    for (size_t i = 0; i < count; i++) {
+        const char* name = names[i % 7];
+        const char* root = roots[(i / 7) % 4];
+        if (i % 5 == 4) {
+            snprintf(buffer, sizeof(buffer), "%s/%s_%zu/%s_impl.c", root, name, i, name);
+        } else {
+            snprintf(buffer, sizeof(buffer), "%s/%s_%zu/lib%s.so.%zu.%zu", root, name, i, name, i % 4, i % 17);
+        }
+        paths[i] = strdup(buffer);
+        *total_bytes += strlen(buffer);
+    }
+    return paths;
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_PATHS;
+    size_t rounds = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : DEFAULT_ROUNDS;
+    if (count == 0) count = DEFAULT_PATHS;
+    if (rounds == 0) rounds = DEFAULT_ROUNDS;
+
+    static const char* patterns[] = {
+        "^lib/components/.*\\.so(\\.[0-9]+)*$",
+        "(tokenizer|parser|lexer)_[0-9]+/",
+        "_[0-9]{5,}/lib[a-z]+\\.so",
+        "/([a-z]+)_([0-9]+)/lib([a-z]+)\\.so\\.([0-9]+)",
+        "[a-z]*q[a-z./_0-9]{12}$"
+    };
+
+    size_t total_bytes;
+    char** paths = generate_paths(count, &total_bytes);
+    nlink_regex_options options = nlink_regex_default_options();
+
+    printf("paths: %zu, %.1f MB, best of %zu rounds\n", count, (double)total_bytes / 1e6, rounds);
+    printf("%-44s %8s %10s %10s %10s\n", "pattern", "matches", "nlink", "positions", "regexec");
+
+    for (size_t p = 0; p < sizeof(patterns) / sizeof(patterns[0]); p++) {
+        nlink_regex* regex = nlink_regex_compile(patterns[p], options);
+        regex_t posix;
+        if (!regex || regcomp(&posix, patterns[p], REG_EXTENDED) != 0) {
+            fprintf(stderr, "cannot compile %s\n", patterns[p]);
+            return 1;
+        }
+
+        double best[3] = { 1e30, 1e30, 1e30 };
+        size_t matches[3] = { 0, 0, 0 };
+        for (size_t r = 0; r < rounds; r++) {
+            double start = now_seconds();
+            matches[0] = 0;
+            for (size_t i = 0; i < count; i++) {
+                matches[0] += nlink_regex_match(regex, paths[i], NULL);
+            }
+            double elapsed = now_seconds() - start;
+            if (elapsed < best[0]) best[0] = elapsed;
+
+            start = now_seconds();
+            matches[1] = 0;
+            for (size_t i = 0; i < count; i++) {
+                nlink_regex_match_result match;
+                if (nlink_regex_match(regex, paths[i], &match)) {
+                    matches[1]++;
+                    nlink_regex_match_free(&match);
+                }
+            }
+            elapsed = now_seconds() - start;
+            if (elapsed < best[1]) best[1] = elapsed;
+
+            start = now_seconds();
+            matches[2] = 0;
+            for (size_t i = 0; i < count; i++) {
+                regmatch_t match[5];
+                matches[2] += regexec(&posix, paths[i], 5, match, 0) == 0;
+            }
+            elapsed = now_seconds() - start;
+            if (elapsed < best[2]) best[2] = elapsed;
+        }
+
+        if (matches[0] != matches[2] || matches[1] != matches[2]) {
+            fprintf(stderr, "match counts differ for %s: %zu %zu %zu\n",
+                    patterns[p], matches[0], matches[1], matches[2]);
+        }
+        printf("%-44s %8zu %7.1f MB/s %7.1f MB/s %7.1f MB/s\n", patterns[p], matches[0],
+               (double)total_bytes / best[0] / 1e6, (double)total_bytes / best[1] / 1e6,
+               (double)total_bytes / best[2] / 1e6);
+
+        nlink_regex_free(regex);
+        regfree(&posix);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        free(paths[i]);
+    }
+    free(paths);
+    return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file bench_dependency_graph.c
+ * @brief Single-pass dependency graph build and resolution benchmark
+ *
+ * Generates a layered pipeline configuration in which every component
+ * depends on a few earlier ones, then times building the interned graph,
+ * resolving the loading order and reporting missing dependencies. For
+ * small graphs the previous approach, resolving each dependency by a
+ * strcmp scan over all nodes, is timed as a baseline.
+ *
+ * Usage: bench_dependency_graph [components] [rounds]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/spsystem/sps_dependency.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_COMPONENTS 100000
+#define DEFAULT_ROUNDS 5
+#define DEPENDENCIES 4
+#define LINEAR_LIMIT 20000
+#define NAME_SIZE 32
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* Dependency lookup as performed before identifiers were interned */
+static size_t linear_resolve(const NexusDependencyGraph* graph) {
+    size_t resolved = 0;
+    for (size_t i = 0; i < graph->node_count; i++) {
+        const NexusDependencyNode* node = graph->nodes[i];
+        for (size_t d = 0; d < node->dependency_count; d++) {
+            for (size_t j = 0; j < graph->node_count; j++) {
+                if (strcmp(graph->nodes[j]->component_id, node->dependencies[d]) == 0) {
+                    resolved++;
+                    break;
+                }
+            }
+        }
+    }
+    return resolved;
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_COMPONENTS;
+    int rounds = argc > 2 ? atoi(argv[2]) : DEFAULT_ROUNDS;
+    if (count < 2) {
+        count = DEFAULT_COMPONENTS;
+    }
+    if (rounds < 1) {
+        rounds = DEFAULT_ROUNDS;
+    }
+
+    NexusContext* ctx = nexus_create_context(NULL);
+    NexusPipelineConfig config = {0};
+    NexusPipelineComponentConfig* components =
+        (NexusPipelineComponentConfig*)calloc(count, sizeof(NexusPipelineComponentConfig));
+    const char** dependencies = (const char**)calloc(count * DEPENDENCIES, sizeof(char*));
+    char* names = (char*)calloc(count, NAME_SIZE);
+    config.pipeline_id = "bench";
+    config.components = (NexusPipelineComponentConfig**)calloc(count, sizeof(NexusPipelineComponentConfig*));
+    config.component_count = count;
+    if (!ctx || !components || !dependencies || !names || !config.components) {
+        fprintf(stderr, "Failed to allocate configuration\n");
+        return 1;
+    }
+
+    /* Components listed in reverse so the order has to be computed */
+    unsigned int seed = 12345;
+    for (size_t i = 0; i < count; i++) {
+        snprintf(names + i * NAME_SIZE, NAME_SIZE, "component.%zu", i);
+    }
+    size_t edges = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t id = count - 1 - i;
+        components[i].component_id = names + id * NAME_SIZE;
+        components[i].dependencies = dependencies + i * DEPENDENCIES;
+        for (size_t d = 0; d < DEPENDENCIES && id > 0; d++) {
+            seed = seed * 1103515245u + 12345u;
+            components[i].dependencies[components[i].dependency_count++] = names + (seed % id) * NAME_SIZE;
+            edges++;
+        }
+        config.components[i] = &components[i];
+    }
+
+    double best_build = 1e30, best_resolve = 1e30, best_missing = 1e30;
+    size_t ordered = 0;
+    for (int round = 0; round < rounds; round++) {
+        double start = now_seconds();
+        NexusDependencyGraph* graph = sps_create_dependency_graph(ctx, &config);
+        double built = now_seconds();
+        const char** order = NULL;
+        NexusResult result = sps_resolve_dependencies(ctx, graph, &order, &ordered);
+        double resolved = now_seconds();
+        NexusMissingDependency* missing = NULL;
+        size_t missing_count = 0;
+        sps_check_missing_dependencies(ctx, graph, &missing, &missing_count);
+        double checked = now_seconds();
+
+        if (!graph || result != NEXUS_SUCCESS || ordered != count || missing_count != 0) {
+            fprintf(stderr, "Resolution failed\n");
+            return 1;
+        }
+        if (built - start < best_build) best_build = built - start;
+        if (resolved - built < best_resolve) best_resolve = resolved - built;
+        if (checked - resolved < best_missing) best_missing = checked - resolved;
+
+        free(missing);
+        free(order);
+        sps_free_dependency_graph(graph);
+    }
+
+    printf("%zu components, %zu dependencies (best of %d)\n", count, edges, rounds);
+    printf("Build graph:     %10.3f ms\n", best_build * 1000.0);
+    printf("Resolve order:   %10.3f ms\n", best_resolve * 1000.0);
+    printf("Missing check:   %10.3f ms\n", best_missing * 1000.0);
+
+    if (count <= LINEAR_LIMIT) {
+        NexusDependencyGraph* graph = sps_create_dependency_graph(ctx, &config);
+        double start = now_seconds();
+        size_t resolved = linear_resolve(graph);
+        double linear_time = now_seconds() - start;
+        printf("Linear lookups:  %10.3f ms (%zu resolved, %.1fx build)\n",
+               linear_time * 1000.0, resolved, linear_time / best_build);
+        sps_free_dependency_graph(graph);
+    }
+
+    free(config.components);
+    free(names);
+    free(dependencies);
+    free(components);
+    nexus_destroy_context(ctx);
+    return 0;
+}
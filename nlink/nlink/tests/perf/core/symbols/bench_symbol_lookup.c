@@ -0,0 +1,119 @@
+/**
+ * @file bench_symbol_lookup.c
+ * @brief Symbol table lookup benchmark
+ *
+ * Loads synthetic symbols into a NexusSymbolRegistry and compares the
+ * hash-indexed nexus_symbol_table_find against the previous linear strcmp
+ * scan over the dense symbol array.
+ *
+ * Usage: bench_symbol_lookup [symbol_count]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/symbols/nexus_symbols.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_SYMBOL_COUNT 100000
+#define INDEXED_LOOKUPS 2000000
+#define LINEAR_LOOKUPS 2000
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* Lookup as performed before the table was indexed */
+static NexusSymbol* linear_find(NexusSymbolTable* table, const char* name) {
+    for (size_t i = 0; i < table->size; i++) {
+        if (strcmp(table->symbols[i].name, name) == 0) {
+            return &table->symbols[i];
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_SYMBOL_COUNT;
+    if (count == 0) {
+        count = DEFAULT_SYMBOL_COUNT;
+    }
+
+    NexusSymbolRegistry* registry = nexus_init_symbol_registry();
+    if (!registry) {
+        fprintf(stderr, "Failed to create registry\n");
+        return 1;
+    }
+
+    char** names = (char**)malloc(count * sizeof(char*));
+    if (!names) {
+        nexus_cleanup_symbol_registry(registry);
+        return 1;
+    }
+
+    double start = now_seconds();
+    for (size_t i = 0; i < count; i++) {
+        char name[64];
+        char component[32];
+        snprintf(name, sizeof(name), "component%zu_symbol_%zu", i % 64, i);
+        snprintf(component, sizeof(component), "component%zu", i % 64);
+        names[i] = strdup(name);
+        nexus_symbol_table_add(&registry->exported, name, (void*)(uintptr_t)(i + 1),
+                               NEXUS_SYMBOL_FUNCTION, component);
+    }
+    double load_time = now_seconds() - start;
+
+    printf("Loaded %zu symbols in %.3f ms\n", count, load_time * 1000.0);
+
+    /* Linear scan (previous behaviour) */
+    size_t found = 0;
+    unsigned int seed = 12345;
+    start = now_seconds();
+    for (size_t i = 0; i < LINEAR_LOOKUPS; i++) {
+        seed = seed * 1103515245u + 12345u;
+        if (linear_find(&registry->exported, names[seed % count])) {
+            found++;
+        }
+    }
+    double linear_time = now_seconds() - start;
+    double linear_rate = LINEAR_LOOKUPS / linear_time;
+
+    /* Hash index */
+    seed = 12345;
+    start = now_seconds();
+    for (size_t i = 0; i < INDEXED_LOOKUPS; i++) {
+        seed = seed * 1103515245u + 12345u;
+        if (nexus_symbol_table_find(&registry->exported, names[seed % count])) {
+            found++;
+        }
+    }
+    double indexed_time = now_seconds() - start;
+    double indexed_rate = INDEXED_LOOKUPS / indexed_time;
+
+    /* Three-tier resolution through the registry (one hash per lookup) */
+    start = now_seconds();
+    for (size_t i = 0; i < INDEXED_LOOKUPS; i++) {
+        seed = seed * 1103515245u + 12345u;
+        if (nexus_resolve_symbol(registry, names[seed % count])) {
+            found++;
+        }
+    }
+    double resolve_rate = INDEXED_LOOKUPS / (now_seconds() - start);
+
+    printf("Linear scan:   %12.0f lookups/s\n", linear_rate);
+    printf("Hash index:    %12.0f lookups/s (%.1fx)\n", indexed_rate, indexed_rate / linear_rate);
+    printf("Resolve:       %12.0f lookups/s\n", resolve_rate);
+    printf("Found: %zu/%d\n", found, LINEAR_LOOKUPS + 2 * INDEXED_LOOKUPS);
+
+    for (size_t i = 0; i < count; i++) {
+        free(names[i]);
+    }
+    free(names);
+    nexus_cleanup_symbol_registry(registry);
+
+    return found == (size_t)(LINEAR_LOOKUPS + 2 * INDEXED_LOOKUPS) ? 0 : 1;
+}
@@ -0,0 +1,186 @@
+/**
+ * @file bench_parallel_abstraction.c
+ * @brief Parallel map, filter, fold and sort benchmark
+ *
+ * Times nlink_map, nlink_filter, nlink_fold and nlink_sort against their
+ * nlink_parallel_* variants on the shared pool for 1, 2, 4 and 8 threads,
+ * and nlink_numerical_summary against the contiguous
+ * nlink_numerical_summary_double and nlink_numerical_summary_int64.
+ *
+ * Usage: bench_parallel_abstraction [items] [rounds]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/tatit/abstraction.h"
+#include "nlink/core/tatit/aggregation.h"
+#include "nlink/core/tatit/parallel.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_ITEMS 4000000
+#define DEFAULT_ROUNDS 3
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void* scramble(void* item, void* context) {
+    (void)context;
+    uintptr_t value = (uintptr_t)item;
+    value ^= value >> 17;
+    value *= 0xed5ad4bbu;
+    return (void*)(value | 1);
+}
+
+static bool is_odd_bucket(void* item, void* context) {
+    (void)context;
+    return ((uintptr_t)item >> 4) % 2 == 1;
+}
+
+static void* add_items(void* accumulator, void* item, void* context) {
+    (void)context;
+    return (void*)((uintptr_t)accumulator + (uintptr_t)item);
+}
+
+static int compare_items(void* a, void* b, void* context) {
+    (void)context;
+    return (uintptr_t)a < (uintptr_t)b ? -1 : (uintptr_t)a > (uintptr_t)b;
+}
+
+typedef enum bench_op {
+    BENCH_MAP,
+    BENCH_FILTER,
+    BENCH_FOLD,
+    BENCH_SORT,
+    BENCH_OP_COUNT
+} bench_op;
+
+static const char* op_names[BENCH_OP_COUNT] = { "map", "filter", "fold", "sort" };
+
+static double time_op(bench_op op, bool parallel, void** items, void** scratch, size_t count, int rounds) {
+    double best = 1e30;
+    for (int round = 0; round < rounds; round++) {
+        memcpy(scratch, items, count * sizeof(void*));
+        size_t size = 0;
+        double t0 = now_seconds();
+        switch (op) {
+            case BENCH_MAP:
+                free(parallel ? nlink_parallel_map(scratch, count, scramble, NULL, &size)
+                              : nlink_map(scratch, count, scramble, NULL, &size));
+                break;
+            case BENCH_FILTER:
+                free(parallel ? nlink_parallel_filter(scratch, count, is_odd_bucket, NULL, &size)
+                              : nlink_filter(scratch, count, is_odd_bucket, NULL, &size));
+                break;
+            case BENCH_FOLD:
+                if (parallel) {
+                    nlink_parallel_fold(scratch, count, NULL, add_items, NULL, NULL);
+                } else {
+                    nlink_fold(scratch, count, NULL, add_items, NULL);
+                }
+                break;
+            case BENCH_SORT:
+                if (parallel) {
+                    nlink_parallel_sort(scratch, count, compare_items, NULL);
+                } else {
+                    nlink_sort(scratch, count, compare_items, NULL);
+                }
+                break;
+            default:
+                break;
+        }
+        double elapsed = now_seconds() - t0;
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_ITEMS;
+    int rounds = argc > 2 ? atoi(argv[2]) : DEFAULT_ROUNDS;
+    if (count < 2) {
+        count = DEFAULT_ITEMS;
+    }
+    if (rounds < 1) {
+        rounds = DEFAULT_ROUNDS;
+    }
+
+    void** items = malloc(count * sizeof(void*));
+    void** scratch = malloc(count * sizeof(void*));
+    double* doubles = malloc(count * sizeof(double));
+    int64_t* integers = malloc(count * sizeof(int64_t));
+    void** boxed = malloc(count * sizeof(void*));
+    if (!items || !scratch || !doubles || !integers || !boxed) {
+        fprintf(stderr, "Failed to allocate items\n");
+        return 1;
+    }
+
+    uint64_t seed = 12345;
+    for (size_t i = 0; i < count; i++) {
+        seed = seed * 6364136223846793005u + 1442695040888963407u;
+        items[i] = (void*)(uintptr_t)(seed >> 16);
+        doubles[i] = (double)(seed >> 40) / 1024.0;
+        integers[i] = (int64_t)(seed >> 24);
+        boxed[i] = &doubles[i];
+    }
+
+    printf("%zu items (best of %d)\n", count, rounds);
+
+    double serial[BENCH_OP_COUNT];
+    for (int op = 0; op < BENCH_OP_COUNT; op++) {
+        serial[op] = time_op((bench_op)op, false, items, scratch, count, rounds);
+        printf("Serial %-7s %10.2f ms\n", op_names[op], serial[op] * 1000.0);
+    }
+
+    static const size_t thread_counts[] = { 1, 2, 4, 8 };
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++) {
+        nlink_parallel_set_threads(thread_counts[t]);
+        printf("%zu thread(s)\n", thread_counts[t]);
+        for (int op = 0; op < BENCH_OP_COUNT; op++) {
+            double elapsed = time_op((bench_op)op, true, items, scratch, count, rounds);
+            printf("  Parallel %-7s %10.2f ms  %6.2fx\n", op_names[op], elapsed * 1000.0, serial[op] / elapsed);
+        }
+    }
+    nlink_parallel_shutdown();
+
+    double best_boxed = 1e30, best_double = 1e30, best_int64 = 1e30;
+    for (int round = 0; round < rounds; round++) {
+        double t0 = now_seconds();
+        nlink_aggregation_result* result = nlink_numerical_summary(boxed, count);
+        double t1 = now_seconds();
+        nlink_aggregation_result* typed = nlink_numerical_summary_double(doubles, count);
+        double t2 = now_seconds();
+        nlink_aggregation_result* whole = nlink_numerical_summary_int64(integers, count);
+        double t3 = now_seconds();
+
+        best_boxed = t1 - t0 < best_boxed ? t1 - t0 : best_boxed;
+        best_double = t2 - t1 < best_double ? t2 - t1 : best_double;
+        best_int64 = t3 - t2 < best_int64 ? t3 - t2 : best_int64;
+
+        nlink_aggregation_result* results[] = { result, typed, whole };
+        for (size_t i = 0; i < 3; i++) {
+            free(results[i]->min);
+            free(results[i]->max);
+            free(results[i]->average);
+            nlink_aggregation_result_free(results[i]);
+        }
+    }
+    printf("Summary via pointers: %10.2f ms\n", best_boxed * 1000.0);
+    printf("Summary of doubles:   %10.2f ms  %6.2fx\n", best_double * 1000.0, best_boxed / best_double);
+    printf("Summary of int64:     %10.2f ms  %6.2fx\n", best_int64 * 1000.0, best_boxed / best_int64);
+
+    free(boxed);
+    free(integers);
+    free(doubles);
+    free(scratch);
+    free(items);
+    return 0;
+}
@@ -0,0 +1,197 @@
+/**
+ * @file bench_parallel_traversal.c
+ * @brief Parallel graph and tree traversal benchmark
+ *
+ * Builds a random directed graph in which every node is reachable from
+ * node 0 and a complete tree of the same size, then times the sequential
+ * traversals against nlink_parallel_traverse_graph_bfs,
+ * nlink_parallel_traverse_graph and nlink_parallel_traverse_tree for
+ * 1, 2, 4 and 8 threads. The visitor performs a little work per node so
+ * that visits dominate, as they do for real visitors.
+ *
+ * Usage: bench_parallel_traversal [nodes] [rounds]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/tatit/parallel.h"
+#include "nlink/core/tatit/traversal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_NODES 1000000
+#define DEFAULT_ROUNDS 3
+#define EDGES_PER_NODE 4
+#define TREE_FANOUT 4
+#define VISIT_WORK 64
+
+typedef struct bench_node {
+    size_t id;
+    size_t degree;
+    struct bench_node** adjacent;
+} bench_node;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void* get_adjacent(void* node, size_t index, void* context) {
+    (void)context;
+    return ((bench_node*)node)->adjacent[index];
+}
+
+static size_t get_adjacent_count(void* node, void* context) {
+    (void)context;
+    return ((bench_node*)node)->degree;
+}
+
+static size_t get_id(void* node, void* context) {
+    (void)context;
+    return ((bench_node*)node)->id;
+}
+
+static void* visit(void* node, void* context) {
+    (void)context;
+    volatile size_t hash = ((bench_node*)node)->id;
+    for (int i = 0; i < VISIT_WORK; i++) {
+        hash = hash * 31 + (size_t)i;
+    }
+    return node;
+}
+
+typedef nlink_traversal_result* (*parallel_walk_fn)(void*, const nlink_parallel_traversal_config*);
+
+static double time_parallel(parallel_walk_fn walk, bench_node* start,
+                            nlink_parallel_traversal_config* config, int rounds, size_t* visited) {
+    double best = 1e30;
+    for (int round = 0; round < rounds; round++) {
+        double t0 = now_seconds();
+        nlink_traversal_result* result = walk(start, config);
+        double elapsed = now_seconds() - t0;
+        *visited = result != NULL ? result->count : 0;
+        nlink_traversal_result_free(result);
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+static double time_sequential_bfs(bench_node* start, int rounds, size_t* visited) {
+    double best = 1e30;
+    for (int round = 0; round < rounds; round++) {
+        double t0 = now_seconds();
+        nlink_traversal_result* result = nlink_traverse_graph_bfs(start, get_adjacent, get_adjacent_count, visit, NULL);
+        double elapsed = now_seconds() - t0;
+        *visited = result != NULL ? result->count : 0;
+        nlink_traversal_result_free(result);
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+static double time_sequential_tree(bench_node* root, int rounds, size_t* visited) {
+    nlink_traversal_config* config = nlink_traversal_config_create(
+        NLINK_TRAVERSAL_PRE_ORDER, visit, get_adjacent, get_adjacent_count, NULL);
+    double best = 1e30;
+    for (int round = 0; round < rounds; round++) {
+        double t0 = now_seconds();
+        nlink_traversal_result* result = nlink_traverse_tree(root, config);
+        double elapsed = now_seconds() - t0;
+        *visited = result != NULL ? result->count : 0;
+        nlink_traversal_result_free(result);
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+    nlink_traversal_config_free(config);
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_NODES;
+    int rounds = argc > 2 ? atoi(argv[2]) : DEFAULT_ROUNDS;
+    if (count < 2) {
+        count = DEFAULT_NODES;
+    }
+    if (rounds < 1) {
+        rounds = DEFAULT_ROUNDS;
+    }
+
+    bench_node* graph = calloc(count, sizeof(bench_node));
+    bench_node** graph_edges = calloc(count * EDGES_PER_NODE, sizeof(bench_node*));
+    bench_node* tree = calloc(count, sizeof(bench_node));
+    bench_node** tree_edges = calloc(count, sizeof(bench_node*));
+    if (!graph || !graph_edges || !tree || !tree_edges) {
+        fprintf(stderr, "Failed to allocate graph\n");
+        return 1;
+    }
+
+    /* Node i links to i + 1, so all nodes are reachable, plus random edges */
+    unsigned int seed = 12345;
+    for (size_t i = 0; i < count; i++) {
+        graph[i].id = i;
+        graph[i].adjacent = graph_edges + i * EDGES_PER_NODE;
+        if (i + 1 < count) {
+            graph[i].adjacent[graph[i].degree++] = &graph[i + 1];
+        }
+        while (graph[i].degree < EDGES_PER_NODE) {
+            seed = seed * 1103515245u + 12345u;
+            graph[i].adjacent[graph[i].degree++] = &graph[((size_t)seed << 8 ^ seed) % count];
+        }
+    }
+
+    /* Complete tree: the children of node i are TREE_FANOUT * i + 1 .. */
+    for (size_t i = 0; i < count; i++) {
+        tree[i].id = i;
+        tree[i].adjacent = tree_edges + (i * TREE_FANOUT + 1 < count ? i * TREE_FANOUT : 0);
+        for (size_t c = 1; c <= TREE_FANOUT && i * TREE_FANOUT + c < count; c++) {
+            tree_edges[i * TREE_FANOUT + c - 1] = &tree[i * TREE_FANOUT + c];
+            tree[i].degree++;
+        }
+    }
+
+    size_t visited = 0;
+    printf("%zu nodes, %d edges per node (best of %d)\n", count, EDGES_PER_NODE, rounds);
+
+    double bfs = time_sequential_bfs(&graph[0], rounds, &visited);
+    printf("Sequential BFS:       %10.2f ms  (%zu visited)\n", bfs * 1000.0, visited);
+    double walk = time_sequential_tree(&tree[0], rounds, &visited);
+    printf("Sequential tree walk: %10.2f ms  (%zu visited)\n", walk * 1000.0, visited);
+
+    nlink_parallel_traversal_config* config = nlink_parallel_traversal_config_create(
+        visit, get_adjacent, get_adjacent_count, NULL);
+    static const size_t thread_counts[] = { 1, 2, 4, 8 };
+    nlink_parallel_set_threads(8);
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++) {
+        nlink_parallel_traversal_config_set_threads(config, thread_counts[t]);
+        printf("%zu thread(s)\n", thread_counts[t]);
+
+        nlink_parallel_traversal_config_set_ids(config, get_id, count);
+        double elapsed = time_parallel(nlink_parallel_traverse_graph_bfs, &graph[0], config, rounds, &visited);
+        printf("  Frontier BFS:       %10.2f ms  %6.2fx  (%zu visited)\n",
+               elapsed * 1000.0, bfs / elapsed, visited);
+        elapsed = time_parallel(nlink_parallel_traverse_graph, &graph[0], config, rounds, &visited);
+        printf("  Stealing graph:     %10.2f ms  %6.2fx  (%zu visited)\n",
+               elapsed * 1000.0, bfs / elapsed, visited);
+
+        nlink_parallel_traversal_config_set_ids(config, NULL, 0);
+        elapsed = time_parallel(nlink_parallel_traverse_tree, &tree[0], config, rounds, &visited);
+        printf("  Stealing tree:      %10.2f ms  %6.2fx  (%zu visited)\n",
+               elapsed * 1000.0, walk / elapsed, visited);
+    }
+    nlink_parallel_traversal_config_free(config);
+    nlink_parallel_shutdown();
+
+    free(tree_edges);
+    free(tree);
+    free(graph_edges);
+    free(graph);
+    return 0;
+}
@@ -0,0 +1,221 @@
+/**
+ * @file bench_traversal.c
+ * @brief Graph and tree traversal benchmark
+ *
+ * Builds a random directed graph in which every node is reachable from
+ * node 0, then times nlink_traverse_graph_bfs and nlink_traverse_graph_dfs
+ * over it, and pre-, post- and level-order walks of a tree of the same
+ * size. For small graphs the previous breadth-first search, with a linear
+ * visited scan and a heap-allocated queue element per node, is timed as a
+ * baseline.
+ *
+ * Usage: bench_traversal [nodes] [rounds]
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink/core/tatit/traversal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_NODES 1000000
+#define DEFAULT_ROUNDS 3
+#define EDGES_PER_NODE 4
+#define TREE_FANOUT 4
+#define LINEAR_LIMIT 20000
+
+typedef struct bench_node {
+    size_t degree;
+    struct bench_node** adjacent;
+} bench_node;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void* get_adjacent(void* node, size_t index, void* context) {
+    (void)context;
+    return ((bench_node*)node)->adjacent[index];
+}
+
+static size_t get_adjacent_count(void* node, void* context) {
+    (void)context;
+    return ((bench_node*)node)->degree;
+}
+
+static void* visit(void* node, void* context) {
+    (void)context;
+    return node;
+}
+
+/* Breadth-first search as performed before the visited set was hashed */
+typedef struct linear_item {
+    void* node;
+    struct linear_item* next;
+} linear_item;
+
+static size_t linear_bfs(bench_node* start) {
+    size_t capacity = 16, count = 0, visited_count = 0;
+    void** visited = malloc(capacity * sizeof(void*));
+    linear_item* head = malloc(sizeof(linear_item));
+    linear_item* tail = head;
+    head->node = start;
+    head->next = NULL;
+    visited[count++] = start;
+
+    while (head != NULL) {
+        linear_item* item = head;
+        bench_node* node = item->node;
+        head = item->next;
+        if (head == NULL) {
+            tail = NULL;
+        }
+        free(item);
+        visited_count++;
+
+        for (size_t i = 0; i < node->degree; i++) {
+            void* adjacent = node->adjacent[i];
+            bool seen = false;
+            for (size_t j = 0; j < count && !seen; j++) {
+                seen = visited[j] == adjacent;
+            }
+            if (seen) {
+                continue;
+            }
+            if (count == capacity) {
+                capacity *= 2;
+                visited = realloc(visited, capacity * sizeof(void*));
+            }
+            visited[count++] = adjacent;
+            linear_item* next = malloc(sizeof(linear_item));
+            next->node = adjacent;
+            next->next = NULL;
+            if (tail == NULL) {
+                head = next;
+            } else {
+                tail->next = next;
+            }
+            tail = next;
+        }
+    }
+
+    free(visited);
+    return visited_count;
+}
+
+typedef nlink_traversal_result* (*graph_walk_fn)(void*, nlink_node_getter_fn, nlink_child_count_fn,
+                                                 nlink_visitor_fn, void*);
+
+static double time_graph(graph_walk_fn walk, bench_node* start, int rounds, size_t* visited) {
+    double best = 1e30;
+    for (int round = 0; round < rounds; round++) {
+        double t0 = now_seconds();
+        nlink_traversal_result* result = walk(start, get_adjacent, get_adjacent_count, visit, NULL);
+        double elapsed = now_seconds() - t0;
+        *visited = result != NULL ? result->count : 0;
+        nlink_traversal_result_free(result);
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+static double time_tree(nlink_traversal_order order, bench_node* root, int rounds, size_t* visited) {
+    nlink_traversal_config* config = nlink_traversal_config_create(
+        order, visit, get_adjacent, get_adjacent_count, NULL);
+    double best = 1e30;
+    for (int round = 0; round < rounds; round++) {
+        double t0 = now_seconds();
+        nlink_traversal_result* result = nlink_traverse_tree(root, config);
+        double elapsed = now_seconds() - t0;
+        *visited = result != NULL ? result->count : 0;
+        nlink_traversal_result_free(result);
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+    nlink_traversal_config_free(config);
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_NODES;
+    int rounds = argc > 2 ? atoi(argv[2]) : DEFAULT_ROUNDS;
+    if (count < 2) {
+        count = DEFAULT_NODES;
+    }
+    if (rounds < 1) {
+        rounds = DEFAULT_ROUNDS;
+    }
+
+    bench_node* graph = calloc(count, sizeof(bench_node));
+    bench_node** graph_edges = calloc(count * EDGES_PER_NODE, sizeof(bench_node*));
+    bench_node* tree = calloc(count, sizeof(bench_node));
+    bench_node** tree_edges = calloc(count, sizeof(bench_node*));
+    if (!graph || !graph_edges || !tree || !tree_edges) {
+        fprintf(stderr, "Failed to allocate graph\n");
+        return 1;
+    }
+
+    /* Node i links to i + 1, so all nodes are reachable, plus random edges */
+    unsigned int seed = 12345;
+    for (size_t i = 0; i < count; i++) {
+        graph[i].adjacent = graph_edges + i * EDGES_PER_NODE;
+        if (i + 1 < count) {
+            graph[i].adjacent[graph[i].degree++] = &graph[i + 1];
+        }
+        while (graph[i].degree < EDGES_PER_NODE) {
+            seed = seed * 1103515245u + 12345u;
+            graph[i].adjacent[graph[i].degree++] = &graph[((size_t)seed << 8 ^ seed) % count];
+        }
+    }
+
+    /* Complete tree: the children of node i are TREE_FANOUT * i + 1 .. */
+    for (size_t i = 0; i < count; i++) {
+        tree[i].adjacent = tree_edges + (i * TREE_FANOUT + 1 < count ? i * TREE_FANOUT : 0);
+        for (size_t c = 1; c <= TREE_FANOUT && i * TREE_FANOUT + c < count; c++) {
+            tree_edges[i * TREE_FANOUT + c - 1] = &tree[i * TREE_FANOUT + c];
+            tree[i].degree++;
+        }
+    }
+
+    size_t visited = 0;
+    printf("%zu nodes, %d edges per node (best of %d)\n", count, EDGES_PER_NODE, rounds);
+
+    double bfs = time_graph(nlink_traverse_graph_bfs, &graph[0], rounds, &visited);
+    printf("Graph BFS:       %10.2f ms  %8.1f Mnodes/s  (%zu visited)\n",
+           bfs * 1000.0, visited / bfs / 1e6, visited);
+    double dfs = time_graph(nlink_traverse_graph_dfs, &graph[0], rounds, &visited);
+    printf("Graph DFS:       %10.2f ms  %8.1f Mnodes/s  (%zu visited)\n",
+           dfs * 1000.0, visited / dfs / 1e6, visited);
+
+    static const struct { nlink_traversal_order order; const char* name; } orders[] = {
+        { NLINK_TRAVERSAL_PRE_ORDER, "Tree pre-order: " },
+        { NLINK_TRAVERSAL_POST_ORDER, "Tree post-order:" },
+        { NLINK_TRAVERSAL_LEVEL_ORDER, "Tree level-order:" },
+    };
+    for (size_t i = 0; i < sizeof(orders) / sizeof(orders[0]); i++) {
+        double elapsed = time_tree(orders[i].order, &tree[0], rounds, &visited);
+        printf("%-17s%10.2f ms  %8.1f Mnodes/s  (%zu visited)\n",
+               orders[i].name, elapsed * 1000.0, visited / elapsed / 1e6, visited);
+    }
+
+    if (count <= LINEAR_LIMIT) {
+        double t0 = now_seconds();
+        visited = linear_bfs(&graph[0]);
+        double linear = now_seconds() - t0;
+        printf("Linear BFS:      %10.2f ms  %8.1f Mnodes/s  (%.1fx slower)\n",
+               linear * 1000.0, visited / linear / 1e6, linear / bfs);
+    }
+
+    free(tree_edges);
+    free(tree);
+    free(graph_edges);
+    free(graph);
+    return 0;
+}
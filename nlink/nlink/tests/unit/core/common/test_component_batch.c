@@ -0,0 +1,148 @@
+/**
+ * @file test_component_batch.c
+ * @brief Unit tests for dependency-aware batch component loading
+ *
+ * The batches load small system libraries by soname; none of them export
+ * nexus_component_init, so initialization always succeeds.
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/common/nexus_loader.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BATCH_SIZE 6
+
+/*
+ * m <- dl <- rt
+ *   <- pthread
+ * util (independent)
+ * resolv <- rt (optional: anl, not in the batch)
+ */
+static const char* const dl_deps[] = { "m" };
+static const char* const rt_deps[] = { "dl", "resolv" };
+static const char* const pthread_deps[] = { "m" };
+static const char* const resolv_deps[] = { "anl" };
+static const bool resolv_optional[] = { true };
+
+static const NexusComponentSpec batch_specs[BATCH_SIZE] = {
+    { "librt.so.1", "rt", rt_deps, NULL, 2 },
+    { "libm.so.6", "m", NULL, NULL, 0 },
+    { "libdl.so.2", "dl", dl_deps, NULL, 1 },
+    { "libpthread.so.0", "pthread", pthread_deps, NULL, 1 },
+    { "libutil.so.1", "util", NULL, NULL, 0 },
+    { "libresolv.so.2", "resolv", resolv_deps, resolv_optional, 1 },
+};
+
+static void free_components(NexusContext* ctx, NexusComponent** components, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (components[i]) nexus_unload_component(ctx, components[i]);
+    }
+}
+
+NLINK_TEST_SUITE_BEGIN(component_batch) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(component_batch) {
+    (void)context;
+}
+
+NLINK_TEST_CASE(component_batch, initializes_after_dependencies) {
+    NLINK_ARRANGE_PHASE("Describe six libraries with a dependency graph");
+    NexusContext ctx = { 0 };
+    ctx.log_level = NEXUS_LOG_ERROR;
+    NexusComponent* components[BATCH_SIZE];
+    NexusComponentTiming timeline[BATCH_SIZE];
+
+    NLINK_ACT_PHASE("Load the batch on four threads");
+    NexusResult result = nexus_load_components(&ctx, batch_specs, BATCH_SIZE, 4, components, timeline);
+
+    NLINK_ASSERT_PHASE("Verify every component loaded after its dependencies");
+    NLINK_ASSERT_TRUE(result == NEXUS_SUCCESS, "batch loads");
+    int violations = 0;
+    for (size_t i = 0; i < BATCH_SIZE; i++) {
+        if (!components[i] || timeline[i].result != NEXUS_SUCCESS) violations++;
+        if (timeline[i].open_end_ms > timeline[i].init_start_ms) violations++;
+        for (size_t d = 0; d < batch_specs[i].dependency_count; d++) {
+            for (size_t j = 0; j < BATCH_SIZE; j++) {
+                if (strcmp(batch_specs[j].id, batch_specs[i].dependencies[d]) == 0 &&
+                    timeline[j].init_end_ms > timeline[i].init_start_ms) {
+                    violations++;
+                }
+            }
+        }
+    }
+    NLINK_ASSERT_EQUAL_INT(0, violations, "components loaded in dependency order");
+    NLINK_ASSERT_TRUE(nexus_resolve_component_symbol(&ctx, components[1], "cos") != NULL, "library usable");
+
+    free_components(&ctx, components, BATCH_SIZE);
+}
+
+NLINK_TEST_CASE(component_batch, failure_skips_dependents) {
+    NLINK_ARRANGE_PHASE("Point the root of one chain at a missing library");
+    NexusContext ctx = { 0 };
+    ctx.log_level = NEXUS_LOG_ERROR + 1;
+    NexusComponentSpec specs[BATCH_SIZE];
+    memcpy(specs, batch_specs, sizeof(specs));
+    specs[1].path = "/nonexistent/libm.so";
+    NexusComponent* components[BATCH_SIZE];
+    NexusComponentTiming timeline[BATCH_SIZE];
+
+    NLINK_ACT_PHASE("Load the batch");
+    NexusResult result = nexus_load_components(&ctx, specs, BATCH_SIZE, 2, components, timeline);
+
+    NLINK_ASSERT_PHASE("Verify dependents fail and independent components load");
+    NLINK_ASSERT_TRUE(result == NEXUS_PARTIAL_SUCCESS, "partial success");
+    NLINK_ASSERT_TRUE(timeline[1].result == NEXUS_IO_ERROR, "missing library");
+    NLINK_ASSERT_TRUE(timeline[2].result == NEXUS_DEPENDENCY_ERROR, "direct dependent skipped");
+    NLINK_ASSERT_TRUE(timeline[0].result == NEXUS_DEPENDENCY_ERROR, "transitive dependent skipped");
+    NLINK_ASSERT_TRUE(timeline[3].result == NEXUS_DEPENDENCY_ERROR, "second dependent skipped");
+    NLINK_ASSERT_TRUE(timeline[0].init_start_ms < 0, "dependent never initialized");
+    NLINK_ASSERT_TRUE(components[4] != NULL && components[5] != NULL, "independent components load");
+    NLINK_ASSERT_TRUE(components[0] == NULL && components[1] == NULL, "failed components are NULL");
+
+    free_components(&ctx, components, BATCH_SIZE);
+}
+
+NLINK_TEST_CASE(component_batch, rejects_cycles_and_missing_dependencies) {
+    NLINK_ARRANGE_PHASE("Build a cycle and a missing required dependency");
+    NexusContext ctx = { 0 };
+    ctx.log_level = NEXUS_LOG_ERROR + 1;
+    static const char* const a_deps[] = { "b" };
+    static const char* const b_deps[] = { "a" };
+    static const char* const c_deps[] = { "absent" };
+    NexusComponentSpec cycle[2] = {
+        { "libm.so.6", "a", a_deps, NULL, 1 },
+        { "libdl.so.2", "b", b_deps, NULL, 1 },
+    };
+    NexusComponentSpec missing[1] = { { "libm.so.6", "c", c_deps, NULL, 1 } };
+    NexusComponentSpec duplicate[2] = {
+        { "libm.so.6", "a", NULL, NULL, 0 },
+        { "libdl.so.2", "a", NULL, NULL, 0 },
+    };
+    NexusComponent* components[2];
+
+    NLINK_ACT_PHASE("Try to load each batch");
+    NexusResult cyclic = nexus_load_components(&ctx, cycle, 2, 2, components, NULL);
+    NexusResult unresolved = nexus_load_components(&ctx, missing, 1, 1, components, NULL);
+    NexusResult twice = nexus_load_components(&ctx, duplicate, 2, 1, components, NULL);
+
+    NLINK_ASSERT_PHASE("Verify nothing is loaded");
+    NLINK_ASSERT_TRUE(cyclic == NEXUS_DEPENDENCY_ERROR, "cycle rejected");
+    NLINK_ASSERT_TRUE(unresolved == NEXUS_DEPENDENCY_ERROR, "missing dependency rejected");
+    NLINK_ASSERT_TRUE(twice == NEXUS_INVALID_PARAMETER, "duplicate identifier rejected");
+    NLINK_ASSERT_TRUE(components[0] == NULL && components[1] == NULL, "no components returned");
+}
+
+NLINK_TEST_REGISTER(component_batch, initializes_after_dependencies);
+NLINK_TEST_REGISTER(component_batch, failure_skips_dependents);
+NLINK_TEST_REGISTER(component_batch, rejects_cycles_and_missing_dependencies);
+
+NLINK_TEST_MAIN(
+    nlink_run_test_component_batch_initializes_after_dependencies();
+    nlink_run_test_component_batch_failure_skips_dependents();
+    nlink_run_test_component_batch_rejects_cycles_and_missing_dependencies();
+)
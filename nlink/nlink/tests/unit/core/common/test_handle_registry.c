@@ -0,0 +1,180 @@
+/**
+ * @file test_handle_registry.c
+ * @brief Unit tests for the hash-indexed component handle registry
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/common/nexus_loader.h"
+#include <dlfcn.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define REGISTRY_THREADS 8
+#define REGISTRY_PATHS_PER_THREAD 200
+
+/* Handles only need to be valid for dlclose() at cleanup */
+static void* open_self(void) {
+    return dlopen(NULL, RTLD_LAZY);
+}
+
+typedef struct {
+    NexusHandleRegistry* registry;
+    int id;
+    int failures;
+} RegistryWorker;
+
+static void* register_and_find(void* arg) {
+    RegistryWorker* worker = (RegistryWorker*)arg;
+    char path[64];
+
+    for (int i = 0; i < REGISTRY_PATHS_PER_THREAD; i++) {
+        /* Every thread registers the shared paths; only one may win each */
+        snprintf(path, sizeof(path), "/nonexistent/shared_%d.so", i);
+        void* handle = open_self();
+        NexusResult result = nexus_register_component_handle(worker->registry, handle, path, "shared");
+        if (result != NEXUS_SUCCESS) {
+            dlclose(handle);
+            if (result != NEXUS_ALREADY_EXISTS) worker->failures++;
+        }
+
+        snprintf(path, sizeof(path), "/nonexistent/t%d_%d.so", worker->id, i);
+        handle = open_self();
+        if (nexus_register_component_handle(worker->registry, handle, path, "own") != NEXUS_SUCCESS) {
+            dlclose(handle);
+            worker->failures++;
+        }
+        if (nexus_find_component_handle(worker->registry, path) != handle) {
+            worker->failures++;
+        }
+    }
+    return NULL;
+}
+
+NLINK_TEST_SUITE_BEGIN(handle_registry) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(handle_registry) {
+    (void)context;
+}
+
+NLINK_TEST_CASE(handle_registry, finds_registered_paths) {
+    NLINK_ARRANGE_PHASE("Create a registry and 100 handles");
+    NexusHandleRegistry* registry = nexus_init_handle_registry();
+    NLINK_ASSERT_NOT_NULL(registry, "registry created");
+    void* handles[100];
+    char path[64];
+
+    NLINK_ACT_PHASE("Register each handle under its own path");
+    for (int i = 0; i < 100; i++) {
+        snprintf(path, sizeof(path), "/nonexistent/lib%d.so", i);
+        handles[i] = open_self();
+        nexus_register_component_handle(registry, handles[i], path, "component");
+    }
+
+    NLINK_ASSERT_PHASE("Verify every path resolves to its handle");
+    NLINK_ASSERT_EQUAL_INT(100, (int)nexus_handle_registry_count(registry), "all registered");
+    for (int i = 0; i < 100; i++) {
+        snprintf(path, sizeof(path), "/nonexistent/lib%d.so", i);
+        NLINK_ASSERT_TRUE(nexus_find_component_handle(registry, path) == handles[i], "path lookup");
+    }
+    NLINK_ASSERT_TRUE(nexus_find_component_handle(registry, "/nonexistent/lib100.so") == NULL, "unknown path misses");
+
+    nexus_cleanup_handle_registry(registry);
+}
+
+NLINK_TEST_CASE(handle_registry, rejects_duplicate_registration) {
+    NLINK_ARRANGE_PHASE("Open two handles for the same path");
+    NexusHandleRegistry* registry = nexus_init_handle_registry();
+    void* first = open_self();
+    void* second = open_self();
+
+    NLINK_ACT_PHASE("Register the path twice");
+    NexusResult added = nexus_register_component_handle(registry, first, "/nonexistent/dup.so", "a");
+    NexusResult again = nexus_register_component_handle(registry, second, "/nonexistent/dup.so", "b");
+
+    NLINK_ASSERT_PHASE("Verify the first registration is kept");
+    NLINK_ASSERT_TRUE(added == NEXUS_SUCCESS, "first registration succeeds");
+    NLINK_ASSERT_TRUE(again == NEXUS_ALREADY_EXISTS, "second registration is rejected");
+    NLINK_ASSERT_EQUAL_INT(1, (int)nexus_handle_registry_count(registry), "one entry");
+    NLINK_ASSERT_TRUE(nexus_find_component_handle(registry, "/nonexistent/dup.so") == first, "first handle kept");
+
+    dlclose(second);
+    nexus_cleanup_handle_registry(registry);
+}
+
+NLINK_TEST_CASE(handle_registry, dedupes_symlinks_and_canonical_paths) {
+    NLINK_ARRANGE_PHASE("Create a library file and a symlink to it");
+    NexusHandleRegistry* registry = nexus_init_handle_registry();
+    char dir[] = "/tmp/nlink_registry_XXXXXX";
+    NLINK_ASSERT_NOT_NULL(mkdtemp(dir), "temporary directory");
+    char target[128], link[128], dotted[160];
+    snprintf(target, sizeof(target), "%s/libreal.so", dir);
+    snprintf(link, sizeof(link), "%s/liblink.so", dir);
+    snprintf(dotted, sizeof(dotted), "%s/./libreal.so", dir);
+    FILE* file = fopen(target, "w");
+    if (file) fclose(file);
+    NLINK_ASSERT_EQUAL_INT(0, symlink(target, link), "symlink created");
+    void* handle = open_self();
+    void* other = open_self();
+
+    NLINK_ACT_PHASE("Register a non-canonical spelling, then the symlink");
+    NexusResult added = nexus_register_component_handle(registry, handle, dotted, "real");
+    NexusResult via_link = nexus_register_component_handle(registry, other, link, "link");
+
+    NLINK_ASSERT_PHASE("Verify every spelling resolves to one entry");
+    NLINK_ASSERT_TRUE(added == NEXUS_SUCCESS, "first registration succeeds");
+    NLINK_ASSERT_TRUE(via_link == NEXUS_ALREADY_EXISTS, "symlink deduped by inode");
+    NLINK_ASSERT_TRUE(nexus_find_component_handle(registry, target) == handle, "canonical path lookup");
+    NLINK_ASSERT_TRUE(nexus_find_component_handle(registry, link) == handle, "symlink lookup");
+    NLINK_ASSERT_EQUAL_INT(1, (int)nexus_handle_registry_count(registry), "one entry");
+
+    dlclose(other);
+    nexus_cleanup_handle_registry(registry);
+    unlink(link);
+    unlink(target);
+    rmdir(dir);
+}
+
+NLINK_TEST_CASE(handle_registry, concurrent_register_and_find) {
+    NLINK_ARRANGE_PHASE("Start with an empty registry");
+    NexusHandleRegistry* registry = nexus_init_handle_registry();
+    pthread_t threads[REGISTRY_THREADS];
+    RegistryWorker workers[REGISTRY_THREADS];
+
+    NLINK_ACT_PHASE("Register and look up from several threads");
+    for (int i = 0; i < REGISTRY_THREADS; i++) {
+        workers[i] = (RegistryWorker){ registry, i, 0 };
+        pthread_create(&threads[i], NULL, register_and_find, &workers[i]);
+    }
+    for (int i = 0; i < REGISTRY_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    NLINK_ASSERT_PHASE("Verify no lookup missed and shared paths were kept once");
+    int failures = 0;
+    for (int i = 0; i < REGISTRY_THREADS; i++) {
+        failures += workers[i].failures;
+    }
+    NLINK_ASSERT_EQUAL_INT(0, failures, "no failed registrations or lookups");
+    NLINK_ASSERT_EQUAL_INT(REGISTRY_PATHS_PER_THREAD * (REGISTRY_THREADS + 1),
+                           (int)nexus_handle_registry_count(registry), "shared paths registered once");
+
+    nexus_cleanup_handle_registry(registry);
+}
+
+NLINK_TEST_REGISTER(handle_registry, finds_registered_paths);
+NLINK_TEST_REGISTER(handle_registry, rejects_duplicate_registration);
+NLINK_TEST_REGISTER(handle_registry, dedupes_symlinks_and_canonical_paths);
+NLINK_TEST_REGISTER(handle_registry, concurrent_register_and_find);
+
+NLINK_TEST_MAIN(
+    nlink_run_test_handle_registry_finds_registered_paths();
+    nlink_run_test_handle_registry_rejects_duplicate_registration();
+    nlink_run_test_handle_registry_dedupes_symlinks_and_canonical_paths();
+    nlink_run_test_handle_registry_concurrent_register_and_find();
+)
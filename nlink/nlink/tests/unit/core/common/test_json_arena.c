@@ -0,0 +1,94 @@
+/**
+ * @file test_json_arena.c
+ * @brief Unit tests for arena-backed JSON parsing
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/common/json.h"
+
+NLINK_TEST_SUITE_BEGIN(json_arena) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(json_arena) {
+    (void)context;
+}
+
+NLINK_TEST_CASE(json_arena, matches_heap_parser) {
+    NLINK_ARRANGE_PHASE("Create an arena and a nested document");
+    NexusJsonArena* arena = nexus_json_arena_create(0);
+    const char* text = "{ \"id\": \"core\", \"version\": \"1.2.0\", \"size\": 42.5,"
+                       "  \"deps\": [ { \"id\": \"a\", \"optional\": true }, { \"id\": \"b\" } ],"
+                       "  \"empty\": [], \"none\": null, \"obj\": {} }";
+
+    NLINK_ACT_PHASE("Parse with both parsers");
+    NexusJsonValue* heap = nexus_json_parse(text);
+    NexusJsonValue* root = nexus_json_parse_arena(arena, text);
+    NexusJsonValue* deps = root ? nexus_json_object_get(root, "deps") : NULL;
+
+    NLINK_ASSERT_PHASE("Verify the arena document matches");
+    NLINK_ASSERT_NOT_NULL(root, "arena parse succeeds");
+    NLINK_ASSERT_EQUAL_STRING(nexus_json_object_get_string(heap, "id", ""),
+                              nexus_json_object_get_string(root, "id", NULL), "string member");
+    NLINK_ASSERT_TRUE(nexus_json_object_get_number(root, "size", 0) == 42.5, "number member");
+    NLINK_ASSERT_EQUAL_INT(2, (int)deps->data.array.count, "array sized exactly");
+    NLINK_ASSERT_TRUE(nexus_json_object_get_bool(deps->data.array.items[0], "optional", false), "nested bool");
+    NLINK_ASSERT_EQUAL_INT(0, (int)nexus_json_object_get(root, "empty")->data.array.count, "empty array");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_JSON_NULL, nexus_json_object_get(root, "none")->type, "null member");
+    NLINK_ASSERT_EQUAL_INT(7, (int)root->data.object.count, "object sized exactly");
+
+    nexus_json_free(heap);
+    nexus_json_arena_destroy(arena);
+}
+
+NLINK_TEST_CASE(json_arena, unescapes_in_place) {
+    NLINK_ARRANGE_PHASE("Create a mutable buffer with escapes");
+    NexusJsonArena* arena = nexus_json_arena_create(0);
+    char buffer[] = "[\"plain\", \"tab\\there\", \"quote\\\"d\", \"\\u00e9\\ud83d\\ude00\"]";
+
+    NLINK_ACT_PHASE("Parse the buffer in place");
+    NexusJsonValue* root = nexus_json_parse_in_place(arena, buffer);
+
+    NLINK_ASSERT_PHASE("Verify strings point into the buffer and are unescaped");
+    NLINK_ASSERT_NOT_NULL(root, "in-place parse succeeds");
+    NLINK_ASSERT_TRUE(root->data.array.items[0]->data.string == buffer + 2, "string storage is the buffer");
+    NLINK_ASSERT_EQUAL_STRING("tab\there", root->data.array.items[1]->data.string, "escape sequence");
+    NLINK_ASSERT_EQUAL_STRING("quote\"d", root->data.array.items[2]->data.string, "escaped quote");
+    NLINK_ASSERT_EQUAL_STRING("\xc3\xa9\xf0\x9f\x98\x80", root->data.array.items[3]->data.string,
+                              "unicode escapes and surrogate pairs become UTF-8");
+
+    nexus_json_arena_destroy(arena);
+}
+
+NLINK_TEST_CASE(json_arena, reset_and_errors) {
+    NLINK_ARRANGE_PHASE("Create an arena");
+    NexusJsonArena* arena = nexus_json_arena_create(0);
+
+    NLINK_ACT_PHASE("Parse malformed input, then reuse the arena");
+    NexusJsonValue* truncated = nexus_json_parse_arena(arena, "{\"a\": [1, 2");
+    NexusJsonValue* trailing = nexus_json_parse_arena(arena, "{} x");
+    NexusJsonValue* bad_escape = nexus_json_parse_arena(arena, "\"\\u12\"");
+    nexus_json_arena_reset(arena);
+    NexusJsonValue* valid = nexus_json_parse_arena(arena, "[1, 2, 3]");
+
+    NLINK_ASSERT_PHASE("Verify failures are reported and reset allows reuse");
+    NLINK_ASSERT_NULL(truncated, "truncated document is rejected");
+    NLINK_ASSERT_NULL(trailing, "trailing text is rejected");
+    NLINK_ASSERT_NULL(bad_escape, "short unicode escape is rejected");
+    NLINK_ASSERT_NOT_NULL(valid, "arena is reusable after reset");
+    NLINK_ASSERT_EQUAL_INT(3, (int)valid->data.array.count, "document parsed after reset");
+
+    nexus_json_arena_destroy(arena);
+}
+
+NLINK_TEST_REGISTER(json_arena, matches_heap_parser)
+NLINK_TEST_REGISTER(json_arena, unescapes_in_place)
+NLINK_TEST_REGISTER(json_arena, reset_and_errors)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_json_arena_matches_heap_parser();
+    nlink_run_test_json_arena_unescapes_in_place();
+    nlink_run_test_json_arena_reset_and_errors()
+)
@@ -0,0 +1,116 @@
+/**
+ * @file test_json_object_index.c
+ * @brief Unit tests for hashed key lookup in JSON objects
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/common/json.h"
+
+#define MEMBER_COUNT 200
+
+/* Heap object with keys "k0".."k<count-1>" mapping to their numbers */
+static NexusJsonValue* make_object(size_t count) {
+    NexusJsonValue* object = nexus_json_object();
+    char key[32];
+    for (size_t i = 0; i < count; i++) {
+        snprintf(key, sizeof(key), "k%zu", i);
+        nexus_json_object_add(object, key, nexus_json_number((double)i));
+    }
+    return object;
+}
+
+NLINK_TEST_SUITE_BEGIN(json_object_index) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(json_object_index) {
+    (void)context;
+}
+
+NLINK_TEST_CASE(json_object_index, lazy_index_lookups) {
+    NLINK_ARRANGE_PHASE("Create a small and a large object");
+    NexusJsonValue* small = make_object(NEXUS_JSON_INDEX_THRESHOLD - 1);
+    NexusJsonValue* large = make_object(MEMBER_COUNT);
+
+    NLINK_ACT_PHASE("Look up every key by name and by precomputed key");
+    bool found_all = true;
+    char key[32];
+    for (size_t i = 0; i < MEMBER_COUNT; i++) {
+        snprintf(key, sizeof(key), "k%zu", i);
+        NexusJsonKey hashed = nexus_json_key(key);
+        if (nexus_json_object_get_number(large, key, -1) != (double)i ||
+            nexus_json_object_get_number_key(large, &hashed, -1) != (double)i) {
+            found_all = false;
+        }
+    }
+    NexusJsonKey missing = nexus_json_key("absent");
+
+    NLINK_ASSERT_PHASE("Verify only the large object is indexed and lookups agree");
+    NLINK_ASSERT_TRUE(found_all, "every key is found");
+    NLINK_ASSERT_NOT_NULL(large->data.object.index, "large object built its index");
+    NLINK_ASSERT_TRUE(nexus_json_object_get_number(small, "k3", -1) == 3.0, "small object lookup");
+    NLINK_ASSERT_NULL(small->data.object.index, "small object is scanned");
+    NLINK_ASSERT_NULL(nexus_json_object_get_key(large, &missing), "missing key");
+
+    nexus_json_free(small);
+    nexus_json_free(large);
+}
+
+NLINK_TEST_CASE(json_object_index, additions_and_duplicates) {
+    NLINK_ARRANGE_PHASE("Create an indexed object");
+    NexusJsonValue* object = make_object(MEMBER_COUNT);
+    nexus_json_object_get(object, "k0");
+
+    NLINK_ACT_PHASE("Add new keys and a duplicate after indexing");
+    nexus_json_object_add(object, "k5", nexus_json_number(-5));
+    nexus_json_object_add(object, "extra", nexus_json_string("value"));
+    char key[32];
+    for (size_t i = MEMBER_COUNT; i < 4 * MEMBER_COUNT; i++) {
+        snprintf(key, sizeof(key), "k%zu", i);
+        nexus_json_object_add(object, key, nexus_json_number((double)i));
+    }
+
+    NLINK_ASSERT_PHASE("Verify the index follows additions and keeps the first duplicate");
+    NLINK_ASSERT_TRUE(nexus_json_object_get_number(object, "k5", 0) == 5.0, "first occurrence wins");
+    NLINK_ASSERT_EQUAL_STRING("value", nexus_json_object_get_string(object, "extra", ""), "key added after indexing");
+    NLINK_ASSERT_TRUE(nexus_json_object_get_number(object, "k799", 0) == 799.0, "key added after regrowth");
+
+    nexus_json_free(object);
+}
+
+NLINK_TEST_CASE(json_object_index, arena_objects) {
+    NLINK_ARRANGE_PHASE("Create a JSON document with a large object");
+    size_t capacity = MEMBER_COUNT * 32 + 16;
+    char* text = (char*)malloc(capacity);
+    size_t length = (size_t)snprintf(text, capacity, "{");
+    for (size_t i = 0; i < MEMBER_COUNT; i++) {
+        length += (size_t)snprintf(text + length, capacity - length, "%s\"k%zu\": %zu", i ? ", " : "", i, i);
+    }
+    snprintf(text + length, capacity - length, ", \"k7\": -7}");
+    NexusJsonArena* arena = nexus_json_arena_create(0);
+
+    NLINK_ACT_PHASE("Parse the document into an arena");
+    NexusJsonValue* root = nexus_json_parse_arena(arena, text);
+
+    NLINK_ASSERT_PHASE("Verify the arena object is indexed from the arena");
+    NLINK_ASSERT_NOT_NULL(root, "document parses");
+    NLINK_ASSERT_NOT_NULL(root->data.object.index, "index built while parsing");
+    NLINK_ASSERT_TRUE(root->data.object.index->in_arena, "index storage is the arena");
+    NLINK_ASSERT_TRUE(nexus_json_object_get_number(root, "k150", 0) == 150.0, "indexed lookup");
+    NLINK_ASSERT_TRUE(nexus_json_object_get_number(root, "k7", 0) == 7.0, "first duplicate wins");
+
+    nexus_json_arena_destroy(arena);
+    free(text);
+}
+
+NLINK_TEST_REGISTER(json_object_index, lazy_index_lookups)
+NLINK_TEST_REGISTER(json_object_index, additions_and_duplicates)
+NLINK_TEST_REGISTER(json_object_index, arena_objects)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_json_object_index_lazy_index_lookups();
+    nlink_run_test_json_object_index_additions_and_duplicates();
+    nlink_run_test_json_object_index_arena_objects()
+)
@@ -0,0 +1,122 @@
+/**
+ * @file test_json_scan.c
+ * @brief Unit tests for vectorized string scanning and number parsing
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/common/json.h"
+
+NLINK_TEST_SUITE_BEGIN(json_scan) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(json_scan) {
+    (void)context;
+}
+
+NLINK_TEST_CASE(json_scan, strings_at_every_alignment) {
+    NLINK_ARRANGE_PHASE("Create a buffer for strings at each offset");
+    const char* text = "\"abcdefghijklmnopq\\\"rs\"          \v ]";
+    size_t length = strlen(text);
+    char buffer[96];
+    NexusJsonArena* arena = nexus_json_arena_create(0);
+    bool heap_ok = true;
+    bool arena_ok = true;
+
+    NLINK_ACT_PHASE("Parse the string from every offset within two blocks");
+    for (size_t offset = 0; offset < 32; offset++) {
+        memset(buffer, 'x', sizeof(buffer));
+        memcpy(buffer + offset, text, length + 1);
+
+        char* out = NULL;
+        const char* next = nexus_json_parse_string(buffer + offset, &out);
+        if (!next || strcmp(out, "abcdefghijklmnopq\"rs") != 0 || *nexus_json_skip_whitespace(next) != ']') {
+            heap_ok = false;
+        }
+        free(out);
+
+        char* in_place = NULL;
+        if (!nexus_json_parse_string_in_place(buffer + offset, &in_place) ||
+            strcmp(in_place, "abcdefghijklmnopq\"rs") != 0) {
+            arena_ok = false;
+        }
+    }
+
+    NLINK_ASSERT_PHASE("Verify scanning does not depend on alignment");
+    NLINK_ASSERT_TRUE(heap_ok, "heap string scan at all offsets");
+    NLINK_ASSERT_TRUE(arena_ok, "in-place string scan at all offsets");
+    NLINK_ASSERT_NULL(nexus_json_parse_string("\"unterminated", &(char*){ NULL }), "unterminated string");
+
+    nexus_json_arena_destroy(arena);
+}
+
+NLINK_TEST_CASE(json_scan, numbers_match_strtod) {
+    NLINK_ARRANGE_PHASE("Create fast-path and fallback numbers");
+    static const char* numbers[] = {
+        "0", "-0", "42", "-17", "3.25", "0.1", "1e22", "1e23", "2.5E-3", "123456789012345678",
+        "9007199254740993", "1.7976931348623157e308", "4.9e-324", "12345678901234567890.5",
+        "0.000000000000000000000001", "1e+5", "0x10", "1.", "1e", "-inf"
+    };
+    bool matches = true;
+    bool ends_match = true;
+
+    NLINK_ACT_PHASE("Scan each number and compare with strtod");
+    for (size_t i = 0; i < sizeof(numbers) / sizeof(numbers[0]); i++) {
+        char* expected_end;
+        double expected = strtod(numbers[i], &expected_end);
+        double value = 0.0;
+        const char* end = nexus_json_scan_number(numbers[i], &value);
+        if (memcmp(&value, &expected, sizeof(double)) != 0) matches = false;
+        if (end != expected_end) ends_match = false;
+    }
+
+    srand(7);
+    for (int i = 0; i < 100000; i++) {
+        char text[64];
+        snprintf(text, sizeof(text), "%d.%0*d", rand() % 100000, 1 + rand() % 9, rand() % 1000000);
+        double value = 0.0;
+        nexus_json_scan_number(text, &value);
+        if (value != strtod(text, NULL)) matches = false;
+    }
+
+    NLINK_ASSERT_PHASE("Verify values are bit-identical to strtod");
+    NLINK_ASSERT_TRUE(matches, "same double as strtod");
+    NLINK_ASSERT_TRUE(ends_match, "same end position as strtod");
+}
+
+NLINK_TEST_CASE(json_scan, parsers_agree) {
+    NLINK_ARRANGE_PHASE("Create a document with numbers, escapes and indentation");
+    const char* text = "{\n    \"weights\": [1, -2.5, 3e2, 0.125],\n\t\"path\": \"a\\\\b\\\\\\\"c\\\"\",\n"
+                       "    \"name\": \"a fairly long string value that spans more than one block\"\n}";
+    NexusJsonArena* arena = nexus_json_arena_create(0);
+
+    NLINK_ACT_PHASE("Parse with the heap and arena parsers");
+    NexusJsonValue* heap = nexus_json_parse(text);
+    NexusJsonValue* root = nexus_json_parse_arena(arena, text);
+
+    NLINK_ASSERT_PHASE("Verify both parsers produce the same values");
+    NLINK_ASSERT_NOT_NULL(heap, "heap parse succeeds");
+    NLINK_ASSERT_NOT_NULL(root, "arena parse succeeds");
+    NexusJsonValue* weights = nexus_json_object_get(root, "weights");
+    NLINK_ASSERT_TRUE(weights->data.array.items[1]->data.number == -2.5, "negative decimal");
+    NLINK_ASSERT_TRUE(weights->data.array.items[2]->data.number == 300.0, "exponent");
+    NLINK_ASSERT_EQUAL_STRING("a\\b\\\"c\"", nexus_json_object_get_string(root, "path", ""), "arena escapes");
+    NLINK_ASSERT_EQUAL_STRING("a\\b\\\"c\"", nexus_json_object_get_string(heap, "path", ""), "heap escapes");
+    NLINK_ASSERT_EQUAL_STRING(nexus_json_object_get_string(heap, "name", ""),
+                              nexus_json_object_get_string(root, "name", NULL), "long string");
+
+    nexus_json_free(heap);
+    nexus_json_arena_destroy(arena);
+}
+
+NLINK_TEST_REGISTER(json_scan, strings_at_every_alignment)
+NLINK_TEST_REGISTER(json_scan, numbers_match_strtod)
+NLINK_TEST_REGISTER(json_scan, parsers_agree)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_json_scan_strings_at_every_alignment();
+    nlink_run_test_json_scan_numbers_match_strtod();
+    nlink_run_test_json_scan_parsers_agree()
+)
@@ -0,0 +1,268 @@
+/**
+ * @file test_json_writer.c
+ * @brief Unit tests for the streaming JSON writer
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/common/json.h"
+
+static NexusJsonValue* create_document(void) {
+    NexusJsonValue* root = nexus_json_object();
+    nexus_json_object_add(root, "name", nexus_json_string("tokenizer \"v2\"\n\tline\x01"));
+    nexus_json_object_add(root, "version", nexus_json_number(3.0));
+    nexus_json_object_add(root, "ratio", nexus_json_number(0.1));
+    nexus_json_object_add(root, "enabled", nexus_json_bool(true));
+    nexus_json_object_add(root, "parent", nexus_json_null());
+    nexus_json_object_add(root, "empty", nexus_json_array());
+
+    NexusJsonValue* list = nexus_json_array();
+    nexus_json_array_add(list, nexus_json_number(-1.5));
+    nexus_json_array_add(list, nexus_json_object());
+    NexusJsonValue* inner = nexus_json_object();
+    nexus_json_object_add(inner, "k\"ey", nexus_json_number(1e300));
+    nexus_json_array_add(list, inner);
+    nexus_json_object_add(root, "list", list);
+    return root;
+}
+
+NLINK_TEST_SUITE_BEGIN(json_writer) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(json_writer) {
+    (void)context;
+}
+
+NLINK_TEST_CASE(json_writer, numbers_round_trip) {
+    NLINK_ARRANGE_PHASE("Create numbers covering each formatting path");
+    static const struct { double value; const char* text; } cases[] = {
+        { 0.0, "0" }, { -0.0, "-0" }, { 42.0, "42" }, { -17.0, "-17" }, { 0.1, "0.1" },
+        { 3.25, "3.25" }, { 0.001, "0.001" }, { -123.456, "-123.456" }, { 4294967296.0, "4294967296" },
+        { 9007199254740991.0, "9007199254740991" }
+    };
+    char text[32];
+    bool exact = true;
+    bool round_trips = true;
+
+    NLINK_ACT_PHASE("Format known values and random doubles");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        size_t length = nexus_json_format_number(text, cases[i].value);
+        text[length] = '\0';
+        if (strcmp(text, cases[i].text) != 0) exact = false;
+    }
+
+    srand(11);
+    for (int i = 0; i < 200000; i++) {
+        uint64_t bits = ((uint64_t)rand() << 40) ^ ((uint64_t)rand() << 20) ^ (uint64_t)rand();
+        double value;
+        switch (i % 3) {
+            case 0: memcpy(&value, &bits, sizeof(value)); break;
+            case 1: value = (double)(rand() % 100000) / 1000.0; break;
+            default: value = (double)rand() / RAND_MAX * 1e6; break;
+        }
+        if (value != value || value > DBL_MAX || value < -DBL_MAX) continue;
+
+        size_t length = nexus_json_format_number(text, value);
+        text[length] = '\0';
+        double parsed = 0.0;
+        const char* end = nexus_json_scan_number(text, &parsed);
+        if (!end || *end != '\0' || memcmp(&parsed, &value, sizeof(double)) != 0) {
+            round_trips = false;
+        }
+    }
+
+    NLINK_ASSERT_PHASE("Verify shortest forms and exact round trips");
+    NLINK_ASSERT_TRUE(exact, "known values use their shortest form");
+    NLINK_ASSERT_TRUE(round_trips, "random doubles read back exactly");
+    size_t length = nexus_json_format_number(text, 0.0 / 0.0);
+    text[length] = '\0';
+    NLINK_ASSERT_EQUAL_STRING("null", text, "NaN is written as null");
+}
+
+/* Significant digits in formatted number text */
+static int significant_digits(const char* text) {
+    int count = 0;
+    int trailing_zeros = 0;
+    for (const char* s = text; *s && *s != 'e'; s++) {
+        if (*s < '0' || *s > '9' || (count == 0 && *s == '0')) continue;
+        count++;
+        trailing_zeros = *s == '0' ? trailing_zeros + 1 : 0;
+    }
+    return count - trailing_zeros;
+}
+
+NLINK_TEST_CASE(json_writer, numbers_shortest_exponents) {
+    NLINK_ARRANGE_PHASE("Create subnormal, tiny and huge numbers");
+    static const struct { double value; const char* text; } cases[] = {
+        { 5e-324, "5e-324" }, { -5e-324, "-5e-324" }, { 1e-310, "1e-310" },
+        { 2.2250738585072014e-308, "2.2250738585072014e-308" }, { 1e-7, "1e-7" },
+        { 1.5e-7, "1.5e-7" }, { 0.000001, "0.000001" }, { 1.25e-6, "0.00000125" },
+        { 1e-20, "1e-20" }, { 0.1 + 0.2, "0.30000000000000004" }, { 1e20, "100000000000000000000" },
+        { 1e21, "1e+21" }, { 1.7976931348623157e308, "1.7976931348623157e+308" },
+        { 9007199254740993.0, "9007199254740992" }, { 18014398509481984.0, "18014398509481984" }
+    };
+    char text[32];
+    bool exact = true;
+    bool shortest = true;
+
+    NLINK_ACT_PHASE("Format known values and check random doubles have no shorter form");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        size_t length = nexus_json_format_number(text, cases[i].value);
+        text[length] = '\0';
+        if (strcmp(text, cases[i].text) != 0) exact = false;
+    }
+
+    srand(23);
+    for (int i = 0; i < 20000; i++) {
+        uint64_t bits = ((uint64_t)rand() << 40) ^ ((uint64_t)rand() << 20) ^ (uint64_t)rand();
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        if (value != value || value > DBL_MAX || value < -DBL_MAX) continue;
+
+        size_t length = nexus_json_format_number(text, value);
+        text[length] = '\0';
+        int digits = significant_digits(text);
+        if (digits > 1) {
+            char shorter[32];
+            snprintf(shorter, sizeof(shorter), "%.*e", digits - 2, value);
+            if (strtod(shorter, NULL) == value) shortest = false;
+        }
+    }
+
+    NLINK_ASSERT_PHASE("Verify digits and layout");
+    NLINK_ASSERT_TRUE(exact, "subnormals and small exponents use their shortest form");
+    NLINK_ASSERT_TRUE(shortest, "one digit fewer never reads back");
+}
+
+NLINK_TEST_CASE(json_writer, pretty_and_compact_output) {
+    NLINK_ARRANGE_PHASE("Create a document with nested and empty containers");
+    NexusJsonValue* root = create_document();
+
+    NLINK_ACT_PHASE("Format it both ways");
+    char* pretty = nexus_json_to_string(root, true);
+    char* compact = nexus_json_to_string(root, false);
+
+    NLINK_ASSERT_PHASE("Verify the exact text");
+    NLINK_ASSERT_EQUAL_STRING(
+        "{\n"
+        "  \"name\": \"tokenizer \\\"v2\\\"\\n\\tline\\u0001\",\n"
+        "  \"version\": 3,\n"
+        "  \"ratio\": 0.1,\n"
+        "  \"enabled\": true,\n"
+        "  \"parent\": null,\n"
+        "  \"empty\": [],\n"
+        "  \"list\": [\n"
+        "    -1.5,\n"
+        "    {},\n"
+        "    {\n"
+        "      \"k\\\"ey\": 1e+300\n"
+        "    }\n"
+        "  ]\n"
+        "}", pretty, "pretty output");
+    NLINK_ASSERT_EQUAL_STRING(
+        "{\"name\":\"tokenizer \\\"v2\\\"\\n\\tline\\u0001\",\"version\":3,\"ratio\":0.1,\"enabled\":true,"
+        "\"parent\":null,\"empty\":[],\"list\":[-1.5,{},{\"k\\\"ey\":1e+300}]}", compact, "compact output");
+
+    NexusJsonArena* arena = nexus_json_arena_create(0);
+    NexusJsonValue* parsed = nexus_json_parse_arena(arena, compact);
+    NLINK_ASSERT_NOT_NULL(parsed, "compact output parses");
+    NLINK_ASSERT_EQUAL_STRING("tokenizer \"v2\"\n\tline\x01", nexus_json_object_get_string(parsed, "name", ""),
+                              "escaped string reads back");
+
+    nexus_json_arena_destroy(arena);
+    free(pretty);
+    free(compact);
+    nexus_json_free(root);
+}
+
+NLINK_TEST_CASE(json_writer, small_buffer_streams) {
+    NLINK_ARRANGE_PHASE("Create a large document and a minimal buffer");
+    NexusJsonValue* root = nexus_json_array();
+    for (int i = 0; i < 500; i++) {
+        NexusJsonValue* item = create_document();
+        nexus_json_object_add(item, "index", nexus_json_number(i));
+        nexus_json_array_add(root, item);
+    }
+    char buffer[NEXUS_JSON_WRITER_MIN_BUFFER];
+    NexusJsonStringSink string = { NULL, 0, 0 };
+    NexusJsonWriter writer;
+
+    NLINK_ACT_PHASE("Stream it through the small buffer");
+    nexus_json_writer_init(&writer, nexus_json_sink_string, &string, buffer, sizeof(buffer), 2);
+    nexus_json_writer_value(&writer, root);
+    bool ok = nexus_json_writer_finish(&writer);
+    char* expected = nexus_json_to_string(root, true);
+
+    NLINK_ASSERT_PHASE("Verify the output matches whole-buffer formatting");
+    NLINK_ASSERT_TRUE(ok, "writer finishes");
+    NLINK_ASSERT_FALSE(writer.owns_buffer, "caller buffer is used");
+    NLINK_ASSERT_EQUAL_STRING(expected, string.data, "streamed output");
+
+    free(expected);
+    free(string.data);
+    nexus_json_free(root);
+}
+
+NLINK_TEST_CASE(json_writer, events_to_file_descriptor) {
+    NLINK_ARRANGE_PHASE("Open a temporary file");
+    FILE* file = tmpfile();
+    NLINK_ASSERT_NOT_NULL(file, "temporary file");
+    NexusJsonWriter writer;
+    nexus_json_writer_init_fd(&writer, fileno(file), NULL, 0, 0);
+
+    NLINK_ACT_PHASE("Write an event log without building a tree");
+    nexus_json_writer_begin_object(&writer);
+    nexus_json_writer_key(&writer, "events");
+    nexus_json_writer_begin_array(&writer);
+    for (int i = 0; i < 20000; i++) {
+        nexus_json_writer_begin_object(&writer);
+        nexus_json_writer_key(&writer, "id");
+        nexus_json_writer_integer(&writer, i - 10000);
+        nexus_json_writer_key(&writer, "elapsed");
+        nexus_json_writer_number(&writer, i * 0.25);
+        nexus_json_writer_end_object(&writer);
+    }
+    nexus_json_writer_end_array(&writer);
+    nexus_json_writer_end_object(&writer);
+    bool ok = nexus_json_writer_finish(&writer);
+
+    NLINK_ASSERT_PHASE("Verify the file parses back to the same events");
+    NLINK_ASSERT_TRUE(ok, "writer finishes");
+    long size = lseek(fileno(file), 0, SEEK_END);
+    char* content = (char*)malloc((size_t)size + 1);
+    NLINK_ASSERT_EQUAL_INT((int)size, (int)pread(fileno(file), content, (size_t)size, 0), "file read");
+    content[size] = '\0';
+
+    NexusJsonValue* root = nexus_json_parse(content);
+    NexusJsonValue* events = nexus_json_object_get(root, "events");
+    NLINK_ASSERT_NOT_NULL(events, "events array");
+    NLINK_ASSERT_EQUAL_INT(20000, (int)events->data.array.count, "event count");
+    NexusJsonValue* last = events->data.array.items[19999];
+    NLINK_ASSERT_TRUE(nexus_json_object_get_number(last, "id", 0) == 9999.0, "integer field");
+    NLINK_ASSERT_TRUE(nexus_json_object_get_number(last, "elapsed", 0) == 4999.75, "number field");
+
+    NexusJsonWriter unbalanced;
+    nexus_json_writer_init(&unbalanced, nexus_json_sink_file, file, NULL, 0, 0);
+    nexus_json_writer_end_array(&unbalanced);
+    NLINK_ASSERT_FALSE(nexus_json_writer_finish(&unbalanced), "unbalanced close fails");
+
+    nexus_json_free(root);
+    free(content);
+    fclose(file);
+}
+
+NLINK_TEST_REGISTER(json_writer, numbers_round_trip)
+NLINK_TEST_REGISTER(json_writer, numbers_shortest_exponents)
+NLINK_TEST_REGISTER(json_writer, pretty_and_compact_output)
+NLINK_TEST_REGISTER(json_writer, small_buffer_streams)
+NLINK_TEST_REGISTER(json_writer, events_to_file_descriptor)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_json_writer_numbers_round_trip();
+    nlink_run_test_json_writer_numbers_shortest_exponents();
+    nlink_run_test_json_writer_pretty_and_compact_output();
+    nlink_run_test_json_writer_small_buffer_streams();
+    nlink_run_test_json_writer_events_to_file_descriptor()
+)
@@ -0,0 +1,175 @@
+/**
+ * @file test_metadata_cache.c
+ * @brief Unit tests for the binary component metadata cache
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/metadata/metadata_cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+static char dir[64];
+static char cache_path[128];
+static char json_paths[2][128];
+
+static const char* const COMPONENT_JSON[2] = {
+    "{\"id\": \"tokenizer\", \"version\": \"1.4.2-beta.1\", \"description\": \"Splits input\","
+    " \"dependencies\": [{\"id\": \"core\", \"version_req\": \">=1.2 <2.0 || ^3.0.0\", \"optional\": false}],"
+    " \"exported_symbols\": [{\"name\": \"tokenize\", \"version\": \"1.4.2\", \"type\": 0}, \"legacy_symbol\"],"
+    " \"imported_symbols\": [{\"name\": \"core_alloc\", \"version\": \"^1.0.0\", \"type\": 0}],"
+    " \"memory_footprint\": 4096, \"avg_load_time_ms\": 1.5}",
+    "{\"id\": \"core\", \"version\": \"1.9.0\", \"dependencies\": []}"
+};
+
+static void write_file(const char* path, const char* contents) {
+    FILE* file = fopen(path, "w");
+    if (file) {
+        fputs(contents, file);
+        fclose(file);
+    }
+}
+
+static void setup_files(void) {
+    snprintf(dir, sizeof(dir), "/tmp/nlink_metadata_XXXXXX");
+    if (!mkdtemp(dir)) return;
+    snprintf(cache_path, sizeof(cache_path), "%s/metadata.cache", dir);
+    for (int i = 0; i < 2; i++) {
+        snprintf(json_paths[i], sizeof(json_paths[i]), "%s/component%d.json", dir, i);
+        write_file(json_paths[i], COMPONENT_JSON[i]);
+    }
+}
+
+static void remove_files(void) {
+    unlink(cache_path);
+    unlink(json_paths[0]);
+    unlink(json_paths[1]);
+    rmdir(dir);
+}
+
+NLINK_TEST_SUITE_BEGIN(metadata_cache) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(metadata_cache) {
+    (void)context;
+}
+
+NLINK_TEST_CASE(metadata_cache, warm_start_matches_json) {
+    NLINK_ARRANGE_PHASE("Write two metadata files and build the cache");
+    setup_files();
+    const char* paths[2] = { json_paths[0], json_paths[1] };
+    EnhancedComponentMetadata* cold[2];
+    NexusMetadataCache* built = nexus_metadata_cache_load(cache_path, paths, 2, cold);
+    NLINK_ASSERT_NOT_NULL(built, "cache built on cold start");
+    nexus_metadata_cache_close(built);
+
+    NLINK_ACT_PHASE("Map the cache again");
+    EnhancedComponentMetadata* warm[2];
+    NexusMetadataCache* cache = nexus_metadata_cache_load(cache_path, paths, 2, warm);
+    EnhancedComponentMetadata* parsed = nexus_load_enhanced_metadata(json_paths[0]);
+
+    NLINK_ASSERT_PHASE("Verify the mapped structures equal the parsed ones");
+    NLINK_ASSERT_NOT_NULL(cache, "cache mapped");
+    NLINK_ASSERT_EQUAL_INT(2, (int)nexus_metadata_cache_count(cache), "both components cached");
+    EnhancedComponentMetadata* m = warm[0];
+    NLINK_ASSERT_NOT_NULL(m, "tokenizer cached");
+    NLINK_ASSERT_EQUAL_STRING(parsed->id, m->id, "id");
+    NLINK_ASSERT_EQUAL_STRING(parsed->version, m->version, "version");
+    NLINK_ASSERT_EQUAL_STRING(parsed->description, m->description, "description");
+    NLINK_ASSERT_EQUAL_INT(1, (int)m->dependencies_count, "dependency count");
+    NLINK_ASSERT_EQUAL_STRING("core", m->dependencies[0].id, "dependency id");
+    NLINK_ASSERT_EQUAL_INT(2, (int)m->exported_count, "exported count");
+    NLINK_ASSERT_EQUAL_STRING("legacy_symbol", m->exported_symbols[1].name, "legacy symbol");
+    NLINK_ASSERT_EQUAL_STRING("1.0.0", m->exported_symbols[1].version, "default symbol version");
+    NLINK_ASSERT_EQUAL_STRING("^1.0.0", m->imported_symbols[0].version, "import requirement");
+    NLINK_ASSERT_EQUAL_INT(4096, (int)m->memory_footprint, "memory footprint");
+    NLINK_ASSERT_TRUE(m->avg_load_time_ms == 1.5, "load time");
+    NLINK_ASSERT_EQUAL_STRING("beta.1", m->parsed_version->prerelease, "parsed prerelease");
+    NLINK_ASSERT_EQUAL_INT(4, m->parsed_version->minor, "parsed minor");
+    NLINK_ASSERT_TRUE(nexus_enhanced_metadata_check_version_compatibility(warm[0], warm[1]),
+                      "compiled constraint usable in place");
+    nexus_enhanced_metadata_track_usage(m);
+    NLINK_ASSERT_EQUAL_INT(1, m->usage_count, "usage tracked in place");
+
+    nexus_free_enhanced_metadata(parsed);
+    nexus_metadata_cache_close(cache);
+    remove_files();
+}
+
+NLINK_TEST_CASE(metadata_cache, detects_changed_sources) {
+    NLINK_ARRANGE_PHASE("Build a cache, then touch one file and rewrite the other");
+    setup_files();
+    const char* paths[2] = { json_paths[0], json_paths[1] };
+    EnhancedComponentMetadata* metadata[2];
+    nexus_metadata_cache_close(nexus_metadata_cache_load(cache_path, paths, 2, metadata));
+
+    struct timeval times[2] = { { 1000000000, 0 }, { 1000000000, 0 } };
+    utimes(json_paths[0], times);
+    write_file(json_paths[1], "{\"id\": \"core\", \"version\": \"2.0.0\"}");
+
+    NLINK_ACT_PHASE("Look both up in the stale cache, then load through it");
+    NexusMetadataCache* stale = nexus_metadata_cache_open(cache_path);
+    EnhancedComponentMetadata* touched = nexus_metadata_cache_lookup(stale, json_paths[0]);
+    EnhancedComponentMetadata* rewritten = nexus_metadata_cache_lookup(stale, json_paths[1]);
+    EnhancedComponentMetadata* unknown = nexus_metadata_cache_lookup(stale, cache_path);
+    nexus_metadata_cache_close(stale);
+    NexusMetadataCache* cache = nexus_metadata_cache_load(cache_path, paths, 2, metadata);
+
+    NLINK_ASSERT_PHASE("Verify only the changed contents were reparsed");
+    NLINK_ASSERT_NOT_NULL(touched, "same contents hit by hash");
+    NLINK_ASSERT_TRUE(rewritten == NULL, "changed contents miss");
+    NLINK_ASSERT_TRUE(unknown == NULL, "uncached path misses");
+    NLINK_ASSERT_NOT_NULL(metadata[1], "reloaded");
+    NLINK_ASSERT_EQUAL_STRING("2.0.0", metadata[1]->version, "new version");
+    NLINK_ASSERT_TRUE(nexus_metadata_cache_lookup(cache, json_paths[1]) == metadata[1], "cache rewritten");
+
+    nexus_metadata_cache_close(cache);
+    remove_files();
+}
+
+NLINK_TEST_CASE(metadata_cache, rejects_damaged_files) {
+    NLINK_ARRANGE_PHASE("Build a cache and damage copies of it");
+    setup_files();
+    const char* paths[2] = { json_paths[0], json_paths[1] };
+    EnhancedComponentMetadata* metadata[2];
+    nexus_metadata_cache_close(nexus_metadata_cache_load(cache_path, paths, 2, metadata));
+    struct stat st;
+    stat(cache_path, &st);
+
+    NLINK_ACT_PHASE("Truncate the cache, then change its version");
+    truncate(cache_path, st.st_size / 2);
+    NexusMetadataCache* truncated = nexus_metadata_cache_open(cache_path);
+    nexus_metadata_cache_close(nexus_metadata_cache_load(cache_path, paths, 2, metadata));
+    FILE* file = fopen(cache_path, "r+b");
+    unsigned char version = NEXUS_METADATA_CACHE_VERSION + 1;
+    fseek(file, 8, SEEK_SET);
+    fwrite(&version, 1, 1, file);
+    fclose(file);
+    NexusMetadataCache* versioned = nexus_metadata_cache_open(cache_path);
+    NexusMetadataCache* rebuilt = nexus_metadata_cache_load(cache_path, paths, 2, metadata);
+
+    NLINK_ASSERT_PHASE("Verify damaged caches are ignored and rebuilt");
+    NLINK_ASSERT_TRUE(truncated == NULL, "truncated cache rejected");
+    NLINK_ASSERT_TRUE(versioned == NULL, "other version rejected");
+    NLINK_ASSERT_NOT_NULL(rebuilt, "cache rebuilt");
+    NLINK_ASSERT_NOT_NULL(metadata[0], "metadata available after rebuild");
+    NLINK_ASSERT_EQUAL_STRING("tokenizer", metadata[0]->id, "rebuilt contents");
+
+    nexus_metadata_cache_close(rebuilt);
+    remove_files();
+}
+
+NLINK_TEST_REGISTER(metadata_cache, warm_start_matches_json);
+NLINK_TEST_REGISTER(metadata_cache, detects_changed_sources);
+NLINK_TEST_REGISTER(metadata_cache, rejects_damaged_files);
+
+NLINK_TEST_MAIN(
+    nlink_run_test_metadata_cache_warm_start_matches_json();
+    nlink_run_test_metadata_cache_detects_changed_sources();
+    nlink_run_test_metadata_cache_rejects_damaged_files();
+)
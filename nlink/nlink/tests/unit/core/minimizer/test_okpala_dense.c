@@ -0,0 +1,135 @@
+/**
+ * @file test_okpala_dense.c
+ * @brief Unit tests for dense Okpala automata and the partition-refinement minimizer
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/minimizer/okpala_automaton.h"
+#include "nlink/core/minimizer/okpala_dense.h"
+
+NLINK_TEST_SUITE_BEGIN(okpala_dense) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(okpala_dense) {
+    (void)context;
+}
+
+/*
+ * Strings over {a, b} ending in "ab". q3 duplicates q0 so that the
+ * minimizer has something to merge. q4 is a dead end; optionally q0 gets
+ * a 'c' transition to it, which q3 lacks, keeping q0 and q3 apart.
+ */
+static OkpalaAutomaton* build_ends_with_ab(bool duplicate) {
+    OkpalaAutomaton* automaton = okpala_automaton_create();
+    okpala_automaton_add_state(automaton, "q0", false);
+    okpala_automaton_add_state(automaton, "q1", false);
+    okpala_automaton_add_state(automaton, "q2", true);
+    okpala_automaton_add_state(automaton, "q3", false);
+    okpala_automaton_add_state(automaton, "q4", false);
+
+    okpala_automaton_add_transition(automaton, "q0", "q1", "a");
+    okpala_automaton_add_transition(automaton, "q0", "q3", "b");
+    okpala_automaton_add_transition(automaton, "q1", "q1", "a");
+    okpala_automaton_add_transition(automaton, "q1", "q2", "b");
+    okpala_automaton_add_transition(automaton, "q2", "q1", "a");
+    okpala_automaton_add_transition(automaton, "q2", "q0", "b");
+    okpala_automaton_add_transition(automaton, "q3", "q1", "a");
+    okpala_automaton_add_transition(automaton, "q3", "q0", "b");
+
+    if (!duplicate) {
+        okpala_automaton_add_transition(automaton, "q0", "q4", "c");
+    }
+
+    return automaton;
+}
+
+NLINK_TEST_CASE(okpala_dense, layouts_agree) {
+    NLINK_ARRANGE_PHASE("Compile one automaton with both layouts");
+    OkpalaAutomaton* automaton = build_ends_with_ab(true);
+    OkpalaDenseAutomaton* flat = okpala_dense_create(automaton, OKPALA_LAYOUT_FLAT);
+    OkpalaDenseAutomaton* csr = okpala_dense_create(automaton, OKPALA_LAYOUT_CSR);
+    const char* inputs[] = { "", "ab", "aab", "abb", "bab", "abab", "ba", "abc" };
+    const bool expected[] = { false, true, true, false, true, true, false, false };
+
+    NLINK_ACT_PHASE("Run every input through both layouts");
+    bool agree = true;
+    for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+        size_t length = strlen(inputs[i]);
+        agree = agree &&
+                okpala_dense_accepts_bytes(flat, inputs[i], length) == expected[i] &&
+                okpala_dense_accepts_bytes(csr, inputs[i], length) == expected[i];
+    }
+
+    NLINK_ASSERT_PHASE("Verify layouts and acceptance");
+    NLINK_ASSERT_NOT_NULL(flat->table, "flat layout has a table");
+    NLINK_ASSERT_NULL(csr->table, "CSR layout has no table");
+    NLINK_ASSERT_EQUAL_INT(2, (int)flat->alphabet.count, "alphabet interned to two ids");
+    NLINK_ASSERT_TRUE(agree, "both layouts accept exactly the strings ending in ab");
+
+    okpala_dense_free(flat);
+    okpala_dense_free(csr);
+    okpala_automaton_free(automaton);
+}
+
+NLINK_TEST_CASE(okpala_dense, streaming_run) {
+    NLINK_ARRANGE_PHASE("Encode a symbol sequence");
+    OkpalaAutomaton* automaton = build_ends_with_ab(true);
+    OkpalaDenseAutomaton* dense = okpala_dense_create(automaton, OKPALA_LAYOUT_AUTO);
+    const char* symbols[] = { "b", "a", "a", "b", "z" };
+    uint32_t ids[5];
+    okpala_dense_encode(dense, symbols, 5, ids);
+
+    NLINK_ACT_PHASE("Feed the input in two chunks");
+    uint32_t state = okpala_dense_run(dense, dense->initial_state, ids, 2);
+    state = okpala_dense_run(dense, state, ids + 2, 2);
+    uint32_t rejected = okpala_dense_run(dense, state, ids + 4, 1);
+
+    NLINK_ASSERT_PHASE("Verify chunked runs resume where they stopped");
+    NLINK_ASSERT_TRUE(okpala_dense_is_accepting(dense, state), "baab is accepted");
+    NLINK_ASSERT_TRUE(okpala_dense_accepts(dense, ids, 4), "same result in one call");
+    NLINK_ASSERT_TRUE(ids[4] == OKPALA_DENSE_NONE, "unknown symbol encodes as none");
+    NLINK_ASSERT_TRUE(rejected == OKPALA_DENSE_NONE, "unknown symbol rejects");
+
+    okpala_dense_free(dense);
+    okpala_automaton_free(automaton);
+}
+
+NLINK_TEST_CASE(okpala_dense, minimizer_matches_reference) {
+    NLINK_ARRANGE_PHASE("Build automata with and without redundant states");
+    OkpalaAutomaton* redundant = build_ends_with_ab(true);
+    OkpalaAutomaton* distinct = build_ends_with_ab(false);
+
+    NLINK_ACT_PHASE("Minimize with both algorithms");
+    OkpalaAutomaton* fast_redundant = okpala_minimize_automaton(redundant, false);
+    OkpalaAutomaton* ref_redundant = okpala_minimize_automaton_reference(redundant, false);
+    OkpalaAutomaton* fast_distinct = okpala_minimize_automaton(distinct, false);
+    OkpalaAutomaton* ref_distinct = okpala_minimize_automaton_reference(distinct, false);
+
+    NLINK_ASSERT_PHASE("Verify state counts agree");
+    NLINK_ASSERT_EQUAL_INT(4, (int)fast_redundant->state_count, "q3 merges into q0");
+    NLINK_ASSERT_EQUAL_INT((int)ref_redundant->state_count, (int)fast_redundant->state_count,
+                           "reference agrees on the redundant automaton");
+    NLINK_ASSERT_EQUAL_INT(5, (int)fast_distinct->state_count, "a missing transition keeps states apart");
+    NLINK_ASSERT_EQUAL_INT((int)ref_distinct->state_count, (int)fast_distinct->state_count,
+                           "reference agrees on the partial automaton");
+
+    okpala_automaton_free(fast_redundant);
+    okpala_automaton_free(ref_redundant);
+    okpala_automaton_free(fast_distinct);
+    okpala_automaton_free(ref_distinct);
+    okpala_automaton_free(redundant);
+    okpala_automaton_free(distinct);
+}
+
+NLINK_TEST_REGISTER(okpala_dense, layouts_agree)
+NLINK_TEST_REGISTER(okpala_dense, streaming_run)
+NLINK_TEST_REGISTER(okpala_dense, minimizer_matches_reference)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_okpala_dense_layouts_agree();
+    nlink_run_test_okpala_dense_streaming_run();
+    nlink_run_test_okpala_dense_minimizer_matches_reference()
+)
@@ -0,0 +1,226 @@
+/**
+ * @file test_mps_scheduling.c
+ * @brief Unit tests for SCC-based multi-pass pipeline scheduling
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/mpsystem/mps_pipeline.h"
+#include <stdlib.h>
+#include <string.h>
+
+static NexusContext* test_ctx = NULL;
+
+NLINK_TEST_SUITE_BEGIN(mps_scheduling) {
+    test_ctx = nexus_create_context(NULL);
+    return test_ctx;
+}
+
+NLINK_TEST_SUITE_END(mps_scheduling) {
+    nexus_destroy_context((NexusContext*)context);
+}
+
+/* Build a configuration whose components all support re-entrance */
+static NexusMPSConfig* create_config(const char** ids, size_t count) {
+    NexusMPSConfig* config = mps_create_default_pipeline_config();
+    config->components = (NexusMPSComponentConfig**)calloc(count, sizeof(NexusMPSComponentConfig*));
+    config->component_count = count;
+    for (size_t i = 0; i < count; i++) {
+        config->components[i] = (NexusMPSComponentConfig*)calloc(1, sizeof(NexusMPSComponentConfig));
+        config->components[i]->component_id = strdup(ids[i]);
+        config->components[i]->supports_reentrance = true;
+    }
+    return config;
+}
+
+static void add_connection(NexusMPSConfig* config, const char* source, const char* target,
+                           NexusConnectionDirection direction) {
+    config->connections = (NexusComponentConnection**)realloc(
+        config->connections, (config->connection_count + 1) * sizeof(NexusComponentConnection*));
+    NexusComponentConnection* connection = (NexusComponentConnection*)calloc(1, sizeof(NexusComponentConnection));
+    connection->source_id = strdup(source);
+    connection->target_id = strdup(target);
+    connection->direction = direction;
+    config->connections[config->connection_count++] = connection;
+}
+
+/* Sum of the ints in a stream */
+static int sum_ints(const NexusMPSDataStream* input) {
+    int sum = 0;
+    for (size_t i = 0; i + sizeof(int) <= input->size; i += sizeof(int)) {
+        int value;
+        memcpy(&value, (const char*)input->data + i, sizeof(int));
+        sum += value;
+    }
+    return sum;
+}
+
+static NexusResult emit_one(NexusMPSPipelineComponent* component, NexusMPSDataStream* input,
+                            NexusMPSDataStream* output) {
+    (void)component;
+    (void)input;
+    int value = 1;
+    return mps_stream_write(output, &value, sizeof(value));
+}
+
+/* Sum of inputs, saturating at 50 */
+static NexusResult saturate(NexusMPSPipelineComponent* component, NexusMPSDataStream* input,
+                            NexusMPSDataStream* output) {
+    (void)component;
+    int value = sum_ints(input);
+    if (value > 50) {
+        value = 50;
+    }
+    return mps_stream_write(output, &value, sizeof(value));
+}
+
+static NexusResult increment(NexusMPSPipelineComponent* component, NexusMPSDataStream* input,
+                             NexusMPSDataStream* output) {
+    (void)component;
+    int value = sum_ints(input) + 1;
+    return mps_stream_write(output, &value, sizeof(value));
+}
+
+static NexusResult copy_input(NexusMPSPipelineComponent* component, NexusMPSDataStream* input,
+                              NexusMPSDataStream* output) {
+    (void)component;
+    return input->size > 0 ? mps_stream_write(output, input->data, input->size) : NEXUS_SUCCESS;
+}
+
+/* source -> {a <-> b} -> sink; a and b feed each other until a saturates */
+static NexusMPSConfig* create_feedback_config(void) {
+    const char* ids[] = { "source", "a", "b", "sink" };
+    NexusMPSConfig* config = create_config(ids, 4);
+    add_connection(config, "source", "a", NEXUS_DIRECTION_FORWARD);
+    add_connection(config, "a", "b", NEXUS_DIRECTION_BIDIRECTIONAL);
+    add_connection(config, "sink", "b", NEXUS_DIRECTION_BACKWARD);
+    return config;
+}
+
+static void bind_feedback_components(NexusMPSPipeline* pipeline) {
+    mps_pipeline_get_component(pipeline, "source")->process_func = emit_one;
+    mps_pipeline_get_component(pipeline, "a")->process_func = saturate;
+    mps_pipeline_get_component(pipeline, "b")->process_func = increment;
+    mps_pipeline_get_component(pipeline, "sink")->process_func = copy_input;
+}
+
+NLINK_TEST_CASE(mps_scheduling, cycle_detection) {
+    NLINK_ARRANGE_PHASE("Create a configuration with one feedback loop");
+    NexusMPSConfig* config = create_feedback_config();
+    NexusCycleInfo* cycles = NULL;
+    size_t cycle_count = 0;
+
+    NLINK_ACT_PHASE("Detect cycles and validate without allowing them");
+    bool found = mps_detect_cycles(test_ctx, config, &cycles, &cycle_count);
+    config->allow_cycles = false;
+    NexusResult result = mps_validate_pipeline_config(test_ctx, config);
+
+    NLINK_ASSERT_PHASE("Verify the loop is reported once");
+    NLINK_ASSERT_TRUE(found, "cycle is detected");
+    NLINK_ASSERT_EQUAL_INT(1, (int)cycle_count, "one strongly connected component is cyclic");
+    NLINK_ASSERT_EQUAL_INT(2, (int)cycles[0].component_count, "cycle spans a and b");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_DEPENDENCY_ERROR, result, "cycles are rejected when not allowed");
+
+    mps_free_cycle_info(cycles, cycle_count);
+    mps_free_pipeline_config(config);
+}
+
+NLINK_TEST_CASE(mps_scheduling, feedback_fixpoint) {
+    NLINK_ARRANGE_PHASE("Create a pipeline with a feedback loop");
+    NexusMPSConfig* config = create_feedback_config();
+    NexusMPSPipeline* pipeline = mps_pipeline_create(test_ctx, config);
+    bind_feedback_components(pipeline);
+    NexusMPSDataStream* input = mps_stream_create_from_data("x", 1, NULL);
+    NexusMPSDataStream* output = mps_stream_create(0);
+
+    NLINK_ACT_PHASE("Execute the pipeline");
+    NexusResult result = mps_pipeline_execute(test_ctx, pipeline, input, output);
+    NexusMPSPipelineStats stats;
+    mps_pipeline_get_stats(pipeline, &stats);
+    int value = 0;
+    memcpy(&value, output->data, sizeof(value));
+
+    NLINK_ASSERT_PHASE("Verify the loop ran to its fixpoint");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "execution succeeds");
+    NLINK_ASSERT_EQUAL_INT(51, value, "sink sees b's output at the fixpoint");
+    NLINK_ASSERT_EQUAL_INT(3, (int)stats.group_count, "source, loop and sink groups");
+    NLINK_ASSERT_EQUAL_INT(3, stats.level_count, "groups form a chain of levels");
+    NLINK_ASSERT_TRUE(stats.groups[1].converged, "loop converges");
+    NLINK_ASSERT_TRUE(stats.groups[1].iterations > 1, "loop is iterated");
+    NLINK_ASSERT_EQUAL_INT(1, stats.groups[0].iterations, "acyclic group runs once");
+
+    mps_pipeline_destroy(test_ctx, pipeline);
+    mps_free_pipeline_config(config);
+    mps_stream_destroy(input);
+    mps_stream_destroy(output);
+}
+
+NLINK_TEST_CASE(mps_scheduling, iteration_limit) {
+    NLINK_ARRANGE_PHASE("Create a feedback pipeline limited to five passes");
+    NexusMPSConfig* config = create_feedback_config();
+    NexusMPSPipeline* pipeline = mps_pipeline_create(test_ctx, config);
+    bind_feedback_components(pipeline);
+    mps_pipeline_set_iteration_limit(pipeline, 5);
+    NexusMPSDataStream* input = mps_stream_create_from_data("x", 1, NULL);
+    NexusMPSDataStream* output = mps_stream_create(0);
+
+    NLINK_ACT_PHASE("Execute the pipeline");
+    NexusResult result = mps_pipeline_execute(test_ctx, pipeline, input, output);
+    NexusMPSPipelineStats stats;
+    mps_pipeline_get_stats(pipeline, &stats);
+
+    NLINK_ASSERT_PHASE("Verify the loop stopped at the limit");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "execution succeeds");
+    NLINK_ASSERT_EQUAL_INT(5, stats.groups[1].iterations, "loop stops after five passes");
+    NLINK_ASSERT_FALSE(stats.groups[1].converged, "loop did not reach its fixpoint");
+
+    mps_pipeline_destroy(test_ctx, pipeline);
+    mps_free_pipeline_config(config);
+    mps_stream_destroy(input);
+    mps_stream_destroy(output);
+}
+
+NLINK_TEST_CASE(mps_scheduling, parallel_branches) {
+    NLINK_ARRANGE_PHASE("Create a fan-out of independent branches");
+    const char* ids[] = { "source", "b0", "b1", "b2", "b3", "sink" };
+    NexusMPSConfig* config = create_config(ids, 6);
+    for (size_t i = 1; i <= 4; i++) {
+        add_connection(config, "source", ids[i], NEXUS_DIRECTION_FORWARD);
+        add_connection(config, ids[i], "sink", NEXUS_DIRECTION_FORWARD);
+    }
+    NexusMPSPipeline* pipeline = mps_pipeline_create(test_ctx, config);
+    for (size_t i = 0; i < 6; i++) {
+        mps_pipeline_get_component(pipeline, ids[i])->process_func = copy_input;
+    }
+    NexusMPSDataStream* input = mps_stream_create_from_data("ab", 2, NULL);
+    NexusMPSDataStream* output = mps_stream_create(0);
+
+    NLINK_ACT_PHASE("Execute the pipeline");
+    NexusResult result = mps_pipeline_execute(test_ctx, pipeline, input, output);
+    NexusMPSPipelineStats stats;
+    mps_pipeline_get_stats(pipeline, &stats);
+
+    NLINK_ASSERT_PHASE("Verify the branches share a level and all reach the sink");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "execution succeeds");
+    NLINK_ASSERT_EQUAL_INT(3, stats.level_count, "source, branches and sink levels");
+    NLINK_ASSERT_EQUAL_INT(8, (int)output->size, "sink gathers every branch");
+    NLINK_ASSERT_TRUE(memcmp(output->data, "abababab", 8) == 0, "branch outputs concatenated in order");
+
+    mps_pipeline_destroy(test_ctx, pipeline);
+    mps_free_pipeline_config(config);
+    mps_stream_destroy(input);
+    mps_stream_destroy(output);
+}
+
+NLINK_TEST_REGISTER(mps_scheduling, cycle_detection)
+NLINK_TEST_REGISTER(mps_scheduling, feedback_fixpoint)
+NLINK_TEST_REGISTER(mps_scheduling, iteration_limit)
+NLINK_TEST_REGISTER(mps_scheduling, parallel_branches)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_mps_scheduling_cycle_detection();
+    nlink_run_test_mps_scheduling_feedback_fixpoint();
+    nlink_run_test_mps_scheduling_iteration_limit();
+    nlink_run_test_mps_scheduling_parallel_branches()
+)
@@ -0,0 +1,223 @@
+/**
+ * @file test_glob_matcher.c
+ * @brief Unit tests for compiled glob programs and pattern sets
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/pattern/matcher.h"
+#include <ctype.h>
+#include <stdlib.h>
+
+/* Recursive reference matcher with the original glob semantics */
+static bool reference_glob(const char* pattern, const char* string) {
+    if (*pattern == '\0') return *string == '\0';
+
+    if (*pattern == '*') {
+        while (pattern[1] == '*') pattern++;
+        for (;; string++) {
+            if (reference_glob(pattern + 1, string)) return true;
+            if (*string == '\0') return false;
+        }
+    }
+
+    if (*string == '\0') return false;
+    if (*pattern == '?') return reference_glob(pattern + 1, string + 1);
+
+    if (*pattern == '[') {
+        const char* end = strchr(pattern, ']');
+        const char* p = pattern + 1;
+        bool negate = false;
+        bool member = false;
+
+        if (!end) return false;
+        if (*p == '^') {
+            negate = true;
+            p++;
+        }
+        while (p < end && !member) {
+            if (p + 2 < end && p[1] == '-') {
+                member = *string >= p[0] && *string <= p[2];
+                p += 3;
+            } else {
+                member = *string == *p++;
+            }
+        }
+        return member != negate && reference_glob(end + 1, string + 1);
+    }
+
+    return *pattern == *string && reference_glob(pattern + 1, string + 1);
+}
+
+static void random_string(char* out, size_t max, const char* alphabet) {
+    size_t length = (size_t)rand() % max;
+    size_t size = strlen(alphabet);
+
+    for (size_t i = 0; i < length; i++) {
+        out[i] = alphabet[rand() % size];
+    }
+    out[length] = '\0';
+}
+
+static void random_pattern(char* out, size_t max) {
+    static const char* pieces[] = { "a", "b", "c", "*", "**", "?", "[ab]", "[^a]", "[a-b]", "[" };
+    size_t count = (size_t)rand() % max;
+
+    out[0] = '\0';
+    for (size_t i = 0; i < count; i++) {
+        /* Keep unterminated classes rare */
+        size_t piece = (size_t)rand() % 10;
+        if (piece == 9 && rand() % 4 != 0) piece = 3;
+        strcat(out, pieces[piece]);
+    }
+}
+
+NLINK_TEST_SUITE_BEGIN(glob_matcher) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(glob_matcher) {
+    (void)context;
+}
+
+NLINK_TEST_CASE(glob_matcher, compiled_semantics) {
+    NLINK_ARRANGE_PHASE("Compile globs with stars, classes and case folding");
+    NlinkPatternMatcher* suffix = nlink_pattern_create("*.so", NLINK_PATTERN_FLAG_GLOB);
+    NlinkPatternMatcher* middle = nlink_pattern_create("lib*_[0-9]*.so", NLINK_PATTERN_FLAG_GLOB);
+    NlinkPatternMatcher* folded = nlink_pattern_create("LIB[A-C]?*", NLINK_PATTERN_FLAG_GLOB | NLINK_PATTERN_FLAG_CASE_INSENSITIVE);
+    NlinkPatternMatcher* broken = nlink_pattern_create("*[abc", NLINK_PATTERN_FLAG_GLOB);
+    NlinkPatternMatcher* stars = nlink_pattern_create("***", NLINK_PATTERN_FLAG_GLOB);
+
+    NLINK_ACT_PHASE("Match representative strings");
+    bool suffix_hit = nlink_pattern_match(suffix, "libcore.so");
+    bool suffix_miss = nlink_pattern_match(suffix, "libcore.so.1");
+    bool middle_hit = nlink_pattern_match(middle, "libparser_2x.so");
+    bool middle_miss = nlink_pattern_match(middle, "libparser_x.so");
+    bool overlap_miss = nlink_pattern_match(middle, "lib_1.s");
+    bool folded_hit = nlink_pattern_match(folded, "libbx");
+    bool folded_miss = nlink_pattern_match(folded, "libd");
+    bool broken_miss = nlink_pattern_match(broken, "[abc");
+    bool stars_hit = nlink_pattern_match(stars, "");
+
+    NLINK_ASSERT_PHASE("Verify compiled matching");
+    NLINK_ASSERT_TRUE(nlink_pattern_is_glob(suffix), "glob flag wins over regex detection");
+    NLINK_ASSERT_TRUE(suffix_hit, "suffix match");
+    NLINK_ASSERT_FALSE(suffix_miss, "suffix is anchored at the end");
+    NLINK_ASSERT_TRUE(middle_hit, "middle segment after class");
+    NLINK_ASSERT_FALSE(middle_miss, "class requires a digit");
+    NLINK_ASSERT_FALSE(overlap_miss, "segments do not overlap");
+    NLINK_ASSERT_TRUE(folded_hit, "case insensitive range");
+    NLINK_ASSERT_FALSE(folded_miss, "case insensitive range rejects");
+    NLINK_ASSERT_FALSE(broken_miss, "unterminated class never matches");
+    NLINK_ASSERT_TRUE(stars_hit, "stars match the empty string");
+
+    nlink_pattern_destroy(suffix);
+    nlink_pattern_destroy(middle);
+    nlink_pattern_destroy(folded);
+    nlink_pattern_destroy(broken);
+    nlink_pattern_destroy(stars);
+}
+
+NLINK_TEST_CASE(glob_matcher, pathological_stars) {
+    NLINK_ARRANGE_PHASE("Compile a pattern that is exponential for a backtracking matcher");
+    NlinkPatternMatcher* matcher = nlink_pattern_create("a*a*a*a*a*a*a*a*a*a*a*a*b", NLINK_PATTERN_FLAG_GLOB);
+    char text[4097];
+    memset(text, 'a', sizeof(text) - 1);
+    text[sizeof(text) - 1] = '\0';
+
+    NLINK_ACT_PHASE("Match a long run without the final byte");
+    bool missed = nlink_pattern_match(matcher, text);
+    text[sizeof(text) - 2] = 'b';
+    bool found = nlink_pattern_match(matcher, text);
+
+    NLINK_ASSERT_PHASE("Verify the result");
+    NLINK_ASSERT_FALSE(missed, "no trailing b");
+    NLINK_ASSERT_TRUE(found, "trailing b");
+
+    nlink_pattern_destroy(matcher);
+}
+
+NLINK_TEST_CASE(glob_matcher, agrees_with_reference) {
+    NLINK_ARRANGE_PHASE("Generate random globs and strings");
+    char pattern[128];
+    char text[16];
+    size_t disagreements = 0;
+    srand(16);
+
+    NLINK_ACT_PHASE("Compare the compiled matcher with the recursive reference");
+    for (int i = 0; i < 2000; i++) {
+        random_pattern(pattern, 8);
+        NlinkPatternMatcher* matcher = nlink_pattern_create(pattern, NLINK_PATTERN_FLAG_GLOB);
+        for (int j = 0; j < 20; j++) {
+            random_string(text, sizeof(text), "abc[");
+            if (nlink_pattern_match(matcher, text) != reference_glob(pattern, text)) {
+                printf("  mismatch: '%s' on \"%s\"\n", pattern, text);
+                disagreements++;
+            }
+        }
+        nlink_pattern_destroy(matcher);
+    }
+
+    NLINK_ASSERT_PHASE("Verify agreement");
+    NLINK_ASSERT_EQUAL_INT(0, (int)disagreements, "compiled globs agree with the reference");
+}
+
+NLINK_TEST_CASE(glob_matcher, pattern_set) {
+    NLINK_ARRANGE_PHASE("Build a set from random globs");
+    enum { PATTERNS = 90 };
+    char storage[PATTERNS][128];
+    const char* patterns[PATTERNS];
+    char text[16];
+    size_t disagreements = 0;
+    srand(61);
+    for (int i = 0; i < PATTERNS; i++) {
+        random_pattern(storage[i], 8);
+        patterns[i] = storage[i];
+    }
+    NlinkPatternSet* set = nlink_pattern_set_create(patterns, PATTERNS, NLINK_PATTERN_FLAG_NONE);
+
+    NLINK_ACT_PHASE("Compare set results with one matcher per pattern");
+    for (int j = 0; j < 500; j++) {
+        size_t matches[PATTERNS];
+        size_t expected = 0;
+        random_string(text, sizeof(text), "abc");
+        size_t found = nlink_pattern_set_match(set, text, matches, PATTERNS);
+        for (size_t i = 0; i < PATTERNS; i++) {
+            if (reference_glob(patterns[i], text)) {
+                if (expected >= found || matches[expected] != i) disagreements++;
+                expected++;
+            }
+        }
+        if (found != expected) disagreements++;
+    }
+
+    const char* named[] = { "*.so", "lib*", "LIBCORE.SO" };
+    NlinkPatternSet* folded = nlink_pattern_set_create(named, 3, NLINK_PATTERN_FLAG_CASE_INSENSITIVE);
+    size_t hits[3];
+    size_t hit_count = nlink_pattern_set_match(folded, "libcore.so", hits, 3);
+    size_t capped = nlink_pattern_set_match(folded, "libcore.so", hits, 1);
+
+    NLINK_ASSERT_PHASE("Verify set matching");
+    NLINK_ASSERT_NOT_NULL(set, "set created");
+    NLINK_ASSERT_EQUAL_INT(PATTERNS, (int)nlink_pattern_set_count(set), "pattern count");
+    NLINK_ASSERT_EQUAL_INT(0, (int)disagreements, "set agrees with individual matching");
+    NLINK_ASSERT_EQUAL_INT(3, (int)hit_count, "all three named patterns match");
+    NLINK_ASSERT_EQUAL_INT(3, (int)capped, "count is reported past the capacity");
+    NLINK_ASSERT_EQUAL_INT(0, (int)hits[0], "first index");
+
+    nlink_pattern_set_destroy(set);
+    nlink_pattern_set_destroy(folded);
+}
+
+NLINK_TEST_REGISTER(glob_matcher, compiled_semantics)
+NLINK_TEST_REGISTER(glob_matcher, pathological_stars)
+NLINK_TEST_REGISTER(glob_matcher, agrees_with_reference)
+NLINK_TEST_REGISTER(glob_matcher, pattern_set)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_glob_matcher_compiled_semantics();
+    nlink_run_test_glob_matcher_pathological_stars();
+    nlink_run_test_glob_matcher_agrees_with_reference();
+    nlink_run_test_glob_matcher_pattern_set()
+)
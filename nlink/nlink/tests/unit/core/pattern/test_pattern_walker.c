@@ -0,0 +1,175 @@
+/**
+ * @file test_pattern_walker.c
+ * @brief Unit tests for the parallel glob directory walker
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/pattern_matching/pattern_matcher.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static char tree[64];
+
+static void make_file(const char* relative) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s", tree, relative);
+
+    /* Create parent directories one level at a time */
+    for (char* p = path + strlen(tree) + 1; *p; p++) {
+        if (*p == '/') {
+            *p = '\0';
+            mkdir(path, 0755);
+            *p = '/';
+        }
+    }
+    FILE* file = fopen(path, "w");
+    if (file) fclose(file);
+}
+
+static void remove_tree(const char* path) {
+    char command[128];
+    snprintf(command, sizeof(command), "rm -rf '%s'", path);
+    if (system(command) != 0) {
+        printf("  could not remove %s\n", path);
+    }
+}
+
+/* Run a walk and join the sorted matches relative to the tree with ',' */
+static void walk(const char* pattern, nlink_pattern_options options, char* out, size_t size) {
+    nlink_pattern_result* result = nlink_match_pattern(pattern, tree, options);
+    size_t prefix = strlen(tree) + 1;
+
+    out[0] = '\0';
+    for (size_t i = 0; result && i < result->count; i++) {
+        if (i > 0) strncat(out, ",", size - strlen(out) - 1);
+        strncat(out, result->matches[i] + prefix, size - strlen(out) - 1);
+    }
+    if (!result) snprintf(out, size, "(null)");
+    nlink_pattern_result_free(result);
+}
+
+static bool stop_after_first(const char* path, void* user_data) {
+    (void)path;
+    (*(int*)user_data)++;
+    return false;
+}
+
+NLINK_TEST_SUITE_BEGIN(pattern_walker) {
+    snprintf(tree, sizeof(tree), "/tmp/nlink_walk_XXXXXX");
+    if (!mkdtemp(tree)) return NULL;
+
+    make_file("a/x.c");
+    make_file("a/b/c.c");
+    make_file("a/b/d.h");
+    make_file("a/.hidden/y.c");
+    make_file("lib/components/tok/libtok.so");
+    make_file("lib/components/tok/tok.c");
+    make_file("lib/components/parse/libparse.so");
+    make_file("lib/README");
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(pattern_walker) {
+    (void)context;
+    remove_tree(tree);
+}
+
+NLINK_TEST_CASE(pattern_walker, globs) {
+    NLINK_ARRANGE_PHASE("Use default options on a small tree");
+    nlink_pattern_options options = nlink_pattern_default_options();
+    char recursive[256], wildcard_dir[256], literal_tail[256], libraries[256], missing[256];
+
+    NLINK_ACT_PHASE("Walk with recursive, wildcard and literal components");
+    walk("**/*.c", options, recursive, sizeof(recursive));
+    walk("a/*/c.c", options, wildcard_dir, sizeof(wildcard_dir));
+    walk("a/b/*", options, literal_tail, sizeof(literal_tail));
+    walk("lib/*/*/lib*.so", options, libraries, sizeof(libraries));
+    walk("nothing/*/here", options, missing, sizeof(missing));
+
+    NLINK_ASSERT_PHASE("Verify the matched paths");
+    NLINK_ASSERT_EQUAL_STRING("a/b/c.c,a/x.c,lib/components/tok/tok.c", recursive, "** skips dot directories");
+    NLINK_ASSERT_EQUAL_STRING("a/b/c.c", wildcard_dir, "* stays within one component");
+    NLINK_ASSERT_EQUAL_STRING("a/b/c.c,a/b/d.h", literal_tail, "literal prefix");
+    NLINK_ASSERT_EQUAL_STRING("lib/components/parse/libparse.so,lib/components/tok/libtok.so", libraries, "nested wildcards");
+    NLINK_ASSERT_EQUAL_STRING("", missing, "missing prefix matches nothing");
+}
+
+NLINK_TEST_CASE(pattern_walker, options) {
+    NLINK_ARRANGE_PHASE("Vary case, dot and thread options");
+    nlink_pattern_options options = nlink_pattern_default_options();
+    char folded[256], dotted[256], single[256], parallel[256];
+
+    NLINK_ACT_PHASE("Walk with each option set");
+    options.case_sensitive = false;
+    walk("A/X.C", options, folded, sizeof(folded));
+    options = nlink_pattern_default_options();
+    options.dot_special = false;
+    walk("a/**/*.c", options, dotted, sizeof(dotted));
+    options = nlink_pattern_default_options();
+    options.max_threads = 1;
+    walk("**/*", options, single, sizeof(single));
+    options.max_threads = 8;
+    walk("**/*", options, parallel, sizeof(parallel));
+
+    NLINK_ASSERT_PHASE("Verify each option");
+    NLINK_ASSERT_EQUAL_STRING("a/x.c", folded, "case insensitive literal components");
+    NLINK_ASSERT_EQUAL_STRING("a/.hidden/y.c,a/b/c.c,a/x.c", dotted, "dot files are ordinary names");
+    NLINK_ASSERT_EQUAL_STRING(single, parallel, "thread count does not change results");
+    NLINK_ASSERT_TRUE(strstr(single, "lib/components/tok/libtok.so") != NULL, "** reaches the deepest files");
+}
+
+NLINK_TEST_CASE(pattern_walker, streaming) {
+    NLINK_ARRANGE_PHASE("Add a symlink loop and prepare a stopping callback");
+    char link_path[128], loop[256];
+    int calls = 0;
+    snprintf(link_path, sizeof(link_path), "%s/a/loop", tree);
+    bool linked = symlink("..", link_path) == 0;
+    nlink_pattern_options options = nlink_pattern_default_options();
+    options.follow_symlinks = true;
+
+    NLINK_ACT_PHASE("Stop after the first match and walk through the loop");
+    bool ran = nlink_match_pattern_stream("**/*", tree, options, stop_after_first, &calls);
+    walk("**/x.c", options, loop, sizeof(loop));
+    unlink(link_path);
+
+    NLINK_ASSERT_PHASE("Verify streaming and loop detection");
+    NLINK_ASSERT_TRUE(linked, "symlink created");
+    NLINK_ASSERT_TRUE(ran, "stopped walk still succeeds");
+    NLINK_ASSERT_EQUAL_INT(1, calls, "callback stops the walk");
+    NLINK_ASSERT_EQUAL_STRING("a/x.c", loop, "each directory is read once");
+}
+
+NLINK_TEST_CASE(pattern_walker, match_string) {
+    NLINK_ARRANGE_PHASE("Use default options");
+    nlink_pattern_options options = nlink_pattern_default_options();
+
+    NLINK_ACT_PHASE("Match paths without touching the file system");
+    bool nested = nlink_pattern_match_string("src/**/*.c", "src/core/x/y.c", options);
+    bool direct = nlink_pattern_match_string("src/**/*.c", "src/y.c", options);
+    bool crosses = nlink_pattern_match_string("src/*.c", "src/core/y.c", options);
+    bool hidden = nlink_pattern_match_string("*", ".profile", options);
+    bool extended = nlink_pattern_match_string("lib+(a|b).so", "libabba.so", options);
+
+    NLINK_ASSERT_PHASE("Verify component semantics");
+    NLINK_ASSERT_TRUE(nested, "** spans directories");
+    NLINK_ASSERT_TRUE(direct, "** matches no directories");
+    NLINK_ASSERT_FALSE(crosses, "* does not cross /");
+    NLINK_ASSERT_FALSE(hidden, "leading dot needs an explicit dot");
+    NLINK_ASSERT_TRUE(extended, "extended glob groups");
+}
+
+NLINK_TEST_REGISTER(pattern_walker, globs)
+NLINK_TEST_REGISTER(pattern_walker, options)
+NLINK_TEST_REGISTER(pattern_walker, streaming)
+NLINK_TEST_REGISTER(pattern_walker, match_string)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_pattern_walker_globs();
+    nlink_run_test_pattern_walker_options();
+    nlink_run_test_pattern_walker_streaming();
+    nlink_run_test_pattern_walker_match_string()
+)
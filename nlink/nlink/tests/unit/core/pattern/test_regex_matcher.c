@@ -0,0 +1,307 @@
+/**
+ * @file test_regex_matcher.c
+ * @brief Unit tests for the compiled regular expression engine
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/pattern_matching/regex_matcher.h"
+#include <regex.h>
+
+typedef struct {
+    const char* pattern;
+    const char* text;
+    long start;             /* -1 if there is no match */
+    long end;
+} RegexCase;
+
+static bool check_cases(const RegexCase* cases, size_t count, nlink_regex_options options) {
+    bool ok = true;
+
+    for (size_t i = 0; i < count; i++) {
+        nlink_regex* regex = nlink_regex_compile(cases[i].pattern, options);
+        if (!regex) {
+            printf("  compile failed: %s\n", cases[i].pattern);
+            ok = false;
+            continue;
+        }
+
+        nlink_regex_match_result match;
+        bool found = nlink_regex_match(regex, cases[i].text, &match);
+        bool quick = nlink_regex_match(regex, cases[i].text, NULL);
+        if (found != (cases[i].start >= 0) || quick != found ||
+            (found && ((long)match.start != cases[i].start || (long)match.end != cases[i].end))) {
+            printf("  mismatch: /%s/ on \"%s\"\n", cases[i].pattern, cases[i].text);
+            ok = false;
+        }
+        if (found) {
+            nlink_regex_match_free(&match);
+        }
+        nlink_regex_free(regex);
+    }
+
+    return ok;
+}
+
+/* Random extended pattern over a small alphabet that POSIX reads the same way */
+static void random_pattern(char* out, int depth) {
+    static const char* atoms[] = { "a", "b", "c", ".", "[ab]", "[^a]", "[b-c]" };
+    static const char* quantifiers[] = { "", "", "", "*", "+", "?", "{1,2}", "{2}" };
+    int parts = 1 + rand() % 3;
+
+    for (int i = 0; i < parts; i++) {
+        if (depth < 2 && rand() % 4 == 0) {
+            char inner[256] = "";
+            random_pattern(inner, depth + 1);
+            strcat(out, "(");
+            strcat(out, inner);
+            if (rand() % 2) {
+                char other[256] = "";
+                random_pattern(other, depth + 1);
+                strcat(out, "|");
+                strcat(out, other);
+            }
+            strcat(out, ")");
+        } else {
+            strcat(out, atoms[rand() % (sizeof(atoms) / sizeof(atoms[0]))]);
+        }
+        strcat(out, quantifiers[rand() % (sizeof(quantifiers) / sizeof(quantifiers[0]))]);
+    }
+}
+
+NLINK_TEST_SUITE_BEGIN(regex_matcher) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(regex_matcher) {
+    (void)context;
+}
+
+NLINK_TEST_CASE(regex_matcher, syntax_and_positions) {
+    NLINK_ARRANGE_PHASE("Create patterns covering the supported syntax");
+    static const RegexCase cases[] = {
+        { "test", "a test string", 2, 6 },
+        { "test", "no match", -1, 0 },
+        { "^lib/.*\\.so$", "lib/components/tokenizer.so", 0, 27 },
+        { "^lib/.*\\.so$", "lib/tokenizer.so.1", -1, 0 },
+        { "stage_[0-9]+", "pipeline/stage_42/out", 9, 17 },
+        { "\\d{2,3}", "v1.2024", 3, 6 },
+        { "colou?r", "the color red", 4, 9 },
+        { "(tok|pars)er", "lexer parser", 6, 12 },
+        { "a|ab", "ab", 0, 1 },
+        { "x*", "abc", 0, 0 },
+        { "a.c", "a\nc abc", 4, 7 },
+        { "[[:upper:]][[:lower:]]+", "nlink Core", 6, 10 },
+        { "[^/]+$", "lib/core/minimizer", 9, 18 },
+        { "\\.", "a.b", 1, 2 },
+        { "\\x41+", "zAAA", 1, 4 },
+        { "a{2}b{0,1}", "aaab", 0, 2 },
+        { "(a*)*b", "aaab", 0, 4 },
+        { "^$", "", 0, 0 },
+        { "$", "abc", 3, 3 },
+        { "a{,2}x", "aaax", 1, 4 },
+        { "[]a]+", "x]a]", 1, 4 },
+        { "[a-]+", "x-a-", 1, 4 },
+        { "{", "a{b", 1, 2 }
+    };
+
+    NLINK_ACT_PHASE("Match each pattern");
+    bool ok = check_cases(cases, sizeof(cases) / sizeof(cases[0]), nlink_regex_default_options());
+
+    NLINK_ASSERT_PHASE("Verify matches and positions");
+    NLINK_ASSERT_TRUE(ok, "every case matches as expected");
+}
+
+NLINK_TEST_CASE(regex_matcher, options) {
+    NLINK_ARRANGE_PHASE("Create option sets");
+    nlink_regex_options insensitive = nlink_regex_default_options();
+    insensitive.case_insensitive = true;
+    nlink_regex_options multiline = nlink_regex_default_options();
+    multiline.multiline = true;
+    nlink_regex_options dot_all = nlink_regex_default_options();
+    dot_all.dot_all = true;
+    nlink_regex_options basic = nlink_regex_default_options();
+    basic.extended = false;
+
+    static const RegexCase insensitive_cases[] = {
+        { "TOKENIZER", "lib/Tokenizer.so", 4, 13 },
+        { "[a-c]+", "xABCa", 1, 5 }
+    };
+    static const RegexCase multiline_cases[] = {
+        { "^b+$", "aa\nbb\ncc", 3, 5 },
+        { "a$", "ba\nb", 1, 2 },
+        { "^c", "ab\ncd", 3, 4 }
+    };
+    static const RegexCase dot_all_cases[] = {
+        { "a.c", "a\nc", 0, 3 }
+    };
+    static const RegexCase basic_cases[] = {
+        { "\\(ab\\)\\{2\\}", "xabab", 1, 5 },
+        { "a|b+", "xa|b+", 1, 5 },
+        { "a\\|c", "xc", 1, 2 }
+    };
+
+    NLINK_ACT_PHASE("Match under each option");
+    bool insensitive_ok = check_cases(insensitive_cases, 2, insensitive);
+    bool multiline_ok = check_cases(multiline_cases, 3, multiline);
+    bool dot_all_ok = check_cases(dot_all_cases, 1, dot_all);
+    bool basic_ok = check_cases(basic_cases, 3, basic);
+    nlink_regex* single_line = nlink_regex_compile("^b", nlink_regex_default_options());
+    bool anchored = nlink_regex_match(single_line, "a\nb", NULL);
+
+    NLINK_ASSERT_PHASE("Verify each option changes matching");
+    NLINK_ASSERT_TRUE(insensitive_ok, "case insensitive");
+    NLINK_ASSERT_TRUE(multiline_ok, "multiline anchors");
+    NLINK_ASSERT_TRUE(dot_all_ok, "dot matches newline");
+    NLINK_ASSERT_TRUE(basic_ok, "basic syntax");
+    NLINK_ASSERT_FALSE(anchored, "^ only matches at the start without multiline");
+
+    nlink_regex_free(single_line);
+}
+
+NLINK_TEST_CASE(regex_matcher, capture_groups) {
+    NLINK_ARRANGE_PHASE("Compile patterns with groups");
+    nlink_regex_options options = nlink_regex_default_options();
+    nlink_regex* version = nlink_regex_compile("([a-z_]+)-(\\d+)\\.(\\d+)(-(\\w+))?", options);
+    nlink_regex* lazy = nlink_regex_compile("<(.+?)>", options);
+    nlink_regex* greedy = nlink_regex_compile("<(.+)>", options);
+    nlink_regex_match_result match;
+    nlink_regex_match_result lazy_match;
+    nlink_regex_match_result greedy_match;
+
+    NLINK_ACT_PHASE("Match and extract groups");
+    bool found = nlink_regex_match(version, "lib/core_tokenizer-2.14.so", &match);
+    char* name = nlink_regex_get_group("lib/core_tokenizer-2.14.so", &match, 1);
+    char* minor = nlink_regex_get_group("lib/core_tokenizer-2.14.so", &match, 3);
+    char* suffix = nlink_regex_get_group("lib/core_tokenizer-2.14.so", &match, 5);
+    nlink_regex_match(lazy, "<a><b>", &lazy_match);
+    nlink_regex_match(greedy, "<a><b>", &greedy_match);
+    char* lazy_text = nlink_regex_get_group("<a><b>", &lazy_match, 1);
+    char* greedy_text = nlink_regex_get_group("<a><b>", &greedy_match, 1);
+
+    NLINK_ASSERT_PHASE("Verify group contents");
+    NLINK_ASSERT_TRUE(found, "version pattern matches");
+    NLINK_ASSERT_EQUAL_INT(5, (int)match.group_count, "group count");
+    NLINK_ASSERT_EQUAL_STRING("core_tokenizer", name, "first group");
+    NLINK_ASSERT_EQUAL_STRING("14", minor, "third group");
+    NLINK_ASSERT_NULL(suffix, "optional group that did not take part");
+    NLINK_ASSERT_TRUE(match.group_starts[3] == NLINK_REGEX_UNSET, "unset group position");
+    NLINK_ASSERT_EQUAL_STRING("a", lazy_text, "lazy quantifier");
+    NLINK_ASSERT_EQUAL_STRING("a><b", greedy_text, "greedy quantifier");
+
+    free(name);
+    free(minor);
+    free(lazy_text);
+    free(greedy_text);
+    nlink_regex_match_free(&match);
+    nlink_regex_match_free(&lazy_match);
+    nlink_regex_match_free(&greedy_match);
+    nlink_regex_free(version);
+    nlink_regex_free(lazy);
+    nlink_regex_free(greedy);
+}
+
+NLINK_TEST_CASE(regex_matcher, invalid_patterns) {
+    NLINK_ARRANGE_PHASE("Create malformed and unsupported patterns");
+    static const char* patterns[] = {
+        "(ab", "ab)", "[abc", "*a", "a{3,2}", "a{5000}", "\\", "\\bword", "(a)\\1", "[z-a]", "[[:nope:]]"
+    };
+    bool all_rejected = true;
+
+    NLINK_ACT_PHASE("Compile each pattern");
+    for (size_t i = 0; i < sizeof(patterns) / sizeof(patterns[0]); i++) {
+        nlink_regex* regex = nlink_regex_compile(patterns[i], nlink_regex_default_options());
+        if (regex) {
+            printf("  accepted: %s\n", patterns[i]);
+            all_rejected = false;
+            nlink_regex_free(regex);
+        }
+    }
+
+    NLINK_ASSERT_PHASE("Verify compilation fails");
+    NLINK_ASSERT_TRUE(all_rejected, "invalid patterns are rejected");
+    NLINK_ASSERT_NULL(nlink_regex_compile(NULL, nlink_regex_default_options()), "NULL pattern");
+}
+
+NLINK_TEST_CASE(regex_matcher, agrees_with_posix) {
+    NLINK_ARRANGE_PHASE("Generate random patterns and inputs");
+    nlink_regex_options table = nlink_regex_default_options();
+    nlink_regex_options lazy = nlink_regex_default_options();
+    lazy.max_dfa_memory = 512;   /* Too small for most tables, so the cache flushes */
+    table.dot_all = true;        /* POSIX '.' also matches newlines */
+    lazy.dot_all = true;
+    bool matches_agree = true;
+    bool starts_agree = true;
+    srand(3);
+
+    NLINK_ACT_PHASE("Compare with POSIX regexec");
+    for (int round = 0; round < 400; round++) {
+        char pattern[1024] = "";
+        random_pattern(pattern, 0);
+        if (rand() % 4 == 0) {
+            memmove(pattern + 1, pattern, strlen(pattern) + 1);
+            pattern[0] = '^';
+        }
+        if (rand() % 4 == 0) {
+            strcat(pattern, "$");
+        }
+
+        regex_t posix;
+        if (regcomp(&posix, pattern, REG_EXTENDED) != 0) continue;
+        nlink_regex* compiled[2] = { nlink_regex_compile(pattern, table), nlink_regex_compile(pattern, lazy) };
+
+        for (int t = 0; t < 30; t++) {
+            char text[32];
+            int length = rand() % 16;
+            for (int i = 0; i < length; i++) text[i] = "abcab\n"[rand() % 6];
+            text[length] = '\0';
+
+            regmatch_t expected;
+            bool posix_found = regexec(&posix, text, 1, &expected, 0) == 0;
+            for (int c = 0; c < 2; c++) {
+                nlink_regex_match_result match;
+                bool found = compiled[c] && nlink_regex_match(compiled[c], text, &match);
+                bool quick = compiled[c] && nlink_regex_match(compiled[c], text, NULL);
+                if (found != posix_found || quick != posix_found) {
+                    printf("  /%s/ on \"%s\": %d, posix %d\n", pattern, text, found, posix_found);
+                    matches_agree = false;
+                }
+                if (found && posix_found && (long)match.start != (long)expected.rm_so) {
+                    starts_agree = false;
+                }
+                if (found) nlink_regex_match_free(&match);
+            }
+        }
+
+        nlink_regex_free(compiled[0]);
+        nlink_regex_free(compiled[1]);
+        regfree(&posix);
+    }
+
+    nlink_regex* large = nlink_regex_compile("(a|b)*a(a|b){14}c", table);
+    bool large_found = nlink_regex_match(large, "bbba" "ababababababab" "c", NULL);
+    bool large_missed = nlink_regex_match(large, "bbba" "bbbbbbbbbbbbbbb" "c", NULL);
+
+    NLINK_ASSERT_PHASE("Verify results agree");
+    NLINK_ASSERT_TRUE(matches_agree, "match results agree with POSIX");
+    NLINK_ASSERT_TRUE(starts_agree, "leftmost match starts agree with POSIX");
+    NLINK_ASSERT_TRUE(large_found, "exponential DFA through the lazy cache");
+    NLINK_ASSERT_FALSE(large_missed, "exponential DFA rejects");
+
+    nlink_regex_free(large);
+}
+
+NLINK_TEST_REGISTER(regex_matcher, syntax_and_positions)
+NLINK_TEST_REGISTER(regex_matcher, options)
+NLINK_TEST_REGISTER(regex_matcher, capture_groups)
+NLINK_TEST_REGISTER(regex_matcher, invalid_patterns)
+NLINK_TEST_REGISTER(regex_matcher, agrees_with_posix)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_regex_matcher_syntax_and_positions();
+    nlink_run_test_regex_matcher_options();
+    nlink_run_test_regex_matcher_capture_groups();
+    nlink_run_test_regex_matcher_invalid_patterns();
+    nlink_run_test_regex_matcher_agrees_with_posix()
+)
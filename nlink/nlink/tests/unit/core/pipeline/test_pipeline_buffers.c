@@ -0,0 +1,105 @@
+/**
+ * @file test_pipeline_buffers.c
+ * @brief Unit tests for sized pipeline buffers and buffer pooling
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/pipeline/nlink_pipeline.h"
+
+static NexusContext* test_ctx = NULL;
+
+NLINK_TEST_SUITE_BEGIN(pipeline_buffers) {
+    test_ctx = nexus_create_context(NULL);
+    return test_ctx;
+}
+
+NLINK_TEST_SUITE_END(pipeline_buffers) {
+    nexus_destroy_context((NexusContext*)context);
+}
+
+/* Duplicate the input: output is twice as long as the input */
+static NexusResult duplicate_stage(const NexusBuffer* input, NexusBuffer* output, void* user_data) {
+    (void)user_data;
+    NexusResult result = nexus_buffer_reserve(output, input->size * 2);
+    if (result != NEXUS_SUCCESS) {
+        return result;
+    }
+    memcpy(output->data, input->data, input->size);
+    memcpy((char*)output->data + input->size, input->data, input->size);
+    output->size = input->size * 2;
+    return NEXUS_SUCCESS;
+}
+
+/* Drop the last byte until a single byte is left */
+static NexusResult trim_stage(const NexusBuffer* input, NexusBuffer* output, void* user_data) {
+    (void)user_data;
+    return nexus_buffer_assign(output, input->data, input->size > 1 ? input->size - 1 : input->size);
+}
+
+NLINK_TEST_CASE(pipeline_buffers, payload_larger_than_default) {
+    NLINK_ARRANGE_PHASE("Create a two-stage single-pass pipeline and a large payload");
+    NlinkPipelineConfig config = nlink_pipeline_default_config();
+    config.mode = NLINK_PIPELINE_MODE_SINGLE_PASS;
+    NlinkPipeline* pipeline = nlink_pipeline_create(test_ctx, &config);
+    nlink_pipeline_add_buffer_stage(pipeline, "duplicate", duplicate_stage, 0, NULL);
+    nlink_pipeline_add_buffer_stage(pipeline, "duplicate_again", duplicate_stage, 0, NULL);
+
+    size_t size = 64 * 1024;
+    char* payload = (char*)malloc(size);
+    for (size_t i = 0; i < size; i++) {
+        payload[i] = (char)('a' + i % 26);
+    }
+    NexusBuffer input = { payload, size, size };
+    NexusBuffer output = { NULL, 0, 0 };
+
+    NLINK_ACT_PHASE("Execute the pipeline repeatedly");
+    NexusResult result = NEXUS_SUCCESS;
+    for (int run = 0; run < 4 && result == NEXUS_SUCCESS; run++) {
+        result = nlink_pipeline_execute_buffer(pipeline, &input, &output);
+    }
+    size_t allocations = pipeline->pool.allocations;
+
+    NLINK_ASSERT_PHASE("Verify sizes, contents and buffer reuse");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "execution succeeds");
+    NLINK_ASSERT_TRUE(output.size == size * 4, "output is four times the input");
+    NLINK_ASSERT_TRUE(memcmp((char*)output.data + size * 3, payload, size) == 0, "last copy intact");
+    NLINK_ASSERT_TRUE(allocations <= 3, "later executions reuse pooled buffers");
+
+    nexus_buffer_free(&output);
+    free(payload);
+    nlink_pipeline_destroy(pipeline);
+}
+
+NLINK_TEST_CASE(pipeline_buffers, multi_pass_converges_on_size) {
+    NLINK_ARRANGE_PHASE("Create a multi-pass pipeline that shrinks its input");
+    NlinkPipelineConfig config = nlink_pipeline_default_config();
+    config.mode = NLINK_PIPELINE_MODE_MULTI_PASS;
+    config.max_iterations = 10;
+    NlinkPipeline* pipeline = nlink_pipeline_create(test_ctx, &config);
+    nlink_pipeline_add_buffer_stage(pipeline, "trim", trim_stage, 0, NULL);
+    NexusBuffer input = { "abcd", 4, 4 };
+    NexusBuffer output = { NULL, 0, 0 };
+
+    NLINK_ACT_PHASE("Execute until the output stops changing");
+    NexusResult result = nlink_pipeline_execute_buffer(pipeline, &input, &output);
+    unsigned iterations = 0;
+    nlink_pipeline_get_stats(pipeline, &iterations, NULL);
+
+    NLINK_ASSERT_PHASE("Verify the fixpoint");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "execution succeeds");
+    NLINK_ASSERT_TRUE(output.size == 1 && ((char*)output.data)[0] == 'a', "trimmed to one byte");
+    NLINK_ASSERT_EQUAL_INT(4, (int)iterations, "converges once trimming is a no-op");
+
+    nexus_buffer_free(&output);
+    nlink_pipeline_destroy(pipeline);
+}
+
+NLINK_TEST_REGISTER(pipeline_buffers, payload_larger_than_default)
+NLINK_TEST_REGISTER(pipeline_buffers, multi_pass_converges_on_size)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_pipeline_buffers_payload_larger_than_default();
+    nlink_run_test_pipeline_buffers_multi_pass_converges_on_size()
+)
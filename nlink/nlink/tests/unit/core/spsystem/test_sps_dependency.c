@@ -0,0 +1,326 @@
+/**
+ * @file test_sps_dependency.c
+ * @brief Unit tests for single-pass dependency resolution
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/spsystem/sps_dependency.h"
+#include "nlink/spsystem/sps_lifecycle.h"
+#include "nlink/spsystem/sps_pipeline.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static NexusContext* test_ctx = NULL;
+
+/* Stands in for a loaded library so initialization does not skip the component */
+static int loaded_marker;
+
+NLINK_TEST_SUITE_BEGIN(sps_dependency) {
+    test_ctx = nexus_create_context(NULL);
+    return test_ctx;
+}
+
+NLINK_TEST_SUITE_END(sps_dependency) {
+    nexus_destroy_context((NexusContext*)context);
+}
+
+/* Build a configuration; deps[i] is a comma-separated list or NULL */
+static NexusPipelineConfig* create_config(const char** ids, const char** deps, size_t count) {
+    NexusPipelineConfig* config = (NexusPipelineConfig*)calloc(1, sizeof(NexusPipelineConfig));
+    config->pipeline_id = "test";
+    config->input_format = "binary";
+    config->output_format = "binary";
+    config->components = (NexusPipelineComponentConfig**)calloc(count, sizeof(NexusPipelineComponentConfig*));
+    config->component_count = count;
+    for (size_t i = 0; i < count; i++) {
+        NexusPipelineComponentConfig* component = (NexusPipelineComponentConfig*)calloc(1, sizeof(NexusPipelineComponentConfig));
+        component->component_id = ids[i];
+        if (deps && deps[i]) {
+            char* list = strdup(deps[i]);
+            component->dependencies = (const char**)calloc(strlen(list) + 1, sizeof(char*));
+            for (char* name = strtok(list, ","); name; name = strtok(NULL, ",")) {
+                component->dependencies[component->dependency_count++] = strdup(name);
+            }
+            free(list);
+        }
+        config->components[i] = component;
+    }
+    return config;
+}
+
+static void free_config(NexusPipelineConfig* config) {
+    for (size_t i = 0; i < config->component_count; i++) {
+        for (size_t j = 0; j < config->components[i]->dependency_count; j++) {
+            free((void*)config->components[i]->dependencies[j]);
+        }
+        free((void*)config->components[i]->dependencies);
+        free(config->components[i]);
+    }
+    free(config->components);
+    free(config);
+}
+
+static size_t position_of(const char** order, size_t count, const char* id) {
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(order[i], id) == 0) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+/* Event sequence numbers recorded by the lifecycle hooks of one component */
+typedef struct {
+    size_t init_start;
+    size_t init_end;
+    size_t term;
+} LifecycleTrace;
+
+static atomic_size_t lifecycle_clock;
+
+static NexusResult trace_init(NexusPipelineComponent* component, void* user_data) {
+    (void)component;
+    LifecycleTrace* trace = (LifecycleTrace*)user_data;
+    trace->init_start = atomic_fetch_add(&lifecycle_clock, 1);
+    struct timespec pause = { 0, 2000000 };
+    nanosleep(&pause, NULL);
+    trace->init_end = atomic_fetch_add(&lifecycle_clock, 1);
+    return NEXUS_SUCCESS;
+}
+
+static NexusResult trace_term(NexusPipelineComponent* component, void* user_data) {
+    (void)component;
+    LifecycleTrace* trace = (LifecycleTrace*)user_data;
+    trace->term = atomic_fetch_add(&lifecycle_clock, 1);
+    return NEXUS_SUCCESS;
+}
+
+NLINK_TEST_CASE(sps_dependency, declared_order) {
+    NLINK_ARRANGE_PHASE("Create a diamond declared out of order");
+    const char* ids[] = {"sink", "left", "right", "source"};
+    const char* deps[] = {"left,right", "source", "source", NULL};
+    NexusPipelineConfig* config = create_config(ids, deps, 4);
+    NexusDependencyGraph* graph = sps_create_dependency_graph(test_ctx, config);
+
+    NLINK_ACT_PHASE("Resolve the loading order");
+    const char** order = NULL;
+    size_t count = 0;
+    NexusResult result = sps_resolve_dependencies(test_ctx, graph, &order, &count);
+
+    NLINK_ASSERT_PHASE("Verify dependencies precede dependents");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "diamond resolves");
+    NLINK_ASSERT_EQUAL_INT(4, (int)count, "every component is ordered");
+    NLINK_ASSERT_EQUAL_STRING("source", order[0], "source comes first");
+    NLINK_ASSERT_EQUAL_STRING("left", order[1], "left follows in configuration order");
+    NLINK_ASSERT_EQUAL_STRING("right", order[2], "right follows left");
+    NLINK_ASSERT_EQUAL_STRING("sink", order[3], "sink comes last");
+    NLINK_ASSERT_EQUAL_INT(3, (int)sps_find_dependency_node(graph, "source"), "source is interned");
+    NLINK_ASSERT_TRUE(sps_find_dependency_node(graph, "absent") == SIZE_MAX, "unknown id is not found");
+
+    free(order);
+    sps_free_dependency_graph(graph);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_dependency, implicit_chain) {
+    NLINK_ARRANGE_PHASE("Create components without declared dependencies");
+    const char* ids[] = {"a", "b", "c"};
+    NexusPipelineConfig* config = create_config(ids, NULL, 3);
+    NexusDependencyGraph* graph = sps_create_dependency_graph(test_ctx, config);
+
+    NLINK_ACT_PHASE("Resolve the loading order");
+    const char** order = NULL;
+    size_t count = 0;
+    NexusResult result = sps_resolve_dependencies(test_ctx, graph, &order, &count);
+
+    NLINK_ASSERT_PHASE("Verify each component depends on the previous one");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "chain resolves");
+    NLINK_ASSERT_EQUAL_INT(1, (int)graph->nodes[2]->dependency_count, "c has one dependency");
+    NLINK_ASSERT_EQUAL_STRING("b", graph->nodes[2]->dependencies[0], "c depends on b");
+    NLINK_ASSERT_EQUAL_STRING("a", order[0], "a first");
+    NLINK_ASSERT_EQUAL_STRING("c", order[2], "c last");
+
+    free(order);
+    sps_free_dependency_graph(graph);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_dependency, cycle_rejected) {
+    NLINK_ARRANGE_PHASE("Create a loop behind an acyclic prefix");
+    const char* ids[] = {"root", "a", "b", "c", "leaf"};
+    const char* deps[] = {NULL, "root,c", "a", "b", "c"};
+    NexusPipelineConfig* config = create_config(ids, deps, 5);
+    NexusDependencyGraph* graph = sps_create_dependency_graph(test_ctx, config);
+
+    NLINK_ACT_PHASE("Resolve the loading order");
+    const char** order = NULL;
+    size_t count = 0;
+    NexusResult result = sps_resolve_dependencies(test_ctx, graph, &order, &count);
+
+    NLINK_ASSERT_PHASE("Verify the cycle is rejected");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_DEPENDENCY_ERROR, result, "cycle is an error");
+    NLINK_ASSERT_NULL(order, "no order is returned");
+    NLINK_ASSERT_EQUAL_INT(0, (int)count, "count stays zero");
+
+    sps_free_dependency_graph(graph);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_dependency, self_dependency) {
+    NLINK_ARRANGE_PHASE("Create a component that depends on itself");
+    const char* ids[] = {"a", "b"};
+    const char* deps[] = {NULL, "b"};
+    NexusPipelineConfig* config = create_config(ids, deps, 2);
+    NexusDependencyGraph* graph = sps_create_dependency_graph(test_ctx, config);
+
+    NLINK_ACT_PHASE("Resolve the loading order");
+    const char** order = NULL;
+    size_t count = 0;
+    NexusResult result = sps_resolve_dependencies(test_ctx, graph, &order, &count);
+
+    NLINK_ASSERT_PHASE("Verify the self-loop is rejected");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_DEPENDENCY_ERROR, result, "self-loop is an error");
+
+    sps_free_dependency_graph(graph);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_dependency, missing_dependencies) {
+    NLINK_ARRANGE_PHASE("Create components naming absent dependencies");
+    const char* ids[] = {"a", "b"};
+    const char* deps[] = {"ghost", "a,phantom"};
+    NexusPipelineConfig* config = create_config(ids, deps, 2);
+    config->components[1]->optional = true;
+    NexusDependencyGraph* graph = sps_create_dependency_graph(test_ctx, config);
+
+    NLINK_ACT_PHASE("Report missing dependencies and resolve");
+    NexusMissingDependency* missing = NULL;
+    size_t missing_count = 0;
+    NexusResult check = sps_check_missing_dependencies(test_ctx, graph, &missing, &missing_count);
+    const char** order = NULL;
+    size_t count = 0;
+    NexusResult result = sps_resolve_dependencies(test_ctx, graph, &order, &count);
+
+    NLINK_ASSERT_PHASE("Verify both absent names are reported");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, check, "check succeeds");
+    NLINK_ASSERT_EQUAL_INT(2, (int)missing_count, "two missing dependencies");
+    NLINK_ASSERT_EQUAL_STRING("ghost", missing[0].missing_dependency, "a misses ghost");
+    NLINK_ASSERT_FALSE(missing[0].is_optional, "a is required");
+    NLINK_ASSERT_EQUAL_STRING("b", missing[1].component_id, "b reports the second");
+    NLINK_ASSERT_EQUAL_STRING("phantom", missing[1].missing_dependency, "b misses phantom");
+    NLINK_ASSERT_TRUE(missing[1].is_optional, "b is optional");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "present edges still order");
+    NLINK_ASSERT_TRUE(position_of(order, count, "a") < position_of(order, count, "b"), "a before b");
+
+    free(missing);
+    free(order);
+    sps_free_dependency_graph(graph);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_dependency, long_chain) {
+    NLINK_ARRANGE_PHASE("Create a chain deeper than a recursive walk could follow");
+    size_t n = 200000;
+    const char** ids = (const char**)calloc(n, sizeof(char*));
+    char* names = (char*)calloc(n, 16);
+    for (size_t i = 0; i < n; i++) {
+        snprintf(names + i * 16, 16, "c%zu", i);
+        ids[i] = names + i * 16;
+    }
+    NexusPipelineConfig* config = create_config(ids, NULL, n);
+    NexusDependencyGraph* graph = sps_create_dependency_graph(test_ctx, config);
+
+    NLINK_ACT_PHASE("Resolve the chain");
+    const char** order = NULL;
+    size_t count = 0;
+    NexusResult result = sps_resolve_dependencies(test_ctx, graph, &order, &count);
+
+    NLINK_ASSERT_PHASE("Verify the whole chain is ordered");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "chain resolves");
+    NLINK_ASSERT_EQUAL_INT((int)n, (int)count, "every component is ordered");
+    NLINK_ASSERT_EQUAL_STRING("c199999", order[n - 1], "last link last");
+
+    free(order);
+    sps_free_dependency_graph(graph);
+    free_config(config);
+    free(names);
+    free(ids);
+}
+
+NLINK_TEST_CASE(sps_dependency, pipeline_levels) {
+    NLINK_ARRANGE_PHASE("Create a pipeline whose middle components are independent");
+    const char* ids[] = {"sink", "source", "left", "right", "report"};
+    const char* deps[] = {"left,right", NULL, "source", "source", "sink"};
+    NexusPipelineConfig* config = create_config(ids, deps, 5);
+
+    config->init_threads = 4;
+    LifecycleTrace traces[5] = {{0}};
+    atomic_store(&lifecycle_clock, 0);
+
+    NLINK_ACT_PHASE("Create, initialize and destroy the pipeline");
+    NexusPipeline* pipeline = sps_pipeline_create(test_ctx, config);
+    NLINK_ASSERT_NOT_NULL(pipeline, "pipeline is created");
+    for (size_t i = 0; i < 5; i++) {
+        NexusPipelineComponent* component = sps_pipeline_get_component(pipeline, ids[i]);
+        NexusComponentLifecycle lifecycle = { trace_init, trace_term, NULL, &traces[i], NULL };
+        component->component = (NexusComponent*)&loaded_marker;
+        sps_register_component_lifecycle(test_ctx, component, &lifecycle);
+    }
+    size_t levels[5];
+    for (size_t i = 0; i < 5; i++) {
+        levels[i] = sps_pipeline_get_component(pipeline, ids[i])->init_level;
+    }
+    NexusResult result = sps_pipeline_initialize(test_ctx, pipeline);
+    NexusPipelineStats stats;
+    sps_pipeline_get_stats(pipeline, &stats);
+    double left_time = sps_pipeline_get_component(pipeline, "left")->init_time_ms;
+    for (size_t i = 0; i < pipeline->component_count; i++) {
+        pipeline->components[i]->component = NULL;
+    }
+    sps_pipeline_destroy(test_ctx, pipeline);
+
+    NLINK_ASSERT_PHASE("Verify levels initialize in order and terminate in reverse");
+    NLINK_ASSERT_EQUAL_INT(0, (int)levels[1], "source has no dependencies");
+    NLINK_ASSERT_EQUAL_INT(1, (int)levels[2], "left shares level one");
+    NLINK_ASSERT_EQUAL_INT(1, (int)levels[3], "right shares level one");
+    NLINK_ASSERT_EQUAL_INT(2, (int)levels[0], "sink waits for both branches");
+    NLINK_ASSERT_EQUAL_INT(3, (int)levels[4], "report follows sink");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "initialization succeeds");
+    for (size_t a = 0; a < 5; a++) {
+        for (size_t b = 0; b < 5; b++) {
+            if (levels[a] < levels[b]) {
+                NLINK_ASSERT_TRUE(traces[a].init_end < traces[b].init_start, "a level finishes before the next starts");
+                NLINK_ASSERT_TRUE(traces[b].term < traces[a].term, "higher levels terminate first");
+            }
+        }
+    }
+    NLINK_ASSERT_EQUAL_INT(4, (int)stats.init_levels, "four levels are initialized");
+    NLINK_ASSERT_TRUE(left_time >= 1.0, "component init time covers its hook");
+    NLINK_ASSERT_TRUE(stats.init_time_ms >= 4 * 1.0, "wall time covers every level");
+
+    free_config(config);
+}
+
+NLINK_TEST_REGISTER(sps_dependency, declared_order)
+NLINK_TEST_REGISTER(sps_dependency, implicit_chain)
+NLINK_TEST_REGISTER(sps_dependency, cycle_rejected)
+NLINK_TEST_REGISTER(sps_dependency, self_dependency)
+NLINK_TEST_REGISTER(sps_dependency, missing_dependencies)
+NLINK_TEST_REGISTER(sps_dependency, long_chain)
+NLINK_TEST_REGISTER(sps_dependency, pipeline_levels)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_sps_dependency_declared_order();
+    nlink_run_test_sps_dependency_implicit_chain();
+    nlink_run_test_sps_dependency_cycle_rejected();
+    nlink_run_test_sps_dependency_self_dependency();
+    nlink_run_test_sps_dependency_missing_dependencies();
+    nlink_run_test_sps_dependency_long_chain();
+    nlink_run_test_sps_dependency_pipeline_levels()
+)
@@ -0,0 +1,395 @@
+/**
+ * @file test_sps_executor.c
+ * @brief Unit tests for the thread-per-stage pipeline executor
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/spsystem/sps_executor.h"
+#include "nlink/spsystem/sps_lifecycle.h"
+#include "nlink/spsystem/sps_pipeline.h"
+#include "nlink/spsystem/sps_stream.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static NexusContext* test_ctx = NULL;
+
+/* Stands in for a loaded library so execution does not skip the component */
+static int loaded_marker;
+
+NLINK_TEST_SUITE_BEGIN(sps_executor) {
+    test_ctx = nexus_create_context(NULL);
+    return test_ctx;
+}
+
+NLINK_TEST_SUITE_END(sps_executor) {
+    nexus_destroy_context((NexusContext*)context);
+}
+
+/* Build a configuration; components without dependencies form a chain */
+static NexusPipelineConfig* create_config(const char** ids, size_t count) {
+    NexusPipelineConfig* config = (NexusPipelineConfig*)calloc(1, sizeof(NexusPipelineConfig));
+    config->pipeline_id = "test";
+    config->input_format = "binary";
+    config->output_format = "binary";
+    config->components = (NexusPipelineComponentConfig**)calloc(count, sizeof(NexusPipelineComponentConfig*));
+    config->component_count = count;
+    for (size_t i = 0; i < count; i++) {
+        config->components[i] = (NexusPipelineComponentConfig*)calloc(1, sizeof(NexusPipelineComponentConfig));
+        config->components[i]->component_id = ids[i];
+    }
+    return config;
+}
+
+static void free_config(NexusPipelineConfig* config) {
+    for (size_t i = 0; i < config->component_count; i++) {
+        free(config->components[i]);
+    }
+    free(config->components);
+    free(config);
+}
+
+/* Mark the component at an execution position loaded and initialized with the given process function */
+static NexusPipelineComponent* bind_component(NexusPipeline* pipeline, size_t position, NexusProcessFunc func) {
+    NexusPipelineComponent* component = pipeline->components[position];
+    component->component = (NexusComponent*)&loaded_marker;
+    component->process_func = func;
+    component->is_initialized = true;
+    pipeline->is_initialized = true;
+    return component;
+}
+
+/* Drop the stand-in libraries so destroy has nothing to unload */
+static void destroy_pipeline(NexusPipeline* pipeline) {
+    for (size_t i = 0; i < pipeline->component_count; i++) {
+        pipeline->components[i]->component = NULL;
+    }
+    sps_pipeline_destroy(test_ctx, pipeline);
+}
+
+static NexusResult copy_input(NexusPipelineComponent* component, NexusDataStream* input,
+                              NexusDataStream* output) {
+    (void)component;
+    return input->size > 0 ? sps_stream_write(output, input->data, input->size) : NEXUS_SUCCESS;
+}
+
+static NexusResult repeat_data(const uint8_t* data, size_t size, NexusDataStream* output) {
+    for (size_t i = 0; i < size; i++) {
+        uint8_t pair[2] = { data[i], data[i] };
+        NexusResult result = sps_stream_write(output, pair, sizeof(pair));
+        if (result != NEXUS_SUCCESS) {
+            return result;
+        }
+    }
+    return NEXUS_SUCCESS;
+}
+
+/* Write every input byte twice */
+static NexusResult repeat_bytes(NexusPipelineComponent* component, NexusDataStream* input,
+                                NexusDataStream* output) {
+    (void)component;
+    return repeat_data((const uint8_t*)input->data, input->size, output);
+}
+
+/* Write the input in reverse; needs the whole stream at once */
+static NexusResult reverse_bytes(NexusPipelineComponent* component, NexusDataStream* input,
+                                 NexusDataStream* output) {
+    (void)component;
+    const uint8_t* data = (const uint8_t*)input->data;
+    for (size_t i = input->size; i > 0; i--) {
+        NexusResult result = sps_stream_write(output, &data[i - 1], 1);
+        if (result != NEXUS_SUCCESS) {
+            return result;
+        }
+    }
+    return NEXUS_SUCCESS;
+}
+
+/* Per-hook counters; hooks run on the stage threads */
+typedef struct {
+    atomic_size_t calls;
+    size_t largest;              /* Largest chunk seen */
+    size_t fail_at;              /* Call that fails, 0 for none */
+    unsigned delay_us;           /* Time spent per chunk */
+    atomic_size_t* upstream;     /* Calls of the producing stage, NULL if unused */
+    size_t max_ahead;            /* Most upstream calls ahead of this stage */
+} HookState;
+
+static void sleep_us(unsigned us) {
+    struct timespec pause = { 0, (long)us * 1000 };
+    nanosleep(&pause, NULL);
+}
+
+static NexusResult record_call(HookState* state, size_t size) {
+    size_t call = atomic_fetch_add(&state->calls, 1) + 1;
+    if (size > state->largest) {
+        state->largest = size;
+    }
+    if (state->upstream) {
+        size_t ahead = atomic_load(state->upstream) - call;
+        if (ahead > state->max_ahead) {
+            state->max_ahead = ahead;
+        }
+    }
+    if (state->delay_us > 0) {
+        sleep_us(state->delay_us);
+    }
+    return call == state->fail_at ? NEXUS_IO_ERROR : NEXUS_SUCCESS;
+}
+
+static NexusResult copy_chunk(NexusPipelineComponent* component, const void* chunk, size_t size,
+                              bool final, NexusDataStream* output, void* user_data) {
+    (void)component;
+    (void)final;
+    NexusResult result = record_call((HookState*)user_data, size);
+    if (result != NEXUS_SUCCESS) {
+        return result;
+    }
+    return size > 0 ? sps_stream_write(output, chunk, size) : NEXUS_SUCCESS;
+}
+
+static NexusResult repeat_chunk(NexusPipelineComponent* component, const void* chunk, size_t size,
+                                bool final, NexusDataStream* output, void* user_data) {
+    (void)component;
+    (void)final;
+    NexusResult result = record_call((HookState*)user_data, size);
+    if (result != NEXUS_SUCCESS) {
+        return result;
+    }
+    return repeat_data((const uint8_t*)chunk, size, output);
+}
+
+static void register_chunk_hook(NexusPipelineComponent* component, NexusComponentChunkFunc func, HookState* state) {
+    NexusComponentLifecycle lifecycle = {0};
+    lifecycle.chunk_func = func;
+    lifecycle.user_data = state;
+    sps_register_component_lifecycle(test_ctx, component, &lifecycle);
+}
+
+static NexusDataStream* create_input(size_t size) {
+    uint8_t* data = (uint8_t*)malloc(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = (uint8_t)(i * 7 + 3);
+    }
+    NexusDataStream* input = sps_stream_create_from_data(data, size, "binary");
+    free(data);
+    return input;
+}
+
+static bool same_bytes(const NexusDataStream* a, const NexusDataStream* b) {
+    return a->size == b->size && memcmp(a->data, b->data, a->size) == 0;
+}
+
+NLINK_TEST_CASE(sps_executor, matches_sequential_with_hooks) {
+    NLINK_ARRANGE_PHASE("Create a doubling chain whose components all take chunks");
+    const char* ids[] = {"read", "repeat", "write"};
+    NexusPipelineConfig* config = create_config(ids, 3);
+    NexusPipeline* pipeline = sps_pipeline_create(test_ctx, config);
+    NLINK_ASSERT_NOT_NULL(pipeline, "pipeline is created");
+    HookState read = {0}, repeat = {0}, write = {0};
+    register_chunk_hook(bind_component(pipeline, 0, copy_input), copy_chunk, &read);
+    register_chunk_hook(bind_component(pipeline, 1, repeat_bytes), repeat_chunk, &repeat);
+    register_chunk_hook(bind_component(pipeline, 2, copy_input), copy_chunk, &write);
+    NexusDataStream* input = create_input(100003);
+    NexusDataStream* expected = sps_stream_create(16);
+    NexusDataStream* output = sps_stream_create(16);
+    sps_pipeline_execute(test_ctx, pipeline, input, expected);
+
+    NLINK_ACT_PHASE("Run the stages on their own threads in 1000 byte chunks");
+    NexusResult result = sps_pipeline_execute_threaded(test_ctx, pipeline, input, output, 1000, 2);
+    NexusPipelineStats stats;
+    sps_pipeline_get_stats(pipeline, &stats);
+
+    NLINK_ASSERT_PHASE("Verify the output matches sequential execution byte for byte");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "threaded execution succeeds");
+    NLINK_ASSERT_TRUE(same_bytes(expected, output), "outputs are identical");
+    NLINK_ASSERT_EQUAL_INT(101, (int)stats.chunks, "input is cut into 101 chunks");
+    NLINK_ASSERT_EQUAL_INT(102, (int)atomic_load(&read.calls), "read sees every chunk and the final call");
+    NLINK_ASSERT_EQUAL_INT(202, (int)atomic_load(&write.calls), "doubled chunks reach write in two slices");
+    NLINK_ASSERT_EQUAL_INT(1000, (int)write.largest, "no slice exceeds the chunk size");
+
+    sps_stream_destroy(output);
+    sps_stream_destroy(expected);
+    sps_stream_destroy(input);
+    destroy_pipeline(pipeline);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_executor, matches_sequential_without_hooks) {
+    NLINK_ARRANGE_PHASE("Create a chain of components that only process whole streams");
+    const char* ids[] = {"reverse", "repeat", "write"};
+    NexusPipelineConfig* config = create_config(ids, 3);
+    NexusPipeline* pipeline = sps_pipeline_create(test_ctx, config);
+    NLINK_ASSERT_NOT_NULL(pipeline, "pipeline is created");
+    bind_component(pipeline, 0, reverse_bytes);
+    bind_component(pipeline, 1, repeat_bytes);
+    bind_component(pipeline, 2, copy_input);
+    NexusDataStream* input = create_input(100003);
+    NexusDataStream* expected = sps_stream_create(16);
+    NexusDataStream* output = sps_stream_create(16);
+    sps_pipeline_execute(test_ctx, pipeline, input, expected);
+
+    NLINK_ACT_PHASE("Run the stages on their own threads in 1000 byte chunks");
+    NexusResult result = sps_pipeline_execute_threaded(test_ctx, pipeline, input, output, 1000, 2);
+
+    NLINK_ASSERT_PHASE("Verify the gathered result matches sequential execution");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "threaded execution succeeds");
+    NLINK_ASSERT_TRUE(same_bytes(expected, output), "outputs are identical");
+    NLINK_ASSERT_NULL(sps_pipeline_get_component(pipeline, "repeat")->chunk_buffer, "gathered input is released");
+
+    sps_stream_destroy(output);
+    sps_stream_destroy(expected);
+    sps_stream_destroy(input);
+    destroy_pipeline(pipeline);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_executor, gathered_output_is_resliced) {
+    NLINK_ARRANGE_PHASE("Feed a streaming stage from a component that gathers its input");
+    const char* ids[] = {"reverse", "repeat", "write"};
+    NexusPipelineConfig* config = create_config(ids, 3);
+    NexusPipeline* pipeline = sps_pipeline_create(test_ctx, config);
+    NLINK_ASSERT_NOT_NULL(pipeline, "pipeline is created");
+    HookState streamed = {0}, threaded = {0}, write = {0};
+    bind_component(pipeline, 0, reverse_bytes);
+    NexusPipelineComponent* repeat = bind_component(pipeline, 1, repeat_bytes);
+    register_chunk_hook(bind_component(pipeline, 2, copy_input), copy_chunk, &write);
+    NexusDataStream* input = create_input(10000);
+    NexusDataStream* expected = sps_stream_create(16);
+    NexusDataStream* output = sps_stream_create(16);
+    register_chunk_hook(repeat, repeat_chunk, &streamed);
+    sps_pipeline_execute_streaming(test_ctx, pipeline, input, expected, 100);
+    input->position = 0;
+    register_chunk_hook(repeat, repeat_chunk, &threaded);
+
+    NLINK_ACT_PHASE("Run the same pipeline threaded with the same chunk size");
+    NexusResult result = sps_pipeline_execute_threaded(test_ctx, pipeline, input, output, 100, 2);
+
+    NLINK_ASSERT_PHASE("Verify the downstream stage runs once per slice as in streaming");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "threaded execution succeeds");
+    NLINK_ASSERT_TRUE(same_bytes(expected, output), "outputs are identical");
+    NLINK_ASSERT_EQUAL_INT(101, (int)atomic_load(&streamed.calls), "streaming slices the gathered output");
+    NLINK_ASSERT_EQUAL_INT((int)atomic_load(&streamed.calls), (int)atomic_load(&threaded.calls),
+                           "threaded execution slices it the same way");
+    NLINK_ASSERT_EQUAL_INT(100, (int)threaded.largest, "no slice exceeds the chunk size");
+
+    sps_stream_destroy(output);
+    sps_stream_destroy(expected);
+    sps_stream_destroy(input);
+    destroy_pipeline(pipeline);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_executor, error_aborts) {
+    NLINK_ARRANGE_PHASE("Create a chain whose middle stage fails on its fifth chunk");
+    const char* ids[] = {"read", "fail", "write"};
+    NexusPipelineConfig* config = create_config(ids, 3);
+    NexusPipeline* pipeline = sps_pipeline_create(test_ctx, config);
+    NLINK_ASSERT_NOT_NULL(pipeline, "pipeline is created");
+    HookState read = {0}, fail = {0}, write = {0};
+    fail.fail_at = 5;
+    register_chunk_hook(bind_component(pipeline, 0, copy_input), copy_chunk, &read);
+    register_chunk_hook(bind_component(pipeline, 1, copy_input), copy_chunk, &fail);
+    register_chunk_hook(bind_component(pipeline, 2, copy_input), copy_chunk, &write);
+    NexusDataStream* input = create_input(100000);
+    NexusDataStream* output = sps_stream_create(16);
+
+    NLINK_ACT_PHASE("Run the stages on their own threads");
+    NexusResult result = sps_pipeline_execute_threaded(test_ctx, pipeline, input, output, 100, 2);
+
+    NLINK_ASSERT_PHASE("Verify the run stops early and reports the failure");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_IO_ERROR, result, "failure is returned");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_IO_ERROR, sps_pipeline_get_component(pipeline, "fail")->last_result,
+                           "failing component records its result");
+    NLINK_ASSERT_EQUAL_INT(5, (int)atomic_load(&fail.calls), "failing stage stops at once");
+    NLINK_ASSERT_EQUAL_INT(400, (int)output->size, "only the chunks before the failure arrive");
+    NLINK_ASSERT_TRUE(atomic_load(&read.calls) < 1000, "upstream stops before the end of the input");
+    NLINK_ASSERT_TRUE(memcmp(input->data, output->data, output->size) == 0, "delivered bytes are in order");
+
+    sps_stream_destroy(output);
+    sps_stream_destroy(input);
+    destroy_pipeline(pipeline);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_executor, error_with_partial_processing) {
+    NLINK_ARRANGE_PHASE("Allow partial processing around a stage that fails once");
+    const char* ids[] = {"read", "fail", "write"};
+    NexusPipelineConfig* config = create_config(ids, 3);
+    config->allow_partial_processing = true;
+    NexusPipeline* pipeline = sps_pipeline_create(test_ctx, config);
+    NLINK_ASSERT_NOT_NULL(pipeline, "pipeline is created");
+    HookState read = {0}, fail = {0}, write = {0};
+    fail.fail_at = 5;
+    register_chunk_hook(bind_component(pipeline, 0, copy_input), copy_chunk, &read);
+    register_chunk_hook(bind_component(pipeline, 1, copy_input), copy_chunk, &fail);
+    register_chunk_hook(bind_component(pipeline, 2, copy_input), copy_chunk, &write);
+    NexusDataStream* input = create_input(1000);
+    NexusDataStream* output = sps_stream_create(16);
+
+    NLINK_ACT_PHASE("Run the stages on their own threads");
+    NexusResult result = sps_pipeline_execute_threaded(test_ctx, pipeline, input, output, 100, 2);
+
+    NLINK_ASSERT_PHASE("Verify every other chunk still arrives");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_IO_ERROR, result, "failure is still returned");
+    NLINK_ASSERT_EQUAL_INT(11, (int)atomic_load(&fail.calls), "failing stage sees every chunk");
+    NLINK_ASSERT_EQUAL_INT(900, (int)output->size, "only the failed chunk is missing");
+    NLINK_ASSERT_TRUE(memcmp(input->data, output->data, 400) == 0, "chunks before the failure arrive");
+    NLINK_ASSERT_TRUE(memcmp((const uint8_t*)input->data + 500, (const uint8_t*)output->data + 400, 500) == 0,
+                      "chunks after the failure arrive");
+
+    sps_stream_destroy(output);
+    sps_stream_destroy(input);
+    destroy_pipeline(pipeline);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_executor, backpressure) {
+    NLINK_ARRANGE_PHASE("Put a slow stage behind a fast one");
+    const char* ids[] = {"read", "slow"};
+    NexusPipelineConfig* config = create_config(ids, 2);
+    NexusPipeline* pipeline = sps_pipeline_create(test_ctx, config);
+    NLINK_ASSERT_NOT_NULL(pipeline, "pipeline is created");
+    HookState read = {0}, slow = {0};
+    slow.delay_us = 500;
+    slow.upstream = &read.calls;
+    NexusPipelineComponent* producer = bind_component(pipeline, 0, copy_input);
+    register_chunk_hook(producer, copy_chunk, &read);
+    register_chunk_hook(bind_component(pipeline, 1, copy_input), copy_chunk, &slow);
+    NexusDataStream* input = create_input(6400);
+    NexusDataStream* output = sps_stream_create(16);
+
+    NLINK_ACT_PHASE("Run 64 chunks with two buffers per link");
+    NexusResult result = sps_pipeline_execute_threaded(test_ctx, pipeline, input, output, 100, 2);
+
+    NLINK_ASSERT_PHASE("Verify the fast stage waits instead of running ahead");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "threaded execution succeeds");
+    NLINK_ASSERT_TRUE(same_bytes(input, output), "output is the input");
+    NLINK_ASSERT_TRUE(producer->backpressure_time_ms > 0, "producer records time blocked on the slow stage");
+    NLINK_ASSERT_TRUE(slow.max_ahead <= 3, "producer stays within the queue depth of the slow stage");
+
+    sps_stream_destroy(output);
+    sps_stream_destroy(input);
+    destroy_pipeline(pipeline);
+    free_config(config);
+}
+
+NLINK_TEST_REGISTER(sps_executor, matches_sequential_with_hooks)
+NLINK_TEST_REGISTER(sps_executor, matches_sequential_without_hooks)
+NLINK_TEST_REGISTER(sps_executor, gathered_output_is_resliced)
+NLINK_TEST_REGISTER(sps_executor, error_aborts)
+NLINK_TEST_REGISTER(sps_executor, error_with_partial_processing)
+NLINK_TEST_REGISTER(sps_executor, backpressure)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_sps_executor_matches_sequential_with_hooks();
+    nlink_run_test_sps_executor_matches_sequential_without_hooks();
+    nlink_run_test_sps_executor_gathered_output_is_resliced();
+    nlink_run_test_sps_executor_error_aborts();
+    nlink_run_test_sps_executor_error_with_partial_processing();
+    nlink_run_test_sps_executor_backpressure()
+)
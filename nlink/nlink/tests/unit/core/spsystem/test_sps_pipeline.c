@@ -0,0 +1,392 @@
+/**
+ * @file test_sps_pipeline.c
+ * @brief Unit tests for single-pass pipeline execution
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/spsystem/sps_pipeline.h"
+#include "nlink/spsystem/sps_lifecycle.h"
+#include "nlink/spsystem/sps_stream.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+static NexusContext* test_ctx = NULL;
+
+/* Stands in for a loaded library so execution does not skip the component */
+static int loaded_marker;
+
+NLINK_TEST_SUITE_BEGIN(sps_pipeline) {
+    test_ctx = nexus_create_context(NULL);
+    return test_ctx;
+}
+
+NLINK_TEST_SUITE_END(sps_pipeline) {
+    nexus_destroy_context((NexusContext*)context);
+}
+
+/* Build a configuration; components without dependencies form a chain */
+static NexusPipelineConfig* create_config(const char** ids, size_t count) {
+    NexusPipelineConfig* config = (NexusPipelineConfig*)calloc(1, sizeof(NexusPipelineConfig));
+    config->pipeline_id = "test";
+    config->input_format = "binary";
+    config->output_format = "binary";
+    config->components = (NexusPipelineComponentConfig**)calloc(count, sizeof(NexusPipelineComponentConfig*));
+    config->component_count = count;
+    for (size_t i = 0; i < count; i++) {
+        config->components[i] = (NexusPipelineComponentConfig*)calloc(1, sizeof(NexusPipelineComponentConfig));
+        config->components[i]->component_id = ids[i];
+    }
+    return config;
+}
+
+static void free_config(NexusPipelineConfig* config) {
+    for (size_t i = 0; i < config->component_count; i++) {
+        free(config->components[i]);
+    }
+    free(config->components);
+    free(config);
+}
+
+/* Mark the component at an execution position loaded and initialized with the given process function */
+static NexusPipelineComponent* bind_component(NexusPipeline* pipeline, size_t position, NexusProcessFunc func) {
+    NexusPipelineComponent* component = pipeline->components[position];
+    component->component = (NexusComponent*)&loaded_marker;
+    component->process_func = func;
+    component->is_initialized = true;
+    pipeline->is_initialized = true;
+    return component;
+}
+
+/* Drop the stand-in libraries so destroy has nothing to unload */
+static void destroy_pipeline(NexusPipeline* pipeline) {
+    for (size_t i = 0; i < pipeline->component_count; i++) {
+        pipeline->components[i]->component = NULL;
+    }
+    sps_pipeline_destroy(test_ctx, pipeline);
+}
+
+static NexusResult copy_input(NexusPipelineComponent* component, NexusDataStream* input,
+                              NexusDataStream* output) {
+    (void)component;
+    return input->size > 0 ? sps_stream_write(output, input->data, input->size) : NEXUS_SUCCESS;
+}
+
+/* Write every input byte twice */
+static NexusResult repeat_bytes(NexusPipelineComponent* component, NexusDataStream* input,
+                                NexusDataStream* output) {
+    (void)component;
+    const uint8_t* data = (const uint8_t*)input->data;
+    for (size_t i = 0; i < input->size; i++) {
+        uint8_t pair[2] = { data[i], data[i] };
+        NexusResult result = sps_stream_write(output, pair, sizeof(pair));
+        if (result != NEXUS_SUCCESS) {
+            return result;
+        }
+    }
+    return NEXUS_SUCCESS;
+}
+
+/* Write the input in reverse; needs the whole stream at once */
+static size_t reverse_calls;
+static size_t reverse_input_size;
+
+static NexusResult reverse_bytes(NexusPipelineComponent* component, NexusDataStream* input,
+                                 NexusDataStream* output) {
+    (void)component;
+    reverse_calls++;
+    reverse_input_size = input->size;
+    const uint8_t* data = (const uint8_t*)input->data;
+    for (size_t i = input->size; i > 0; i--) {
+        NexusResult result = sps_stream_write(output, &data[i - 1], 1);
+        if (result != NEXUS_SUCCESS) {
+            return result;
+        }
+    }
+    return NEXUS_SUCCESS;
+}
+
+/* Chunk hooks count their calls in user_data */
+static NexusResult copy_chunk(NexusPipelineComponent* component, const void* chunk, size_t size,
+                              bool final, NexusDataStream* output, void* user_data) {
+    (void)component;
+    (void)final;
+    (*(size_t*)user_data)++;
+    return size > 0 ? sps_stream_write(output, chunk, size) : NEXUS_SUCCESS;
+}
+
+static NexusResult repeat_chunk(NexusPipelineComponent* component, const void* chunk, size_t size,
+                                bool final, NexusDataStream* output, void* user_data) {
+    (void)component;
+    (void)final;
+    (*(size_t*)user_data)++;
+    const uint8_t* data = (const uint8_t*)chunk;
+    for (size_t i = 0; i < size; i++) {
+        uint8_t pair[2] = { data[i], data[i] };
+        NexusResult result = sps_stream_write(output, pair, sizeof(pair));
+        if (result != NEXUS_SUCCESS) {
+            return result;
+        }
+    }
+    return NEXUS_SUCCESS;
+}
+
+static void register_chunk_hook(NexusPipelineComponent* component, NexusComponentChunkFunc func, size_t* calls) {
+    NexusComponentLifecycle lifecycle = {0};
+    lifecycle.chunk_func = func;
+    lifecycle.user_data = calls;
+    sps_register_component_lifecycle(test_ctx, component, &lifecycle);
+}
+
+/* Collects streamed output and the largest piece delivered */
+typedef struct {
+    NexusDataStream* stream;
+    size_t calls;
+    size_t largest;
+} ChunkCollector;
+
+static void collect_chunk(NexusPipeline* pipeline, const void* data, size_t size, void* user_data) {
+    (void)pipeline;
+    ChunkCollector* collector = (ChunkCollector*)user_data;
+    collector->calls++;
+    if (size > collector->largest) {
+        collector->largest = size;
+    }
+    sps_stream_write(collector->stream, data, size);
+}
+
+static bool same_bytes(const NexusDataStream* a, const NexusDataStream* b) {
+    return a->size == b->size && memcmp(a->data, b->data, a->size) == 0;
+}
+
+static NexusDataStream* create_input(size_t size) {
+    uint8_t* data = (uint8_t*)malloc(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = (uint8_t)(i * 7 + 3);
+    }
+    NexusDataStream* input = sps_stream_create_from_data(data, size, "binary");
+    free(data);
+    return input;
+}
+
+/* Whether output holds every input byte twice */
+static bool is_repeated(const NexusDataStream* input, const NexusDataStream* output) {
+    if (output->size != input->size * 2) {
+        return false;
+    }
+    const uint8_t* in = (const uint8_t*)input->data;
+    const uint8_t* out = (const uint8_t*)output->data;
+    for (size_t i = 0; i < input->size; i++) {
+        if (out[2 * i] != in[i] || out[2 * i + 1] != in[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+NLINK_TEST_CASE(sps_pipeline, stream_pool_reuse) {
+    NLINK_ARRANGE_PHASE("Create a chain whose middle component doubles its input");
+    const char* ids[] = {"read", "repeat", "write"};
+    NexusPipelineConfig* config = create_config(ids, 3);
+    NexusPipeline* pipeline = sps_pipeline_create(test_ctx, config);
+    NLINK_ASSERT_NOT_NULL(pipeline, "pipeline is created");
+    bind_component(pipeline, 0, copy_input);
+    bind_component(pipeline, 1, repeat_bytes);
+    bind_component(pipeline, 2, copy_input);
+    NexusDataStream* input = create_input(1000);
+    NexusDataStream* first = sps_stream_create(16);
+    NexusDataStream* second = sps_stream_create(16);
+    NexusPipelineStats after_first;
+    NexusPipelineStats after_second;
+
+    NLINK_ACT_PHASE("Execute the pipeline twice");
+    NexusResult first_result = sps_pipeline_execute(test_ctx, pipeline, input, first);
+    sps_pipeline_get_stats(pipeline, &after_first);
+    NexusDataStream* first_streams[2] = { pipeline->stream_slots[0].stream, pipeline->stream_slots[1].stream };
+    void* grown_buffer = pipeline->stream_slots[1].stream->data;
+    NexusResult second_result = sps_pipeline_execute(test_ctx, pipeline, input, second);
+    sps_pipeline_get_stats(pipeline, &after_second);
+
+    NLINK_ASSERT_PHASE("Verify the second run reuses the streams sized by the first");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, first_result, "first run succeeds");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, second_result, "second run succeeds");
+    NLINK_ASSERT_TRUE(is_repeated(input, first), "first output is the doubled input");
+    NLINK_ASSERT_TRUE(is_repeated(input, second), "second output is the doubled input");
+    NLINK_ASSERT_EQUAL_INT(1, (int)after_first.executions, "one execution counted");
+    NLINK_ASSERT_EQUAL_INT(2, (int)after_first.stream_allocations, "one stream per boundary");
+    NLINK_ASSERT_EQUAL_INT(0, (int)after_first.stream_reuses, "nothing to reuse yet");
+    NLINK_ASSERT_EQUAL_INT(1, (int)after_first.stream_growths, "only the doubled stream grows");
+    NLINK_ASSERT_EQUAL_INT(2000, (int)after_first.high_water_size, "peak is the doubled input");
+    NLINK_ASSERT_EQUAL_INT(2, (int)after_second.executions, "two executions counted");
+    NLINK_ASSERT_EQUAL_INT(2, (int)after_second.stream_allocations, "no new streams");
+    NLINK_ASSERT_EQUAL_INT(2, (int)after_second.stream_reuses, "both streams reused");
+    NLINK_ASSERT_EQUAL_INT(1, (int)after_second.stream_growths, "grown stream keeps its capacity");
+    NLINK_ASSERT_EQUAL_INT(2000, (int)after_second.high_water_size, "peak is unchanged");
+    NLINK_ASSERT_TRUE(pipeline->stream_slots[0].stream == first_streams[0], "first stream is the same object");
+    NLINK_ASSERT_TRUE(pipeline->stream_slots[1].stream == first_streams[1], "second stream is the same object");
+    NLINK_ASSERT_TRUE(pipeline->stream_slots[1].stream->data == grown_buffer, "grown buffer is kept");
+
+    sps_stream_destroy(second);
+    sps_stream_destroy(first);
+    sps_stream_destroy(input);
+    destroy_pipeline(pipeline);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_pipeline, high_water_sizing) {
+    NLINK_ARRANGE_PHASE("Run a doubling chain once and release its streams");
+    const char* ids[] = {"read", "repeat", "write"};
+    NexusPipelineConfig* config = create_config(ids, 3);
+    config->size_streams_from_high_water = true;
+    NexusPipeline* pipeline = sps_pipeline_create(test_ctx, config);
+    NLINK_ASSERT_NOT_NULL(pipeline, "pipeline is created");
+    bind_component(pipeline, 0, copy_input);
+    bind_component(pipeline, 1, repeat_bytes);
+    bind_component(pipeline, 2, copy_input);
+    NexusDataStream* input = create_input(1000);
+    NexusDataStream* output = sps_stream_create(16);
+    sps_pipeline_execute(test_ctx, pipeline, input, output);
+    sps_pipeline_release_streams(pipeline);
+    sps_stream_clear(output);
+
+    NLINK_ACT_PHASE("Execute again with freshly allocated streams");
+    NexusResult result = sps_pipeline_execute(test_ctx, pipeline, input, output);
+    NexusPipelineStats stats;
+    sps_pipeline_get_stats(pipeline, &stats);
+
+    NLINK_ASSERT_PHASE("Verify the new streams start at their recorded peak");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "run succeeds");
+    NLINK_ASSERT_TRUE(is_repeated(input, output), "output is the doubled input");
+    NLINK_ASSERT_EQUAL_INT(4, (int)stats.stream_allocations, "released streams are recreated");
+    NLINK_ASSERT_EQUAL_INT(0, (int)stats.stream_reuses, "nothing was pooled");
+    NLINK_ASSERT_EQUAL_INT(1, (int)stats.stream_growths, "no growth on the second run");
+    NLINK_ASSERT_TRUE(pipeline->stream_slots[1].stream->capacity >= 2000, "doubled stream starts large enough");
+
+    sps_stream_destroy(output);
+    sps_stream_destroy(input);
+    destroy_pipeline(pipeline);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_pipeline, streaming_chunk_hooks) {
+    NLINK_ARRANGE_PHASE("Create a doubling chain whose components all take chunks");
+    const char* ids[] = {"read", "repeat", "write"};
+    NexusPipelineConfig* config = create_config(ids, 3);
+    NexusPipeline* pipeline = sps_pipeline_create(test_ctx, config);
+    NLINK_ASSERT_NOT_NULL(pipeline, "pipeline is created");
+    size_t read_calls = 0, repeat_calls = 0, write_calls = 0;
+    register_chunk_hook(bind_component(pipeline, 0, copy_input), copy_chunk, &read_calls);
+    register_chunk_hook(bind_component(pipeline, 1, repeat_bytes), repeat_chunk, &repeat_calls);
+    register_chunk_hook(bind_component(pipeline, 2, copy_input), copy_chunk, &write_calls);
+    NexusDataStream* input = create_input(1030);
+    NexusDataStream* expected = sps_stream_create(16);
+    NexusDataStream* output = sps_stream_create(16);
+
+    NLINK_ACT_PHASE("Stream the input in 100 byte chunks, then run it whole");
+    NexusResult result = sps_pipeline_execute_streaming(test_ctx, pipeline, input, output, 100);
+    NexusPipelineStats stats;
+    sps_pipeline_get_stats(pipeline, &stats);
+    sps_pipeline_execute(test_ctx, pipeline, input, expected);
+
+    NLINK_ASSERT_PHASE("Verify every chunk passes through the hooks");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "streaming succeeds");
+    NLINK_ASSERT_TRUE(is_repeated(input, expected), "sequential output is the doubled input");
+    NLINK_ASSERT_TRUE(same_bytes(expected, output), "streamed output matches sequential output");
+    NLINK_ASSERT_EQUAL_INT(11, (int)stats.chunks, "ten full chunks and one partial");
+    NLINK_ASSERT_EQUAL_INT(12, (int)read_calls, "read sees every chunk and the final call");
+    NLINK_ASSERT_EQUAL_INT(12, (int)repeat_calls, "repeat sees every chunk and the final call");
+    NLINK_ASSERT_EQUAL_INT(22, (int)write_calls, "write sees the doubled chunks re-sliced and the final call");
+    NLINK_ASSERT_EQUAL_INT(1030, (int)input->position, "input is consumed");
+    NLINK_ASSERT_TRUE(stats.high_water_size <= 200, "intermediate streams hold one chunk's output");
+
+    sps_stream_destroy(output);
+    sps_stream_destroy(expected);
+    sps_stream_destroy(input);
+    destroy_pipeline(pipeline);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_pipeline, streaming_gathers_without_hook) {
+    NLINK_ARRANGE_PHASE("Put a component without a chunk hook between two that stream");
+    const char* ids[] = {"read", "reverse", "write"};
+    NexusPipelineConfig* config = create_config(ids, 3);
+    NexusPipeline* pipeline = sps_pipeline_create(test_ctx, config);
+    NLINK_ASSERT_NOT_NULL(pipeline, "pipeline is created");
+    size_t read_calls = 0, write_calls = 0;
+    register_chunk_hook(bind_component(pipeline, 0, copy_input), copy_chunk, &read_calls);
+    NexusPipelineComponent* reverse = bind_component(pipeline, 1, reverse_bytes);
+    register_chunk_hook(bind_component(pipeline, 2, copy_input), copy_chunk, &write_calls);
+    NexusDataStream* input = create_input(1000);
+    NexusDataStream* expected = sps_stream_create(16);
+    NexusDataStream* output = sps_stream_create(16);
+    sps_pipeline_execute(test_ctx, pipeline, input, expected);
+    reverse_calls = 0;
+    reverse_input_size = 0;
+
+    NLINK_ACT_PHASE("Stream the input in 64 byte chunks");
+    NexusResult result = sps_pipeline_execute_streaming(test_ctx, pipeline, input, output, 64);
+
+    NLINK_ASSERT_PHASE("Verify the component runs once over the gathered input");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "streaming succeeds");
+    NLINK_ASSERT_TRUE(same_bytes(expected, output), "streamed output matches sequential output");
+    NLINK_ASSERT_EQUAL_INT(1, (int)reverse_calls, "process function runs on the final call only");
+    NLINK_ASSERT_EQUAL_INT(1000, (int)reverse_input_size, "it sees the whole input");
+    NLINK_ASSERT_NULL(reverse->chunk_buffer, "gathered input is released");
+    NLINK_ASSERT_EQUAL_INT(17, (int)read_calls, "read still streams");
+    NLINK_ASSERT_EQUAL_INT(17, (int)write_calls, "reversed output is re-sliced for write");
+
+    sps_stream_destroy(output);
+    sps_stream_destroy(expected);
+    sps_stream_destroy(input);
+    destroy_pipeline(pipeline);
+    free_config(config);
+}
+
+NLINK_TEST_CASE(sps_pipeline, chunk_handler_order) {
+    NLINK_ARRANGE_PHASE("Attach a chunk handler to a doubling chain");
+    const char* ids[] = {"read", "repeat", "write"};
+    NexusPipelineConfig* config = create_config(ids, 3);
+    NexusPipeline* pipeline = sps_pipeline_create(test_ctx, config);
+    NLINK_ASSERT_NOT_NULL(pipeline, "pipeline is created");
+    size_t read_calls = 0, repeat_calls = 0, write_calls = 0;
+    register_chunk_hook(bind_component(pipeline, 0, copy_input), copy_chunk, &read_calls);
+    register_chunk_hook(bind_component(pipeline, 1, repeat_bytes), repeat_chunk, &repeat_calls);
+    register_chunk_hook(bind_component(pipeline, 2, copy_input), copy_chunk, &write_calls);
+    ChunkCollector collector = { sps_stream_create(16), 0, 0 };
+    pipeline->user_data = &collector;
+    sps_pipeline_set_chunk_handler(pipeline, collect_chunk);
+    NexusDataStream* input = create_input(1030);
+    NexusDataStream* output = sps_stream_create(16);
+
+    NLINK_ACT_PHASE("Stream the input in 100 byte chunks");
+    NexusResult result = sps_pipeline_execute_streaming(test_ctx, pipeline, input, output, 100);
+
+    NLINK_ASSERT_PHASE("Verify the handler sees the output in order, one piece at a time");
+    NLINK_ASSERT_EQUAL_INT(NEXUS_SUCCESS, result, "streaming succeeds");
+    NLINK_ASSERT_TRUE(is_repeated(input, output), "output is the doubled input");
+    NLINK_ASSERT_TRUE(same_bytes(output, collector.stream), "handler received the output in order");
+    NLINK_ASSERT_EQUAL_INT(21, (int)collector.calls, "one delivery per piece written");
+    NLINK_ASSERT_EQUAL_INT(100, (int)collector.largest, "no delivery exceeds the chunk size");
+
+    sps_stream_destroy(collector.stream);
+    sps_stream_destroy(output);
+    sps_stream_destroy(input);
+    destroy_pipeline(pipeline);
+    free_config(config);
+}
+
+NLINK_TEST_REGISTER(sps_pipeline, stream_pool_reuse)
+NLINK_TEST_REGISTER(sps_pipeline, high_water_sizing)
+NLINK_TEST_REGISTER(sps_pipeline, streaming_chunk_hooks)
+NLINK_TEST_REGISTER(sps_pipeline, streaming_gathers_without_hook)
+NLINK_TEST_REGISTER(sps_pipeline, chunk_handler_order)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_sps_pipeline_stream_pool_reuse();
+    nlink_run_test_sps_pipeline_high_water_sizing();
+    nlink_run_test_sps_pipeline_streaming_chunk_hooks();
+    nlink_run_test_sps_pipeline_streaming_gathers_without_hook();
+    nlink_run_test_sps_pipeline_chunk_handler_order()
+)
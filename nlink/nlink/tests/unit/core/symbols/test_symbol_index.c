@@ -0,0 +1,179 @@
+/**
+ * @file test_symbol_index.c
+ * @brief Unit tests for the symbol table hash index
+ *
+ * Symbols are given chosen hashes so that they collide into the same
+ * probe run, which exercises backward-shift deletion and relocation.
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/symbols/symbol_index.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_MAX_SYMBOLS 256
+#define TEST_NAME_SIZE 16
+
+static NexusSymbolTable table;
+static NexusSymbol symbols[TEST_MAX_SYMBOLS];
+static char names[TEST_MAX_SYMBOLS][TEST_NAME_SIZE];
+static uint32_t hashes[TEST_MAX_SYMBOLS];
+static bool removed[TEST_MAX_SYMBOLS];
+
+NLINK_TEST_SUITE_BEGIN(symbol_index) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(symbol_index) {
+    (void)context;
+}
+
+static void reset_table(void) {
+    nexus_symbol_index_free(&table);
+    memset(&table, 0, sizeof(table));
+    memset(symbols, 0, sizeof(symbols));
+    memset(removed, 0, sizeof(removed));
+    table.symbols = symbols;
+    table.capacity = TEST_MAX_SYMBOLS;
+}
+
+/* Append key 'key' with a chosen hash and index it */
+static NexusResult add_key(size_t key, uint32_t hash) {
+    snprintf(names[key], TEST_NAME_SIZE, "key%zu", key);
+    hashes[key] = hash;
+    symbols[table.size].name = names[key];
+    symbols[table.size].hash = hash;
+    table.size++;
+    return nexus_symbol_index_insert(&table, table.size - 1);
+}
+
+/* Remove a key the way nexus_symbol_table_remove does: drop its slot,
+ * move the last symbol into the gap and repoint that symbol's slot */
+static void remove_key(size_t key) {
+    NexusSymbol* symbol = nexus_symbol_index_find(&table, names[key], hashes[key]);
+    size_t i = (size_t)(symbol - table.symbols);
+    size_t last = table.size - 1;
+
+    nexus_symbol_index_remove(&table, i);
+    if (i < last) {
+        table.symbols[i] = table.symbols[last];
+        nexus_symbol_index_relocate(&table, last, i);
+    }
+    table.size--;
+    removed[key] = true;
+}
+
+/* Check that every key in [0, count) is found unless it was removed */
+static bool all_keys_found(size_t count) {
+    for (size_t key = 0; key < count; key++) {
+        NexusSymbol* symbol = nexus_symbol_index_find(&table, names[key], hashes[key]);
+        bool found = symbol != NULL && strcmp(symbol->name, names[key]) == 0;
+        if (found == removed[key]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+NLINK_TEST_CASE(symbol_index, remove_from_probe_run) {
+    NLINK_ARRANGE_PHASE("Index keys that share one probe run");
+    reset_table();
+    // Homes 5, 6 and 7 in a 128-slot index; 133 also lands on slot 5
+    static const uint32_t run[] = { 5, 5, 5, 6, 5, 7, 5, 133 };
+    size_t count = sizeof(run) / sizeof(run[0]);
+    bool inserted = true;
+    for (size_t key = 0; key < count; key++) {
+        inserted = inserted && add_key(key, run[key]) == NEXUS_SUCCESS;
+    }
+    bool found_before = all_keys_found(count);
+
+    NLINK_ACT_PHASE("Remove keys from the middle and the start of the run");
+    remove_key(2);
+    bool found_after_middle = all_keys_found(count);
+    remove_key(0);
+    bool found_after_start = all_keys_found(count);
+
+    NLINK_ASSERT_PHASE("Verify the remaining keys are still reachable");
+    NLINK_ASSERT_TRUE(inserted, "all keys inserted");
+    NLINK_ASSERT_TRUE(found_before, "all keys found before removal");
+    NLINK_ASSERT_TRUE(found_after_middle, "remaining keys found after removing from the middle");
+    NLINK_ASSERT_TRUE(found_after_start, "remaining keys found after removing the first key");
+    NLINK_ASSERT_EQUAL_INT((int)count - 2, (int)table.size, "two symbols removed");
+
+    reset_table();
+}
+
+NLINK_TEST_CASE(symbol_index, remove_across_wraparound) {
+    NLINK_ARRANGE_PHASE("Index keys whose probe run wraps past the last slot");
+    reset_table();
+    static const uint32_t run[] = { 127, 255, 0, 127, 1, 128 };
+    size_t count = sizeof(run) / sizeof(run[0]);
+    for (size_t key = 0; key < count; key++) {
+        add_key(key, run[key]);
+    }
+
+    NLINK_ACT_PHASE("Remove the key in the last slot and one after the wrap");
+    remove_key(0);
+    bool found_after_first = all_keys_found(count);
+    remove_key(2);
+    bool found_after_second = all_keys_found(count);
+
+    NLINK_ASSERT_PHASE("Verify the remaining keys are still reachable");
+    NLINK_ASSERT_EQUAL_INT(128, (int)table.index_capacity, "index did not grow");
+    NLINK_ASSERT_TRUE(found_after_first, "remaining keys found after removing the last slot");
+    NLINK_ASSERT_TRUE(found_after_second, "remaining keys found after removing past the wrap");
+
+    reset_table();
+}
+
+NLINK_TEST_CASE(symbol_index, grow_past_threshold) {
+    NLINK_ARRANGE_PHASE("Index colliding keys up to the resize threshold");
+    reset_table();
+    // Hashes 5, 133, 261, ... share a home slot until the index grows
+    size_t key = 0;
+    bool inserted = true;
+    for (; key < 64; key++) {
+        inserted = inserted && add_key(key, (uint32_t)(key * 128 + 5)) == NEXUS_SUCCESS;
+    }
+    size_t capacity_at_threshold = table.index_capacity;
+    for (size_t victim = 10; victim < 64; victim += 10) {
+        remove_key(victim);
+    }
+
+    NLINK_ACT_PHASE("Keep inserting past the threshold");
+    size_t count = 200;
+    for (; key < count; key++) {
+        inserted = inserted && add_key(key, (uint32_t)(key * 128 + 5)) == NEXUS_SUCCESS;
+    }
+    bool found_after_growth = all_keys_found(count);
+    for (size_t victim = 3; victim < count; victim += 7) {
+        if (!removed[victim]) {
+            remove_key(victim);
+        }
+    }
+    bool found_after_removal = all_keys_found(count);
+
+    NLINK_ASSERT_PHASE("Verify the index grew and every key is still found");
+    NLINK_ASSERT_TRUE(inserted, "all keys inserted");
+    NLINK_ASSERT_EQUAL_INT(128, (int)capacity_at_threshold, "index at minimum capacity");
+    NLINK_ASSERT_TRUE(table.index_capacity > capacity_at_threshold, "index grew");
+    NLINK_ASSERT_TRUE(table.size * 2 <= table.index_capacity, "load factor at most one half");
+    NLINK_ASSERT_TRUE(found_after_growth, "all keys found after growth");
+    NLINK_ASSERT_TRUE(found_after_removal, "remaining keys found after removals in the grown index");
+
+    reset_table();
+}
+
+NLINK_TEST_REGISTER(symbol_index, remove_from_probe_run)
+NLINK_TEST_REGISTER(symbol_index, remove_across_wraparound)
+NLINK_TEST_REGISTER(symbol_index, grow_past_threshold)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_symbol_index_remove_from_probe_run();
+    nlink_run_test_symbol_index_remove_across_wraparound();
+    nlink_run_test_symbol_index_grow_past_threshold()
+)
@@ -0,0 +1,135 @@
+/**
+ * @file test_versioned_resolution_cache.c
+ * @brief Unit tests for the versioned symbol resolution cache
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/symbols/nexus_versioned_symbols.h"
+
+static int symbol_a = 1;
+static int symbol_b = 2;
+
+NLINK_TEST_SUITE_BEGIN(versioned_resolution_cache) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(versioned_resolution_cache) {
+    (void)context;
+}
+
+/* Registry exporting "compute" from lib_a 1.0.0 and, at a higher priority, lib_b 2.0.0 */
+static VersionedSymbolRegistry* create_registry(void) {
+    VersionedSymbolRegistry* registry = nexus_versioned_registry_create();
+    versioned_symbol_table_add(&registry->exported, "compute", "1.0.0", &symbol_a,
+                               VSYMBOL_FUNCTION, "lib_a", 0);
+    versioned_symbol_table_add(&registry->exported, "compute", "2.0.0", &symbol_b,
+                               VSYMBOL_FUNCTION, "lib_b", 5);
+    return registry;
+}
+
+static VersionedResolutionCacheStats get_stats(const VersionedSymbolRegistry* registry) {
+    VersionedResolutionCacheStats stats;
+    nexus_versioned_registry_get_cache_stats(registry, &stats);
+    return stats;
+}
+
+NLINK_TEST_CASE(versioned_resolution_cache, miss_then_hit) {
+    NLINK_ARRANGE_PHASE("Create a registry with two providers");
+    VersionedSymbolRegistry* registry = create_registry();
+
+    NLINK_ACT_PHASE("Resolve the same symbol twice");
+    void* first = nexus_resolve_versioned_symbol(registry, "compute", NULL, "app");
+    VersionedResolutionCacheStats after_first = get_stats(registry);
+    void* second = nexus_resolve_versioned_symbol(registry, "compute", NULL, "app");
+    VersionedResolutionCacheStats after_second = get_stats(registry);
+
+    NLINK_ASSERT_PHASE("Verify the second lookup is served from the cache");
+    NLINK_ASSERT_TRUE(first == &symbol_b, "highest priority provider resolved");
+    NLINK_ASSERT_TRUE(second == first, "cached resolution matches");
+    NLINK_ASSERT_EQUAL_INT(1, (int)after_first.misses, "first lookup misses");
+    NLINK_ASSERT_EQUAL_INT(0, (int)after_first.hits, "first lookup does not hit");
+    NLINK_ASSERT_EQUAL_INT(1, (int)after_second.misses, "second lookup does not miss");
+    NLINK_ASSERT_EQUAL_INT(1, (int)after_second.hits, "second lookup hits");
+    NLINK_ASSERT_EQUAL_INT(1, (int)after_second.entries, "one entry cached");
+
+    nexus_versioned_registry_free(registry);
+}
+
+NLINK_TEST_CASE(versioned_resolution_cache, add_symbol_invalidates) {
+    NLINK_ARRANGE_PHASE("Cache a failed and a successful resolution");
+    VersionedSymbolRegistry* registry = create_registry();
+    void* missing = nexus_resolve_versioned_symbol(registry, "render", NULL, "app");
+    nexus_resolve_versioned_symbol(registry, "render", NULL, "app");
+    VersionedResolutionCacheStats before = get_stats(registry);
+
+    NLINK_ACT_PHASE("Export the missing symbol and resolve it again");
+    versioned_symbol_table_add(&registry->exported, "render", "1.0.0", &symbol_a,
+                               VSYMBOL_FUNCTION, "lib_a", 0);
+    void* found = nexus_resolve_versioned_symbol(registry, "render", NULL, "app");
+    VersionedResolutionCacheStats after = get_stats(registry);
+
+    NLINK_ASSERT_PHASE("Verify the cached failure was dropped");
+    NLINK_ASSERT_NULL(missing, "symbol initially missing");
+    NLINK_ASSERT_EQUAL_INT(1, (int)before.hits, "failed resolution was cached");
+    NLINK_ASSERT_TRUE(found == &symbol_a, "new symbol resolved");
+    NLINK_ASSERT_EQUAL_INT((int)before.misses + 1, (int)after.misses, "lookup after adding misses");
+    NLINK_ASSERT_EQUAL_INT((int)before.hits, (int)after.hits, "lookup after adding does not hit");
+
+    nexus_versioned_registry_free(registry);
+}
+
+NLINK_TEST_CASE(versioned_resolution_cache, dependency_change_invalidates) {
+    NLINK_ARRANGE_PHASE("Cache a resolution that picks the higher priority provider");
+    VersionedSymbolRegistry* registry = create_registry();
+    void* before_dependency = nexus_resolve_versioned_symbol(registry, "compute", NULL, "app");
+    VersionedResolutionCacheStats before = get_stats(registry);
+
+    NLINK_ACT_PHASE("Make app depend on lib_a and resolve again");
+    nexus_add_component_dependency(registry, "app", "lib_a", "^1.0.0", false);
+    void* after_dependency = nexus_resolve_versioned_symbol(registry, "compute", NULL, "app");
+    VersionedResolutionCacheStats after = get_stats(registry);
+
+    NLINK_ASSERT_PHASE("Verify the direct dependency wins instead of the stale entry");
+    NLINK_ASSERT_TRUE(before_dependency == &symbol_b, "lib_b resolved without dependencies");
+    NLINK_ASSERT_TRUE(after_dependency == &symbol_a, "lib_a resolved through the dependency");
+    NLINK_ASSERT_EQUAL_INT((int)before.misses + 1, (int)after.misses, "lookup after the change misses");
+    NLINK_ASSERT_EQUAL_INT((int)before.hits, (int)after.hits, "lookup after the change does not hit");
+    NLINK_ASSERT_EQUAL_INT(1, (int)after.invalidations, "cache flushed once");
+
+    nexus_versioned_registry_free(registry);
+}
+
+NLINK_TEST_CASE(versioned_resolution_cache, explicit_invalidation) {
+    NLINK_ARRANGE_PHASE("Cache a resolution");
+    VersionedSymbolRegistry* registry = create_registry();
+    nexus_resolve_versioned_symbol(registry, "compute", "^2.0.0", "app");
+
+    NLINK_ACT_PHASE("Invalidate the cache and resolve again");
+    nexus_versioned_registry_invalidate_cache(registry);
+    VersionedResolutionCacheStats flushed = get_stats(registry);
+    void* resolved = nexus_resolve_versioned_symbol(registry, "compute", "^2.0.0", "app");
+    VersionedResolutionCacheStats after = get_stats(registry);
+
+    NLINK_ASSERT_PHASE("Verify the lookup after invalidation misses");
+    NLINK_ASSERT_EQUAL_INT(0, (int)flushed.entries, "entries dropped");
+    NLINK_ASSERT_EQUAL_INT(1, (int)flushed.invalidations, "invalidation counted");
+    NLINK_ASSERT_TRUE(resolved == &symbol_b, "symbol resolved again");
+    NLINK_ASSERT_EQUAL_INT(2, (int)after.misses, "lookup after invalidation misses");
+    NLINK_ASSERT_EQUAL_INT(0, (int)after.hits, "no lookup hit");
+
+    nexus_versioned_registry_free(registry);
+}
+
+NLINK_TEST_REGISTER(versioned_resolution_cache, miss_then_hit)
+NLINK_TEST_REGISTER(versioned_resolution_cache, add_symbol_invalidates)
+NLINK_TEST_REGISTER(versioned_resolution_cache, dependency_change_invalidates)
+NLINK_TEST_REGISTER(versioned_resolution_cache, explicit_invalidation)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_versioned_resolution_cache_miss_then_hit();
+    nlink_run_test_versioned_resolution_cache_add_symbol_invalidates();
+    nlink_run_test_versioned_resolution_cache_dependency_change_invalidates();
+    nlink_run_test_versioned_resolution_cache_explicit_invalidation()
+)
@@ -0,0 +1,244 @@
+/**
+ * @file test_parallel.c
+ * @brief Unit tests for parallel abstraction tactics and typed summaries
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/tatit/abstraction.h"
+#include "nlink/core/tatit/aggregation.h"
+#include "nlink/core/tatit/parallel.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_THREADS 4
+#define TEST_COUNT 100003
+
+NLINK_TEST_SUITE_BEGIN(parallel) {
+    nlink_parallel_set_threads(TEST_THREADS);
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(parallel) {
+    (void)context;
+    nlink_parallel_shutdown();
+}
+
+/* Items are small integers stored in the pointers themselves */
+static void** create_items(size_t count, size_t modulus) {
+    void** items = malloc(count * sizeof(void*));
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < count; i++) {
+        seed = seed * 1103515245u + 12345u;
+        items[i] = (void*)(uintptr_t)(seed % modulus + 1);
+    }
+    return items;
+}
+
+static void* double_item(void* item, void* context) {
+    (void)context;
+    return (void*)((uintptr_t)item * 2);
+}
+
+static void* fail_on_seven(void* item, void* context) {
+    (void)context;
+    return (uintptr_t)item == 7 ? NULL : item;
+}
+
+static bool is_even(void* item, void* context) {
+    (void)context;
+    return (uintptr_t)item % 2 == 0;
+}
+
+static void* add_items(void* accumulator, void* item, void* context) {
+    (void)context;
+    return (void*)((uintptr_t)accumulator + (uintptr_t)item);
+}
+
+static int compare_items(void* a, void* b, void* context) {
+    (void)context;
+    return (uintptr_t)a < (uintptr_t)b ? -1 : (uintptr_t)a > (uintptr_t)b;
+}
+
+NLINK_TEST_CASE(parallel, map_and_filter) {
+    NLINK_ARRANGE_PHASE("Create an array spanning many chunks");
+    void** items = create_items(TEST_COUNT, 1000);
+
+    NLINK_ACT_PHASE("Map and filter serially and in parallel");
+    size_t map_size = 0, parallel_map_size = 0, filter_size = 0, parallel_filter_size = 0, failed_size = 1;
+    void** mapped = nlink_map(items, TEST_COUNT, double_item, NULL, &map_size);
+    void** parallel_mapped = nlink_parallel_map(items, TEST_COUNT, double_item, NULL, &parallel_map_size);
+    void** filtered = nlink_filter(items, TEST_COUNT, is_even, NULL, &filter_size);
+    void** parallel_filtered = nlink_parallel_filter(items, TEST_COUNT, is_even, NULL, &parallel_filter_size);
+    void** failed = nlink_parallel_map(items, TEST_COUNT, fail_on_seven, NULL, &failed_size);
+
+    NLINK_ASSERT_PHASE("Verify the parallel results match the serial ones");
+    NLINK_ASSERT_EQUAL_INT((int)map_size, (int)parallel_map_size, "map sizes match");
+    NLINK_ASSERT_TRUE(memcmp(mapped, parallel_mapped, map_size * sizeof(void*)) == 0, "mapped items match");
+    NLINK_ASSERT_EQUAL_INT((int)filter_size, (int)parallel_filter_size, "filter sizes match");
+    NLINK_ASSERT_TRUE(memcmp(filtered, parallel_filtered, filter_size * sizeof(void*)) == 0,
+                      "filtered items match in order");
+    NLINK_ASSERT_NULL(failed, "a failed mapping fails the map");
+    NLINK_ASSERT_EQUAL_INT(0, (int)failed_size, "failed map has no items");
+
+    free(mapped);
+    free(parallel_mapped);
+    free(filtered);
+    free(parallel_filtered);
+    free(items);
+}
+
+NLINK_TEST_CASE(parallel, fold_sum) {
+    NLINK_ARRANGE_PHASE("Create an array spanning many chunks");
+    void** items = create_items(TEST_COUNT, 1000);
+
+    NLINK_ACT_PHASE("Sum the items serially and in parallel");
+    void* sum = nlink_fold(items, TEST_COUNT, NULL, add_items, NULL);
+    void* parallel_sum = nlink_parallel_fold(items, TEST_COUNT, NULL, add_items, NULL, NULL);
+    void* short_sum = nlink_parallel_fold(items, 9, NULL, add_items, NULL, NULL);
+    void* empty = nlink_parallel_fold(items, 0, (void*)42, add_items, NULL, NULL);
+
+    NLINK_ASSERT_PHASE("Verify the folds match the serial fold");
+    NLINK_ASSERT_TRUE(sum == parallel_sum, "parallel sum matches");
+    NLINK_ASSERT_TRUE(short_sum == nlink_fold(items, 9, NULL, add_items, NULL), "single-chunk fold matches");
+    NLINK_ASSERT_TRUE(empty == (void*)42, "empty fold returns identity");
+
+    free(items);
+}
+
+/* Polynomial hash of a sequence; combining is associative but not
+ * commutative: h(xs ++ ys) = h(xs) * 31^|ys| + h(ys) */
+typedef struct poly_hash {
+    uint64_t hash;
+    uint64_t power;
+} poly_hash;
+
+static poly_hash hash_storage[3 * TEST_COUNT];
+static atomic_size_t hash_used;
+
+static poly_hash* new_hash(uint64_t hash, uint64_t power) {
+    poly_hash* result = &hash_storage[atomic_fetch_add(&hash_used, 1)];
+    result->hash = hash;
+    result->power = power;
+    return result;
+}
+
+static void* hash_item(void* accumulator, void* item, void* context) {
+    (void)context;
+    poly_hash* acc = accumulator;
+    uint64_t hash = acc != NULL ? acc->hash : 0;
+    uint64_t power = acc != NULL ? acc->power : 1;
+    return new_hash(hash * 31 + (uintptr_t)item, power * 31);
+}
+
+static void* hash_combine(void* left, void* right, void* context) {
+    (void)context;
+    poly_hash* a = left;
+    poly_hash* b = right;
+    if (a == NULL) {
+        return b;
+    }
+    if (b == NULL) {
+        return a;
+    }
+    return new_hash(a->hash * b->power + b->hash, a->power * b->power);
+}
+
+NLINK_TEST_CASE(parallel, fold_tree_order) {
+    NLINK_ARRANGE_PHASE("Create an array spanning many chunks");
+    void** items = create_items(TEST_COUNT, 1000);
+
+    NLINK_ACT_PHASE("Fold an order-sensitive hash serially and in parallel");
+    atomic_store(&hash_used, 0);
+    poly_hash* serial = nlink_fold(items, TEST_COUNT, NULL, hash_item, NULL);
+    poly_hash* parallel = nlink_parallel_fold(items, TEST_COUNT, NULL, hash_item, hash_combine, NULL);
+
+    NLINK_ASSERT_PHASE("Verify the tree reduction keeps the item order");
+    NLINK_ASSERT_NOT_NULL(parallel, "fold produced a value");
+    NLINK_ASSERT_TRUE(serial->hash == parallel->hash, "hashes match");
+
+    free(items);
+}
+
+NLINK_TEST_CASE(parallel, sort_matches_serial) {
+    NLINK_ARRANGE_PHASE("Create arrays with many duplicates and a reversed run");
+    size_t sizes[] = { 1, 100, 8192, 8193, TEST_COUNT };
+    bool all_match = true;
+
+    NLINK_ACT_PHASE("Sort serially and in parallel");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t count = sizes[s];
+        void** items = create_items(count, 50);
+        for (size_t i = 0; i < count / 4; i++) {
+            items[i] = (void*)(uintptr_t)(count - i);
+        }
+        void** expected = nlink_clone_array(items, count);
+        nlink_sort(expected, count, compare_items, NULL);
+        nlink_parallel_sort(items, count, compare_items, NULL);
+        all_match = all_match && memcmp(items, expected, count * sizeof(void*)) == 0;
+        free(expected);
+        free(items);
+    }
+
+    NLINK_ASSERT_PHASE("Verify every size sorts identically");
+    NLINK_ASSERT_TRUE(all_match, "parallel sort matches serial sort");
+}
+
+NLINK_TEST_CASE(parallel, typed_summaries) {
+    NLINK_ARRANGE_PHASE("Create double and integer arrays with a ragged tail");
+    size_t count = 1003;
+    double* doubles = malloc(count * sizeof(double));
+    int64_t* integers = malloc(count * sizeof(int64_t));
+    void** pointers = malloc(count * sizeof(void*));
+    for (size_t i = 0; i < count; i++) {
+        doubles[i] = (double)((i * 37) % 101) - 50.0;
+        integers[i] = (int64_t)((i * 37) % 101) - 50 + ((int64_t)1 << 40);
+        pointers[i] = &doubles[i];
+    }
+
+    NLINK_ACT_PHASE("Summarize through pointers and contiguously");
+    nlink_aggregation_result* boxed = nlink_numerical_summary(pointers, count);
+    nlink_aggregation_result* typed = nlink_numerical_summary_double(doubles, count);
+    nlink_aggregation_result* whole = nlink_numerical_summary_int64(integers, count);
+    nlink_aggregation_result* single = nlink_numerical_summary_double(doubles + 7, 1);
+
+    NLINK_ASSERT_PHASE("Verify the statistics agree");
+    NLINK_ASSERT_TRUE(*(double*)typed->min == *(double*)boxed->min, "double minimum");
+    NLINK_ASSERT_TRUE(*(double*)typed->max == *(double*)boxed->max, "double maximum");
+    NLINK_ASSERT_TRUE(typed->numeric_sum == boxed->numeric_sum, "integral double sums are exact");
+    NLINK_ASSERT_EQUAL_INT((int)count, (int)typed->count, "double count");
+    NLINK_ASSERT_TRUE(*(int64_t*)whole->min == ((int64_t)1 << 40) - 50, "integer minimum");
+    NLINK_ASSERT_TRUE(*(int64_t*)whole->max == ((int64_t)1 << 40) + 50, "integer maximum");
+    NLINK_ASSERT_TRUE(whole->numeric_sum == boxed->numeric_sum + (double)count * (double)((int64_t)1 << 40),
+                      "integer sum");
+    NLINK_ASSERT_TRUE(*(double*)single->min == doubles[7] && *(double*)single->max == doubles[7],
+                      "single value summary");
+
+    nlink_aggregation_result* results[] = { boxed, typed, whole, single };
+    for (size_t i = 0; i < 4; i++) {
+        free(results[i]->min);
+        free(results[i]->max);
+        free(results[i]->average);
+        nlink_aggregation_result_free(results[i]);
+    }
+    free(pointers);
+    free(integers);
+    free(doubles);
+}
+
+NLINK_TEST_REGISTER(parallel, map_and_filter)
+NLINK_TEST_REGISTER(parallel, fold_sum)
+NLINK_TEST_REGISTER(parallel, fold_tree_order)
+NLINK_TEST_REGISTER(parallel, sort_matches_serial)
+NLINK_TEST_REGISTER(parallel, typed_summaries)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_parallel_map_and_filter();
+    nlink_run_test_parallel_fold_sum();
+    nlink_run_test_parallel_fold_tree_order();
+    nlink_run_test_parallel_sort_matches_serial();
+    nlink_run_test_parallel_typed_summaries()
+)
@@ -0,0 +1,269 @@
+/**
+ * @file test_parallel_traversal.c
+ * @brief Unit tests for parallel traversal tactics
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/tatit/parallel.h"
+#include "nlink/core/tatit/traversal.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_THREADS 4
+
+typedef struct test_node {
+    size_t id;
+    size_t degree;
+    size_t depth;
+    atomic_int visits;
+    struct test_node* adjacent[3];
+} test_node;
+
+NLINK_TEST_SUITE_BEGIN(parallel_traversal) {
+    nlink_parallel_set_threads(TEST_THREADS);
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(parallel_traversal) {
+    (void)context;
+    nlink_parallel_shutdown();
+}
+
+static void* get_adjacent(void* node, size_t index, void* context) {
+    (void)context;
+    return ((test_node*)node)->adjacent[index];
+}
+
+static size_t get_adjacent_count(void* node, void* context) {
+    (void)context;
+    return ((test_node*)node)->degree;
+}
+
+static size_t get_id(void* node, void* context) {
+    (void)context;
+    return ((test_node*)node)->id;
+}
+
+static void* visit(void* node, void* context) {
+    (void)context;
+    atomic_fetch_add(&((test_node*)node)->visits, 1);
+    return node;
+}
+
+static void link_nodes(test_node* from, test_node* to) {
+    from->adjacent[from->degree++] = to;
+}
+
+static test_node* create_nodes(size_t count) {
+    test_node* nodes = calloc(count, sizeof(test_node));
+    for (size_t i = 0; i < count; i++) {
+        nodes[i].id = i;
+    }
+    return nodes;
+}
+
+static bool visited_once(test_node* nodes, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (atomic_load(&nodes[i].visits) != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+NLINK_TEST_CASE(parallel_traversal, tree_walk) {
+    NLINK_ARRANGE_PHASE("Create a complete binary tree");
+    size_t count = 100000;
+    test_node* nodes = create_nodes(count);
+    for (size_t i = 1; i < count; i++) {
+        link_nodes(&nodes[(i - 1) / 2], &nodes[i]);
+    }
+    nlink_parallel_traversal_config* config = nlink_parallel_traversal_config_create(
+        visit, get_adjacent, get_adjacent_count, NULL);
+    nlink_parallel_traversal_config_set_threads(config, TEST_THREADS);
+
+    NLINK_ACT_PHASE("Walk the tree with work stealing");
+    nlink_traversal_result* result = nlink_parallel_traverse_tree(&nodes[0], config);
+
+    NLINK_ASSERT_PHASE("Verify each node is visited once and collected");
+    NLINK_ASSERT_NOT_NULL(result, "traversal succeeds");
+    NLINK_ASSERT_EQUAL_INT((int)count, (int)result->count, "all nodes collected");
+    NLINK_ASSERT_TRUE(visited_once(nodes, count), "each node visited once");
+    NLINK_ASSERT_TRUE(nlink_traversal_visited(result, &nodes[0]), "root collected");
+
+    nlink_traversal_result_free(result);
+    nlink_parallel_traversal_config_free(config);
+    free(nodes);
+}
+
+NLINK_TEST_CASE(parallel_traversal, graph_visits_once) {
+    NLINK_ARRANGE_PHASE("Create a ring with chords and an unreachable node");
+    size_t count = 50001;
+    size_t reachable = count - 1;
+    test_node* nodes = create_nodes(count);
+    for (size_t i = 0; i < reachable; i++) {
+        link_nodes(&nodes[i], &nodes[(i + 1) % reachable]);
+        link_nodes(&nodes[i], &nodes[(i * 7919) % reachable]);
+    }
+    nlink_parallel_traversal_config* config = nlink_parallel_traversal_config_create(
+        visit, get_adjacent, get_adjacent_count, NULL);
+    nlink_parallel_traversal_config_set_threads(config, TEST_THREADS);
+
+    NLINK_ACT_PHASE("Traverse without and with node identifiers");
+    nlink_traversal_result* without_ids = nlink_parallel_traverse_graph(&nodes[0], config);
+    nlink_parallel_traversal_config_set_ids(config, get_id, count);
+    nlink_traversal_result* result = nlink_parallel_traverse_graph(&nodes[0], config);
+
+    NLINK_ASSERT_PHASE("Verify identifiers are required and each node is visited once");
+    NLINK_ASSERT_NULL(without_ids, "graph traversal requires identifiers");
+    NLINK_ASSERT_NOT_NULL(result, "traversal succeeds");
+    NLINK_ASSERT_EQUAL_INT((int)reachable, (int)result->count, "reachable nodes collected");
+    NLINK_ASSERT_TRUE(visited_once(nodes, reachable), "each reachable node visited once");
+    NLINK_ASSERT_EQUAL_INT(0, atomic_load(&nodes[reachable].visits), "unreachable node not visited");
+
+    nlink_traversal_result_free(result);
+    nlink_parallel_traversal_config_free(config);
+    free(nodes);
+}
+
+NLINK_TEST_CASE(parallel_traversal, bfs_level_order) {
+    NLINK_ARRANGE_PHASE("Create a layered graph with cross edges and back edges");
+    size_t width = 1000;
+    size_t depth = 50;
+    size_t count = width * depth;
+    test_node* nodes = create_nodes(count);
+    for (size_t level = 0; level + 1 < depth; level++) {
+        for (size_t i = 0; i < width; i++) {
+            test_node* node = &nodes[level * width + i];
+            link_nodes(node, &nodes[(level + 1) * width + i]);
+            link_nodes(node, &nodes[(level + 1) * width + (i * 31 + 7) % width]);
+            link_nodes(node, &nodes[(i * 13) % width]);
+        }
+    }
+    nlink_parallel_traversal_config* config = nlink_parallel_traversal_config_create(
+        visit, get_adjacent, get_adjacent_count, NULL);
+    nlink_parallel_traversal_config_set_ids(config, get_id, count);
+    nlink_parallel_traversal_config_set_threads(config, TEST_THREADS);
+
+    NLINK_ACT_PHASE("Search the graph breadth-first and compare with the sequential search");
+    nlink_traversal_result* result = nlink_parallel_traverse_graph_bfs(&nodes[0], config);
+    nlink_traversal_result* expected = nlink_traverse_graph_bfs(&nodes[0], get_adjacent, get_adjacent_count, visit, NULL);
+
+    NLINK_ASSERT_PHASE("Verify the same nodes are found at the same distances");
+    NLINK_ASSERT_NOT_NULL(result, "traversal succeeds");
+    NLINK_ASSERT_EQUAL_INT((int)expected->count, (int)result->count, "same nodes reached");
+
+    // Record sequential distances, then check the parallel order never decreases them
+    for (size_t i = 0; i < count; i++) {
+        nodes[i].depth = SIZE_MAX;
+    }
+    nodes[0].depth = 0;
+    for (size_t i = 0; i < expected->count; i++) {
+        test_node* node = expected->nodes[i];
+        for (size_t j = 0; j < node->degree; j++) {
+            if (node->adjacent[j]->depth == SIZE_MAX) {
+                node->adjacent[j]->depth = node->depth + 1;
+            }
+        }
+    }
+    bool level_order = true;
+    for (size_t i = 1; i < result->count; i++) {
+        if (((test_node*)result->nodes[i])->depth < ((test_node*)result->nodes[i - 1])->depth) {
+            level_order = false;
+        }
+    }
+    NLINK_ASSERT_TRUE(level_order, "results are in level order");
+    NLINK_ASSERT_TRUE(result->nodes[0] == &nodes[0], "start node first");
+
+    nlink_traversal_result_free(result);
+    nlink_traversal_result_free(expected);
+    nlink_parallel_traversal_config_free(config);
+    free(nodes);
+}
+
+NLINK_TEST_CASE(parallel_traversal, out_of_range_id) {
+    NLINK_ARRANGE_PHASE("Declare fewer identifiers than nodes");
+    test_node* nodes = create_nodes(3);
+    link_nodes(&nodes[0], &nodes[1]);
+    link_nodes(&nodes[1], &nodes[2]);
+    nlink_parallel_traversal_config* config = nlink_parallel_traversal_config_create(
+        visit, get_adjacent, get_adjacent_count, NULL);
+    nlink_parallel_traversal_config_set_ids(config, get_id, 2);
+    nlink_parallel_traversal_config_set_threads(config, TEST_THREADS);
+
+    NLINK_ACT_PHASE("Traverse the graph both ways");
+    nlink_traversal_result* walk = nlink_parallel_traverse_graph(&nodes[0], config);
+    nlink_traversal_result* bfs = nlink_parallel_traverse_graph_bfs(&nodes[0], config);
+
+    NLINK_ASSERT_PHASE("Verify both traversals fail");
+    NLINK_ASSERT_NULL(walk, "work-stealing walk rejects the identifier");
+    NLINK_ASSERT_NULL(bfs, "breadth-first search rejects the identifier");
+
+    nlink_parallel_traversal_config_free(config);
+    free(nodes);
+}
+
+/* Runs both kinds of traversal from inside a loop on the shared pool */
+typedef struct nested_walks {
+    test_node* nodes;
+    const nlink_parallel_traversal_config* config;
+    size_t count;
+    atomic_size_t complete;
+} nested_walks;
+
+static void run_nested_walks(size_t begin, size_t end, size_t chunk, void* context) {
+    (void)begin;
+    (void)end;
+    (void)chunk;
+    nested_walks* walks = context;
+    nlink_traversal_result* walk = nlink_parallel_traverse_graph(&walks->nodes[0], walks->config);
+    nlink_traversal_result* bfs = nlink_parallel_traverse_graph_bfs(&walks->nodes[0], walks->config);
+    if (walk != NULL && walk->count == walks->count && bfs != NULL && bfs->count == walks->count) {
+        atomic_fetch_add(&walks->complete, 1);
+    }
+    nlink_traversal_result_free(walk);
+    nlink_traversal_result_free(bfs);
+}
+
+NLINK_TEST_CASE(parallel_traversal, nested_in_parallel_loop) {
+    NLINK_ARRANGE_PHASE("Create a ring with chords and ask for more threads than the pool has");
+    size_t count = 20000;
+    test_node* nodes = create_nodes(count);
+    for (size_t i = 0; i < count; i++) {
+        link_nodes(&nodes[i], &nodes[(i + 1) % count]);
+        link_nodes(&nodes[i], &nodes[(i * 7919) % count]);
+    }
+    nlink_parallel_traversal_config* config = nlink_parallel_traversal_config_create(
+        visit, get_adjacent, get_adjacent_count, NULL);
+    nlink_parallel_traversal_config_set_ids(config, get_id, count);
+    nlink_parallel_traversal_config_set_threads(config, TEST_THREADS * 4);
+    nested_walks walks = { nodes, config, count, 0 };
+
+    NLINK_ACT_PHASE("Traverse from every chunk of a parallel loop");
+    nlink_parallel_for(TEST_THREADS, 1, run_nested_walks, &walks);
+
+    NLINK_ASSERT_PHASE("Verify the nested traversals finish on their calling threads");
+    NLINK_ASSERT_EQUAL_INT(TEST_THREADS, (int)atomic_load(&walks.complete), "every nested pair of traversals completes");
+    NLINK_ASSERT_EQUAL_INT(2 * TEST_THREADS, atomic_load(&nodes[count - 1].visits), "each traversal visits a node once");
+
+    nlink_parallel_traversal_config_free(config);
+    free(nodes);
+}
+
+NLINK_TEST_REGISTER(parallel_traversal, tree_walk)
+NLINK_TEST_REGISTER(parallel_traversal, graph_visits_once)
+NLINK_TEST_REGISTER(parallel_traversal, bfs_level_order)
+NLINK_TEST_REGISTER(parallel_traversal, out_of_range_id)
+NLINK_TEST_REGISTER(parallel_traversal, nested_in_parallel_loop)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_parallel_traversal_tree_walk();
+    nlink_run_test_parallel_traversal_graph_visits_once();
+    nlink_run_test_parallel_traversal_bfs_level_order();
+    nlink_run_test_parallel_traversal_out_of_range_id();
+    nlink_run_test_parallel_traversal_nested_in_parallel_loop()
+)
@@ -0,0 +1,153 @@
+/**
+ * @file test_traversal.c
+ * @brief Unit tests for tree and graph traversal tactics
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/tatit/traversal.h"
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct test_node {
+    int value;
+    size_t degree;
+    struct test_node* adjacent[4];
+} test_node;
+
+NLINK_TEST_SUITE_BEGIN(traversal) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(traversal) {
+    (void)context;
+}
+
+static void* get_adjacent(void* node, size_t index, void* context) {
+    (void)context;
+    return ((test_node*)node)->adjacent[index];
+}
+
+static size_t get_adjacent_count(void* node, void* context) {
+    (void)context;
+    return ((test_node*)node)->degree;
+}
+
+static void* visit(void* node, void* context) {
+    (void)context;
+    return node;
+}
+
+static void link_nodes(test_node* from, test_node* to) {
+    from->adjacent[from->degree++] = to;
+}
+
+/* Concatenate visited values as digits */
+static int visit_order(const nlink_traversal_result* result) {
+    int order = 0;
+    for (size_t i = 0; i < result->count; i++) {
+        order = order * 10 + ((test_node*)result->nodes[i])->value;
+    }
+    return order;
+}
+
+NLINK_TEST_CASE(traversal, tree_orders) {
+    NLINK_ARRANGE_PHASE("Create a tree 1 -> (2 -> (4, 5), 3)");
+    test_node nodes[6] = {{0}};
+    for (int i = 1; i <= 5; i++) {
+        nodes[i].value = i;
+    }
+    link_nodes(&nodes[1], &nodes[2]);
+    link_nodes(&nodes[1], &nodes[3]);
+    link_nodes(&nodes[2], &nodes[4]);
+    link_nodes(&nodes[2], &nodes[5]);
+    nlink_traversal_config* config = nlink_traversal_config_create(
+        NLINK_TRAVERSAL_PRE_ORDER, visit, get_adjacent, get_adjacent_count, NULL);
+
+    NLINK_ACT_PHASE("Walk the tree in each order");
+    nlink_traversal_result* pre = nlink_traverse_tree(&nodes[1], config);
+    config->order = NLINK_TRAVERSAL_POST_ORDER;
+    nlink_traversal_result* post = nlink_traverse_tree(&nodes[1], config);
+    config->order = NLINK_TRAVERSAL_LEVEL_ORDER;
+    nlink_traversal_result* level = nlink_traverse_tree(&nodes[1], config);
+    config->order = NLINK_TRAVERSAL_IN_ORDER;
+    nlink_traversal_result* in = nlink_traverse_tree(&nodes[1], config);
+
+    NLINK_ASSERT_PHASE("Verify the visiting sequences");
+    NLINK_ASSERT_EQUAL_INT(12453, visit_order(pre), "pre-order");
+    NLINK_ASSERT_EQUAL_INT(45231, visit_order(post), "post-order");
+    NLINK_ASSERT_EQUAL_INT(12345, visit_order(level), "level-order");
+    NLINK_ASSERT_EQUAL_INT(42513, visit_order(in), "in-order");
+
+    nlink_traversal_result_free(pre);
+    nlink_traversal_result_free(post);
+    nlink_traversal_result_free(level);
+    nlink_traversal_result_free(in);
+    nlink_traversal_config_free(config);
+}
+
+NLINK_TEST_CASE(traversal, graph_with_cycles) {
+    NLINK_ARRANGE_PHASE("Create a graph with a cycle and a shared successor");
+    test_node nodes[5] = {{0}};
+    for (int i = 1; i <= 4; i++) {
+        nodes[i].value = i;
+    }
+    link_nodes(&nodes[1], &nodes[2]);
+    link_nodes(&nodes[1], &nodes[3]);
+    link_nodes(&nodes[2], &nodes[4]);
+    link_nodes(&nodes[3], &nodes[4]);
+    link_nodes(&nodes[4], &nodes[1]);
+
+    NLINK_ACT_PHASE("Search the graph breadth- and depth-first");
+    nlink_traversal_result* bfs = nlink_traverse_graph_bfs(&nodes[1], get_adjacent, get_adjacent_count, visit, NULL);
+    nlink_traversal_result* dfs = nlink_traverse_graph_dfs(&nodes[1], get_adjacent, get_adjacent_count, visit, NULL);
+
+    NLINK_ASSERT_PHASE("Verify each node is visited once");
+    NLINK_ASSERT_EQUAL_INT(1234, visit_order(bfs), "breadth-first order");
+    NLINK_ASSERT_EQUAL_INT(4, (int)dfs->count, "depth-first visits every node once");
+    NLINK_ASSERT_EQUAL_INT(1, visit_order(dfs) / 1000, "depth-first starts at the start node");
+    NLINK_ASSERT_TRUE(nlink_traversal_visited(dfs, &nodes[4]), "shared successor visited");
+    NLINK_ASSERT_FALSE(nlink_traversal_visited(dfs, &nodes[0]), "unreachable node not visited");
+
+    nlink_traversal_result_free(bfs);
+    nlink_traversal_result_free(dfs);
+}
+
+NLINK_TEST_CASE(traversal, large_graph) {
+    NLINK_ARRANGE_PHASE("Create a long ring with chords, larger than the cached arena");
+    size_t count = 200000;
+    test_node* nodes = calloc(count, sizeof(test_node));
+    for (size_t i = 0; i < count; i++) {
+        link_nodes(&nodes[i], &nodes[(i + 1) % count]);
+        link_nodes(&nodes[i], &nodes[(i * 7919) % count]);
+    }
+
+    NLINK_ACT_PHASE("Search the graph twice in each direction");
+    size_t visited[4];
+    for (int round = 0; round < 2; round++) {
+        nlink_traversal_result* bfs = nlink_traverse_graph_bfs(&nodes[0], get_adjacent, get_adjacent_count, visit, NULL);
+        nlink_traversal_result* dfs = nlink_traverse_graph_dfs(&nodes[0], get_adjacent, get_adjacent_count, visit, NULL);
+        visited[round * 2] = bfs->count;
+        visited[round * 2 + 1] = dfs->count;
+        nlink_traversal_result_free(bfs);
+        nlink_traversal_result_free(dfs);
+    }
+
+    NLINK_ASSERT_PHASE("Verify every node is visited exactly once each time");
+    for (int i = 0; i < 4; i++) {
+        NLINK_ASSERT_EQUAL_INT((int)count, (int)visited[i], "all nodes visited once");
+    }
+
+    free(nodes);
+}
+
+NLINK_TEST_REGISTER(traversal, tree_orders)
+NLINK_TEST_REGISTER(traversal, graph_with_cycles)
+NLINK_TEST_REGISTER(traversal, large_graph)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_traversal_tree_orders();
+    nlink_run_test_traversal_graph_with_cycles();
+    nlink_run_test_traversal_large_graph()
+)
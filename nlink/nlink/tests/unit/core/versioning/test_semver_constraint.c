@@ -0,0 +1,121 @@
+/**
+ * @file test_semver_constraint.c
+ * @brief Unit tests for compiled semantic version constraints
+ *
+ * Copyright © 2025 OBINexus Computing
+ */
+
+#include "nlink_test.h"
+#include "nlink/core/versioning/semver.h"
+
+NLINK_TEST_SUITE_BEGIN(semver_constraint) {
+    return NULL;
+}
+
+NLINK_TEST_SUITE_END(semver_constraint) {
+    (void)context;
+}
+
+/* Evaluate a version string against a compiled constraint */
+static bool check(const SemVerConstraint* constraint, const char* version) {
+    SemVer* ver = semver_parse(version);
+    bool result = ver && semver_constraint_matches(constraint, ver);
+    semver_free(ver);
+    return result;
+}
+
+NLINK_TEST_CASE(semver_constraint, simple_operators) {
+    NLINK_ARRANGE_PHASE("Compile single-operator constraints");
+    SemVerConstraint* caret = semver_constraint_compile("^1.2.3");
+    SemVerConstraint* tilde = semver_constraint_compile("~1.2.3");
+    SemVerConstraint* exact = semver_constraint_compile("1.2.3");
+
+    NLINK_ACT_PHASE("Evaluate candidate versions");
+    bool caret_ok = check(caret, "1.9.0") && !check(caret, "2.0.0") && !check(caret, "1.2.2");
+    bool tilde_ok = check(tilde, "1.2.9") && !check(tilde, "1.3.0");
+    bool exact_ok = check(exact, "1.2.3") && !check(exact, "1.2.4");
+
+    NLINK_ASSERT_PHASE("Verify operator semantics");
+    NLINK_ASSERT_TRUE(caret_ok, "caret keeps the major version");
+    NLINK_ASSERT_TRUE(tilde_ok, "tilde keeps the major.minor version");
+    NLINK_ASSERT_TRUE(exact_ok, "bare version is an exact match");
+
+    semver_constraint_free(caret);
+    semver_constraint_free(tilde);
+    semver_constraint_free(exact);
+}
+
+NLINK_TEST_CASE(semver_constraint, compound_ranges) {
+    NLINK_ARRANGE_PHASE("Compile a range with alternatives and partial versions");
+    SemVerConstraint* range = semver_constraint_compile(">=1.2 <2.0 || ^3.0.0");
+    SemVerConstraint* partial = semver_constraint_compile("1.2");
+
+    NLINK_ACT_PHASE("Evaluate candidate versions");
+    bool range_ok = check(range, "1.2.0") && check(range, "1.9.9") &&
+                    !check(range, "2.0.0") && check(range, "3.4.0") &&
+                    !check(range, "1.1.9");
+    bool partial_ok = check(partial, "1.2.7") && !check(partial, "1.3.0");
+
+    NLINK_ASSERT_PHASE("Verify set and alternative semantics");
+    NLINK_ASSERT_NOT_NULL(range, "compound range compiles");
+    NLINK_ASSERT_TRUE(range_ok, "comparators in a set are conjunctive, sets are alternatives");
+    NLINK_ASSERT_TRUE(partial_ok, "partial version matches its whole minor line");
+
+    semver_constraint_free(range);
+    semver_constraint_free(partial);
+}
+
+NLINK_TEST_CASE(semver_constraint, batch_filter) {
+    NLINK_ARRANGE_PHASE("Parse candidates and compile one constraint");
+    const char* versions[] = { "0.9.0", "1.0.0", "1.4.2", "2.0.0", "2.1.0" };
+    SemVer* candidates[5];
+    for (size_t i = 0; i < 5; i++) {
+        candidates[i] = semver_parse(versions[i]);
+    }
+    SemVerConstraint* constraint = semver_constraint_compile(">=1.0.0 <2.0.0 || 2.1.0");
+    size_t matches[5];
+
+    NLINK_ACT_PHASE("Filter the candidates");
+    size_t count = semver_constraint_filter(constraint, (const SemVer* const*)candidates, 5, matches);
+
+    NLINK_ASSERT_PHASE("Verify matching indices");
+    NLINK_ASSERT_EQUAL_INT(3, (int)count, "three candidates match");
+    NLINK_ASSERT_TRUE(matches[0] == 1 && matches[1] == 2 && matches[2] == 4, "indices in order");
+
+    semver_constraint_free(constraint);
+    for (size_t i = 0; i < 5; i++) {
+        semver_free(candidates[i]);
+    }
+}
+
+NLINK_TEST_CASE(semver_constraint, malformed) {
+    NLINK_ARRANGE_PHASE("Nothing to arrange");
+
+    NLINK_ACT_PHASE("Compile malformed constraints");
+    SemVerConstraint* garbage = semver_constraint_compile("garbage");
+    SemVerConstraint* pipe = semver_constraint_compile("1.0.0 | 2.0.0");
+    SemVerConstraint* empty = semver_constraint_compile("");
+    SemVerConstraint* blank = semver_constraint_compile("   ");
+    SemVerConstraint* empty_set = semver_constraint_compile("1.0.0 || || 2.0.0");
+
+    NLINK_ASSERT_PHASE("Verify compilation fails");
+    NLINK_ASSERT_NULL(garbage, "non-version text is rejected");
+    NLINK_ASSERT_NULL(pipe, "single pipe is rejected");
+    NLINK_ASSERT_NULL(empty, "empty constraint is rejected");
+    NLINK_ASSERT_NULL(blank, "blank constraint is rejected");
+    NLINK_ASSERT_NULL(empty_set, "empty alternative is rejected");
+    NLINK_ASSERT_FALSE(semver_satisfies("1.0.0", ""), "semver_satisfies rejects an empty constraint");
+    NLINK_ASSERT_FALSE(semver_satisfies("1.0.0", "garbage"), "semver_satisfies rejects it too");
+}
+
+NLINK_TEST_REGISTER(semver_constraint, simple_operators)
+NLINK_TEST_REGISTER(semver_constraint, compound_ranges)
+NLINK_TEST_REGISTER(semver_constraint, batch_filter)
+NLINK_TEST_REGISTER(semver_constraint, malformed)
+
+NLINK_TEST_MAIN(
+    nlink_run_test_semver_constraint_simple_operators();
+    nlink_run_test_semver_constraint_compound_ranges();
+    nlink_run_test_semver_constraint_batch_filter();
+    nlink_run_test_semver_constraint_malformed()
+)